@@ -0,0 +1,288 @@
+#pragma once
+
+#include "Platform/Trace.h"
+
+#include "Foundation/DynamicArray.h"
+#include "Foundation/Pair.h"
+#include "Foundation/Functions.h"
+
+#include <type_traits>
+
+namespace Helium
+{
+    /// B+tree implementation with cache-line sized nodes.
+    ///
+    /// Values are stored only in leaf nodes, which are sized to span a few cache lines and hold as many values as fit
+    /// in that space.  Branch nodes hold copies of separator keys and child node pointers, so each level of a search
+    /// touches a single contiguous node instead of one scattered node per comparison as with a binary tree.  Leaf nodes
+    /// are linked in key order, so iterating over a range of values walks contiguous arrays of values.
+    ///
+    /// BTree provides the same lookup, insertion, removal, and iteration interface as RedBlackTree, and either can be
+    /// used as the tree engine for SortedMap and SortedSet.  Additionally, BTree can be bulk-loaded from sorted values
+    /// in linear time.  As with RedBlackTree, any insertion or removal invalidates all iterators into the tree, as
+    /// values are shifted within leaf nodes and nodes may be split, merged, or rebalanced.
+    template<
+        typename Value, typename Key, typename ExtractKey, typename CompareKey = Less< Key >,
+        typename Allocator = DefaultAllocator, typename InternalValue = Value >
+    class BTree
+    {
+    private:
+        struct LeafNode;
+        struct BranchNode;
+
+    public:
+        /// Type for tree keys.
+        typedef Key KeyType;
+        /// Type for tree entries.
+        typedef Value ValueType;
+
+        /// Internal value type (type used for actual value storage).
+        typedef InternalValue InternalValueType;
+
+        /// Type for comparing two keys.
+        typedef CompareKey KeyCompareType;
+        /// Allocator type.
+        typedef Allocator AllocatorType;
+
+        /// Size of a cache line, in bytes (nodes are allocated on cache line boundaries).
+        static const size_t CACHE_LINE_SIZE = 64;
+        /// Target size of each node, in bytes.
+        static const size_t NODE_SIZE = CACHE_LINE_SIZE * 4;
+
+        /// Maximum number of values in each leaf node.
+        static const size_t LEAF_CAPACITY =
+            ( ( NODE_SIZE - 3 * sizeof( void* ) ) / sizeof( InternalValue ) > 4
+              ? ( NODE_SIZE - 3 * sizeof( void* ) ) / sizeof( InternalValue )
+              : 4 );
+        /// Maximum number of child nodes referenced by each branch node.
+        static const size_t BRANCH_CAPACITY =
+            ( ( NODE_SIZE + sizeof( Key ) - sizeof( size_t ) ) / ( sizeof( void* ) + sizeof( Key ) ) > 4
+              ? ( NODE_SIZE + sizeof( Key ) - sizeof( size_t ) ) / ( sizeof( void* ) + sizeof( Key ) )
+              : 4 );
+
+        /// Constant B+tree iterator.
+        class ConstIterator
+        {
+            friend class BTree;
+
+        public:
+            // STL iterator support.
+            typedef std::bidirectional_iterator_tag iterator_category;
+            typedef Value value_type;
+            typedef ptrdiff_t difference_type;
+
+            typedef const Value* pointer;
+            typedef const Value& reference;
+
+            /// @name Construction/Destruction
+            //@{
+            ConstIterator();
+            //@}
+
+            /// @name Overloaded Operators
+            //@{
+            const Value& operator*() const;
+            const Value* operator->() const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++( int );
+            ConstIterator& operator--();
+            ConstIterator operator--( int );
+
+            bool operator==( const ConstIterator& rOther ) const;
+            bool operator!=( const ConstIterator& rOther ) const;
+            //@}
+
+        protected:
+            /// Tree instance.
+            BTree* m_pTree;
+            /// Current leaf node (null if at the end of the tree).
+            LeafNode* m_pLeaf;
+            /// Value index within the current leaf node.
+            size_t m_index;
+
+            /// @name Construction/Destruction, Protected
+            //@{
+            ConstIterator( const BTree* pTree, LeafNode* pLeaf, size_t index );
+            //@}
+        };
+
+        /// B+tree iterator.
+        class Iterator : public ConstIterator
+        {
+            friend class BTree;
+
+        public:
+            // STL iterator support.
+            typedef typename ConstIterator::iterator_category iterator_category;
+            typedef typename ConstIterator::value_type value_type;
+            typedef typename ConstIterator::difference_type difference_type;
+
+            typedef Value* pointer;
+            typedef Value& reference;
+
+            /// @name Construction/Destruction
+            //@{
+            Iterator();
+            //@}
+
+            /// @name Overloaded Operators
+            //@{
+            Value& operator*() const;
+            Value* operator->() const;
+
+            Iterator& operator++();
+            Iterator operator++( int );
+            Iterator& operator--();
+            Iterator operator--( int );
+            //@}
+
+        protected:
+            /// @name Construction/Destruction, Protected
+            //@{
+            Iterator( BTree* pTree, LeafNode* pLeaf, size_t index );
+            //@}
+        };
+
+        /// @name Construction/Destruction
+        //@{
+        BTree();
+        BTree( const BTree& rSource );
+        template< typename OtherAllocator > BTree(
+            const BTree< Value, Key, ExtractKey, CompareKey, OtherAllocator, InternalValue >& rSource );
+        ~BTree();
+        //@}
+
+        /// @name Tree Operations
+        //@{
+        size_t GetSize() const;
+        bool IsEmpty() const;
+
+        void Clear();
+
+        Iterator Begin();
+        ConstIterator Begin() const;
+        Iterator End();
+        ConstIterator End() const;
+
+        Iterator Find( const Key& rKey );
+        ConstIterator Find( const Key& rKey ) const;
+
+        Iterator LowerBound( const Key& rKey );
+        ConstIterator LowerBound( const Key& rKey ) const;
+        Iterator UpperBound( const Key& rKey );
+        ConstIterator UpperBound( const Key& rKey ) const;
+
+        Pair< Iterator, bool > Insert( const Value& rValue );
+        bool Insert( ConstIterator& rIterator, const Value& rValue );
+
+        bool Remove( const Key& rKey );
+        void Remove( Iterator iterator );
+
+        void BulkLoad( const Value* pValues, size_t count );
+
+        void Swap( BTree& rTree );
+        //@}
+
+        /// @name Debug Verification
+        //@{
+        bool Verify() const;
+        //@}
+
+        /// @name Overloaded Operators
+        //@{
+        BTree& operator=( const BTree& rSource );
+        template< typename OtherAllocator > BTree& operator=(
+            const BTree< Value, Key, ExtractKey, CompareKey, OtherAllocator, InternalValue >& rSource );
+        //@}
+
+    private:
+        /// Type used for storing separator keys in branch nodes.
+        typedef typename std::remove_const< Key >::type KeyStorage;
+
+        /// Minimum number of values in each leaf node other than the root.
+        static const size_t LEAF_MIN_COUNT = LEAF_CAPACITY / 2;
+        /// Minimum number of child nodes referenced by each branch node other than the root.
+        static const size_t BRANCH_MIN_COUNT = BRANCH_CAPACITY / 2;
+
+        /// Leaf node.
+        struct LeafNode
+        {
+            /// Previous leaf node in key order.
+            LeafNode* pPrevious;
+            /// Next leaf node in key order.
+            LeafNode* pNext;
+            /// Number of values in this node.
+            size_t count;
+            /// Value storage.
+            typename std::aligned_storage<
+                sizeof( InternalValue ) * LEAF_CAPACITY, std::alignment_of< InternalValue >::value >::type values;
+
+            /// @name Data Access
+            //@{
+            InternalValue* GetValues();
+            const InternalValue* GetValues() const;
+            //@}
+        };
+
+        /// Branch node.
+        struct BranchNode
+        {
+            /// Number of child nodes (one more than the number of separator keys).
+            size_t count;
+            /// Child nodes (leaf nodes if this node is on the lowest branch level, branch nodes otherwise).
+            void* pChildren[ BRANCH_CAPACITY ];
+            /// Separator key storage (each key is the lowest key in the subtree of the child node that follows it).
+            typename std::aligned_storage<
+                sizeof( KeyStorage ) * ( BRANCH_CAPACITY - 1 ), std::alignment_of< KeyStorage >::value >::type keys;
+
+            /// @name Data Access
+            //@{
+            KeyStorage* GetKeys();
+            const KeyStorage* GetKeys() const;
+            //@}
+        };
+
+        /// Root node (a leaf node if the depth is zero, a branch node otherwise, or null if the tree is empty).
+        void* m_pRoot;
+        /// First leaf node in key order.
+        LeafNode* m_pFirstLeaf;
+        /// Last leaf node in key order.
+        LeafNode* m_pLastLeaf;
+        /// Number of values in this tree.
+        size_t m_size;
+        /// Number of branch node levels above the leaf nodes.
+        size_t m_depth;
+
+        /// @name Private Utility Functions
+        //@{
+        template< typename SourceIterator > void Build( SourceIterator source, size_t count );
+
+        LeafNode* FindLeaf( const Key& rKey ) const;
+        ConstIterator FindLowerBound( const Key& rKey ) const;
+        ConstIterator FindUpperBound( const Key& rKey ) const;
+
+        void SplitChild( BranchNode* pParent, size_t childIndex, bool bLeafChild );
+        size_t FillChild( BranchNode* pParent, size_t childIndex, bool bLeafChild );
+        void MergeChildren( BranchNode* pParent, size_t leftChildIndex, bool bLeafChildren );
+
+        bool RecursiveVerify(
+            const void* pNode, size_t depth, const Key* pLowerKey, const Key* pUpperKey,
+            const LeafNode*& rpPreviousLeaf, size_t& rValueCount ) const;
+
+        static size_t FindChildIndex( const BranchNode* pNode, const Key& rKey );
+        static size_t FindValueIndex( const LeafNode* pNode, const Key& rKey );
+        static const Key& GetLowestKey( const void* pNode, size_t depth );
+
+        template< typename T, typename U > static void InsertElement(
+            T* pElements, size_t count, size_t index, const U& rValue );
+        template< typename T > static void RemoveElement( T* pElements, size_t count, size_t index );
+
+        static LeafNode* AllocateLeaf();
+        static BranchNode* AllocateBranch();
+        static void FreeNode( void* pNode, size_t depth );
+        //@}
+    };
+}
+
+#include "Foundation/BTree.inl"
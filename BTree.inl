@@ -0,0 +1,1628 @@
+/// Constructor.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::BTree()
+    : m_pRoot( NULL )
+    , m_pFirstLeaf( NULL )
+    , m_pLastLeaf( NULL )
+    , m_size( 0 )
+    , m_depth( 0 )
+{
+}
+
+/// Copy constructor.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::BTree( const BTree& rSource )
+    : m_pRoot( NULL )
+    , m_pFirstLeaf( NULL )
+    , m_pLastLeaf( NULL )
+    , m_size( 0 )
+    , m_depth( 0 )
+{
+    Build( rSource.Begin(), rSource.GetSize() );
+}
+
+/// Copy constructor.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+template< typename OtherAllocator >
+Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::BTree(
+    const BTree< Value, Key, ExtractKey, CompareKey, OtherAllocator, InternalValue >& rSource )
+    : m_pRoot( NULL )
+    , m_pFirstLeaf( NULL )
+    , m_pLastLeaf( NULL )
+    , m_size( 0 )
+    , m_depth( 0 )
+{
+    Build( rSource.Begin(), rSource.GetSize() );
+}
+
+/// Destructor.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::~BTree()
+{
+    Clear();
+}
+
+/// Get the number of elements in this tree.
+///
+/// @return  Number of elements currently in this tree.
+///
+/// @see IsEmpty()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+size_t Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::GetSize() const
+{
+    return m_size;
+}
+
+/// Get whether this tree is empty.
+///
+/// @return  True if this tree is empty, false if not.
+///
+/// @see GetSize()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+bool Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::IsEmpty() const
+{
+    return ( m_size == 0 );
+}
+
+/// Clear out all elements from this tree and free all dynamically allocated memory.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+void Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Clear()
+{
+    if( m_pRoot )
+    {
+        FreeNode( m_pRoot, m_depth );
+    }
+
+    m_pRoot = NULL;
+    m_pFirstLeaf = NULL;
+    m_pLastLeaf = NULL;
+    m_size = 0;
+    m_depth = 0;
+}
+
+/// Retrieve an iterator referencing the beginning of this tree.
+///
+/// @return  Iterator at the beginning of this tree.
+///
+/// @see End()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Begin()
+{
+    return Iterator( this, m_pFirstLeaf, 0 );
+}
+
+/// Retrieve a constant iterator referencing the beginning of this tree.
+///
+/// @return  Constant iterator at the beginning of this tree.
+///
+/// @see End()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Begin() const
+{
+    return ConstIterator( this, m_pFirstLeaf, 0 );
+}
+
+/// Retrieve an iterator referencing the end of this tree.
+///
+/// @return  Iterator at the end of this tree.
+///
+/// @see Begin()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::End()
+{
+    return Iterator( this, NULL, 0 );
+}
+
+/// Retrieve a constant iterator referencing the end of this tree.
+///
+/// @return  Constant iterator at the end of this tree.
+///
+/// @see Begin()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::End() const
+{
+    return ConstIterator( this, NULL, 0 );
+}
+
+/// Find an element in this tree with the specified key.
+///
+/// @param[in] rKey  Key for which to search.
+///
+/// @return  Iterator referencing the element with the specified key if found, otherwise an iterator referencing the end
+///          of this tree if not found.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Find( const Key& rKey )
+{
+    ConstIterator iterator = static_cast< const BTree* >( this )->Find( rKey );
+
+    return Iterator( this, iterator.m_pLeaf, iterator.m_index );
+}
+
+/// Find an element in this tree with the specified key.
+///
+/// @param[in] rKey  Key for which to search.
+///
+/// @return  Constant iterator referencing the element with the specified key if found, otherwise a constant iterator
+///          referencing the end of this tree if not found.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Find( const Key& rKey ) const
+{
+    if( !m_pRoot )
+    {
+        return End();
+    }
+
+    LeafNode* pLeaf = FindLeaf( rKey );
+    size_t index = FindValueIndex( pLeaf, rKey );
+    if( index >= pLeaf->count || CompareKey()( rKey, ExtractKey()( pLeaf->GetValues()[ index ] ) ) )
+    {
+        return End();
+    }
+
+    return ConstIterator( this, pLeaf, index );
+}
+
+/// Find the first element in this tree with a key that does not precede the specified key.
+///
+/// @param[in] rKey  Key for which to search.
+///
+/// @return  Iterator referencing the first element with a key that is not less than the specified key, or an iterator
+///          referencing the end of this tree if all keys are less than the specified key.
+///
+/// @see UpperBound()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::LowerBound( const Key& rKey )
+{
+    ConstIterator iterator = FindLowerBound( rKey );
+
+    return Iterator( this, iterator.m_pLeaf, iterator.m_index );
+}
+
+/// Find the first element in this tree with a key that does not precede the specified key.
+///
+/// @param[in] rKey  Key for which to search.
+///
+/// @return  Constant iterator referencing the first element with a key that is not less than the specified key, or a
+///          constant iterator referencing the end of this tree if all keys are less than the specified key.
+///
+/// @see UpperBound()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::LowerBound( const Key& rKey ) const
+{
+    return FindLowerBound( rKey );
+}
+
+/// Find the first element in this tree with a key that succeeds the specified key.
+///
+/// @param[in] rKey  Key for which to search.
+///
+/// @return  Iterator referencing the first element with a key that is greater than the specified key, or an iterator
+///          referencing the end of this tree if no keys are greater than the specified key.
+///
+/// @see LowerBound()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::UpperBound( const Key& rKey )
+{
+    ConstIterator iterator = FindUpperBound( rKey );
+
+    return Iterator( this, iterator.m_pLeaf, iterator.m_index );
+}
+
+/// Find the first element in this tree with a key that succeeds the specified key.
+///
+/// @param[in] rKey  Key for which to search.
+///
+/// @return  Constant iterator referencing the first element with a key that is greater than the specified key, or a
+///          constant iterator referencing the end of this tree if no keys are greater than the specified key.
+///
+/// @see LowerBound()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::UpperBound( const Key& rKey ) const
+{
+    return FindUpperBound( rKey );
+}
+
+/// Attempt to insert an element with a unique key into this tree.
+///
+/// @param[in] rValue  Value of the element to insert.
+///
+/// @return  A pair containing an iterator and a boolean value.  If the element was inserted, the iterator will
+///          reference the inserted element, and the boolean value will be set to true.  If an element with the same key
+///          already exists in this tree, the iterator will reference the existing element, and the boolean value will be
+///          set to false.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+Helium::Pair< typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator, bool >
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Insert( const Value& rValue )
+{
+    Pair< Iterator, bool > result;
+    result.Second() = Insert( result.First(), rValue );
+
+    return result;
+}
+
+/// Attempt to insert an element with a unique key into this tree.
+///
+/// Full nodes are split on the way down from the root, so the insertion never needs to walk back up the tree.
+///
+/// @param[out] rIterator  Iterator set to the inserted element if an existing element with the same key is not already
+///                        in this tree, otherwise set to the existing element in this tree with the same key.
+/// @param[in]  rValue     Value of the element to insert.
+///
+/// @return  True if an element with the same key as the given value did not already exist in this tree and a new
+///          element was inserted, false if an element with the same key already existing in this tree.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+bool Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Insert(
+    ConstIterator& rIterator,
+    const Value& rValue )
+{
+    ExtractKey keyExtract;
+    CompareKey keyCompare;
+
+    rIterator.m_pTree = this;
+
+    const Key& rKey = keyExtract( rValue );
+
+    if( !m_pRoot )
+    {
+        LeafNode* pLeaf = AllocateLeaf();
+        new( pLeaf->GetValues() ) InternalValue( rValue );
+        pLeaf->count = 1;
+
+        m_pRoot = pLeaf;
+        m_pFirstLeaf = pLeaf;
+        m_pLastLeaf = pLeaf;
+        m_size = 1;
+
+        rIterator.m_pLeaf = pLeaf;
+        rIterator.m_index = 0;
+
+        return true;
+    }
+
+    // Search for an existing element with the same key first so that we don't split any nodes unnecessarily.
+    LeafNode* pLeaf = FindLeaf( rKey );
+    size_t index = FindValueIndex( pLeaf, rKey );
+    if( index < pLeaf->count && !keyCompare( rKey, keyExtract( pLeaf->GetValues()[ index ] ) ) )
+    {
+        rIterator.m_pLeaf = pLeaf;
+        rIterator.m_index = index;
+
+        return false;
+    }
+
+    // Split the root node if it is full, growing the tree by one level.
+    bool bLeafRoot = ( m_depth == 0 );
+    size_t rootCount = ( bLeafRoot
+                         ? static_cast< LeafNode* >( m_pRoot )->count
+                         : static_cast< BranchNode* >( m_pRoot )->count );
+    if( rootCount == ( bLeafRoot ? LEAF_CAPACITY : BRANCH_CAPACITY ) )
+    {
+        BranchNode* pRoot = AllocateBranch();
+        pRoot->pChildren[ 0 ] = m_pRoot;
+        pRoot->count = 1;
+
+        m_pRoot = pRoot;
+        ++m_depth;
+
+        SplitChild( pRoot, 0, bLeafRoot );
+    }
+
+    // Descend to the leaf node in which the value belongs, splitting any full nodes along the way.
+    void* pNode = m_pRoot;
+    for( size_t depth = m_depth; depth != 0; --depth )
+    {
+        BranchNode* pBranch = static_cast< BranchNode* >( pNode );
+        size_t childIndex = FindChildIndex( pBranch, rKey );
+
+        bool bLeafChild = ( depth == 1 );
+        void* pChild = pBranch->pChildren[ childIndex ];
+        size_t childCount = ( bLeafChild
+                              ? static_cast< LeafNode* >( pChild )->count
+                              : static_cast< BranchNode* >( pChild )->count );
+        if( childCount == ( bLeafChild ? LEAF_CAPACITY : BRANCH_CAPACITY ) )
+        {
+            SplitChild( pBranch, childIndex, bLeafChild );
+            if( !keyCompare( rKey, pBranch->GetKeys()[ childIndex ] ) )
+            {
+                ++childIndex;
+            }
+        }
+
+        pNode = pBranch->pChildren[ childIndex ];
+    }
+
+    pLeaf = static_cast< LeafNode* >( pNode );
+    HELIUM_ASSERT( pLeaf->count < LEAF_CAPACITY );
+
+    index = FindValueIndex( pLeaf, rKey );
+    InsertElement( pLeaf->GetValues(), pLeaf->count, index, rValue );
+    ++pLeaf->count;
+    ++m_size;
+
+    rIterator.m_pLeaf = pLeaf;
+    rIterator.m_index = index;
+
+    return true;
+}
+
+/// Remove any entry with the specified key from this tree.
+///
+/// Nodes with the minimum number of entries are refilled on the way down from the root, so the removal never needs to
+/// walk back up the tree.
+///
+/// @param[in] rKey  Key to locate.
+///
+/// @return  True if an entry was found and removed, false if not.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+bool Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Remove( const Key& rKey )
+{
+    // Make sure the key exists first so that we don't rebalance any nodes unnecessarily.
+    if( Find( rKey ) == End() )
+    {
+        return false;
+    }
+
+    void* pNode = m_pRoot;
+    for( size_t depth = m_depth; depth != 0; --depth )
+    {
+        BranchNode* pBranch = static_cast< BranchNode* >( pNode );
+        size_t childIndex = FillChild( pBranch, FindChildIndex( pBranch, rKey ), depth == 1 );
+        pNode = pBranch->pChildren[ childIndex ];
+    }
+
+    LeafNode* pLeaf = static_cast< LeafNode* >( pNode );
+    size_t index = FindValueIndex( pLeaf, rKey );
+    HELIUM_ASSERT( index < pLeaf->count );
+    RemoveElement( pLeaf->GetValues(), pLeaf->count, index );
+    --pLeaf->count;
+    --m_size;
+
+    // Shrink the tree if the root node is left with a single child node, or free the root if the tree is now empty.
+    if( m_depth != 0 )
+    {
+        BranchNode* pRoot = static_cast< BranchNode* >( m_pRoot );
+        if( pRoot->count == 1 )
+        {
+            m_pRoot = pRoot->pChildren[ 0 ];
+            --m_depth;
+
+            Allocator().FreeAligned( pRoot );
+        }
+    }
+    else if( pLeaf->count == 0 )
+    {
+        Clear();
+    }
+
+    return true;
+}
+
+/// Remove the entry referenced by the specified iterator.
+///
+/// @param[in] iterator  Iterator for the entry to remove.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+void Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Remove( Iterator iterator )
+{
+    HELIUM_ASSERT( iterator.m_pTree == this );
+    HELIUM_ASSERT( iterator.m_pLeaf );
+
+    // Removal can move entries around, so we need a copy of the key that does not reference the entry itself.
+    KeyStorage key( ExtractKey()( *iterator ) );
+    HELIUM_VERIFY( Remove( key ) );
+}
+
+/// Replace the contents of this tree with a sorted array of values.
+///
+/// The tree is built bottom-up with completely filled nodes, which is considerably faster than inserting each value
+/// individually and produces the most compact tree possible.  Values must be sorted by key with no duplicate keys.
+///
+/// @param[in] pValues  Values to load, sorted by key.
+/// @param[in] count    Number of values to load.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+void Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::BulkLoad(
+    const Value* pValues,
+    size_t count )
+{
+    HELIUM_ASSERT( pValues || count == 0 );
+
+    Build( pValues, count );
+}
+
+/// Swap the contents of this tree with another tree.
+///
+/// @param[in] rTree  Tree with which to swap.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+void Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Swap( BTree& rTree )
+{
+    Helium::Swap( m_pRoot, rTree.m_pRoot );
+    Helium::Swap( m_pFirstLeaf, rTree.m_pFirstLeaf );
+    Helium::Swap( m_pLastLeaf, rTree.m_pLastLeaf );
+    Helium::Swap( m_size, rTree.m_size );
+    Helium::Swap( m_depth, rTree.m_depth );
+}
+
+/// Check this tree for validity.
+///
+/// The following tests are performed:
+/// - All nodes other than the root contain at least the minimum number of entries, and no node exceeds its capacity.
+/// - Values within each leaf node and separator keys within each branch node are sorted.
+/// - All keys in each subtree fall within the range bounded by the separator keys in its parent node.
+/// - All leaf nodes are at the same depth, and the leaf node links match the order of leaf nodes in the tree.
+/// - The number of values in all leaf nodes matches the tree size.
+///
+/// Tree verification is provided for debugging purposes.  Verifying a tree is slow and should not be performed during
+/// game runtime in a release build.
+///
+/// @return  True if this tree is valid, false if not.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+bool Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Verify() const
+{
+    if( !m_pRoot )
+    {
+        return ( m_size == 0 && m_depth == 0 && !m_pFirstLeaf && !m_pLastLeaf );
+    }
+
+    const LeafNode* pPreviousLeaf = NULL;
+    size_t valueCount = 0;
+    if( !RecursiveVerify( m_pRoot, m_depth, NULL, NULL, pPreviousLeaf, valueCount ) )
+    {
+        return false;
+    }
+
+    if( pPreviousLeaf != m_pLastLeaf || m_pLastLeaf->pNext )
+    {
+        HELIUM_TRACE( TraceLevels::Debug, TXT( "BTree last leaf node link mismatch.\n" ) );
+
+        return false;
+    }
+
+    if( valueCount != m_size )
+    {
+        HELIUM_TRACE(
+            TraceLevels::Debug,
+            TXT( "BTree size mismatch (%" ) PRIuSZ TXT( " values found, %" ) PRIuSZ TXT( " expected).\n" ),
+            valueCount,
+            m_size );
+
+        return false;
+    }
+
+    return true;
+}
+
+/// Assignment operator.
+///
+/// @param[in] rSource  Source object from which to copy.
+///
+/// @return  Reference to this object.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >&
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::operator=( const BTree& rSource )
+{
+    if( this != &rSource )
+    {
+        Build( rSource.Begin(), rSource.GetSize() );
+    }
+
+    return *this;
+}
+
+/// Assignment operator.
+///
+/// @param[in] rSource  Source object from which to copy.
+///
+/// @return  Reference to this object.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+template< typename OtherAllocator >
+Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >&
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::operator=(
+        const BTree< Value, Key, ExtractKey, CompareKey, OtherAllocator, InternalValue >& rSource )
+{
+    Build( rSource.Begin(), rSource.GetSize() );
+
+    return *this;
+}
+
+/// Replace the contents of this tree with a sequence of values sorted by key.
+///
+/// Values are distributed evenly across the fewest leaf nodes that can hold them, and branch levels are then built
+/// bottom-up in the same manner, so every node other than the root is at least half full.
+///
+/// @param[in] source  Iterator referencing the first value to load.
+/// @param[in] count   Number of values to load.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+template< typename SourceIterator >
+void Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Build(
+    SourceIterator source,
+    size_t count )
+{
+    Clear();
+
+    if( count == 0 )
+    {
+        return;
+    }
+
+    ExtractKey keyExtract;
+    CompareKey keyCompare;
+
+    // Build the leaf level.
+    size_t leafCount = ( count + LEAF_CAPACITY - 1 ) / LEAF_CAPACITY;
+
+    DynamicArray< void*, Allocator > nodes;
+    nodes.Reserve( leafCount );
+
+    const InternalValue* pPreviousValue = NULL;
+    for( size_t leafIndex = 0; leafIndex < leafCount; ++leafIndex )
+    {
+        size_t valueCount = count / leafCount + ( leafIndex < count % leafCount );
+
+        LeafNode* pLeaf = AllocateLeaf();
+        InternalValue* pValues = pLeaf->GetValues();
+        for( size_t valueIndex = 0; valueIndex < valueCount; ++valueIndex, ++source )
+        {
+            new( pValues + valueIndex ) InternalValue( *source );
+            HELIUM_ASSERT(
+                !pPreviousValue || keyCompare( keyExtract( *pPreviousValue ), keyExtract( pValues[ valueIndex ] ) ) );
+            pPreviousValue = pValues + valueIndex;
+        }
+
+        pLeaf->count = valueCount;
+
+        pLeaf->pPrevious = m_pLastLeaf;
+        if( m_pLastLeaf )
+        {
+            m_pLastLeaf->pNext = pLeaf;
+        }
+        else
+        {
+            m_pFirstLeaf = pLeaf;
+        }
+
+        m_pLastLeaf = pLeaf;
+
+        nodes.Push( pLeaf );
+    }
+
+    m_size = count;
+
+    // Build each branch level from the nodes in the level below it until we are left with a single root node.  Branch
+    // nodes are written back into the node array in place, as each one consumes at least two entries.
+    size_t depth = 0;
+    while( nodes.GetSize() > 1 )
+    {
+        size_t childCount = nodes.GetSize();
+        size_t branchCount = ( childCount + BRANCH_CAPACITY - 1 ) / BRANCH_CAPACITY;
+
+        size_t childIndex = 0;
+        for( size_t branchIndex = 0; branchIndex < branchCount; ++branchIndex )
+        {
+            size_t branchChildCount = childCount / branchCount + ( branchIndex < childCount % branchCount );
+
+            BranchNode* pBranch = AllocateBranch();
+            KeyStorage* pKeys = pBranch->GetKeys();
+            for( size_t branchChildIndex = 0; branchChildIndex < branchChildCount; ++branchChildIndex, ++childIndex )
+            {
+                void* pChild = nodes[ childIndex ];
+                pBranch->pChildren[ branchChildIndex ] = pChild;
+                if( branchChildIndex != 0 )
+                {
+                    new( pKeys + branchChildIndex - 1 ) KeyStorage( GetLowestKey( pChild, depth ) );
+                }
+            }
+
+            pBranch->count = branchChildCount;
+
+            nodes[ branchIndex ] = pBranch;
+        }
+
+        nodes.Resize( branchCount );
+        ++depth;
+    }
+
+    m_pRoot = nodes[ 0 ];
+    m_depth = depth;
+}
+
+/// Find the leaf node in which a given key belongs.
+///
+/// @param[in] rKey  Key to locate.
+///
+/// @return  Leaf node covering the given key.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::LeafNode*
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::FindLeaf( const Key& rKey ) const
+{
+    HELIUM_ASSERT( m_pRoot );
+
+    void* pNode = m_pRoot;
+    for( size_t depth = m_depth; depth != 0; --depth )
+    {
+        const BranchNode* pBranch = static_cast< const BranchNode* >( pNode );
+        pNode = pBranch->pChildren[ FindChildIndex( pBranch, rKey ) ];
+    }
+
+    return static_cast< LeafNode* >( pNode );
+}
+
+/// Find the first element in this tree with a key that does not precede a given key.
+///
+/// @param[in] rKey  Key to locate.
+///
+/// @return  Constant iterator referencing the lower bound of the given key.
+///
+/// @see FindUpperBound()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::FindLowerBound( const Key& rKey ) const
+{
+    if( !m_pRoot )
+    {
+        return End();
+    }
+
+    LeafNode* pLeaf = FindLeaf( rKey );
+    size_t index = FindValueIndex( pLeaf, rKey );
+    if( index >= pLeaf->count )
+    {
+        // All keys in the next leaf node succeed the separator key that led us here, so they also succeed this key.
+        pLeaf = pLeaf->pNext;
+        index = 0;
+    }
+
+    return ConstIterator( this, pLeaf, index );
+}
+
+/// Find the first element in this tree with a key that succeeds a given key.
+///
+/// @param[in] rKey  Key to locate.
+///
+/// @return  Constant iterator referencing the upper bound of the given key.
+///
+/// @see FindLowerBound()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::FindUpperBound( const Key& rKey ) const
+{
+    if( !m_pRoot )
+    {
+        return End();
+    }
+
+    ExtractKey keyExtract;
+    CompareKey keyCompare;
+
+    LeafNode* pLeaf = FindLeaf( rKey );
+    const InternalValue* pValues = pLeaf->GetValues();
+
+    size_t lowIndex = 0;
+    size_t highIndex = pLeaf->count;
+    while( lowIndex < highIndex )
+    {
+        size_t middleIndex = lowIndex + ( highIndex - lowIndex ) / 2;
+        if( keyCompare( rKey, keyExtract( pValues[ middleIndex ] ) ) )
+        {
+            highIndex = middleIndex;
+        }
+        else
+        {
+            lowIndex = middleIndex + 1;
+        }
+    }
+
+    if( lowIndex >= pLeaf->count )
+    {
+        pLeaf = pLeaf->pNext;
+        lowIndex = 0;
+    }
+
+    return ConstIterator( this, pLeaf, lowIndex );
+}
+
+/// Split a full child node of a branch node in half.
+///
+/// @param[in] pParent     Parent branch node (must not be full).
+/// @param[in] childIndex  Index of the child node to split.
+/// @param[in] bLeafChild  True if the child node is a leaf node, false if it is a branch node.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+void Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::SplitChild(
+    BranchNode* pParent,
+    size_t childIndex,
+    bool bLeafChild )
+{
+    HELIUM_ASSERT( pParent );
+    HELIUM_ASSERT( pParent->count < BRANCH_CAPACITY );
+    HELIUM_ASSERT( childIndex < pParent->count );
+
+    size_t parentCount = pParent->count;
+    KeyStorage* pParentKeys = pParent->GetKeys();
+
+    void* pNewChild;
+    if( bLeafChild )
+    {
+        LeafNode* pLeft = static_cast< LeafNode* >( pParent->pChildren[ childIndex ] );
+        LeafNode* pRight = AllocateLeaf();
+
+        size_t leftCount = pLeft->count / 2;
+        size_t rightCount = pLeft->count - leftCount;
+
+        InternalValue* pLeftValues = pLeft->GetValues();
+        InternalValue* pRightValues = pRight->GetValues();
+        for( size_t valueIndex = 0; valueIndex < rightCount; ++valueIndex )
+        {
+            new( pRightValues + valueIndex ) InternalValue( std::move( pLeftValues[ leftCount + valueIndex ] ) );
+        }
+
+        ArrayInPlaceDestruct( pLeftValues + leftCount, rightCount );
+
+        pLeft->count = leftCount;
+        pRight->count = rightCount;
+
+        pRight->pPrevious = pLeft;
+        pRight->pNext = pLeft->pNext;
+        if( pLeft->pNext )
+        {
+            pLeft->pNext->pPrevious = pRight;
+        }
+        else
+        {
+            m_pLastLeaf = pRight;
+        }
+
+        pLeft->pNext = pRight;
+
+        InsertElement( pParentKeys, parentCount - 1, childIndex, ExtractKey()( pRightValues[ 0 ] ) );
+
+        pNewChild = pRight;
+    }
+    else
+    {
+        BranchNode* pLeft = static_cast< BranchNode* >( pParent->pChildren[ childIndex ] );
+        BranchNode* pRight = AllocateBranch();
+
+        size_t leftCount = pLeft->count / 2;
+        size_t rightCount = pLeft->count - leftCount;
+
+        // The left node keeps its first (leftCount - 1) keys, the key following them moves up into the parent, and the
+        // remaining (rightCount - 1) keys move into the right node.
+        KeyStorage* pLeftKeys = pLeft->GetKeys();
+        KeyStorage* pRightKeys = pRight->GetKeys();
+        for( size_t keyIndex = 0; keyIndex < rightCount - 1; ++keyIndex )
+        {
+            new( pRightKeys + keyIndex ) KeyStorage( std::move( pLeftKeys[ leftCount + keyIndex ] ) );
+        }
+
+        MemoryCopy( pRight->pChildren, pLeft->pChildren + leftCount, rightCount * sizeof( void* ) );
+
+        InsertElement( pParentKeys, parentCount - 1, childIndex, pLeftKeys[ leftCount - 1 ] );
+        ArrayInPlaceDestruct( pLeftKeys + leftCount - 1, rightCount );
+
+        pLeft->count = leftCount;
+        pRight->count = rightCount;
+
+        pNewChild = pRight;
+    }
+
+    InsertElement( pParent->pChildren, parentCount, childIndex + 1, pNewChild );
+    ++pParent->count;
+}
+
+/// Make sure a child node of a branch node has more than the minimum number of entries before descending into it to
+/// remove an entry, either by moving an entry from a sibling node or merging it with a sibling node.
+///
+/// @param[in] pParent      Parent branch node.
+/// @param[in] childIndex   Index of the child node to fill.
+/// @param[in] bLeafChild   True if the child nodes are leaf nodes, false if they are branch nodes.
+///
+/// @return  Index of the child node covering the same key range as the original child node (this will change if the
+///          node was merged with its left sibling).
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+size_t Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::FillChild(
+    BranchNode* pParent,
+    size_t childIndex,
+    bool bLeafChild )
+{
+    HELIUM_ASSERT( pParent );
+    HELIUM_ASSERT( pParent->count >= 2 );
+    HELIUM_ASSERT( childIndex < pParent->count );
+
+    size_t minCount = ( bLeafChild ? LEAF_MIN_COUNT : BRANCH_MIN_COUNT );
+    KeyStorage* pParentKeys = pParent->GetKeys();
+
+    if( bLeafChild )
+    {
+        LeafNode* pChild = static_cast< LeafNode* >( pParent->pChildren[ childIndex ] );
+        if( pChild->count > minCount )
+        {
+            return childIndex;
+        }
+
+        ExtractKey keyExtract;
+
+        if( childIndex != 0 )
+        {
+            LeafNode* pLeft = static_cast< LeafNode* >( pParent->pChildren[ childIndex - 1 ] );
+            if( pLeft->count > minCount )
+            {
+                InsertElement( pChild->GetValues(), pChild->count, 0, pLeft->GetValues()[ pLeft->count - 1 ] );
+                ++pChild->count;
+                RemoveElement( pLeft->GetValues(), pLeft->count, pLeft->count - 1 );
+                --pLeft->count;
+
+                pParentKeys[ childIndex - 1 ] = keyExtract( pChild->GetValues()[ 0 ] );
+
+                return childIndex;
+            }
+        }
+
+        if( childIndex + 1 < pParent->count )
+        {
+            LeafNode* pRight = static_cast< LeafNode* >( pParent->pChildren[ childIndex + 1 ] );
+            if( pRight->count > minCount )
+            {
+                InsertElement( pChild->GetValues(), pChild->count, pChild->count, pRight->GetValues()[ 0 ] );
+                ++pChild->count;
+                RemoveElement( pRight->GetValues(), pRight->count, 0 );
+                --pRight->count;
+
+                pParentKeys[ childIndex ] = keyExtract( pRight->GetValues()[ 0 ] );
+
+                return childIndex;
+            }
+        }
+    }
+    else
+    {
+        BranchNode* pChild = static_cast< BranchNode* >( pParent->pChildren[ childIndex ] );
+        if( pChild->count > minCount )
+        {
+            return childIndex;
+        }
+
+        // Rotate a child node and key through the parent key separating the two siblings.
+        if( childIndex != 0 )
+        {
+            BranchNode* pLeft = static_cast< BranchNode* >( pParent->pChildren[ childIndex - 1 ] );
+            if( pLeft->count > minCount )
+            {
+                KeyStorage* pLeftKeys = pLeft->GetKeys();
+
+                InsertElement( pChild->GetKeys(), pChild->count - 1, 0, pParentKeys[ childIndex - 1 ] );
+                InsertElement( pChild->pChildren, pChild->count, 0, pLeft->pChildren[ pLeft->count - 1 ] );
+                ++pChild->count;
+
+                pParentKeys[ childIndex - 1 ] = std::move( pLeftKeys[ pLeft->count - 2 ] );
+                RemoveElement( pLeftKeys, pLeft->count - 1, pLeft->count - 2 );
+                --pLeft->count;
+
+                return childIndex;
+            }
+        }
+
+        if( childIndex + 1 < pParent->count )
+        {
+            BranchNode* pRight = static_cast< BranchNode* >( pParent->pChildren[ childIndex + 1 ] );
+            if( pRight->count > minCount )
+            {
+                KeyStorage* pRightKeys = pRight->GetKeys();
+
+                InsertElement( pChild->GetKeys(), pChild->count - 1, pChild->count - 1, pParentKeys[ childIndex ] );
+                InsertElement( pChild->pChildren, pChild->count, pChild->count, pRight->pChildren[ 0 ] );
+                ++pChild->count;
+
+                pParentKeys[ childIndex ] = std::move( pRightKeys[ 0 ] );
+                RemoveElement( pRightKeys, pRight->count - 1, 0 );
+                RemoveElement( pRight->pChildren, pRight->count, 0 );
+                --pRight->count;
+
+                return childIndex;
+            }
+        }
+    }
+
+    // Neither sibling has any entries to spare, so merge the child with one of them.
+    if( childIndex != 0 )
+    {
+        MergeChildren( pParent, childIndex - 1, bLeafChild );
+
+        return childIndex - 1;
+    }
+
+    MergeChildren( pParent, childIndex, bLeafChild );
+
+    return childIndex;
+}
+
+/// Merge two adjacent child nodes of a branch node into a single node.
+///
+/// @param[in] pParent         Parent branch node.
+/// @param[in] leftChildIndex  Index of the first of the two child nodes to merge.
+/// @param[in] bLeafChildren   True if the child nodes are leaf nodes, false if they are branch nodes.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+void Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::MergeChildren(
+    BranchNode* pParent,
+    size_t leftChildIndex,
+    bool bLeafChildren )
+{
+    HELIUM_ASSERT( pParent );
+    HELIUM_ASSERT( leftChildIndex + 1 < pParent->count );
+
+    KeyStorage* pParentKeys = pParent->GetKeys();
+
+    if( bLeafChildren )
+    {
+        LeafNode* pLeft = static_cast< LeafNode* >( pParent->pChildren[ leftChildIndex ] );
+        LeafNode* pRight = static_cast< LeafNode* >( pParent->pChildren[ leftChildIndex + 1 ] );
+        HELIUM_ASSERT( pLeft->count + pRight->count <= LEAF_CAPACITY );
+
+        InternalValue* pLeftValues = pLeft->GetValues() + pLeft->count;
+        InternalValue* pRightValues = pRight->GetValues();
+        for( size_t valueIndex = 0; valueIndex < pRight->count; ++valueIndex )
+        {
+            new( pLeftValues + valueIndex ) InternalValue( std::move( pRightValues[ valueIndex ] ) );
+        }
+
+        ArrayInPlaceDestruct( pRightValues, pRight->count );
+        pLeft->count += pRight->count;
+
+        pLeft->pNext = pRight->pNext;
+        if( pRight->pNext )
+        {
+            pRight->pNext->pPrevious = pLeft;
+        }
+        else
+        {
+            m_pLastLeaf = pLeft;
+        }
+
+        Allocator().FreeAligned( pRight );
+    }
+    else
+    {
+        BranchNode* pLeft = static_cast< BranchNode* >( pParent->pChildren[ leftChildIndex ] );
+        BranchNode* pRight = static_cast< BranchNode* >( pParent->pChildren[ leftChildIndex + 1 ] );
+        HELIUM_ASSERT( pLeft->count + pRight->count <= BRANCH_CAPACITY );
+
+        // The parent key separating the two nodes moves down between the keys of the left and right nodes.
+        KeyStorage* pLeftKeys = pLeft->GetKeys() + pLeft->count - 1;
+        KeyStorage* pRightKeys = pRight->GetKeys();
+        new( pLeftKeys ) KeyStorage( std::move( pParentKeys[ leftChildIndex ] ) );
+        for( size_t keyIndex = 0; keyIndex < pRight->count - 1; ++keyIndex )
+        {
+            new( pLeftKeys + 1 + keyIndex ) KeyStorage( std::move( pRightKeys[ keyIndex ] ) );
+        }
+
+        ArrayInPlaceDestruct( pRightKeys, pRight->count - 1 );
+
+        MemoryCopy( pLeft->pChildren + pLeft->count, pRight->pChildren, pRight->count * sizeof( void* ) );
+        pLeft->count += pRight->count;
+
+        Allocator().FreeAligned( pRight );
+    }
+
+    RemoveElement( pParentKeys, pParent->count - 1, leftChildIndex );
+    RemoveElement( pParent->pChildren, pParent->count, leftChildIndex + 1 );
+    --pParent->count;
+}
+
+/// Verify that a node and all of its children are valid.
+///
+/// @param[in]     pNode           Node to verify.
+/// @param[in]     depth           Number of branch levels below this node.
+/// @param[in]     pLowerKey       Lowest key allowed in this subtree, or null if there is no lower bound.
+/// @param[in]     pUpperKey       Key succeeding all keys allowed in this subtree, or null if there is no upper bound.
+/// @param[in,out] rpPreviousLeaf  Last leaf node visited (updated as leaf nodes are visited).
+/// @param[in,out] rValueCount     Number of values visited (updated as leaf nodes are visited).
+///
+/// @return  True if the subtree is valid, false if not.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+bool Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::RecursiveVerify(
+    const void* pNode,
+    size_t depth,
+    const Key* pLowerKey,
+    const Key* pUpperKey,
+    const LeafNode*& rpPreviousLeaf,
+    size_t& rValueCount ) const
+{
+    ExtractKey keyExtract;
+    CompareKey keyCompare;
+
+    bool bRoot = ( pNode == m_pRoot );
+
+    if( depth == 0 )
+    {
+        const LeafNode* pLeaf = static_cast< const LeafNode* >( pNode );
+        size_t count = pLeaf->count;
+        if( count == 0 || count > LEAF_CAPACITY || ( !bRoot && count < LEAF_MIN_COUNT ) )
+        {
+            HELIUM_TRACE(
+                TraceLevels::Debug,
+                TXT( "Invalid BTree leaf node value count %" ) PRIuSZ TXT( ".\n" ),
+                count );
+
+            return false;
+        }
+
+        const InternalValue* pValues = pLeaf->GetValues();
+        for( size_t valueIndex = 0; valueIndex < count; ++valueIndex )
+        {
+            const Key& rKey = keyExtract( pValues[ valueIndex ] );
+            if( ( valueIndex != 0 && !keyCompare( keyExtract( pValues[ valueIndex - 1 ] ), rKey ) ) ||
+                ( pLowerKey && keyCompare( rKey, *pLowerKey ) ) ||
+                ( pUpperKey && !keyCompare( rKey, *pUpperKey ) ) )
+            {
+                HELIUM_TRACE(
+                    TraceLevels::Debug,
+                    TXT( "BTree sort mismatch at leaf node value %" ) PRIuSZ TXT( ".\n" ),
+                    valueIndex );
+
+                return false;
+            }
+        }
+
+        if( pLeaf->pPrevious != rpPreviousLeaf ||
+            ( rpPreviousLeaf ? rpPreviousLeaf->pNext != pLeaf : m_pFirstLeaf != pLeaf ) )
+        {
+            HELIUM_TRACE( TraceLevels::Debug, TXT( "BTree leaf node link mismatch.\n" ) );
+
+            return false;
+        }
+
+        rpPreviousLeaf = pLeaf;
+        rValueCount += count;
+
+        return true;
+    }
+
+    const BranchNode* pBranch = static_cast< const BranchNode* >( pNode );
+    size_t count = pBranch->count;
+    if( count < 2 || count > BRANCH_CAPACITY || ( !bRoot && count < BRANCH_MIN_COUNT ) )
+    {
+        HELIUM_TRACE(
+            TraceLevels::Debug,
+            TXT( "Invalid BTree branch node child count %" ) PRIuSZ TXT( ".\n" ),
+            count );
+
+        return false;
+    }
+
+    const KeyStorage* pKeys = pBranch->GetKeys();
+    for( size_t keyIndex = 0; keyIndex < count - 1; ++keyIndex )
+    {
+        if( ( keyIndex != 0 && !keyCompare( pKeys[ keyIndex - 1 ], pKeys[ keyIndex ] ) ) ||
+            ( pLowerKey && keyCompare( pKeys[ keyIndex ], *pLowerKey ) ) ||
+            ( pUpperKey && !keyCompare( pKeys[ keyIndex ], *pUpperKey ) ) )
+        {
+            HELIUM_TRACE(
+                TraceLevels::Debug,
+                TXT( "BTree sort mismatch at branch node key %" ) PRIuSZ TXT( ".\n" ),
+                keyIndex );
+
+            return false;
+        }
+    }
+
+    for( size_t childIndex = 0; childIndex < count; ++childIndex )
+    {
+        const Key* pChildLowerKey = ( childIndex != 0 ? pKeys + childIndex - 1 : pLowerKey );
+        const Key* pChildUpperKey = ( childIndex != count - 1 ? pKeys + childIndex : pUpperKey );
+        if( !RecursiveVerify(
+                pBranch->pChildren[ childIndex ],
+                depth - 1,
+                pChildLowerKey,
+                pChildUpperKey,
+                rpPreviousLeaf,
+                rValueCount ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// Find the index of the child node of a branch node that covers a given key.
+///
+/// @param[in] pNode  Branch node to search.
+/// @param[in] rKey   Key to locate.
+///
+/// @return  Index of the child node covering the given key.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+size_t Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::FindChildIndex(
+    const BranchNode* pNode,
+    const Key& rKey )
+{
+    HELIUM_ASSERT( pNode );
+
+    CompareKey keyCompare;
+    const KeyStorage* pKeys = pNode->GetKeys();
+
+    // Find the number of separator keys that do not succeed the given key.
+    size_t lowIndex = 0;
+    size_t highIndex = pNode->count - 1;
+    while( lowIndex < highIndex )
+    {
+        size_t middleIndex = lowIndex + ( highIndex - lowIndex ) / 2;
+        if( keyCompare( rKey, pKeys[ middleIndex ] ) )
+        {
+            highIndex = middleIndex;
+        }
+        else
+        {
+            lowIndex = middleIndex + 1;
+        }
+    }
+
+    return lowIndex;
+}
+
+/// Find the index of the first value in a leaf node with a key that does not precede a given key.
+///
+/// @param[in] pNode  Leaf node to search.
+/// @param[in] rKey   Key to locate.
+///
+/// @return  Index of the first value not less than the given key, or the leaf node value count if all values are less.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+size_t Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::FindValueIndex(
+    const LeafNode* pNode,
+    const Key& rKey )
+{
+    HELIUM_ASSERT( pNode );
+
+    ExtractKey keyExtract;
+    CompareKey keyCompare;
+    const InternalValue* pValues = pNode->GetValues();
+
+    size_t lowIndex = 0;
+    size_t highIndex = pNode->count;
+    while( lowIndex < highIndex )
+    {
+        size_t middleIndex = lowIndex + ( highIndex - lowIndex ) / 2;
+        if( keyCompare( keyExtract( pValues[ middleIndex ] ), rKey ) )
+        {
+            lowIndex = middleIndex + 1;
+        }
+        else
+        {
+            highIndex = middleIndex;
+        }
+    }
+
+    return lowIndex;
+}
+
+/// Get the lowest key in a subtree.
+///
+/// @param[in] pNode  Root node of the subtree.
+/// @param[in] depth  Number of branch levels below the given node.
+///
+/// @return  Lowest key in the subtree.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+const Key& Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::GetLowestKey(
+    const void* pNode,
+    size_t depth )
+{
+    HELIUM_ASSERT( pNode );
+
+    for( ; depth != 0; --depth )
+    {
+        pNode = static_cast< const BranchNode* >( pNode )->pChildren[ 0 ];
+    }
+
+    const LeafNode* pLeaf = static_cast< const LeafNode* >( pNode );
+    HELIUM_ASSERT( pLeaf->count != 0 );
+
+    return ExtractKey()( pLeaf->GetValues()[ 0 ] );
+}
+
+/// Insert an element into an array of elements with uninitialized storage following the last element.
+///
+/// @param[in] pElements  Array of elements.
+/// @param[in] count      Number of elements currently in the array.
+/// @param[in] index      Index at which to insert the element.
+/// @param[in] rValue     Value of the element to insert.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+template< typename T, typename U >
+void Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::InsertElement(
+    T* pElements,
+    size_t count,
+    size_t index,
+    const U& rValue )
+{
+    HELIUM_ASSERT( pElements );
+    HELIUM_ASSERT( index <= count );
+
+    if( index == count )
+    {
+        new( pElements + count ) T( rValue );
+
+        return;
+    }
+
+    new( pElements + count ) T( std::move( pElements[ count - 1 ] ) );
+    for( size_t elementIndex = count - 1; elementIndex > index; --elementIndex )
+    {
+        pElements[ elementIndex ] = std::move( pElements[ elementIndex - 1 ] );
+    }
+
+    pElements[ index ] = T( rValue );
+}
+
+/// Remove an element from an array of elements, destroying the last element once the following elements have been
+/// shifted down to fill the gap.
+///
+/// @param[in] pElements  Array of elements.
+/// @param[in] count      Number of elements currently in the array.
+/// @param[in] index      Index of the element to remove.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+template< typename T >
+void Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::RemoveElement(
+    T* pElements,
+    size_t count,
+    size_t index )
+{
+    HELIUM_ASSERT( pElements );
+    HELIUM_ASSERT( index < count );
+
+    for( size_t elementIndex = index + 1; elementIndex < count; ++elementIndex )
+    {
+        pElements[ elementIndex - 1 ] = std::move( pElements[ elementIndex ] );
+    }
+
+    ArrayInPlaceDestruct( pElements + count - 1, 1 );
+}
+
+/// Allocate an empty leaf node.
+///
+/// @return  Newly allocated leaf node.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::LeafNode*
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::AllocateLeaf()
+{
+    size_t alignment = std::alignment_of< LeafNode >::value;
+    if( alignment < CACHE_LINE_SIZE )
+    {
+        alignment = CACHE_LINE_SIZE;
+    }
+
+    LeafNode* pLeaf = static_cast< LeafNode* >( Allocator().AllocateAligned( alignment, sizeof( LeafNode ) ) );
+    HELIUM_ASSERT( pLeaf );
+    pLeaf->pPrevious = NULL;
+    pLeaf->pNext = NULL;
+    pLeaf->count = 0;
+
+    return pLeaf;
+}
+
+/// Allocate an empty branch node.
+///
+/// @return  Newly allocated branch node.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::BranchNode*
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::AllocateBranch()
+{
+    size_t alignment = std::alignment_of< BranchNode >::value;
+    if( alignment < CACHE_LINE_SIZE )
+    {
+        alignment = CACHE_LINE_SIZE;
+    }
+
+    BranchNode* pBranch = static_cast< BranchNode* >( Allocator().AllocateAligned( alignment, sizeof( BranchNode ) ) );
+    HELIUM_ASSERT( pBranch );
+    pBranch->count = 0;
+
+    return pBranch;
+}
+
+/// Destroy the contents of a node and all of its children, and free their memory.
+///
+/// @param[in] pNode  Node to free.
+/// @param[in] depth  Number of branch levels below the given node.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+void Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::FreeNode( void* pNode, size_t depth )
+{
+    HELIUM_ASSERT( pNode );
+
+    if( depth == 0 )
+    {
+        LeafNode* pLeaf = static_cast< LeafNode* >( pNode );
+        ArrayInPlaceDestruct( pLeaf->GetValues(), pLeaf->count );
+    }
+    else
+    {
+        BranchNode* pBranch = static_cast< BranchNode* >( pNode );
+        for( size_t childIndex = 0; childIndex < pBranch->count; ++childIndex )
+        {
+            FreeNode( pBranch->pChildren[ childIndex ], depth - 1 );
+        }
+
+        ArrayInPlaceDestruct( pBranch->GetKeys(), pBranch->count - 1 );
+    }
+
+    Allocator().FreeAligned( pNode );
+}
+
+/// Get the values stored in this leaf node.
+///
+/// @return  Leaf node values.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+InternalValue* Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::LeafNode::GetValues()
+{
+    return reinterpret_cast< InternalValue* >( &values );
+}
+
+/// Get the values stored in this leaf node.
+///
+/// @return  Leaf node values.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+const InternalValue* Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::LeafNode::GetValues() const
+{
+    return reinterpret_cast< const InternalValue* >( &values );
+}
+
+/// Get the separator keys stored in this branch node.
+///
+/// @return  Branch node separator keys.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::KeyStorage*
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::BranchNode::GetKeys()
+{
+    return reinterpret_cast< KeyStorage* >( &keys );
+}
+
+/// Get the separator keys stored in this branch node.
+///
+/// @return  Branch node separator keys.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+const typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::KeyStorage*
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::BranchNode::GetKeys() const
+{
+    return reinterpret_cast< const KeyStorage* >( &keys );
+}
+
+/// Constructor.
+///
+/// Creates an uninitialized iterator.  Using this is not safe until it is initialized.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator::ConstIterator()
+{
+}
+
+/// Constructor.
+///
+/// @param[in] pTree   Tree to iterate.
+/// @param[in] pLeaf   Leaf node containing the value at which to start iterating, or null to start at the end.
+/// @param[in] index   Index of the value in the leaf node at which to start iterating.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator::ConstIterator(
+    const BTree* pTree,
+    LeafNode* pLeaf,
+    size_t index )
+    : m_pTree( const_cast< BTree* >( pTree ) )
+    , m_pLeaf( pLeaf )
+    , m_index( index )
+{
+}
+
+/// Access the current tree entry.
+///
+/// @return  Constant reference to the current tree entry.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+const Value& Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator::operator*() const
+{
+    HELIUM_ASSERT( m_pLeaf );
+    HELIUM_ASSERT( m_index < m_pLeaf->count );
+
+    return m_pLeaf->GetValues()[ m_index ];
+}
+
+/// Access the current tree entry.
+///
+/// @return  Constant pointer to the current tree entry.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+const Value* Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator::operator->() const
+{
+    HELIUM_ASSERT( m_pLeaf );
+    HELIUM_ASSERT( m_index < m_pLeaf->count );
+
+    return m_pLeaf->GetValues() + m_index;
+}
+
+/// Increment this iterator to the next tree entry.
+///
+/// @return  Reference to this iterator.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator&
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator::operator++()
+{
+    HELIUM_ASSERT( m_pLeaf );
+
+    ++m_index;
+    if( m_index >= m_pLeaf->count )
+    {
+        m_pLeaf = m_pLeaf->pNext;
+        m_index = 0;
+    }
+
+    return *this;
+}
+
+/// Increment this iterator to the next tree entry.
+///
+/// @return  Copy of this iterator prior to incrementing.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator::operator++( int )
+{
+    ConstIterator result = *this;
+    ++( *this );
+
+    return result;
+}
+
+/// Decrement this iterator to the previous tree entry.
+///
+/// @return  Reference to this iterator.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator&
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator::operator--()
+{
+    // Allow decrementing from the End() iterator (the leaf node will be null in such cases).
+    if( !m_pLeaf )
+    {
+        HELIUM_ASSERT( m_pTree );
+        m_pLeaf = m_pTree->m_pLastLeaf;
+        HELIUM_ASSERT( m_pLeaf );
+        m_index = m_pLeaf->count - 1;
+
+        return *this;
+    }
+
+    if( m_index == 0 )
+    {
+        m_pLeaf = m_pLeaf->pPrevious;
+        HELIUM_ASSERT( m_pLeaf );
+        m_index = m_pLeaf->count;
+    }
+
+    --m_index;
+
+    return *this;
+}
+
+/// Decrement this iterator to the previous tree entry.
+///
+/// @return  Copy of this iterator prior to decrementing.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator::operator--( int )
+{
+    ConstIterator result = *this;
+    --( *this );
+
+    return result;
+}
+
+/// Get whether this iterator references the same tree entry as another iterator.
+///
+/// @param[in] rOther  Iterator against which to compare.
+///
+/// @return  True if the iterators reference the same tree entry, false if not.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+bool Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator::operator==(
+    const ConstIterator& rOther ) const
+{
+    return ( m_pLeaf == rOther.m_pLeaf && m_index == rOther.m_index );
+}
+
+/// Get whether this iterator references a different tree entry than another iterator.
+///
+/// @param[in] rOther  Iterator against which to compare.
+///
+/// @return  True if the iterators reference different tree entries, false if they reference the same entry.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+bool Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator::operator!=(
+    const ConstIterator& rOther ) const
+{
+    return !( *this == rOther );
+}
+
+/// Constructor.
+///
+/// Creates an uninitialized iterator.  Using this is not safe until it is initialized.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator::Iterator()
+{
+}
+
+/// Constructor.
+///
+/// @param[in] pTree   Tree to iterate.
+/// @param[in] pLeaf   Leaf node containing the value at which to start iterating, or null to start at the end.
+/// @param[in] index   Index of the value in the leaf node at which to start iterating.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator::Iterator(
+    BTree* pTree,
+    LeafNode* pLeaf,
+    size_t index )
+    : ConstIterator( pTree, pLeaf, index )
+{
+}
+
+/// Access the current tree entry.
+///
+/// @return  Reference to the current tree entry.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+Value& Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator::operator*() const
+{
+    return const_cast< Value& >( ConstIterator::operator*() );
+}
+
+/// Access the current tree entry.
+///
+/// @return  Pointer to the current tree entry.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+Value* Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator::operator->() const
+{
+    return const_cast< Value* >( ConstIterator::operator->() );
+}
+
+/// Increment this iterator to the next tree entry.
+///
+/// @return  Reference to this iterator.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator&
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator::operator++()
+{
+    ConstIterator::operator++();
+
+    return *this;
+}
+
+/// Increment this iterator to the next tree entry.
+///
+/// @return  Copy of this iterator prior to incrementing.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator::operator++( int )
+{
+    Iterator result = *this;
+    ConstIterator::operator++();
+
+    return result;
+}
+
+/// Decrement this iterator to the previous tree entry.
+///
+/// @return  Reference to this iterator.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator&
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator::operator--()
+{
+    ConstIterator::operator--();
+
+    return *this;
+}
+
+/// Decrement this iterator to the previous tree entry.
+///
+/// @return  Copy of this iterator prior to decrementing.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator
+    Helium::BTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator::operator--( int )
+{
+    Iterator result = *this;
+    ConstIterator::operator--();
+
+    return result;
+}
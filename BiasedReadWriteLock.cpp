@@ -0,0 +1,73 @@
+#include "FoundationPch.h"
+#include "Foundation/BiasedReadWriteLock.h"
+
+#include "Platform/Thread.h"
+
+using namespace Helium;
+
+BiasedReadWriteLock::ReaderSlot BiasedReadWriteLock::sm_readerSlots[ BiasedReadWriteLock::READER_SLOT_COUNT ] = {};
+
+/// Constructor.
+BiasedReadWriteLock::BiasedReadWriteLock()
+    : m_bReadBias( 1 )
+    , m_inhibitBiasUntil( 0 )
+    , m_pendingWriterCount( 0 )
+    , m_revokeCount( 0 )
+{
+}
+
+/// Acquire an exclusive lock, revoking read biasing first if necessary.
+void BiasedReadWriteLock::LockWriteSlow()
+{
+    // Prevent readers from restoring biasing until we have the lock.
+    AtomicIncrementAcquire( m_pendingWriterCount );
+
+    for( ; ; )
+    {
+        if( m_bReadBias )
+        {
+            RevokeReadBias();
+        }
+
+        m_lock.LockWrite();
+
+        // Another writer may still be waiting for registered readers to leave (or biasing may have been restored just
+        // before we registered as a pending writer), in which case we need to try again.
+        if( !m_bReadBias && m_revokeCount == 0 )
+        {
+            break;
+        }
+
+        m_lock.UnlockWrite();
+        Thread::Yield();
+    }
+
+    AtomicDecrementRelease( m_pendingWriterCount );
+}
+
+/// Disable read biasing and wait for any readers registered in the visible-readers table to release their locks.
+///
+/// This must be called without holding the underlying lock, as registered readers may need to acquire other locks
+/// before they can finish.
+void BiasedReadWriteLock::RevokeReadBias()
+{
+    AtomicIncrementAcquire( m_revokeCount );
+
+    // The exchange must be a full barrier so the slot loads below cannot be reordered ahead of it (see LockRead()).
+    AtomicExchange( m_bReadBias, 0 );
+
+    uint64_t startTickCount = Timer::GetTickCount();
+
+    for( size_t slotIndex = 0; slotIndex < READER_SLOT_COUNT; ++slotIndex )
+    {
+        while( sm_readerSlots[ slotIndex ].pLock == this )
+        {
+            Thread::Yield();
+        }
+    }
+
+    uint64_t endTickCount = Timer::GetTickCount();
+    m_inhibitBiasUntil = endTickCount + ( endTickCount - startTickCount ) * BIAS_INHIBIT_MULTIPLIER;
+
+    AtomicDecrementRelease( m_revokeCount );
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Platform/Atomic.h"
+#include "Platform/Locks.h"
+#include "Platform/Timer.h"
+#include "Platform/Utility.h"
+
+#include "Foundation/API.h"
+#include "Foundation/HashFunctions.h"
+
+namespace Helium
+{
+    /// Read-write lock optimized for read-mostly access.
+    ///
+    /// While read biasing is enabled, readers do not touch the lock itself.  Instead, each reader publishes the lock
+    /// address in a slot of a global visible-readers table, selected by hashing the lock address with an identifier for
+    /// the calling thread.  Each slot is padded to a full cache line, so readers on different threads write to
+    /// different cache lines instead of all contending on the reader count of a shared ReadWriteLock.  Writers revoke
+    /// read biasing and wait for any readers still registered in the table to leave before acquiring the underlying
+    /// lock, so readers blocked on the underlying lock can never prevent registered readers from finishing.  If a
+    /// reader's slot is already in use (hash collision or a recursive read lock), it simply falls back to the
+    /// underlying lock.
+    ///
+    /// Readers publish their slot and then check that biasing is still enabled, while writers disable biasing and then
+    /// check the slots.  Both sides use full-barrier atomic operations for the first step, so at least one of them is
+    /// guaranteed to see the other's update.
+    ///
+    /// Since revocation requires a scan of the reader table, biasing stays disabled after a revocation for a multiple
+    /// of the time the revocation took, which bounds the overhead revocation adds to write-heavy phases.
+    ///
+    /// Read lock acquisition returns a token that must be passed back when releasing the read lock.
+    class HELIUM_FOUNDATION_API BiasedReadWriteLock : NonCopyable
+    {
+    public:
+        /// Number of slots in the global visible-readers table (power of two).  Since each slot occupies a cache line,
+        /// this is kept small enough that a revocation scan only touches 64 KB.
+        static const size_t READER_SLOT_COUNT = 1024;
+        /// Multiple of the time spent revoking read biasing for which biasing stays disabled afterward.
+        static const uint64_t BIAS_INHIBIT_MULTIPLIER = 9;
+
+        /// @name Construction/Destruction
+        //@{
+        BiasedReadWriteLock();
+        //@}
+
+        /// @name Synchronization Interface
+        //@{
+        inline size_t LockRead();
+        inline void UnlockRead( size_t token );
+
+        inline void LockWrite();
+        inline void UnlockWrite();
+        //@}
+
+    private:
+        /// Visible-readers table slot, aligned and padded to a cache line (64 bytes) to avoid false sharing between
+        /// readers registered in neighboring slots.
+        HELIUM_ALIGN_PRE( 64 ) struct ReaderSlot
+        {
+            /// Lock for which a reader is registered in this slot (null if unused).
+            void* volatile pLock;
+        } HELIUM_ALIGN_POST( 64 );
+
+        /// Underlying read-write lock.
+        ReadWriteLock m_lock;
+        /// Non-zero if readers may use the visible-readers table instead of the underlying lock.
+        volatile int32_t m_bReadBias;
+        /// Timer tick count before which read biasing may not be re-enabled.
+        volatile uint64_t m_inhibitBiasUntil;
+        /// Number of writers that have revoked read biasing but not yet acquired the underlying lock.
+        volatile int32_t m_pendingWriterCount;
+        /// Number of writers currently waiting for registered readers to leave.
+        volatile int32_t m_revokeCount;
+
+        /// Visible-readers table.
+        static ReaderSlot sm_readerSlots[ READER_SLOT_COUNT ];
+
+        /// @name Private Utility Functions
+        //@{
+        inline size_t GetReaderSlotIndex() const;
+        void LockWriteSlow();
+        void RevokeReadBias();
+        //@}
+    };
+}
+
+#include "Foundation/BiasedReadWriteLock.inl"
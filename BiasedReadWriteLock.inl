@@ -0,0 +1,96 @@
+/// Acquire a shared (read-only) lock.
+///
+/// @return  Token to pass to UnlockRead() when releasing the lock.
+///
+/// @see UnlockRead()
+size_t Helium::BiasedReadWriteLock::LockRead()
+{
+    if( m_bReadBias )
+    {
+        size_t slotIndex = GetReaderSlotIndex();
+        void* volatile& rSlot = sm_readerSlots[ slotIndex ].pLock;
+        if( !rSlot && AtomicCompareExchange< void >( rSlot, this, NULL ) == NULL )
+        {
+            // Make sure biasing wasn't revoked by a writer before our slot became visible.  The compare-exchange above
+            // is a full barrier, so this load cannot be reordered ahead of the slot store (see RevokeReadBias()).
+            if( m_bReadBias )
+            {
+                return slotIndex;
+            }
+
+            AtomicExchangeRelease< void >( rSlot, NULL );
+        }
+    }
+
+    m_lock.LockRead();
+
+    // Writers are excluded while we hold the lock, so it is safe to restore read biasing here (as long as no writers
+    // are waiting to acquire the lock).  The inhibit time is only a heuristic, so a torn read is harmless.
+    if( !m_bReadBias && m_pendingWriterCount == 0 && Timer::GetTickCount() >= m_inhibitBiasUntil )
+    {
+        AtomicExchangeRelease( m_bReadBias, 1 );
+    }
+
+    return Invalid< size_t >();
+}
+
+/// Release a shared (read-only) lock.
+///
+/// @param[in] token  Token returned by the matching LockRead() call.
+///
+/// @see LockRead()
+void Helium::BiasedReadWriteLock::UnlockRead( size_t token )
+{
+    if( IsValid( token ) )
+    {
+        HELIUM_ASSERT( token < READER_SLOT_COUNT );
+        HELIUM_ASSERT( sm_readerSlots[ token ].pLock == this );
+        AtomicExchangeRelease< void >( sm_readerSlots[ token ].pLock, NULL );
+
+        return;
+    }
+
+    m_lock.UnlockRead();
+}
+
+/// Acquire an exclusive (read-write) lock.
+///
+/// @see UnlockWrite()
+void Helium::BiasedReadWriteLock::LockWrite()
+{
+    // Registered readers can only be present if biasing is enabled or a revocation is still in progress.
+    if( !m_bReadBias )
+    {
+        m_lock.LockWrite();
+        if( !m_bReadBias && m_revokeCount == 0 )
+        {
+            return;
+        }
+
+        m_lock.UnlockWrite();
+    }
+
+    LockWriteSlow();
+}
+
+/// Release an exclusive (read-write) lock.
+///
+/// @see LockWrite()
+void Helium::BiasedReadWriteLock::UnlockWrite()
+{
+    m_lock.UnlockWrite();
+}
+
+/// Get the visible-readers table slot to use for the calling thread.
+///
+/// The address of a stack variable serves as a cheap thread identifier, as thread stacks never overlap.  The result
+/// does not need to be stable across calls, since the slot index is returned to the caller as the read lock token.
+///
+/// @return  Reader slot index.
+size_t Helium::BiasedReadWriteLock::GetReaderSlotIndex() const
+{
+    int32_t stackMarker;
+    uintptr_t threadKey = reinterpret_cast< uintptr_t >( &stackMarker ) >> 16;
+
+    return MixHash( threadKey ^ reinterpret_cast< uintptr_t >( this ) ) & ( READER_SLOT_COUNT - 1 );
+}
@@ -1,2 +1,315 @@
 #include "FoundationPch.h"
-#include "BitArray.h"
\ No newline at end of file
+#include "Foundation/BitArray.h"
+
+#if defined( HELIUM_CPU_X86 ) && defined( __AVX2__ )
+# define HELIUM_BIT_ARRAY_AVX2 1
+# include <immintrin.h>
+#endif
+
+using namespace Helium;
+
+/// Number of bits in each bit array word.
+static const size_t BIT_ARRAY_WORD_BITS = sizeof( uint32_t ) * 8;
+
+#if HELIUM_BIT_ARRAY_AVX2
+/// Number of bit array words processed per vector.
+static const size_t BIT_ARRAY_VECTOR_WORDS = sizeof( __m256i ) / sizeof( uint32_t );
+
+static inline __m256i LoadBitVector( const uint32_t* pWords )
+{
+    return _mm256_loadu_si256( reinterpret_cast< const __m256i* >( pWords ) );
+}
+
+static inline void StoreBitVector( uint32_t* pWords, __m256i bits )
+{
+    _mm256_storeu_si256( reinterpret_cast< __m256i* >( pWords ), bits );
+}
+
+/// Count the set bits in each 64-bit lane of a vector.
+///
+/// Each byte is split into nibbles, which are counted using a 16-entry lookup table, and the byte counts are summed
+/// into 64-bit lanes.
+static inline __m256i CountBitVectorSetBits( __m256i bits )
+{
+    const __m256i nibbleCounts = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 );
+    const __m256i lowNibbleMask = _mm256_set1_epi8( 0x0f );
+
+    __m256i lowNibbles = _mm256_and_si256( bits, lowNibbleMask );
+    __m256i highNibbles = _mm256_and_si256( _mm256_srli_epi16( bits, 4 ), lowNibbleMask );
+    __m256i byteCounts = _mm256_add_epi8(
+        _mm256_shuffle_epi8( nibbleCounts, lowNibbles ),
+        _mm256_shuffle_epi8( nibbleCounts, highNibbles ) );
+
+    return _mm256_sad_epu8( byteCounts, _mm256_setzero_si256() );
+}
+#endif
+
+/// Load two consecutive bit array words as a single 64-bit word.
+///
+/// @param[in] pWords  First of the two words to load.
+///
+/// @return  Combined word, with the first word in the low 32 bits.
+static inline uint64_t LoadBitArrayWord64( const uint32_t* pWords )
+{
+    return ( static_cast< uint64_t >( pWords[ 0 ] ) | ( static_cast< uint64_t >( pWords[ 1 ] ) << 32 ) );
+}
+
+/// Find the first bit with a given value at or after a given index.
+///
+/// Every word is XORed with the inversion mask before testing for set bits, so searching for unset bits only differs
+/// by the mask used.
+///
+/// @param[in] pWords      Bit array words.
+/// @param[in] bitCount    Number of bits in the array.
+/// @param[in] startIndex  Index of the first bit to test.
+/// @param[in] invertMask  Zero to search for set bits, or all bits set to search for unset bits.
+///
+/// @return  Index of the first matching bit, or an invalid index if no matching bit was found.
+static size_t FindBitArrayBit( const uint32_t* pWords, size_t bitCount, size_t startIndex, uint32_t invertMask )
+{
+    if( startIndex >= bitCount )
+    {
+        return Invalid< size_t >();
+    }
+
+    HELIUM_ASSERT( pWords );
+
+    size_t wordCount = ( bitCount + BIT_ARRAY_WORD_BITS - 1 ) / BIT_ARRAY_WORD_BITS;
+    size_t wordIndex = startIndex / BIT_ARRAY_WORD_BITS;
+
+    // Mask off bits preceding the start index in the first word.
+    uint32_t firstWord = ( pWords[ wordIndex ] ^ invertMask ) & ( ~0U << ( startIndex % BIT_ARRAY_WORD_BITS ) );
+    size_t bitIndex = Invalid< size_t >();
+    if( firstWord != 0 )
+    {
+        bitIndex = wordIndex * BIT_ARRAY_WORD_BITS + CountTrailingZeros( firstWord );
+    }
+    else
+    {
+        ++wordIndex;
+
+#if HELIUM_BIT_ARRAY_AVX2
+        // Skip whole vectors without any matching bits.
+        __m256i invertVector = _mm256_set1_epi32( static_cast< int32_t >( invertMask ) );
+        while( wordIndex + BIT_ARRAY_VECTOR_WORDS <= wordCount &&
+               _mm256_testz_si256(
+                   _mm256_xor_si256( LoadBitVector( pWords + wordIndex ), invertVector ),
+                   _mm256_set1_epi32( -1 ) ) )
+        {
+            wordIndex += BIT_ARRAY_VECTOR_WORDS;
+        }
+#endif
+
+        uint64_t invertMask64 = ( static_cast< uint64_t >( invertMask ) << 32 ) | invertMask;
+        for( ; wordIndex + 2 <= wordCount; wordIndex += 2 )
+        {
+            uint64_t word = LoadBitArrayWord64( pWords + wordIndex ) ^ invertMask64;
+            if( word != 0 )
+            {
+                bitIndex = wordIndex * BIT_ARRAY_WORD_BITS + CountTrailingZeros( word );
+                break;
+            }
+        }
+
+        if( IsInvalid( bitIndex ) && wordIndex < wordCount )
+        {
+            uint32_t word = pWords[ wordIndex ] ^ invertMask;
+            if( word != 0 )
+            {
+                bitIndex = wordIndex * BIT_ARRAY_WORD_BITS + CountTrailingZeros( word );
+            }
+        }
+    }
+
+    // Bits past the end of the array in the last word are undefined, so discard any match found there.
+    return ( bitIndex < bitCount ? bitIndex : Invalid< size_t >() );
+}
+
+/// Perform a bitwise AND of two sets of bit array words.
+///
+/// @param[in,out] pDest      Words to update.
+/// @param[in]     pSource    Words with which to combine.
+/// @param[in]     wordCount  Number of words to process.
+///
+/// @see BitArrayOr(), BitArrayXor(), BitArrayAndNot()
+void Helium::BitArrayAnd( uint32_t* pDest, const uint32_t* pSource, size_t wordCount )
+{
+    HELIUM_ASSERT( ( pDest && pSource ) || wordCount == 0 );
+
+    size_t wordIndex = 0;
+#if HELIUM_BIT_ARRAY_AVX2
+    for( ; wordIndex + BIT_ARRAY_VECTOR_WORDS <= wordCount; wordIndex += BIT_ARRAY_VECTOR_WORDS )
+    {
+        StoreBitVector(
+            pDest + wordIndex,
+            _mm256_and_si256( LoadBitVector( pDest + wordIndex ), LoadBitVector( pSource + wordIndex ) ) );
+    }
+#endif
+
+    for( ; wordIndex < wordCount; ++wordIndex )
+    {
+        pDest[ wordIndex ] &= pSource[ wordIndex ];
+    }
+}
+
+/// Perform a bitwise OR of two sets of bit array words.
+///
+/// @param[in,out] pDest      Words to update.
+/// @param[in]     pSource    Words with which to combine.
+/// @param[in]     wordCount  Number of words to process.
+///
+/// @see BitArrayAnd(), BitArrayXor(), BitArrayAndNot()
+void Helium::BitArrayOr( uint32_t* pDest, const uint32_t* pSource, size_t wordCount )
+{
+    HELIUM_ASSERT( ( pDest && pSource ) || wordCount == 0 );
+
+    size_t wordIndex = 0;
+#if HELIUM_BIT_ARRAY_AVX2
+    for( ; wordIndex + BIT_ARRAY_VECTOR_WORDS <= wordCount; wordIndex += BIT_ARRAY_VECTOR_WORDS )
+    {
+        StoreBitVector(
+            pDest + wordIndex,
+            _mm256_or_si256( LoadBitVector( pDest + wordIndex ), LoadBitVector( pSource + wordIndex ) ) );
+    }
+#endif
+
+    for( ; wordIndex < wordCount; ++wordIndex )
+    {
+        pDest[ wordIndex ] |= pSource[ wordIndex ];
+    }
+}
+
+/// Perform a bitwise exclusive OR of two sets of bit array words.
+///
+/// @param[in,out] pDest      Words to update.
+/// @param[in]     pSource    Words with which to combine.
+/// @param[in]     wordCount  Number of words to process.
+///
+/// @see BitArrayAnd(), BitArrayOr(), BitArrayAndNot()
+void Helium::BitArrayXor( uint32_t* pDest, const uint32_t* pSource, size_t wordCount )
+{
+    HELIUM_ASSERT( ( pDest && pSource ) || wordCount == 0 );
+
+    size_t wordIndex = 0;
+#if HELIUM_BIT_ARRAY_AVX2
+    for( ; wordIndex + BIT_ARRAY_VECTOR_WORDS <= wordCount; wordIndex += BIT_ARRAY_VECTOR_WORDS )
+    {
+        StoreBitVector(
+            pDest + wordIndex,
+            _mm256_xor_si256( LoadBitVector( pDest + wordIndex ), LoadBitVector( pSource + wordIndex ) ) );
+    }
+#endif
+
+    for( ; wordIndex < wordCount; ++wordIndex )
+    {
+        pDest[ wordIndex ] ^= pSource[ wordIndex ];
+    }
+}
+
+/// Clear the bits in one set of bit array words that are set in another set of words.
+///
+/// @param[in,out] pDest      Words to update.
+/// @param[in]     pSource    Words specifying the bits to clear.
+/// @param[in]     wordCount  Number of words to process.
+///
+/// @see BitArrayAnd(), BitArrayOr(), BitArrayXor()
+void Helium::BitArrayAndNot( uint32_t* pDest, const uint32_t* pSource, size_t wordCount )
+{
+    HELIUM_ASSERT( ( pDest && pSource ) || wordCount == 0 );
+
+    size_t wordIndex = 0;
+#if HELIUM_BIT_ARRAY_AVX2
+    for( ; wordIndex + BIT_ARRAY_VECTOR_WORDS <= wordCount; wordIndex += BIT_ARRAY_VECTOR_WORDS )
+    {
+        // Note that _mm256_andnot_si256() inverts its first operand.
+        StoreBitVector(
+            pDest + wordIndex,
+            _mm256_andnot_si256( LoadBitVector( pSource + wordIndex ), LoadBitVector( pDest + wordIndex ) ) );
+    }
+#endif
+
+    for( ; wordIndex < wordCount; ++wordIndex )
+    {
+        pDest[ wordIndex ] &= ~pSource[ wordIndex ];
+    }
+}
+
+/// Count the number of set bits in a bit array.
+///
+/// @param[in] pWords    Bit array words.
+/// @param[in] bitCount  Number of bits in the array (any bits past this count in the last word are ignored).
+///
+/// @return  Number of set bits.
+size_t Helium::BitArrayCountSetBits( const uint32_t* pWords, size_t bitCount )
+{
+    HELIUM_ASSERT( pWords || bitCount == 0 );
+
+    size_t fullWordCount = bitCount / BIT_ARRAY_WORD_BITS;
+    size_t wordIndex = 0;
+    size_t setBitCount = 0;
+
+#if HELIUM_BIT_ARRAY_AVX2
+    if( fullWordCount >= BIT_ARRAY_VECTOR_WORDS )
+    {
+        __m256i laneCounts = _mm256_setzero_si256();
+        for( ; wordIndex + BIT_ARRAY_VECTOR_WORDS <= fullWordCount; wordIndex += BIT_ARRAY_VECTOR_WORDS )
+        {
+            laneCounts = _mm256_add_epi64( laneCounts, CountBitVectorSetBits( LoadBitVector( pWords + wordIndex ) ) );
+        }
+
+        uint64_t laneCountValues[ 4 ];
+        _mm256_storeu_si256( reinterpret_cast< __m256i* >( laneCountValues ), laneCounts );
+        setBitCount = static_cast< size_t >(
+            laneCountValues[ 0 ] + laneCountValues[ 1 ] + laneCountValues[ 2 ] + laneCountValues[ 3 ] );
+    }
+#endif
+
+    for( ; wordIndex + 2 <= fullWordCount; wordIndex += 2 )
+    {
+        setBitCount += CountSetBits( LoadBitArrayWord64( pWords + wordIndex ) );
+    }
+
+    if( wordIndex < fullWordCount )
+    {
+        setBitCount += CountSetBits( pWords[ wordIndex ] );
+        ++wordIndex;
+    }
+
+    size_t trailingBitCount = bitCount % BIT_ARRAY_WORD_BITS;
+    if( trailingBitCount != 0 )
+    {
+        setBitCount += CountSetBits( pWords[ wordIndex ] & ( ( 1U << trailingBitCount ) - 1 ) );
+    }
+
+    return setBitCount;
+}
+
+/// Find the first set bit in a bit array at or after a given index.
+///
+/// @param[in] pWords      Bit array words.
+/// @param[in] bitCount    Number of bits in the array.
+/// @param[in] startIndex  Index of the first bit to test.
+///
+/// @return  Index of the first set bit found, or an invalid index if no set bit was found.
+///
+/// @see BitArrayFindUnset()
+size_t Helium::BitArrayFindSet( const uint32_t* pWords, size_t bitCount, size_t startIndex )
+{
+    return FindBitArrayBit( pWords, bitCount, startIndex, 0 );
+}
+
+/// Find the first unset bit in a bit array at or after a given index.
+///
+/// @param[in] pWords      Bit array words.
+/// @param[in] bitCount    Number of bits in the array.
+/// @param[in] startIndex  Index of the first bit to test.
+///
+/// @return  Index of the first unset bit found, or an invalid index if no unset bit was found.
+///
+/// @see BitArrayFindSet()
+size_t Helium::BitArrayFindUnset( const uint32_t* pWords, size_t bitCount, size_t startIndex )
+{
+    return FindBitArrayBit( pWords, bitCount, startIndex, ~0U );
+}
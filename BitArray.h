@@ -9,6 +9,21 @@
 
 namespace Helium
 {
+    /// @defgroup bitarraysupport Bit Array Support
+    ///
+    /// Bulk operations on raw bit array words.  These process whole words at a time (eight words per instruction when
+    /// compiled with AVX2 support), and are used to implement the corresponding BitArray operations.
+    //@{
+    HELIUM_FOUNDATION_API void BitArrayAnd( uint32_t* pDest, const uint32_t* pSource, size_t wordCount );
+    HELIUM_FOUNDATION_API void BitArrayOr( uint32_t* pDest, const uint32_t* pSource, size_t wordCount );
+    HELIUM_FOUNDATION_API void BitArrayXor( uint32_t* pDest, const uint32_t* pSource, size_t wordCount );
+    HELIUM_FOUNDATION_API void BitArrayAndNot( uint32_t* pDest, const uint32_t* pSource, size_t wordCount );
+
+    HELIUM_FOUNDATION_API size_t BitArrayCountSetBits( const uint32_t* pWords, size_t bitCount );
+    HELIUM_FOUNDATION_API size_t BitArrayFindSet( const uint32_t* pWords, size_t bitCount, size_t startIndex );
+    HELIUM_FOUNDATION_API size_t BitArrayFindUnset( const uint32_t* pWords, size_t bitCount, size_t startIndex );
+    //@}
+
     /// Constant bit array element proxy.
     class HELIUM_FOUNDATION_API ConstBitArrayElementProxy
     {
@@ -152,6 +167,10 @@ namespace Helium
     };
 
     /// Resizable bit array (not thread-safe).
+    ///
+    /// In addition to per-bit access, bit arrays support bulk set operations with other bit arrays of the same size,
+    /// counting set bits, searching for set or unset bits, and setting or unsetting ranges of bits.  These operate on
+    /// whole words rather than on individual bits, so they should be preferred over iterating through the array.
     template< typename Allocator = DefaultAllocator >
     class BitArray
     {
@@ -211,6 +230,26 @@ namespace Helium
         ConstReferenceType GetLast() const;
         size_t Push( bool bValue );
         void Pop();
+
+        void Swap( BitArray& rArray );
+        //@}
+
+        /// @name Bulk Operations
+        //@{
+        void SetRange( size_t startIndex, size_t count, bool bValue = true );
+        void UnsetRange( size_t startIndex, size_t count );
+
+        template< typename OtherAllocator > void And( const BitArray< OtherAllocator >& rOther );
+        template< typename OtherAllocator > void Or( const BitArray< OtherAllocator >& rOther );
+        template< typename OtherAllocator > void Xor( const BitArray< OtherAllocator >& rOther );
+        template< typename OtherAllocator > void AndNot( const BitArray< OtherAllocator >& rOther );
+
+        size_t CountSetBits() const;
+
+        size_t FindFirstSet() const;
+        size_t FindNextSet( size_t index ) const;
+        size_t FindFirstUnset() const;
+        size_t FindNextUnset( size_t index ) const;
         //@}
 
         /// @name Overloaded Operators
@@ -220,9 +259,15 @@ namespace Helium
 
         ReferenceType operator[]( ptrdiff_t index );
         ConstReferenceType operator[]( ptrdiff_t index ) const;
+
+        template< typename OtherAllocator > BitArray& operator&=( const BitArray< OtherAllocator >& rOther );
+        template< typename OtherAllocator > BitArray& operator|=( const BitArray< OtherAllocator >& rOther );
+        template< typename OtherAllocator > BitArray& operator^=( const BitArray< OtherAllocator >& rOther );
         //@}
 
     private:
+        template< typename OtherAllocator > friend class BitArray;
+
         /// Bit array buffer.
         uint32_t* m_pBuffer;
         /// Used number of bits.
@@ -795,14 +795,7 @@ void Helium::BitArray< Allocator >::Add( bool bValue, size_t count )
     size_t newSize = m_size + count;
     Grow( newSize );
 
-    if( bValue )
-    {
-        SetBitRange( m_pBuffer, m_size, count );
-    }
-    else
-    {
-        ClearBitRange( m_pBuffer, m_size, count );
-    }
+    Fill( m_pBuffer, bValue, m_size, count );
 
     m_size = newSize;
 }
@@ -945,6 +938,177 @@ void Helium::BitArray< Allocator >::Pop()
     Resize( m_size - 1 );
 }
 
+/// Swap the contents of this array with another array.
+///
+/// @param[in] rArray  Array with which to swap.
+template< typename Allocator >
+void Helium::BitArray< Allocator >::Swap( BitArray& rArray )
+{
+    uint32_t* pBuffer = m_pBuffer;
+    size_t size = m_size;
+    size_t capacity = m_capacity;
+
+    m_pBuffer = rArray.m_pBuffer;
+    m_size = rArray.m_size;
+    m_capacity = rArray.m_capacity;
+
+    rArray.m_pBuffer = pBuffer;
+    rArray.m_size = size;
+    rArray.m_capacity = capacity;
+}
+
+/// Set a range of bits in this array to the specified value.
+///
+/// @param[in] startIndex  Index of the first bit to update.
+/// @param[in] count       Number of bits to update.
+/// @param[in] bValue      True to set the bits, false to unset them (default is to set the bits).
+///
+/// @see UnsetRange(), SetAll()
+template< typename Allocator >
+void Helium::BitArray< Allocator >::SetRange( size_t startIndex, size_t count, bool bValue )
+{
+    HELIUM_ASSERT( startIndex <= m_size );
+    HELIUM_ASSERT( count <= m_size - startIndex );
+
+    Fill( m_pBuffer, bValue, startIndex, count );
+}
+
+/// Unset a range of bits in this array.
+///
+/// @param[in] startIndex  Index of the first bit to unset.
+/// @param[in] count       Number of bits to unset.
+///
+/// @see SetRange(), UnsetAll()
+template< typename Allocator >
+void Helium::BitArray< Allocator >::UnsetRange( size_t startIndex, size_t count )
+{
+    HELIUM_ASSERT( startIndex <= m_size );
+    HELIUM_ASSERT( count <= m_size - startIndex );
+
+    Fill( m_pBuffer, false, startIndex, count );
+}
+
+/// Perform a bitwise AND of this array with another array of the same size.
+///
+/// @param[in] rOther  Array with which to combine.
+///
+/// @see Or(), Xor(), AndNot()
+template< typename Allocator >
+template< typename OtherAllocator >
+void Helium::BitArray< Allocator >::And( const BitArray< OtherAllocator >& rOther )
+{
+    HELIUM_ASSERT( rOther.m_size == m_size );
+
+    size_t elementCount = ( m_size + sizeof( uint32_t ) * 8 - 1 ) / ( sizeof( uint32_t ) * 8 );
+    BitArrayAnd( m_pBuffer, rOther.m_pBuffer, elementCount );
+}
+
+/// Perform a bitwise OR of this array with another array of the same size.
+///
+/// @param[in] rOther  Array with which to combine.
+///
+/// @see And(), Xor(), AndNot()
+template< typename Allocator >
+template< typename OtherAllocator >
+void Helium::BitArray< Allocator >::Or( const BitArray< OtherAllocator >& rOther )
+{
+    HELIUM_ASSERT( rOther.m_size == m_size );
+
+    size_t elementCount = ( m_size + sizeof( uint32_t ) * 8 - 1 ) / ( sizeof( uint32_t ) * 8 );
+    BitArrayOr( m_pBuffer, rOther.m_pBuffer, elementCount );
+}
+
+/// Perform a bitwise exclusive OR of this array with another array of the same size.
+///
+/// @param[in] rOther  Array with which to combine.
+///
+/// @see And(), Or(), AndNot()
+template< typename Allocator >
+template< typename OtherAllocator >
+void Helium::BitArray< Allocator >::Xor( const BitArray< OtherAllocator >& rOther )
+{
+    HELIUM_ASSERT( rOther.m_size == m_size );
+
+    size_t elementCount = ( m_size + sizeof( uint32_t ) * 8 - 1 ) / ( sizeof( uint32_t ) * 8 );
+    BitArrayXor( m_pBuffer, rOther.m_pBuffer, elementCount );
+}
+
+/// Unset each bit in this array that is set in another array of the same size.
+///
+/// @param[in] rOther  Array specifying the bits to unset.
+///
+/// @see And(), Or(), Xor()
+template< typename Allocator >
+template< typename OtherAllocator >
+void Helium::BitArray< Allocator >::AndNot( const BitArray< OtherAllocator >& rOther )
+{
+    HELIUM_ASSERT( rOther.m_size == m_size );
+
+    size_t elementCount = ( m_size + sizeof( uint32_t ) * 8 - 1 ) / ( sizeof( uint32_t ) * 8 );
+    BitArrayAndNot( m_pBuffer, rOther.m_pBuffer, elementCount );
+}
+
+/// Count the number of set bits in this array.
+///
+/// @return  Number of set bits.
+template< typename Allocator >
+size_t Helium::BitArray< Allocator >::CountSetBits() const
+{
+    return BitArrayCountSetBits( m_pBuffer, m_size );
+}
+
+/// Find the first set bit in this array.
+///
+/// @return  Index of the first set bit, or an invalid index if no bits are set.
+///
+/// @see FindNextSet(), FindFirstUnset()
+template< typename Allocator >
+size_t Helium::BitArray< Allocator >::FindFirstSet() const
+{
+    return BitArrayFindSet( m_pBuffer, m_size, 0 );
+}
+
+/// Find the next set bit in this array following a given bit.
+///
+/// @param[in] index  Index of the bit after which to begin searching.
+///
+/// @return  Index of the next set bit, or an invalid index if no following bits are set.
+///
+/// @see FindFirstSet(), FindNextUnset()
+template< typename Allocator >
+size_t Helium::BitArray< Allocator >::FindNextSet( size_t index ) const
+{
+    HELIUM_ASSERT( index < m_size );
+
+    return BitArrayFindSet( m_pBuffer, m_size, index + 1 );
+}
+
+/// Find the first unset bit in this array.
+///
+/// @return  Index of the first unset bit, or an invalid index if all bits are set.
+///
+/// @see FindNextUnset(), FindFirstSet()
+template< typename Allocator >
+size_t Helium::BitArray< Allocator >::FindFirstUnset() const
+{
+    return BitArrayFindUnset( m_pBuffer, m_size, 0 );
+}
+
+/// Find the next unset bit in this array following a given bit.
+///
+/// @param[in] index  Index of the bit after which to begin searching.
+///
+/// @return  Index of the next unset bit, or an invalid index if all following bits are set.
+///
+/// @see FindFirstUnset(), FindNextSet()
+template< typename Allocator >
+size_t Helium::BitArray< Allocator >::FindNextUnset( size_t index ) const
+{
+    HELIUM_ASSERT( index < m_size );
+
+    return BitArrayFindUnset( m_pBuffer, m_size, index + 1 );
+}
+
 /// Set this array to the contents of the given array.
 ///
 /// If the given array is not the same as this array, this will always destroy the current contents of this array and
@@ -997,6 +1161,54 @@ typename Helium::BitArray< Allocator >::ConstReferenceType Helium::BitArray< All
     return GetElement( static_cast< size_t >( index ) );
 }
 
+/// Perform a bitwise AND of this array with another array of the same size.
+///
+/// @param[in] rOther  Array with which to combine.
+///
+/// @return  Reference to this array.
+///
+/// @see And()
+template< typename Allocator >
+template< typename OtherAllocator >
+Helium::BitArray< Allocator >& Helium::BitArray< Allocator >::operator&=( const BitArray< OtherAllocator >& rOther )
+{
+    And( rOther );
+
+    return *this;
+}
+
+/// Perform a bitwise OR of this array with another array of the same size.
+///
+/// @param[in] rOther  Array with which to combine.
+///
+/// @return  Reference to this array.
+///
+/// @see Or()
+template< typename Allocator >
+template< typename OtherAllocator >
+Helium::BitArray< Allocator >& Helium::BitArray< Allocator >::operator|=( const BitArray< OtherAllocator >& rOther )
+{
+    Or( rOther );
+
+    return *this;
+}
+
+/// Perform a bitwise exclusive OR of this array with another array of the same size.
+///
+/// @param[in] rOther  Array with which to combine.
+///
+/// @return  Reference to this array.
+///
+/// @see Xor()
+template< typename Allocator >
+template< typename OtherAllocator >
+Helium::BitArray< Allocator >& Helium::BitArray< Allocator >::operator^=( const BitArray< OtherAllocator >& rOther )
+{
+    Xor( rOther );
+
+    return *this;
+}
+
 /// Get the capacity to which this array should grow if growing to support the desired number of bits.
 ///
 /// @param[in] desiredCount  Desired minimum capacity.
@@ -1058,3 +1270,56 @@ Helium::BitArray< Allocator >& Helium::BitArray< Allocator >::Assign( const BitA
 
     return *this;
 }
+
+/// Set a range of bits to the specified value.
+///
+/// Partial words at either end of the range are masked, while whole words within the range are filled directly.
+///
+/// @param[in] pDest       Bit array words.
+/// @param[in] bValue      True to set the bits, false to unset them.
+/// @param[in] startIndex  Index of the first bit to update.
+/// @param[in] count       Number of bits to update.
+template< typename Allocator >
+void Helium::BitArray< Allocator >::Fill( uint32_t* pDest, bool bValue, size_t startIndex, size_t count )
+{
+    if( count == 0 )
+    {
+        return;
+    }
+
+    HELIUM_ASSERT( pDest );
+
+    const size_t elementBitCount = sizeof( uint32_t ) * 8;
+
+    size_t elementIndex = startIndex / elementBitCount;
+    size_t endIndex = startIndex + count;
+    size_t endElementIndex = endIndex / elementBitCount;
+
+    uint32_t startMask = ~static_cast< uint32_t >( 0 ) << ( startIndex % elementBitCount );
+    uint32_t endMask = ( static_cast< uint32_t >( 1 ) << ( endIndex % elementBitCount ) ) - 1;
+
+    if( elementIndex == endElementIndex )
+    {
+        // The range lies within a single element.
+        uint32_t mask = startMask & endMask;
+        uint32_t element = pDest[ elementIndex ];
+        pDest[ elementIndex ] = ( bValue ? element | mask : element & ~mask );
+
+        return;
+    }
+
+    if( startMask != ~static_cast< uint32_t >( 0 ) )
+    {
+        uint32_t element = pDest[ elementIndex ];
+        pDest[ elementIndex ] = ( bValue ? element | startMask : element & ~startMask );
+        ++elementIndex;
+    }
+
+    MemorySet( pDest + elementIndex, ( bValue ? 0xff : 0 ), ( endElementIndex - elementIndex ) * sizeof( uint32_t ) );
+
+    if( endMask != 0 )
+    {
+        uint32_t element = pDest[ endElementIndex ];
+        pDest[ endElementIndex ] = ( bValue ? element | endMask : element & ~endMask );
+    }
+}
@@ -0,0 +1,1533 @@
+#include "FoundationPch.h"
+#include "Foundation/CompressedBitmap.h"
+
+#include "Foundation/BitArray.h"
+#include "Foundation/Endian.h"
+#include "Foundation/Math.h"
+
+using namespace Helium;
+
+/// Number of 32-bit words in a bitmap container.
+static const size_t BITMAP_WORD_COUNT = CompressedBitmap::CONTAINER_VALUE_COUNT / 32;
+/// Largest valid container key (values are 64-bit, and the low 16 bits index into the container).
+static const uint64_t MAX_CONTAINER_KEY = UINT64_C( 0xffffffffffff );
+
+/// Find the first element in a sorted array of values that is not less than a given value.
+///
+/// @param[in] pValues  Sorted values.
+/// @param[in] count    Number of values.
+/// @param[in] value    Value to locate.
+///
+/// @return  Index of the first element not less than the given value, or the value count if all elements are less.
+static size_t LowerBound( const uint16_t* pValues, size_t count, uint32_t value )
+{
+    size_t low = 0;
+    size_t high = count;
+    while( low < high )
+    {
+        size_t middle = low + ( high - low ) / 2;
+        if( pValues[ middle ] < value )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/// Find the run that may contain a given value in a run container.
+///
+/// @param[in] pRuns     Sorted pairs of run starts and lengths minus one.
+/// @param[in] runCount  Number of runs.
+/// @param[in] value     Value to locate.
+///
+/// @return  Index of the last run starting at or before the given value, or an invalid index if no such run exists.
+static size_t FindRun( const uint16_t* pRuns, size_t runCount, uint32_t value )
+{
+    size_t low = 0;
+    size_t high = runCount;
+    while( low < high )
+    {
+        size_t middle = low + ( high - low ) / 2;
+        if( pRuns[ middle * 2 ] <= value )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low - 1;
+}
+
+/// Set a range of bits in a bitmap container.
+///
+/// @param[in] pWords      Bitmap words.
+/// @param[in] firstIndex  Index of the first bit to set.
+/// @param[in] lastIndex   Index of the last bit to set (inclusive).
+static void SetBitmapRange( uint32_t* pWords, uint32_t firstIndex, uint32_t lastIndex )
+{
+    HELIUM_ASSERT( firstIndex <= lastIndex );
+
+    size_t firstWord = firstIndex / 32;
+    size_t lastWord = lastIndex / 32;
+    uint32_t firstMask = ~0U << ( firstIndex % 32 );
+    uint32_t lastMask = ~0U >> ( 31 - lastIndex % 32 );
+    if( firstWord == lastWord )
+    {
+        pWords[ firstWord ] |= firstMask & lastMask;
+
+        return;
+    }
+
+    pWords[ firstWord ] |= firstMask;
+    for( size_t wordIndex = firstWord + 1; wordIndex < lastWord; ++wordIndex )
+    {
+        pWords[ wordIndex ] = ~0U;
+    }
+
+    pWords[ lastWord ] |= lastMask;
+}
+
+/// Write an array of integers to a stream in little-endian byte order.
+///
+/// @param[in] rStream  Stream to which the values should be written.
+/// @param[in] pValues  Values to write.
+/// @param[in] count    Number of values to write.
+///
+/// @return  True if all values were written successfully, false if not.
+template< typename T >
+static bool WriteLittleEndian( Stream& rStream, const T* pValues, size_t count )
+{
+    if( PlatformByteOrder == ByteOrders::LittleEndian )
+    {
+        return ( rStream.Write( pValues, sizeof( T ), count ) == count );
+    }
+
+    T buffer[ 256 ];
+    while( count != 0 )
+    {
+        size_t blockCount = Min( count, HELIUM_ARRAY_COUNT( buffer ) );
+        for( size_t valueIndex = 0; valueIndex < blockCount; ++valueIndex )
+        {
+            buffer[ valueIndex ] = ConvertEndian( pValues[ valueIndex ] );
+        }
+
+        if( rStream.Write( buffer, sizeof( T ), blockCount ) != blockCount )
+        {
+            return false;
+        }
+
+        pValues += blockCount;
+        count -= blockCount;
+    }
+
+    return true;
+}
+
+/// Read an array of little-endian integers from a stream.
+///
+/// @param[in]  rStream  Stream from which the values should be read.
+/// @param[out] pValues  Values read from the stream.
+/// @param[in]  count    Number of values to read.
+///
+/// @return  True if all values were read successfully, false if not.
+template< typename T >
+static bool ReadLittleEndian( Stream& rStream, T* pValues, size_t count )
+{
+    if( rStream.Read( pValues, sizeof( T ), count ) != count )
+    {
+        return false;
+    }
+
+    if( PlatformByteOrder != ByteOrders::LittleEndian )
+    {
+        for( size_t valueIndex = 0; valueIndex < count; ++valueIndex )
+        {
+            pValues[ valueIndex ] = ConvertEndian( pValues[ valueIndex ] );
+        }
+    }
+
+    return true;
+}
+
+/// Constructor.
+///
+/// Creates an empty bitmap.
+CompressedBitmap::CompressedBitmap()
+{
+}
+
+/// Copy constructor.
+///
+/// @param[in] rSource  Bitmap from which to copy.
+CompressedBitmap::CompressedBitmap( const CompressedBitmap& rSource )
+    : m_containers( rSource.m_containers )
+{
+}
+
+/// Destructor.
+CompressedBitmap::~CompressedBitmap()
+{
+}
+
+/// Get the number of values in this bitmap.
+///
+/// @return  Value count.
+///
+/// @see IsEmpty()
+uint64_t CompressedBitmap::GetSize() const
+{
+    uint64_t size = 0;
+
+    size_t containerCount = m_containers.GetSize();
+    for( size_t containerIndex = 0; containerIndex < containerCount; ++containerIndex )
+    {
+        size += m_containers[ containerIndex ].cardinality;
+    }
+
+    return size;
+}
+
+/// Remove all values from this bitmap and free all allocated memory.
+void CompressedBitmap::Clear()
+{
+    m_containers.Clear();
+}
+
+/// Get whether this bitmap contains a given value.
+///
+/// @param[in] value  Value to locate.
+///
+/// @return  True if the value is in this bitmap, false if not.
+bool CompressedBitmap::Contains( uint64_t value ) const
+{
+    uint64_t key = value >> 16;
+    size_t containerIndex = FindContainer( key );
+
+    return ( containerIndex < m_containers.GetSize() &&
+             m_containers[ containerIndex ].key == key &&
+             m_containers[ containerIndex ].Contains( static_cast< uint32_t >( value & 0xffff ) ) );
+}
+
+/// Add a value to this bitmap.
+///
+/// @param[in] value  Value to add.
+///
+/// @return  True if the value was added, false if it was already in this bitmap.
+///
+/// @see AddRange(), Remove()
+bool CompressedBitmap::Add( uint64_t value )
+{
+    uint64_t key = value >> 16;
+    uint32_t lowValue = static_cast< uint32_t >( value & 0xffff );
+
+    size_t containerIndex = FindContainer( key );
+    if( containerIndex < m_containers.GetSize() && m_containers[ containerIndex ].key == key )
+    {
+        return m_containers[ containerIndex ].Add( lowValue );
+    }
+
+    Container container;
+    container.key = key;
+    container.type = CONTAINER_ARRAY;
+    container.cardinality = 1;
+    container.values.Add( static_cast< uint16_t >( lowValue ) );
+    m_containers.Insert( containerIndex, std::move( container ) );
+
+    return true;
+}
+
+/// Add a range of consecutive values to this bitmap.
+///
+/// Chunks that are not yet in this bitmap are stored as run containers.
+///
+/// @param[in] firstValue  First value to add.
+/// @param[in] count       Number of consecutive values to add.
+///
+/// @see Add()
+void CompressedBitmap::AddRange( uint64_t firstValue, uint64_t count )
+{
+    if( count == 0 )
+    {
+        return;
+    }
+
+    uint64_t lastValue = firstValue + ( count - 1 );
+    HELIUM_ASSERT( lastValue >= firstValue );
+
+    uint64_t firstKey = firstValue >> 16;
+    uint64_t lastKey = lastValue >> 16;
+
+    size_t containerIndex = FindContainer( firstKey );
+    for( uint64_t key = firstKey; ; ++key, ++containerIndex )
+    {
+        uint32_t firstLowValue = ( key == firstKey ? static_cast< uint32_t >( firstValue & 0xffff ) : 0 );
+        uint32_t lastLowValue = ( key == lastKey ? static_cast< uint32_t >( lastValue & 0xffff ) : 0xffff );
+
+        if( containerIndex < m_containers.GetSize() && m_containers[ containerIndex ].key == key )
+        {
+            m_containers[ containerIndex ].AddRange( firstLowValue, lastLowValue );
+        }
+        else
+        {
+            Container container;
+            container.key = key;
+            container.type = CONTAINER_RUN;
+            container.cardinality = lastLowValue - firstLowValue + 1;
+            container.values.Add( static_cast< uint16_t >( firstLowValue ) );
+            container.values.Add( static_cast< uint16_t >( lastLowValue - firstLowValue ) );
+            m_containers.Insert( containerIndex, std::move( container ) );
+        }
+
+        if( key == lastKey )
+        {
+            break;
+        }
+    }
+}
+
+/// Remove a value from this bitmap.
+///
+/// @param[in] value  Value to remove.
+///
+/// @return  True if the value was removed, false if it was not in this bitmap.
+///
+/// @see Add()
+bool CompressedBitmap::Remove( uint64_t value )
+{
+    uint64_t key = value >> 16;
+
+    size_t containerIndex = FindContainer( key );
+    if( containerIndex >= m_containers.GetSize() || m_containers[ containerIndex ].key != key )
+    {
+        return false;
+    }
+
+    Container& rContainer = m_containers[ containerIndex ];
+    if( !rContainer.Remove( static_cast< uint32_t >( value & 0xffff ) ) )
+    {
+        return false;
+    }
+
+    if( rContainer.cardinality == 0 )
+    {
+        m_containers.Remove( containerIndex );
+    }
+
+    return true;
+}
+
+/// Add all values in another bitmap to this bitmap (set union).
+///
+/// @param[in] rOther  Bitmap to merge with this bitmap.
+///
+/// @see And(), AndNot()
+void CompressedBitmap::Or( const CompressedBitmap& rOther )
+{
+    if( &rOther == this )
+    {
+        return;
+    }
+
+    size_t containerCount = m_containers.GetSize();
+    size_t otherContainerCount = rOther.m_containers.GetSize();
+
+    DynamicArray< Container > containers;
+    containers.Reserve( containerCount + otherContainerCount );
+
+    size_t containerIndex = 0;
+    size_t otherContainerIndex = 0;
+    while( containerIndex < containerCount && otherContainerIndex < otherContainerCount )
+    {
+        Container& rContainer = m_containers[ containerIndex ];
+        const Container& rOtherContainer = rOther.m_containers[ otherContainerIndex ];
+        if( rContainer.key < rOtherContainer.key )
+        {
+            containers.Add( std::move( rContainer ) );
+            ++containerIndex;
+        }
+        else if( rOtherContainer.key < rContainer.key )
+        {
+            containers.Add( rOtherContainer );
+            ++otherContainerIndex;
+        }
+        else
+        {
+            OrContainers( rContainer, rOtherContainer );
+            containers.Add( std::move( rContainer ) );
+            ++containerIndex;
+            ++otherContainerIndex;
+        }
+    }
+
+    for( ; containerIndex < containerCount; ++containerIndex )
+    {
+        containers.Add( std::move( m_containers[ containerIndex ] ) );
+    }
+
+    for( ; otherContainerIndex < otherContainerCount; ++otherContainerIndex )
+    {
+        containers.Add( rOther.m_containers[ otherContainerIndex ] );
+    }
+
+    m_containers.Swap( containers );
+}
+
+/// Remove all values not in another bitmap from this bitmap (set intersection).
+///
+/// @param[in] rOther  Bitmap to intersect with this bitmap.
+///
+/// @see Or(), AndNot()
+void CompressedBitmap::And( const CompressedBitmap& rOther )
+{
+    if( &rOther == this )
+    {
+        return;
+    }
+
+    size_t containerCount = m_containers.GetSize();
+    size_t otherContainerCount = rOther.m_containers.GetSize();
+
+    size_t keptContainerCount = 0;
+    size_t containerIndex = 0;
+    size_t otherContainerIndex = 0;
+    while( containerIndex < containerCount && otherContainerIndex < otherContainerCount )
+    {
+        Container& rContainer = m_containers[ containerIndex ];
+        const Container& rOtherContainer = rOther.m_containers[ otherContainerIndex ];
+        if( rContainer.key < rOtherContainer.key )
+        {
+            ++containerIndex;
+        }
+        else if( rOtherContainer.key < rContainer.key )
+        {
+            ++otherContainerIndex;
+        }
+        else
+        {
+            AndContainers( rContainer, rOtherContainer );
+            if( rContainer.cardinality != 0 )
+            {
+                if( keptContainerCount != containerIndex )
+                {
+                    m_containers[ keptContainerCount ] = std::move( rContainer );
+                }
+
+                ++keptContainerCount;
+            }
+
+            ++containerIndex;
+            ++otherContainerIndex;
+        }
+    }
+
+    m_containers.Resize( keptContainerCount );
+}
+
+/// Remove all values in another bitmap from this bitmap (set difference).
+///
+/// @param[in] rOther  Bitmap containing the values to remove.
+///
+/// @see Or(), And()
+void CompressedBitmap::AndNot( const CompressedBitmap& rOther )
+{
+    if( &rOther == this )
+    {
+        Clear();
+
+        return;
+    }
+
+    size_t containerCount = m_containers.GetSize();
+    size_t otherContainerCount = rOther.m_containers.GetSize();
+
+    size_t keptContainerCount = 0;
+    size_t otherContainerIndex = 0;
+    for( size_t containerIndex = 0; containerIndex < containerCount; ++containerIndex )
+    {
+        Container& rContainer = m_containers[ containerIndex ];
+        while( otherContainerIndex < otherContainerCount &&
+               rOther.m_containers[ otherContainerIndex ].key < rContainer.key )
+        {
+            ++otherContainerIndex;
+        }
+
+        if( otherContainerIndex < otherContainerCount &&
+            rOther.m_containers[ otherContainerIndex ].key == rContainer.key )
+        {
+            AndNotContainers( rContainer, rOther.m_containers[ otherContainerIndex ] );
+            if( rContainer.cardinality == 0 )
+            {
+                continue;
+            }
+        }
+
+        if( keptContainerCount != containerIndex )
+        {
+            m_containers[ keptContainerCount ] = std::move( rContainer );
+        }
+
+        ++keptContainerCount;
+    }
+
+    m_containers.Resize( keptContainerCount );
+}
+
+/// Convert each container to its most compact representation and release unused memory.
+///
+/// Chunks made up of long runs of consecutive values are converted to run containers, and run containers that are no
+/// longer the most compact representation of their chunk are converted back to array or bitmap containers.
+void CompressedBitmap::Optimize()
+{
+    size_t containerCount = m_containers.GetSize();
+    for( size_t containerIndex = 0; containerIndex < containerCount; ++containerIndex )
+    {
+        m_containers[ containerIndex ].Optimize();
+    }
+
+    m_containers.Trim();
+}
+
+/// Get the amount of memory used by this bitmap.
+///
+/// @return  Size of this bitmap and all memory it has allocated, in bytes.
+size_t CompressedBitmap::GetMemorySize() const
+{
+    size_t memorySize = sizeof( *this ) + m_containers.GetCapacity() * sizeof( Container );
+
+    size_t containerCount = m_containers.GetSize();
+    for( size_t containerIndex = 0; containerIndex < containerCount; ++containerIndex )
+    {
+        const Container& rContainer = m_containers[ containerIndex ];
+        memorySize += rContainer.values.GetCapacity() * sizeof( uint16_t );
+        memorySize += rContainer.bits.GetCapacity() * sizeof( uint32_t );
+    }
+
+    return memorySize;
+}
+
+/// Swap the contents of this bitmap with another bitmap.
+///
+/// @param[in] rBitmap  Bitmap with which to swap.
+void CompressedBitmap::Swap( CompressedBitmap& rBitmap )
+{
+    m_containers.Swap( rBitmap.m_containers );
+}
+
+/// Write this bitmap to a stream.
+///
+/// All values are written in little-endian byte order, so serialized bitmaps can be shared between platforms.
+///
+/// @param[in] rStream  Stream to which the bitmap should be written.
+///
+/// @return  True if the bitmap was written successfully, false if not.
+///
+/// @see Deserialize()
+bool CompressedBitmap::Serialize( Stream& rStream ) const
+{
+    uint32_t header[ 2 ] = { SERIALIZED_SIGNATURE, SERIALIZED_VERSION };
+    uint64_t containerCount = m_containers.GetSize();
+
+    bool bSuccess = WriteLittleEndian( rStream, header, HELIUM_ARRAY_COUNT( header ) );
+    bSuccess = bSuccess && WriteLittleEndian( rStream, &containerCount, 1 );
+
+    for( size_t containerIndex = 0; bSuccess && containerIndex < m_containers.GetSize(); ++containerIndex )
+    {
+        bSuccess = m_containers[ containerIndex ].Serialize( rStream );
+    }
+
+    return bSuccess;
+}
+
+/// Replace the contents of this bitmap with a bitmap read from a stream.
+///
+/// The serialized data is fully validated.  If it cannot be read or is malformed, this bitmap is left empty.
+///
+/// @param[in] rStream  Stream from which the bitmap should be read.
+///
+/// @return  True if the bitmap was read successfully, false if not.
+///
+/// @see Serialize()
+bool CompressedBitmap::Deserialize( Stream& rStream )
+{
+    Clear();
+
+    uint32_t header[ 2 ];
+    uint64_t containerCount;
+    if( !ReadLittleEndian( rStream, header, HELIUM_ARRAY_COUNT( header ) ) ||
+        header[ 0 ] != SERIALIZED_SIGNATURE ||
+        header[ 1 ] != SERIALIZED_VERSION ||
+        !ReadLittleEndian( rStream, &containerCount, 1 ) ||
+        containerCount > MAX_CONTAINER_KEY + 1 )
+    {
+        return false;
+    }
+
+    for( uint64_t containerIndex = 0; containerIndex < containerCount; ++containerIndex )
+    {
+        Container container;
+        if( !container.Deserialize( rStream ) ||
+            ( !m_containers.IsEmpty() && container.key <= m_containers.GetLast().key ) )
+        {
+            Clear();
+
+            return false;
+        }
+
+        m_containers.Add( std::move( container ) );
+    }
+
+    return true;
+}
+
+/// Assignment operator.
+///
+/// @param[in] rSource  Bitmap from which to copy.
+///
+/// @return  Reference to this bitmap.
+CompressedBitmap& CompressedBitmap::operator=( const CompressedBitmap& rSource )
+{
+    if( this != &rSource )
+    {
+        m_containers = rSource.m_containers;
+    }
+
+    return *this;
+}
+
+/// Find the container for a given key.
+///
+/// @param[in] key  Container key to locate.
+///
+/// @return  Index of the container with the given key if it exists, or the index at which it should be inserted if
+///          it does not.
+size_t CompressedBitmap::FindContainer( uint64_t key ) const
+{
+    size_t low = 0;
+    size_t high = m_containers.GetSize();
+    while( low < high )
+    {
+        size_t middle = low + ( high - low ) / 2;
+        if( m_containers[ middle ].key < key )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/// Add all values in one container to another container with the same key.
+///
+/// @param[in,out] rDest    Container to which values should be added.
+/// @param[in]     rSource  Container with the values to add.
+void CompressedBitmap::OrContainers( Container& rDest, const Container& rSource )
+{
+    HELIUM_ASSERT( rDest.key == rSource.key );
+
+    if( rSource.type == CONTAINER_RUN )
+    {
+        Container source( rSource );
+        source.Expand();
+        OrContainers( rDest, source );
+
+        return;
+    }
+
+    if( rDest.type == CONTAINER_RUN )
+    {
+        rDest.Expand();
+    }
+
+    const uint16_t* pSourceValues = rSource.values.GetData();
+    size_t sourceCount = rSource.values.GetSize();
+
+    if( rDest.type == CONTAINER_ARRAY && rSource.type == CONTAINER_ARRAY )
+    {
+        const uint16_t* pDestValues = rDest.values.GetData();
+        size_t destCount = rDest.values.GetSize();
+
+        DynamicArray< uint16_t > values;
+        values.Reserve( destCount + sourceCount );
+
+        size_t destIndex = 0;
+        size_t sourceIndex = 0;
+        while( destIndex < destCount && sourceIndex < sourceCount )
+        {
+            uint16_t destValue = pDestValues[ destIndex ];
+            uint16_t sourceValue = pSourceValues[ sourceIndex ];
+            values.Add( Min( destValue, sourceValue ) );
+            destIndex += ( destValue <= sourceValue );
+            sourceIndex += ( sourceValue <= destValue );
+        }
+
+        values.AddArray( pDestValues + destIndex, destCount - destIndex );
+        values.AddArray( pSourceValues + sourceIndex, sourceCount - sourceIndex );
+
+        rDest.values.Swap( values );
+        rDest.cardinality = static_cast< uint32_t >( rDest.values.GetSize() );
+        rDest.Normalize();
+
+        return;
+    }
+
+    if( rDest.type == CONTAINER_ARRAY )
+    {
+        rDest.ConvertToBitmap();
+    }
+
+    uint32_t* pDestWords = rDest.bits.GetData();
+    if( rSource.type == CONTAINER_BITMAP )
+    {
+        BitArrayOr( pDestWords, rSource.bits.GetData(), BITMAP_WORD_COUNT );
+        rDest.cardinality = static_cast< uint32_t >( BitArrayCountSetBits( pDestWords, CONTAINER_VALUE_COUNT ) );
+    }
+    else
+    {
+        for( size_t sourceIndex = 0; sourceIndex < sourceCount; ++sourceIndex )
+        {
+            uint16_t value = pSourceValues[ sourceIndex ];
+            uint32_t& rWord = pDestWords[ value / 32 ];
+            uint32_t mask = 1U << ( value % 32 );
+            rDest.cardinality += ( ( rWord & mask ) == 0 );
+            rWord |= mask;
+        }
+    }
+
+    rDest.Normalize();
+}
+
+/// Remove all values not in one container from another container with the same key.
+///
+/// @param[in,out] rDest    Container from which values should be removed.
+/// @param[in]     rSource  Container with the values to keep.
+void CompressedBitmap::AndContainers( Container& rDest, const Container& rSource )
+{
+    HELIUM_ASSERT( rDest.key == rSource.key );
+
+    if( rSource.type == CONTAINER_RUN )
+    {
+        Container source( rSource );
+        source.Expand();
+        AndContainers( rDest, source );
+
+        return;
+    }
+
+    if( rDest.type == CONTAINER_RUN )
+    {
+        rDest.Expand();
+    }
+
+    const uint16_t* pSourceValues = rSource.values.GetData();
+    size_t sourceCount = rSource.values.GetSize();
+
+    if( rDest.type == CONTAINER_ARRAY )
+    {
+        uint16_t* pDestValues = rDest.values.GetData();
+        size_t destCount = rDest.values.GetSize();
+
+        size_t keptCount = 0;
+        if( rSource.type == CONTAINER_ARRAY )
+        {
+            size_t destIndex = 0;
+            size_t sourceIndex = 0;
+            while( destIndex < destCount && sourceIndex < sourceCount )
+            {
+                uint16_t destValue = pDestValues[ destIndex ];
+                uint16_t sourceValue = pSourceValues[ sourceIndex ];
+                if( destValue == sourceValue )
+                {
+                    pDestValues[ keptCount++ ] = destValue;
+                }
+
+                destIndex += ( destValue <= sourceValue );
+                sourceIndex += ( sourceValue <= destValue );
+            }
+        }
+        else
+        {
+            const uint32_t* pSourceWords = rSource.bits.GetData();
+            for( size_t destIndex = 0; destIndex < destCount; ++destIndex )
+            {
+                uint16_t value = pDestValues[ destIndex ];
+                pDestValues[ keptCount ] = value;
+                keptCount += ( ( pSourceWords[ value / 32 ] >> ( value % 32 ) ) & 1 );
+            }
+        }
+
+        rDest.values.Resize( keptCount );
+        rDest.cardinality = static_cast< uint32_t >( keptCount );
+
+        return;
+    }
+
+    uint32_t* pDestWords = rDest.bits.GetData();
+    if( rSource.type == CONTAINER_BITMAP )
+    {
+        BitArrayAnd( pDestWords, rSource.bits.GetData(), BITMAP_WORD_COUNT );
+        rDest.cardinality = static_cast< uint32_t >( BitArrayCountSetBits( pDestWords, CONTAINER_VALUE_COUNT ) );
+        rDest.Normalize();
+
+        return;
+    }
+
+    // The intersection of a bitmap and an array is never larger than the array.
+    DynamicArray< uint16_t > values;
+    values.Reserve( sourceCount );
+    for( size_t sourceIndex = 0; sourceIndex < sourceCount; ++sourceIndex )
+    {
+        uint16_t value = pSourceValues[ sourceIndex ];
+        if( ( pDestWords[ value / 32 ] >> ( value % 32 ) ) & 1 )
+        {
+            values.Add( value );
+        }
+    }
+
+    rDest.type = CONTAINER_ARRAY;
+    rDest.cardinality = static_cast< uint32_t >( values.GetSize() );
+    rDest.values.Swap( values );
+    rDest.bits.Clear();
+}
+
+/// Remove all values in one container from another container with the same key.
+///
+/// @param[in,out] rDest    Container from which values should be removed.
+/// @param[in]     rSource  Container with the values to remove.
+void CompressedBitmap::AndNotContainers( Container& rDest, const Container& rSource )
+{
+    HELIUM_ASSERT( rDest.key == rSource.key );
+
+    if( rSource.type == CONTAINER_RUN )
+    {
+        Container source( rSource );
+        source.Expand();
+        AndNotContainers( rDest, source );
+
+        return;
+    }
+
+    if( rDest.type == CONTAINER_RUN )
+    {
+        rDest.Expand();
+    }
+
+    const uint16_t* pSourceValues = rSource.values.GetData();
+    size_t sourceCount = rSource.values.GetSize();
+
+    if( rDest.type == CONTAINER_ARRAY )
+    {
+        uint16_t* pDestValues = rDest.values.GetData();
+        size_t destCount = rDest.values.GetSize();
+
+        size_t keptCount = 0;
+        if( rSource.type == CONTAINER_ARRAY )
+        {
+            size_t sourceIndex = 0;
+            for( size_t destIndex = 0; destIndex < destCount; ++destIndex )
+            {
+                uint16_t value = pDestValues[ destIndex ];
+                while( sourceIndex < sourceCount && pSourceValues[ sourceIndex ] < value )
+                {
+                    ++sourceIndex;
+                }
+
+                if( sourceIndex >= sourceCount || pSourceValues[ sourceIndex ] != value )
+                {
+                    pDestValues[ keptCount++ ] = value;
+                }
+            }
+        }
+        else
+        {
+            const uint32_t* pSourceWords = rSource.bits.GetData();
+            for( size_t destIndex = 0; destIndex < destCount; ++destIndex )
+            {
+                uint16_t value = pDestValues[ destIndex ];
+                pDestValues[ keptCount ] = value;
+                keptCount += ( ( ~pSourceWords[ value / 32 ] >> ( value % 32 ) ) & 1 );
+            }
+        }
+
+        rDest.values.Resize( keptCount );
+        rDest.cardinality = static_cast< uint32_t >( keptCount );
+
+        return;
+    }
+
+    uint32_t* pDestWords = rDest.bits.GetData();
+    if( rSource.type == CONTAINER_BITMAP )
+    {
+        BitArrayAndNot( pDestWords, rSource.bits.GetData(), BITMAP_WORD_COUNT );
+        rDest.cardinality = static_cast< uint32_t >( BitArrayCountSetBits( pDestWords, CONTAINER_VALUE_COUNT ) );
+    }
+    else
+    {
+        for( size_t sourceIndex = 0; sourceIndex < sourceCount; ++sourceIndex )
+        {
+            uint16_t value = pSourceValues[ sourceIndex ];
+            uint32_t& rWord = pDestWords[ value / 32 ];
+            uint32_t mask = 1U << ( value % 32 );
+            rDest.cardinality -= ( ( rWord & mask ) != 0 );
+            rWord &= ~mask;
+        }
+    }
+
+    rDest.Normalize();
+}
+
+/// Get whether this container contains a given value.
+///
+/// @param[in] value  Low 16 bits of the value to locate.
+///
+/// @return  True if the value is in this container, false if not.
+bool CompressedBitmap::Container::Contains( uint32_t value ) const
+{
+    HELIUM_ASSERT( value < CONTAINER_VALUE_COUNT );
+
+    const uint16_t* pValues = values.GetData();
+    if( type == CONTAINER_ARRAY )
+    {
+        size_t count = values.GetSize();
+        size_t index = LowerBound( pValues, count, value );
+
+        return ( index < count && pValues[ index ] == value );
+    }
+
+    if( type == CONTAINER_BITMAP )
+    {
+        return ( ( bits[ value / 32 ] >> ( value % 32 ) ) & 1 ) != 0;
+    }
+
+    size_t runIndex = FindRun( pValues, values.GetSize() / 2, value );
+
+    return ( IsValid( runIndex ) && value - pValues[ runIndex * 2 ] <= pValues[ runIndex * 2 + 1 ] );
+}
+
+/// Add a value to this container.
+///
+/// Run containers are expanded to array or bitmap containers first.
+///
+/// @param[in] value  Low 16 bits of the value to add.
+///
+/// @return  True if the value was added, false if it was already in this container.
+bool CompressedBitmap::Container::Add( uint32_t value )
+{
+    HELIUM_ASSERT( value < CONTAINER_VALUE_COUNT );
+
+    if( type == CONTAINER_RUN )
+    {
+        if( Contains( value ) )
+        {
+            return false;
+        }
+
+        Expand();
+    }
+
+    if( type == CONTAINER_ARRAY )
+    {
+        size_t count = values.GetSize();
+        size_t index = LowerBound( values.GetData(), count, value );
+        if( index < count && values[ index ] == value )
+        {
+            return false;
+        }
+
+        if( count < MAX_ARRAY_VALUE_COUNT )
+        {
+            values.Insert( index, static_cast< uint16_t >( value ) );
+            ++cardinality;
+
+            return true;
+        }
+
+        ConvertToBitmap();
+    }
+
+    uint32_t& rWord = bits[ value / 32 ];
+    uint32_t mask = 1U << ( value % 32 );
+    if( rWord & mask )
+    {
+        return false;
+    }
+
+    rWord |= mask;
+    ++cardinality;
+
+    return true;
+}
+
+/// Remove a value from this container.
+///
+/// Run containers are expanded to array or bitmap containers first.
+///
+/// @param[in] value  Low 16 bits of the value to remove.
+///
+/// @return  True if the value was removed, false if it was not in this container.
+bool CompressedBitmap::Container::Remove( uint32_t value )
+{
+    HELIUM_ASSERT( value < CONTAINER_VALUE_COUNT );
+
+    if( type == CONTAINER_RUN )
+    {
+        if( !Contains( value ) )
+        {
+            return false;
+        }
+
+        Expand();
+    }
+
+    if( type == CONTAINER_ARRAY )
+    {
+        size_t count = values.GetSize();
+        size_t index = LowerBound( values.GetData(), count, value );
+        if( index >= count || values[ index ] != value )
+        {
+            return false;
+        }
+
+        values.Remove( index );
+        --cardinality;
+
+        return true;
+    }
+
+    uint32_t& rWord = bits[ value / 32 ];
+    uint32_t mask = 1U << ( value % 32 );
+    if( !( rWord & mask ) )
+    {
+        return false;
+    }
+
+    rWord &= ~mask;
+    --cardinality;
+    Normalize();
+
+    return true;
+}
+
+/// Add a range of consecutive values to this container.
+///
+/// @param[in] firstValue  Low 16 bits of the first value to add.
+/// @param[in] lastValue   Low 16 bits of the last value to add (inclusive).
+void CompressedBitmap::Container::AddRange( uint32_t firstValue, uint32_t lastValue )
+{
+    HELIUM_ASSERT( firstValue <= lastValue );
+    HELIUM_ASSERT( lastValue < CONTAINER_VALUE_COUNT );
+
+    if( firstValue == 0 && lastValue == CONTAINER_VALUE_COUNT - 1 )
+    {
+        // The range covers the entire chunk, which is stored most compactly as a single run.
+        values.Clear();
+        bits.Clear();
+        values.Add( static_cast< uint16_t >( 0 ) );
+        values.Add( static_cast< uint16_t >( lastValue ) );
+        type = CONTAINER_RUN;
+        cardinality = CONTAINER_VALUE_COUNT;
+
+        return;
+    }
+
+    if( type == CONTAINER_RUN )
+    {
+        Expand();
+    }
+
+    uint32_t rangeCount = lastValue - firstValue + 1;
+    if( type == CONTAINER_ARRAY )
+    {
+        if( cardinality + rangeCount <= MAX_ARRAY_VALUE_COUNT )
+        {
+            const uint16_t* pValues = values.GetData();
+            size_t count = values.GetSize();
+            size_t firstIndex = LowerBound( pValues, count, firstValue );
+            size_t lastIndex = LowerBound( pValues, count, lastValue + 1 );
+
+            DynamicArray< uint16_t > mergedValues;
+            mergedValues.Reserve( count - ( lastIndex - firstIndex ) + rangeCount );
+            mergedValues.AddArray( pValues, firstIndex );
+            for( uint32_t value = firstValue; value <= lastValue; ++value )
+            {
+                mergedValues.Add( static_cast< uint16_t >( value ) );
+            }
+
+            mergedValues.AddArray( pValues + lastIndex, count - lastIndex );
+
+            values.Swap( mergedValues );
+            cardinality = static_cast< uint32_t >( values.GetSize() );
+
+            return;
+        }
+
+        ConvertToBitmap();
+    }
+
+    SetBitmapRange( bits.GetData(), firstValue, lastValue );
+    cardinality = static_cast< uint32_t >( BitArrayCountSetBits( bits.GetData(), CONTAINER_VALUE_COUNT ) );
+    Normalize();
+}
+
+/// Convert this container to an array container.
+///
+/// @see ConvertToBitmap(), ConvertToRun()
+void CompressedBitmap::Container::ConvertToArray()
+{
+    HELIUM_ASSERT( cardinality <= MAX_ARRAY_VALUE_COUNT );
+
+    if( type == CONTAINER_ARRAY )
+    {
+        return;
+    }
+
+    DynamicArray< uint16_t > arrayValues;
+    arrayValues.Reserve( cardinality );
+
+    if( type == CONTAINER_BITMAP )
+    {
+        const uint32_t* pWords = bits.GetData();
+        for( size_t wordIndex = 0; wordIndex < BITMAP_WORD_COUNT; ++wordIndex )
+        {
+            for( uint32_t word = pWords[ wordIndex ]; word != 0; word &= word - 1 )
+            {
+                arrayValues.Add( static_cast< uint16_t >( wordIndex * 32 + CountTrailingZeros( word ) ) );
+            }
+        }
+    }
+    else
+    {
+        const uint16_t* pRuns = values.GetData();
+        size_t runCount = values.GetSize() / 2;
+        for( size_t runIndex = 0; runIndex < runCount; ++runIndex )
+        {
+            uint32_t firstValue = pRuns[ runIndex * 2 ];
+            uint32_t lastValue = firstValue + pRuns[ runIndex * 2 + 1 ];
+            for( uint32_t value = firstValue; value <= lastValue; ++value )
+            {
+                arrayValues.Add( static_cast< uint16_t >( value ) );
+            }
+        }
+    }
+
+    values.Swap( arrayValues );
+    bits.Clear();
+    type = CONTAINER_ARRAY;
+}
+
+/// Convert this container to a bitmap container.
+///
+/// @see ConvertToArray(), ConvertToRun()
+void CompressedBitmap::Container::ConvertToBitmap()
+{
+    if( type == CONTAINER_BITMAP )
+    {
+        return;
+    }
+
+    bits.Resize( BITMAP_WORD_COUNT );
+    uint32_t* pWords = bits.GetData();
+    MemoryZero( pWords, BITMAP_WORD_COUNT * sizeof( uint32_t ) );
+
+    const uint16_t* pValues = values.GetData();
+    size_t count = values.GetSize();
+    if( type == CONTAINER_ARRAY )
+    {
+        for( size_t index = 0; index < count; ++index )
+        {
+            uint16_t value = pValues[ index ];
+            pWords[ value / 32 ] |= 1U << ( value % 32 );
+        }
+    }
+    else
+    {
+        for( size_t index = 0; index < count; index += 2 )
+        {
+            SetBitmapRange( pWords, pValues[ index ], pValues[ index ] + pValues[ index + 1 ] );
+        }
+    }
+
+    values.Clear();
+    type = CONTAINER_BITMAP;
+}
+
+/// Convert this container to a run container.
+///
+/// @see ConvertToArray(), ConvertToBitmap()
+void CompressedBitmap::Container::ConvertToRun()
+{
+    if( type == CONTAINER_RUN )
+    {
+        return;
+    }
+
+    DynamicArray< uint16_t > runs;
+    runs.Reserve( GetRunCount() * 2 );
+
+    if( type == CONTAINER_ARRAY )
+    {
+        const uint16_t* pValues = values.GetData();
+        size_t count = values.GetSize();
+
+        size_t index = 0;
+        while( index < count )
+        {
+            uint16_t firstValue = pValues[ index ];
+            uint16_t lastValue = firstValue;
+            for( ++index; index < count && pValues[ index ] == lastValue + 1; ++index )
+            {
+                ++lastValue;
+            }
+
+            runs.Add( firstValue );
+            runs.Add( static_cast< uint16_t >( lastValue - firstValue ) );
+        }
+    }
+    else
+    {
+        const uint32_t* pWords = bits.GetData();
+        size_t firstIndex = BitArrayFindSet( pWords, CONTAINER_VALUE_COUNT, 0 );
+        while( IsValid( firstIndex ) )
+        {
+            size_t endIndex = BitArrayFindUnset( pWords, CONTAINER_VALUE_COUNT, firstIndex );
+            if( IsInvalid( endIndex ) )
+            {
+                endIndex = CONTAINER_VALUE_COUNT;
+            }
+
+            runs.Add( static_cast< uint16_t >( firstIndex ) );
+            runs.Add( static_cast< uint16_t >( endIndex - firstIndex - 1 ) );
+
+            firstIndex = BitArrayFindSet( pWords, CONTAINER_VALUE_COUNT, endIndex );
+        }
+    }
+
+    values.Swap( runs );
+    bits.Clear();
+    type = CONTAINER_RUN;
+}
+
+/// Convert a run container to an array or bitmap container, depending on its cardinality.
+void CompressedBitmap::Container::Expand()
+{
+    HELIUM_ASSERT( type == CONTAINER_RUN );
+
+    if( cardinality <= MAX_ARRAY_VALUE_COUNT )
+    {
+        ConvertToArray();
+    }
+    else
+    {
+        ConvertToBitmap();
+    }
+}
+
+/// Convert between array and bitmap containers after the container cardinality has changed.
+void CompressedBitmap::Container::Normalize()
+{
+    if( type == CONTAINER_BITMAP && cardinality <= MAX_ARRAY_VALUE_COUNT )
+    {
+        ConvertToArray();
+    }
+    else if( type == CONTAINER_ARRAY && cardinality > MAX_ARRAY_VALUE_COUNT )
+    {
+        ConvertToBitmap();
+    }
+}
+
+/// Convert this container to its most compact representation and release unused memory.
+void CompressedBitmap::Container::Optimize()
+{
+    size_t runSize = GetRunCount() * 2 * sizeof( uint16_t );
+    size_t expandedSize = ( cardinality <= MAX_ARRAY_VALUE_COUNT
+                            ? cardinality * sizeof( uint16_t )
+                            : BITMAP_WORD_COUNT * sizeof( uint32_t ) );
+    if( runSize < expandedSize )
+    {
+        ConvertToRun();
+    }
+    else if( type == CONTAINER_RUN )
+    {
+        Expand();
+    }
+
+    values.Trim();
+    bits.Trim();
+}
+
+/// Get the number of runs of consecutive values in this container.
+///
+/// @return  Run count.
+size_t CompressedBitmap::Container::GetRunCount() const
+{
+    if( type == CONTAINER_RUN )
+    {
+        return values.GetSize() / 2;
+    }
+
+    size_t runCount = 0;
+    if( type == CONTAINER_ARRAY )
+    {
+        const uint16_t* pValues = values.GetData();
+        size_t count = values.GetSize();
+        for( size_t index = 0; index < count; ++index )
+        {
+            runCount += ( index == 0 || pValues[ index ] != pValues[ index - 1 ] + 1 );
+        }
+    }
+    else
+    {
+        // Count set bits that are not preceded by another set bit.
+        const uint32_t* pWords = bits.GetData();
+        uint32_t carry = 0;
+        for( size_t wordIndex = 0; wordIndex < BITMAP_WORD_COUNT; ++wordIndex )
+        {
+            uint32_t word = pWords[ wordIndex ];
+            runCount += CountSetBits( word & ~( ( word << 1 ) | carry ) );
+            carry = word >> 31;
+        }
+    }
+
+    return runCount;
+}
+
+/// Write this container to a stream.
+///
+/// @param[in] rStream  Stream to which the container should be written.
+///
+/// @return  True if the container was written successfully, false if not.
+bool CompressedBitmap::Container::Serialize( Stream& rStream ) const
+{
+    uint32_t info[ 2 ] = { type, cardinality };
+
+    bool bSuccess = WriteLittleEndian( rStream, &key, 1 );
+    bSuccess = bSuccess && WriteLittleEndian( rStream, info, HELIUM_ARRAY_COUNT( info ) );
+
+    if( type == CONTAINER_BITMAP )
+    {
+        bSuccess = bSuccess && WriteLittleEndian( rStream, bits.GetData(), BITMAP_WORD_COUNT );
+    }
+    else
+    {
+        if( type == CONTAINER_RUN )
+        {
+            uint32_t runCount = static_cast< uint32_t >( values.GetSize() / 2 );
+            bSuccess = bSuccess && WriteLittleEndian( rStream, &runCount, 1 );
+        }
+
+        bSuccess = bSuccess && WriteLittleEndian( rStream, values.GetData(), values.GetSize() );
+    }
+
+    return bSuccess;
+}
+
+/// Read this container from a stream.
+///
+/// @param[in] rStream  Stream from which the container should be read.
+///
+/// @return  True if a valid container was read successfully, false if not.
+bool CompressedBitmap::Container::Deserialize( Stream& rStream )
+{
+    uint32_t info[ 2 ];
+    if( !ReadLittleEndian( rStream, &key, 1 ) || !ReadLittleEndian( rStream, info, HELIUM_ARRAY_COUNT( info ) ) )
+    {
+        return false;
+    }
+
+    type = info[ 0 ];
+    cardinality = info[ 1 ];
+    if( key > MAX_CONTAINER_KEY || cardinality == 0 || cardinality > CONTAINER_VALUE_COUNT )
+    {
+        return false;
+    }
+
+    switch( type )
+    {
+    case CONTAINER_ARRAY:
+        {
+            if( cardinality > MAX_ARRAY_VALUE_COUNT )
+            {
+                return false;
+            }
+
+            values.Resize( cardinality );
+            if( !ReadLittleEndian( rStream, values.GetData(), cardinality ) )
+            {
+                return false;
+            }
+
+            for( size_t index = 1; index < cardinality; ++index )
+            {
+                if( values[ index ] <= values[ index - 1 ] )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+    case CONTAINER_BITMAP:
+        {
+            bits.Resize( BITMAP_WORD_COUNT );
+            if( !ReadLittleEndian( rStream, bits.GetData(), BITMAP_WORD_COUNT ) ||
+                BitArrayCountSetBits( bits.GetData(), CONTAINER_VALUE_COUNT ) != cardinality )
+            {
+                return false;
+            }
+
+            Normalize();
+
+            return true;
+        }
+
+    case CONTAINER_RUN:
+        {
+            uint32_t runCount;
+            if( !ReadLittleEndian( rStream, &runCount, 1 ) ||
+                runCount == 0 ||
+                runCount > CONTAINER_VALUE_COUNT / 2 )
+            {
+                return false;
+            }
+
+            values.Resize( runCount * 2 );
+            if( !ReadLittleEndian( rStream, values.GetData(), values.GetSize() ) )
+            {
+                return false;
+            }
+
+            // Runs must be sorted, non-overlapping, and non-adjacent, and their lengths must add up to the cardinality.
+            uint32_t valueCount = 0;
+            uint32_t nextFirstValue = 0;
+            for( size_t runIndex = 0; runIndex < runCount; ++runIndex )
+            {
+                uint32_t firstValue = values[ runIndex * 2 ];
+                uint32_t lastValue = firstValue + values[ runIndex * 2 + 1 ];
+                if( firstValue < nextFirstValue || lastValue >= CONTAINER_VALUE_COUNT )
+                {
+                    return false;
+                }
+
+                valueCount += lastValue - firstValue + 1;
+                nextFirstValue = lastValue + 2;
+            }
+
+            return ( valueCount == cardinality );
+        }
+    }
+
+    return false;
+}
+
+/// Constructor.
+///
+/// @param[in] pBitmap         Bitmap being iterated.
+/// @param[in] containerIndex  Index of the container at which to start.
+CompressedBitmap::ConstIterator::ConstIterator( const CompressedBitmap* pBitmap, size_t containerIndex )
+    : m_pBitmap( pBitmap )
+    , m_containerIndex( containerIndex )
+    , m_position( 0 )
+    , m_lowValue( 0 )
+{
+    HELIUM_ASSERT( pBitmap );
+    SeekContainerStart();
+}
+
+/// Increment this iterator to the next value in the bitmap.
+///
+/// @return  Reference to this iterator.
+CompressedBitmap::ConstIterator& CompressedBitmap::ConstIterator::operator++()
+{
+    HELIUM_ASSERT( m_pBitmap );
+    HELIUM_ASSERT( m_containerIndex < m_pBitmap->m_containers.GetSize() );
+
+    const Container& rContainer = m_pBitmap->m_containers[ m_containerIndex ];
+    if( rContainer.type == CONTAINER_ARRAY )
+    {
+        ++m_position;
+        if( m_position < rContainer.values.GetSize() )
+        {
+            m_lowValue = rContainer.values[ m_position ];
+
+            return *this;
+        }
+    }
+    else if( rContainer.type == CONTAINER_BITMAP )
+    {
+        size_t nextValue = BitArrayFindSet( rContainer.bits.GetData(), CONTAINER_VALUE_COUNT, m_lowValue + 1 );
+        if( IsValid( nextValue ) )
+        {
+            m_lowValue = static_cast< uint32_t >( nextValue );
+
+            return *this;
+        }
+    }
+    else
+    {
+        const uint16_t* pRun = rContainer.values.GetData() + m_position * 2;
+        if( m_lowValue < static_cast< uint32_t >( pRun[ 0 ] ) + pRun[ 1 ] )
+        {
+            ++m_lowValue;
+
+            return *this;
+        }
+
+        ++m_position;
+        if( m_position * 2 < rContainer.values.GetSize() )
+        {
+            m_lowValue = pRun[ 2 ];
+
+            return *this;
+        }
+    }
+
+    ++m_containerIndex;
+    SeekContainerStart();
+
+    return *this;
+}
+
+/// Increment this iterator to the next value in the bitmap.
+///
+/// @return  Copy of this iterator prior to incrementing.
+CompressedBitmap::ConstIterator CompressedBitmap::ConstIterator::operator++( int )
+{
+    ConstIterator result = *this;
+    ++( *this );
+
+    return result;
+}
+
+/// Move this iterator to the first value in the current container, or to the end of the bitmap if there are no more
+/// containers.
+void CompressedBitmap::ConstIterator::SeekContainerStart()
+{
+    m_position = 0;
+    m_lowValue = 0;
+
+    if( m_containerIndex < m_pBitmap->m_containers.GetSize() )
+    {
+        const Container& rContainer = m_pBitmap->m_containers[ m_containerIndex ];
+        if( rContainer.type == CONTAINER_BITMAP )
+        {
+            m_lowValue = static_cast< uint32_t >(
+                BitArrayFindSet( rContainer.bits.GetData(), CONTAINER_VALUE_COUNT, 0 ) );
+        }
+        else
+        {
+            m_lowValue = rContainer.values[ 0 ];
+        }
+    }
+}
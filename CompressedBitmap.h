@@ -0,0 +1,192 @@
+#pragma once
+
+#include "Foundation/API.h"
+#include "Foundation/DynamicArray.h"
+#include "Foundation/Stream.h"
+
+namespace Helium
+{
+    /// Compressed (roaring-style) bitmap of 64-bit values (not thread-safe).
+    ///
+    /// The value space is split into chunks of CONTAINER_VALUE_COUNT values keyed by the upper 48 bits of each value,
+    /// and only chunks that contain at least one value are stored.  Each chunk is stored in whichever container type
+    /// suits its contents:
+    /// - sparse chunks are stored as a sorted array of the low 16 bits of each value,
+    /// - dense chunks are stored as a 65536-bit bitmap, and
+    /// - chunks made up of long runs of consecutive values can be stored as a list of runs.
+    ///
+    /// This keeps large, sparse sets of identifiers (such as TUIDs) compact while still allowing fast membership tests
+    /// and fast union, intersection, and difference between sets, which work a container at a time and use the
+    /// word-parallel BitArray kernels for bitmap containers.
+    ///
+    /// Run containers are created by AddRange() and Optimize().  Adding or removing a single value in a run container
+    /// converts it back to an array or bitmap container, so call Optimize() again after a batch of changes if compact
+    /// storage matters (e.g. before serializing).
+    class HELIUM_FOUNDATION_API CompressedBitmap
+    {
+    public:
+        /// Number of values covered by each container.
+        static const uint32_t CONTAINER_VALUE_COUNT = 65536;
+        /// Maximum number of values stored in an array container before it is converted to a bitmap container.
+        static const uint32_t MAX_ARRAY_VALUE_COUNT = 4096;
+
+        /// Serialized bitmap signature ("HCBM").
+        static const uint32_t SERIALIZED_SIGNATURE = 0x4d424348;
+        /// Serialized bitmap format version.
+        static const uint32_t SERIALIZED_VERSION = 1;
+
+        /// Constant iterator over the values in a compressed bitmap, in ascending order.
+        class HELIUM_FOUNDATION_API ConstIterator
+        {
+            friend class CompressedBitmap;
+
+        public:
+            /// @name Construction/Destruction
+            //@{
+            inline ConstIterator();
+            //@}
+
+            /// @name Overloaded Operators
+            //@{
+            inline uint64_t operator*() const;
+
+            ConstIterator& operator++();
+            ConstIterator operator++( int );
+
+            inline bool operator==( const ConstIterator& rOther ) const;
+            inline bool operator!=( const ConstIterator& rOther ) const;
+            //@}
+
+        private:
+            /// Bitmap being iterated.
+            const CompressedBitmap* m_pBitmap;
+            /// Index of the current container.
+            size_t m_containerIndex;
+            /// Array index or run index within the current container (unused for bitmap containers).
+            size_t m_position;
+            /// Low 16 bits of the current value.
+            uint32_t m_lowValue;
+
+            /// @name Construction/Destruction, Private
+            //@{
+            ConstIterator( const CompressedBitmap* pBitmap, size_t containerIndex );
+            //@}
+
+            /// @name Private Utility Functions
+            //@{
+            void SeekContainerStart();
+            //@}
+        };
+
+        /// @name Construction/Destruction
+        //@{
+        CompressedBitmap();
+        CompressedBitmap( const CompressedBitmap& rSource );
+        ~CompressedBitmap();
+        //@}
+
+        /// @name Set Operations
+        //@{
+        uint64_t GetSize() const;
+        inline bool IsEmpty() const;
+
+        void Clear();
+
+        bool Contains( uint64_t value ) const;
+
+        bool Add( uint64_t value );
+        void AddRange( uint64_t firstValue, uint64_t count );
+        bool Remove( uint64_t value );
+
+        void Or( const CompressedBitmap& rOther );
+        void And( const CompressedBitmap& rOther );
+        void AndNot( const CompressedBitmap& rOther );
+
+        void Optimize();
+        size_t GetMemorySize() const;
+
+        void Swap( CompressedBitmap& rBitmap );
+        //@}
+
+        /// @name Iteration
+        //@{
+        inline ConstIterator Begin() const;
+        inline ConstIterator End() const;
+        //@}
+
+        /// @name Serialization
+        //@{
+        bool Serialize( Stream& rStream ) const;
+        bool Deserialize( Stream& rStream );
+        //@}
+
+        /// @name Overloaded Operators
+        //@{
+        CompressedBitmap& operator=( const CompressedBitmap& rSource );
+
+        inline CompressedBitmap& operator|=( const CompressedBitmap& rOther );
+        inline CompressedBitmap& operator&=( const CompressedBitmap& rOther );
+        //@}
+
+    private:
+        /// Container types.
+        enum EContainerType
+        {
+            CONTAINER_ARRAY,   ///< Sorted array of values.
+            CONTAINER_BITMAP,  ///< Bitmap covering every value in the chunk.
+            CONTAINER_RUN,     ///< Sorted list of runs of consecutive values.
+        };
+
+        /// Storage for the values in a single chunk.
+        struct Container
+        {
+            /// Upper 48 bits shared by all values in this container.
+            uint64_t key;
+            /// Container type (EContainerType value).
+            uint32_t type;
+            /// Number of values in this container (always non-zero).
+            uint32_t cardinality;
+            /// Sorted values (array containers) or pairs of run starts and lengths minus one (run containers).
+            DynamicArray< uint16_t > values;
+            /// Bitmap words (bitmap containers).
+            DynamicArray< uint32_t > bits;
+
+            /// @name Container Operations
+            //@{
+            bool Contains( uint32_t value ) const;
+            bool Add( uint32_t value );
+            bool Remove( uint32_t value );
+            void AddRange( uint32_t firstValue, uint32_t lastValue );
+
+            void ConvertToArray();
+            void ConvertToBitmap();
+            void ConvertToRun();
+            void Expand();
+            void Normalize();
+            void Optimize();
+
+            size_t GetRunCount() const;
+            //@}
+
+            /// @name Serialization
+            //@{
+            bool Serialize( Stream& rStream ) const;
+            bool Deserialize( Stream& rStream );
+            //@}
+        };
+
+        /// Containers with at least one value, sorted by key.
+        DynamicArray< Container > m_containers;
+
+        /// @name Private Utility Functions
+        //@{
+        size_t FindContainer( uint64_t key ) const;
+
+        static void OrContainers( Container& rDest, const Container& rSource );
+        static void AndContainers( Container& rDest, const Container& rSource );
+        static void AndNotContainers( Container& rDest, const Container& rSource );
+        //@}
+    };
+}
+
+#include "Foundation/CompressedBitmap.inl"
@@ -0,0 +1,102 @@
+/// Default constructor.
+///
+/// Creates an iterator that does not reference any bitmap.
+Helium::CompressedBitmap::ConstIterator::ConstIterator()
+    : m_pBitmap( NULL )
+    , m_containerIndex( 0 )
+    , m_position( 0 )
+    , m_lowValue( 0 )
+{
+}
+
+/// Get the value referenced by this iterator.
+///
+/// @return  Current value.
+uint64_t Helium::CompressedBitmap::ConstIterator::operator*() const
+{
+    HELIUM_ASSERT( m_pBitmap );
+    HELIUM_ASSERT( m_containerIndex < m_pBitmap->m_containers.GetSize() );
+
+    return ( m_pBitmap->m_containers[ m_containerIndex ].key << 16 ) | m_lowValue;
+}
+
+/// Equality comparison operator.
+///
+/// @param[in] rOther  Iterator with which to compare.
+///
+/// @return  True if both iterators reference the same value in the same bitmap, false if not.
+bool Helium::CompressedBitmap::ConstIterator::operator==( const ConstIterator& rOther ) const
+{
+    return ( m_pBitmap == rOther.m_pBitmap &&
+             m_containerIndex == rOther.m_containerIndex &&
+             m_position == rOther.m_position &&
+             m_lowValue == rOther.m_lowValue );
+}
+
+/// Inequality comparison operator.
+///
+/// @param[in] rOther  Iterator with which to compare.
+///
+/// @return  True if the iterators reference different values, false if they are the same.
+bool Helium::CompressedBitmap::ConstIterator::operator!=( const ConstIterator& rOther ) const
+{
+    return !( *this == rOther );
+}
+
+/// Get whether this bitmap is empty.
+///
+/// @return  True if this bitmap does not contain any values, false if not.
+///
+/// @see GetSize()
+bool Helium::CompressedBitmap::IsEmpty() const
+{
+    return m_containers.IsEmpty();
+}
+
+/// Get an iterator referencing the smallest value in this bitmap.
+///
+/// @return  Iterator at the beginning of this bitmap.
+///
+/// @see End()
+Helium::CompressedBitmap::ConstIterator Helium::CompressedBitmap::Begin() const
+{
+    return ConstIterator( this, 0 );
+}
+
+/// Get an iterator referencing the end of this bitmap.
+///
+/// @return  Iterator past the largest value in this bitmap.
+///
+/// @see Begin()
+Helium::CompressedBitmap::ConstIterator Helium::CompressedBitmap::End() const
+{
+    return ConstIterator( this, m_containers.GetSize() );
+}
+
+/// Add all values in another bitmap to this bitmap.
+///
+/// @param[in] rOther  Bitmap to merge with this bitmap.
+///
+/// @return  Reference to this bitmap.
+///
+/// @see Or()
+Helium::CompressedBitmap& Helium::CompressedBitmap::operator|=( const CompressedBitmap& rOther )
+{
+    Or( rOther );
+
+    return *this;
+}
+
+/// Remove all values not in another bitmap from this bitmap.
+///
+/// @param[in] rOther  Bitmap to intersect with this bitmap.
+///
+/// @return  Reference to this bitmap.
+///
+/// @see And()
+Helium::CompressedBitmap& Helium::CompressedBitmap::operator&=( const CompressedBitmap& rOther )
+{
+    And( rOther );
+
+    return *this;
+}
@@ -23,8 +23,8 @@ namespace Helium
             Pair< Key, Data > >
     {
     public:
-        /// Default hash table bucket count (prime numbers are recommended).
-        static const size_t DEFAULT_BUCKET_COUNT = 37;
+        /// Default hash table bucket count.
+        static const size_t DEFAULT_BUCKET_COUNT = 64;
 
         /// Parent class type.
         typedef ConcurrentHashTable<
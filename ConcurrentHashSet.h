@@ -16,8 +16,8 @@ namespace Helium
         : public ConcurrentHashTable< const Key, const Key, HashFunction, Identity< const Key >, EqualKey, Allocator, Key >
     {
     public:
-        /// Default hash table bucket count (prime numbers are recommended).
-        static const size_t DEFAULT_BUCKET_COUNT = 37;
+        /// Default hash table bucket count.
+        static const size_t DEFAULT_BUCKET_COUNT = 64;
 
         /// Parent class type.
         typedef ConcurrentHashTable< const Key, const Key, HashFunction, Identity< const Key >, EqualKey, Allocator, Key >
@@ -1,8 +1,8 @@
 #pragma once
 
-#include "Platform/Locks.h"
-
+#include "Foundation/BiasedReadWriteLock.h"
 #include "Foundation/DynamicArray.h"
+#include "Foundation/HashFunctions.h"
 
 namespace Helium
 {
@@ -68,14 +68,12 @@ namespace Helium
     private:
         /// Hash table currently referenced by this accessor.
         const TableType* m_pTable;
-        /// Current table bucket index.
-        size_t m_bucketIndex;
-        /// Current table element index.
-        size_t m_elementIndex;
+        /// Location of the current table entry.
+        typename TableType::Location m_location;
 
         /// @name Private Utility Functions
         //@{
-        void Set( const TableType* pTable, size_t bucketIndex, size_t elementIndex );
+        void Set( const TableType* pTable, const typename TableType::Location& rLocation );
         //@}
     };
 
@@ -136,18 +134,26 @@ namespace Helium
     private:
         /// Hash table currently referenced by this accessor.
         TableType* m_pTable;
-        /// Current table bucket index.
-        size_t m_bucketIndex;
-        /// Current table element index.
-        size_t m_elementIndex;
+        /// Location of the current table entry.
+        typename TableType::Location m_location;
 
         /// @name Private Utility Functions
         //@{
-        void Set( TableType* pTable, size_t bucketIndex, size_t elementIndex );
+        void Set( TableType* pTable, const typename TableType::Location& rLocation );
         //@}
     };
 
     /// Base class for hash table containers with thread-safe access support.
+    ///
+    /// Access is synchronized using a fixed set of lock stripes, each guarding a subset of the table buckets.  When the
+    /// load factor exceeds the configured maximum, a bucket array twice the size is published and entries are migrated
+    /// to it incrementally: each write operation moves a few of the buckets covered by the stripe it has already locked,
+    /// so readers and writers on other stripes are never blocked by a resize.  Until a bucket has been migrated,
+    /// lookups simply continue to use its old location.  Replaced bucket arrays are kept until CompleteMigration() is
+    /// called or the table is destroyed.
+    ///
+    /// Element counts are also kept per stripe and only summed when the table size is requested, so write operations on
+    /// different stripes never contend on a shared counter.
     template<
         typename Value,
         typename Key,
@@ -162,8 +168,12 @@ namespace Helium
         friend class ConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >;
 
     public:
-        /// Default hash table bucket count (prime numbers are recommended).
-        static const size_t DEFAULT_BUCKET_COUNT = 37;
+        /// Default hash table bucket count.
+        static const size_t DEFAULT_BUCKET_COUNT = 64;
+        /// Maximum number of buckets migrated to a resized bucket array by each write operation.
+        static const size_t MIGRATION_BUCKET_COUNT = 4;
+        /// Number of keys for which buckets are prefetched at a time by batch operations.
+        static const size_t BATCH_BLOCK_SIZE = 16;
 
         /// Type for hash table keys.
         typedef Key KeyType;
@@ -210,25 +220,114 @@ namespace Helium
         bool Remove( Accessor& rAccessor );
         //@}
 
+        /// @name Batch Operations
+        //@{
+        template< typename Function > size_t FindBatch(
+            const Key* pKeys, size_t keyCount, Function function ) const;
+        size_t InsertBatch( const Value* pValues, size_t valueCount, bool* pInserted = NULL );
+        size_t RemoveBatch( const Key* pKeys, size_t keyCount, bool* pRemoved = NULL );
+        //@}
+
+        /// @name Resizing
+        //@{
+        size_t GetBucketCount() const;
+        float32_t GetLoadFactor() const;
+        float32_t GetMaxLoadFactor() const;
+        void SetMaxLoadFactor( float32_t maxLoadFactor );
+
+        bool IsMigrating() const;
+        float32_t GetMigrationProgress() const;
+        void CompleteMigration();
+        //@}
+
     protected:
+        /// Lock stripe.
+        ///
+        /// Each stripe guards every bucket (in both the current and any previous bucket array) whose index matches the
+        /// stripe index in the low bits.  Since bucket counts are always a power of two no smaller than the stripe
+        /// count, the buckets into which a bucket is split when the table grows are covered by the same stripe.
+        ///
+        /// Stripes are aligned and padded to a cache line (64 bytes), so lock, tag, and size updates on one stripe do
+        /// not invalidate the cache line holding its neighbors.
+        HELIUM_ALIGN_PRE( 64 ) struct Stripe
+        {
+            /// Read-write lock for access synchronization (read-biased, so concurrent lookups do not contend on a shared
+            /// reader count).
+            BiasedReadWriteLock lock;
+            /// State tag (incremented when entries are removed or moved between buckets).
+            volatile int32_t tag;
+            /// Number of entries in the buckets covered by this stripe (only modified with an exclusive lock held).
+            volatile size_t size;
+        } HELIUM_ALIGN_POST( 64 );
+
         /// Hash table bucket.
         struct Bucket
         {
             /// Bucket entries.
             DynamicArray< InternalValue, Allocator > entries;
-            /// Read-write lock for access synchronization.
-            ReadWriteLock lock;
-            /// State tag (incremented when entries are removed).
-            volatile int32_t tag;
+            /// True if this bucket belongs to a previous bucket array and its entries have been moved to the current
+            /// bucket array.
+            bool bMigrated;
+        };
+
+        /// Bucket array state.
+        ///
+        /// States are immutable once published (aside from migration counters, which are only updated with the
+        /// appropriate stripe locks held), so a state loaded while holding a stripe lock remains a valid view of that
+        /// stripe's buckets for as long as the lock is held.  The bucket arrays of previous states are only freed by
+        /// CompleteMigration() while holding every stripe lock, and the state records themselves are not freed until
+        /// the table itself is destroyed.
+        struct TableState
+        {
+            /// Current bucket array.
+            Bucket* pBuckets;
+            /// Number of buckets in the current bucket array.
+            size_t bucketCount;
+
+            /// Bucket array from which entries are being migrated (null if no migration is in progress).
+            Bucket* pOldBuckets;
+            /// Number of buckets in the old bucket array.
+            size_t oldBucketCount;
+            /// Index of the next old bucket to migrate for each lock stripe (in units of stripe-local buckets).
+            size_t* pMigrationIndices;
+            /// Total number of old buckets migrated so far.
+            volatile int32_t migratedBucketCount;
+
+            /// Previously published state (kept until the table is destroyed, although its bucket arrays may be freed
+            /// once it is no longer current).
+            TableState* pPreviousState;
+            /// True if this state is responsible for freeing its current bucket array.
+            bool bOwnsBuckets;
         };
 
-        /// Hash table buckets.
-        Bucket* m_pBuckets;
-        /// Number of hash table buckets.
-        size_t m_bucketCount;
+        /// Table entry location.
+        struct Location
+        {
+            /// Table state used to resolve the location.
+            const TableState* pState;
+            /// Bucket containing the entry.
+            Bucket* pBucket;
+            /// Index of the lock stripe covering the bucket.
+            size_t stripeIndex;
+            /// Stripe-local bucket index (buckets from any old bucket array are ordered before those from the current
+            /// bucket array).
+            size_t bucketIndex;
+            /// Bucket element index.
+            size_t elementIndex;
+            /// Token for releasing the stripe lock, if it is held for read-only access.
+            size_t readToken;
+        };
+
+        /// Lock stripes.
+        Stripe* m_pStripes;
+        /// Number of lock stripes (power of two).
+        size_t m_stripeCount;
+
+        /// Current table state.
+        TableState* volatile m_pState;
 
-        /// Number of elements currently in the hash table.
-        volatile int32_t m_size;
+        /// Maximum ratio of elements to buckets before the bucket array is grown.
+        float32_t m_maxLoadFactor;
 
         /// Key hashing functor.
         HasherType m_hasher;
@@ -259,7 +358,30 @@ namespace Helium
     private:
         /// @name Private Utility Functions
         //@{
-        void AllocateBuckets();
+        size_t HashKey( const Key& rKey ) const;
+
+        void LockStripe( Location& rLocation, bool bWrite ) const;
+        void UnlockStripe( const Location& rLocation, bool bWrite ) const;
+
+        Bucket& LocateBucket( size_t hash, Location& rLocation ) const;
+        void GroupByStripe( const size_t* pHashes, size_t count, DynamicArray< size_t, Allocator >& rOrder ) const;
+        void LocateBatchBuckets(
+            const size_t* pHashes, const size_t* pIndices, size_t count, Location& rLocation, Bucket** ppBuckets ) const;
+        size_t GetStripeBucketCount( const TableState* pState ) const;
+        Bucket* GetStripeBucket( const TableState* pState, size_t stripeIndex, size_t bucketIndex ) const;
+        bool SeekNext( Location& rLocation, bool bWrite ) const;
+        bool SeekPrevious( Location& rLocation, bool bWrite ) const;
+
+        void CheckGrowth( size_t stripeIndex );
+        void MigrateStripe( size_t stripeIndex, size_t maxBucketCount );
+
+        void AllocateStripes();
+        Bucket* AllocateBuckets( size_t bucketCount );
+        void FreeBuckets( Bucket* pBuckets, size_t bucketCount );
+        TableState* CreateState(
+            Bucket* pBuckets, size_t bucketCount, Bucket* pOldBuckets, size_t oldBucketCount, bool bOwnsBuckets );
+        void DestroyState( TableState* pState );
+        void ReleaseRetiredStates();
 
         void CopyConstruct( const ConcurrentHashTable& rSource );
         void Finalize();
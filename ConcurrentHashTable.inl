@@ -7,8 +7,6 @@ template<
 Helium::ConstConcurrentHashTableAccessor<
     Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::ConstConcurrentHashTableAccessor()
     : m_pTable( NULL )
-    , m_bucketIndex( 0 )
-    , m_elementIndex( 0 )
 {
 }
 
@@ -47,11 +45,8 @@ void Helium::ConstConcurrentHashTableAccessor<
 {
     if( m_pTable )
     {
-        HELIUM_ASSERT( m_pTable->m_pBuckets );
-        m_pTable->m_pBuckets[ m_bucketIndex ].lock.UnlockRead();
+        m_pTable->UnlockStripe( m_location, false );
         m_pTable = NULL;
-        m_bucketIndex = 0;
-        m_elementIndex = 0;
     }
 }
 
@@ -65,9 +60,9 @@ const Value& Helium::ConstConcurrentHashTableAccessor<
     Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator*() const
 {
     HELIUM_ASSERT( m_pTable );
-    HELIUM_ASSERT( m_pTable->m_pBuckets );
+    HELIUM_ASSERT( m_location.pBucket );
 
-    return m_pTable->m_pBuckets[ m_bucketIndex ].entries[ m_elementIndex ];
+    return m_location.pBucket->entries[ m_location.elementIndex ];
 }
 
 /// Access the current hash table entry.
@@ -80,9 +75,9 @@ const Value* Helium::ConstConcurrentHashTableAccessor<
     Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator->() const
 {
     HELIUM_ASSERT( m_pTable );
-    HELIUM_ASSERT( m_pTable->m_pBuckets );
+    HELIUM_ASSERT( m_location.pBucket );
 
-    return &m_pTable->m_pBuckets[ m_bucketIndex ].entries[ m_elementIndex ];
+    return &m_location.pBucket->entries[ m_location.elementIndex ];
 }
 
 /// Increment this accessor to the next hash table entry.
@@ -95,36 +90,19 @@ Helium::ConstConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey,
     Helium::ConstConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator++()
 {
     HELIUM_ASSERT( m_pTable );
+    HELIUM_ASSERT( m_location.pBucket );
 
-    ++m_elementIndex;
-
-    typename TableType::Bucket* pBuckets = m_pTable->m_pBuckets;
-    HELIUM_ASSERT( pBuckets );
-
-    typename TableType::Bucket& rCurrentBucket = pBuckets[ m_bucketIndex ];
-    if( m_elementIndex >= rCurrentBucket.entries.GetSize() )
+    ++m_location.elementIndex;
+    if( m_location.elementIndex < m_location.pBucket->entries.GetSize() )
     {
-        rCurrentBucket.lock.UnlockRead();
-
-        m_elementIndex = 0;
-
-        size_t bucketCount = m_pTable->m_bucketCount;
-        for( size_t bucketIndex = m_bucketIndex + 1; bucketIndex < bucketCount; ++bucketIndex )
-        {
-            typename TableType::Bucket& rBucket = pBuckets[ bucketIndex ];
-            rBucket.lock.LockRead();
-            if( !rBucket.entries.IsEmpty() )
-            {
-                m_bucketIndex = bucketIndex;
-
-                return *this;
-            }
-
-            rBucket.lock.UnlockRead();
-        }
+        return *this;
+    }
 
+    ++m_location.bucketIndex;
+    if( !m_pTable->SeekNext( m_location, false ) )
+    {
+        // Reached the end of the table (all locks have been released).
         m_pTable = NULL;
-        m_bucketIndex = 0;
     }
 
     return *this;
@@ -140,43 +118,21 @@ Helium::ConstConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey,
     Helium::ConstConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator--()
 {
     HELIUM_ASSERT( m_pTable );
+    HELIUM_ASSERT( m_location.pBucket );
 
-    if( m_elementIndex > 0 )
+    if( m_location.elementIndex > 0 )
     {
-        --m_elementIndex;
+        --m_location.elementIndex;
 
         return *this;
     }
 
-    typename TableType::Bucket* pBuckets = m_pTable->m_pBuckets;
-    HELIUM_ASSERT( pBuckets );
-
-    size_t bucketIndex = m_bucketIndex;
-    pBuckets[ bucketIndex ].lock.UnlockRead();
-
-    while( bucketIndex != 0 )
+    if( !m_pTable->SeekPrevious( m_location, false ) )
     {
-        --bucketIndex;
-
-        typename TableType::Bucket& rBucket = pBuckets[ bucketIndex ];
-        rBucket.lock.LockRead();
-
-        size_t entryCount = rBucket.entries.GetSize();
-        if( entryCount != 0 )
-        {
-            m_bucketIndex = bucketIndex;
-            m_elementIndex = entryCount - 1;
-
-            return *this;
-        }
-
-        rBucket.lock.UnlockRead();
+        // Reached the start of the table (all locks have been released).
+        m_pTable = NULL;
     }
 
-    m_pTable = NULL;
-    m_bucketIndex = 0;
-    m_elementIndex = 0;
-
     return *this;
 }
 
@@ -191,9 +147,14 @@ template<
 bool Helium::ConstConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator==(
     const ConstConcurrentHashTableAccessor& rOther ) const
 {
-    return ( m_pTable == rOther.m_pTable &&
-             m_bucketIndex == rOther.m_bucketIndex &&
-             m_elementIndex == rOther.m_elementIndex );
+    if( m_pTable != rOther.m_pTable )
+    {
+        return false;
+    }
+
+    return ( !m_pTable ||
+             ( m_location.pBucket == rOther.m_location.pBucket &&
+               m_location.elementIndex == rOther.m_location.elementIndex ) );
 }
 
 /// Get whether this accessor does not reference the same hash table location as another accessor.
@@ -208,9 +169,7 @@ template<
 bool Helium::ConstConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator!=(
     const ConstConcurrentHashTableAccessor& rOther ) const
 {
-    return ( m_pTable != rOther.m_pTable ||
-             m_bucketIndex != rOther.m_bucketIndex ||
-             m_elementIndex != rOther.m_elementIndex );
+    return !( *this == rOther );
 }
 
 /// Directly set the hash table entry reference for this accessor.
@@ -218,36 +177,30 @@ bool Helium::ConstConcurrentHashTableAccessor< Value, Key, HashFunction, Extract
 /// This should only be called by the table itself, and only on entries for which a lock already exists.  Control of the
 /// lock is passed onto this accessor to release at a later time.
 ///
-/// @param[in] pTable        Table to reference.
-/// @param[in] bucketIndex   Index of the bucket containing the entry to reference.
-/// @param[in] elementIndex  Index of the bucket element in which the table entry is stored.
+/// @param[in] pTable     Table to reference.
+/// @param[in] rLocation  Location of the entry to reference.
 template<
     typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
     typename InternalValue >
 void Helium::ConstConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Set(
     const TableType* pTable,
-    size_t bucketIndex,
-    size_t elementIndex )
+    const typename TableType::Location& rLocation )
 {
     HELIUM_ASSERT( m_pTable == NULL );
 
     m_pTable = pTable;
-    m_bucketIndex = bucketIndex;
-    m_elementIndex = elementIndex;
+    m_location = rLocation;
 }
 
 /// Constructor.
 ///
-/// Creates a read-write hash table accessor, initialized in an invalid state (not referencing any hash table
-/// entry).
+/// Creates a read-write hash table accessor, initialized in an invalid state (not referencing any hash table entry).
 template<
     typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
     typename InternalValue >
 Helium::ConcurrentHashTableAccessor<
     Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::ConcurrentHashTableAccessor()
     : m_pTable( NULL )
-    , m_bucketIndex( 0 )
-    , m_elementIndex( 0 )
 {
 }
 
@@ -269,7 +222,8 @@ Helium::ConcurrentHashTableAccessor<
 template<
     typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
     typename InternalValue >
-bool Helium::ConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::IsValid() const
+bool Helium::ConcurrentHashTableAccessor<
+    Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::IsValid() const
 {
     return ( m_pTable != NULL );
 }
@@ -280,15 +234,13 @@ bool Helium::ConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey,
 template<
     typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
     typename InternalValue >
-void Helium::ConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Release()
+void Helium::ConcurrentHashTableAccessor<
+    Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Release()
 {
     if( m_pTable )
     {
-        HELIUM_ASSERT( m_pTable->m_pBuckets );
-        m_pTable->m_pBuckets[ m_bucketIndex ].lock.UnlockWrite();
+        m_pTable->UnlockStripe( m_location, true );
         m_pTable = NULL;
-        m_bucketIndex = 0;
-        m_elementIndex = 0;
     }
 }
 
@@ -302,9 +254,9 @@ Value& Helium::ConcurrentHashTableAccessor<
     Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator*() const
 {
     HELIUM_ASSERT( m_pTable );
-    HELIUM_ASSERT( m_pTable->m_pBuckets );
+    HELIUM_ASSERT( m_location.pBucket );
 
-    return m_pTable->m_pBuckets[ m_bucketIndex ].entries[ m_elementIndex ];
+    return m_location.pBucket->entries[ m_location.elementIndex ];
 }
 
 /// Access the current hash table entry.
@@ -317,9 +269,9 @@ Value* Helium::ConcurrentHashTableAccessor<
     Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator->() const
 {
     HELIUM_ASSERT( m_pTable );
-    HELIUM_ASSERT( m_pTable->m_pBuckets );
+    HELIUM_ASSERT( m_location.pBucket );
 
-    return &m_pTable->m_pBuckets[ m_bucketIndex ].entries[ m_elementIndex ];
+    return &m_location.pBucket->entries[ m_location.elementIndex ];
 }
 
 /// Increment this accessor to the next hash table entry.
@@ -332,36 +284,19 @@ Helium::ConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, Equal
     Helium::ConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator++()
 {
     HELIUM_ASSERT( m_pTable );
+    HELIUM_ASSERT( m_location.pBucket );
 
-    ++m_elementIndex;
-
-    typename TableType::Bucket* pBuckets = m_pTable->m_pBuckets;
-    HELIUM_ASSERT( pBuckets );
-
-    typename TableType::Bucket& rCurrentBucket = pBuckets[ m_bucketIndex ];
-    if( m_elementIndex >= rCurrentBucket.entries.GetSize() )
+    ++m_location.elementIndex;
+    if( m_location.elementIndex < m_location.pBucket->entries.GetSize() )
     {
-        rCurrentBucket.lock.UnlockWrite();
-
-        m_elementIndex = 0;
-
-        size_t bucketCount = m_pTable->m_bucketCount;
-        for( size_t bucketIndex = m_bucketIndex + 1; bucketIndex < bucketCount; ++bucketIndex )
-        {
-            typename TableType::Bucket& rBucket = pBuckets[ bucketIndex ];
-            rBucket.lock.LockWrite();
-            if( !rBucket.entries.IsEmpty() )
-            {
-                m_bucketIndex = bucketIndex;
-
-                return *this;
-            }
-
-            rBucket.lock.UnlockWrite();
-        }
+        return *this;
+    }
 
+    ++m_location.bucketIndex;
+    if( !m_pTable->SeekNext( m_location, true ) )
+    {
+        // Reached the end of the table (all locks have been released).
         m_pTable = NULL;
-        m_bucketIndex = 0;
     }
 
     return *this;
@@ -377,43 +312,21 @@ Helium::ConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, Equal
     Helium::ConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator--()
 {
     HELIUM_ASSERT( m_pTable );
+    HELIUM_ASSERT( m_location.pBucket );
 
-    if( m_elementIndex > 0 )
+    if( m_location.elementIndex > 0 )
     {
-        --m_elementIndex;
+        --m_location.elementIndex;
 
         return *this;
     }
 
-    typename TableType::Bucket* pBuckets = m_pTable->m_pBuckets;
-    HELIUM_ASSERT( pBuckets );
-
-    size_t bucketIndex = m_bucketIndex;
-    pBuckets[ bucketIndex ].lock.UnlockWrite();
-
-    while( bucketIndex != 0 )
+    if( !m_pTable->SeekPrevious( m_location, true ) )
     {
-        --bucketIndex;
-
-        typename TableType::Bucket& rBucket = pBuckets[ bucketIndex ];
-        rBucket.lock.LockWrite();
-
-        size_t entryCount = rBucket.entries.GetSize();
-        if( entryCount != 0 )
-        {
-            m_bucketIndex = bucketIndex;
-            m_elementIndex = entryCount - 1;
-
-            return *this;
-        }
-
-        rBucket.lock.UnlockWrite();
+        // Reached the start of the table (all locks have been released).
+        m_pTable = NULL;
     }
 
-    m_pTable = NULL;
-    m_bucketIndex = 0;
-    m_elementIndex = 0;
-
     return *this;
 }
 
@@ -428,9 +341,14 @@ template<
 bool Helium::ConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator==(
     const ConcurrentHashTableAccessor& rOther ) const
 {
-    return ( m_pTable == rOther.m_pTable &&
-             m_bucketIndex == rOther.m_bucketIndex &&
-             m_elementIndex == rOther.m_elementIndex );
+    if( m_pTable != rOther.m_pTable )
+    {
+        return false;
+    }
+
+    return ( !m_pTable ||
+             ( m_location.pBucket == rOther.m_location.pBucket &&
+               m_location.elementIndex == rOther.m_location.elementIndex ) );
 }
 
 /// Get whether this accessor does not reference the same hash table location as another accessor.
@@ -445,9 +363,7 @@ template<
 bool Helium::ConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator!=(
     const ConcurrentHashTableAccessor& rOther ) const
 {
-    return ( m_pTable != rOther.m_pTable ||
-             m_bucketIndex != rOther.m_bucketIndex ||
-             m_elementIndex != rOther.m_elementIndex );
+    return !( *this == rOther );
 }
 
 /// Directly set the hash table entry reference for this accessor.
@@ -455,28 +371,25 @@ bool Helium::ConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey,
 /// This should only be called by the table itself, and only on entries for which a lock already exists.  Control of the
 /// lock is passed onto this accessor to release at a later time.
 ///
-/// @param[in] pTable        Table to reference.
-/// @param[in] bucketIndex   Index of the bucket containing the entry to reference.
-/// @param[in] elementIndex  Index of the bucket element in which the table entry is stored.
+/// @param[in] pTable     Table to reference.
+/// @param[in] rLocation  Location of the entry to reference.
 template<
     typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
     typename InternalValue >
 void Helium::ConcurrentHashTableAccessor< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Set(
     TableType* pTable,
-    size_t bucketIndex,
-    size_t elementIndex )
+    const typename TableType::Location& rLocation )
 {
     HELIUM_ASSERT( m_pTable == NULL );
 
     m_pTable = pTable;
-    m_bucketIndex = bucketIndex;
-    m_elementIndex = elementIndex;
+    m_location = rLocation;
 }
 
 /// Constructor.
 ///
-/// @param[in] bucketCount  Number of buckets to allocate in the table.  Prime numbers are recommended for more
-///                         efficient distribution.  This will be clamped to a minimum of one.
+/// @param[in] bucketCount  Number of buckets to allocate in the table.  This is rounded up to a power of two and also
+///                         determines the number of lock stripes used for access synchronization.
 /// @param[in] rHasher      Key hashing functor.
 /// @param[in] rKeyEquals   Key equal comparison functor.
 /// @param[in] rExtractKey  Key extraction functor.
@@ -490,20 +403,20 @@ Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, All
     const EqualKey& rKeyEquals,
     const ExtractKey& rExtractKey,
     const Allocator& rAllocator )
-    : m_bucketCount( Max<size_t>( bucketCount, 1 ) )
-    , m_size( 0 )
+    : m_stripeCount( bucketCount )
+    , m_maxLoadFactor( 1.0f )
     , m_hasher( rHasher )
     , m_keyEquals( rKeyEquals )
     , m_extractKey( rExtractKey )
     , m_allocator( rAllocator )
 {
-    AllocateBuckets();
+    AllocateStripes();
 }
 
 /// Constructor.
 ///
-/// @param[in] bucketCount  Number of buckets to allocate in the table.  Prime numbers are recommended for more
-///                         efficient distribution.  This will be clamped to a minimum of one.
+/// @param[in] bucketCount  Number of buckets to allocate in the table.  This is rounded up to a power of two and also
+///                         determines the number of lock stripes used for access synchronization.
 /// @param[in] rHasher      Key hashing functor.
 /// @param[in] rKeyEquals   Key equal comparison functor.
 /// @param[in] rAllocator   Allocator functor.
@@ -515,13 +428,13 @@ Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, All
     const HashFunction& rHasher,
     const EqualKey& rKeyEquals,
     const Allocator& rAllocator )
-    : m_bucketCount( Max< size_t >( bucketCount, 1 ) )
-    , m_size( 0 )
+    : m_stripeCount( bucketCount )
+    , m_maxLoadFactor( 1.0f )
     , m_hasher( rHasher )
     , m_keyEquals( rKeyEquals )
     , m_allocator( rAllocator )
 {
-    AllocateBuckets();
+    AllocateStripes();
 }
 
 /// Copy constructor.
@@ -547,6 +460,9 @@ Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, All
 
 /// Get the number of entries currently in this table.
 ///
+/// This sums the entry counts of each lock stripe without locking them, so the result is only approximate if the table
+/// is being modified concurrently.
+///
 /// @return  Number of hash table entries.
 ///
 /// @see IsEmpty()
@@ -555,7 +471,15 @@ template<
     typename InternalValue >
 size_t Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetSize() const
 {
-    return static_cast< uint32_t >( m_size );
+    size_t size = 0;
+
+    size_t stripeCount = m_stripeCount;
+    for( size_t stripeIndex = 0; stripeIndex < stripeCount; ++stripeIndex )
+    {
+        size += m_pStripes[ stripeIndex ].size;
+    }
+
+    return size;
 }
 
 /// Get whether this table is currently empty.
@@ -568,28 +492,54 @@ template<
     typename InternalValue >
 bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::IsEmpty() const
 {
-    return ( m_size == 0 );
+    size_t stripeCount = m_stripeCount;
+    for( size_t stripeIndex = 0; stripeIndex < stripeCount; ++stripeIndex )
+    {
+        if( m_pStripes[ stripeIndex ].size != 0 )
+        {
+            return false;
+        }
+    }
+
+    return true;
 }
 
 /// Clear out all entries in this table.
 ///
+/// The bucket array is not shrunk.
+///
 /// @see Trim()
 template<
     typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
     typename InternalValue >
 void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Clear()
 {
-    size_t bucketCount = m_bucketCount;
-    for( size_t bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex )
+    Location location;
+
+    size_t stripeCount = m_stripeCount;
+    for( size_t stripeIndex = 0; stripeIndex < stripeCount; ++stripeIndex )
     {
-        Bucket& rBucket = m_pBuckets[ bucketIndex ];
-        rBucket.lock.LockWrite();
-        rBucket.entries.Clear();
-        AtomicIncrementRelease( rBucket.tag );
-        rBucket.lock.UnlockWrite();
-    }
+        location.stripeIndex = stripeIndex;
+        LockStripe( location, true );
 
-    AtomicExchangeRelease( m_size, 0 );
+        const TableState* pState = m_pState;
+
+        size_t bucketCount = GetStripeBucketCount( pState );
+        for( size_t bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex )
+        {
+            Bucket* pBucket = GetStripeBucket( pState, stripeIndex, bucketIndex );
+            if( pBucket )
+            {
+                pBucket->entries.Clear();
+            }
+        }
+
+        Stripe& rStripe = m_pStripes[ stripeIndex ];
+        AtomicIncrementRelease( rStripe.tag );
+        rStripe.size = 0;
+
+        UnlockStripe( location, true );
+    }
 }
 
 /// Trim all excess memory used in each table bucket.
@@ -600,13 +550,26 @@ template<
     typename InternalValue >
 void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Trim()
 {
-    size_t bucketCount = m_bucketCount;
-    for( size_t bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex )
+    Location location;
+
+    size_t stripeCount = m_stripeCount;
+    for( size_t stripeIndex = 0; stripeIndex < stripeCount; ++stripeIndex )
     {
-        Bucket& rBucket = m_pBuckets[ bucketIndex ];
-        rBucket.lock.LockWrite();
-        rBucket.entries.Trim();
-        rBucket.lock.UnlockWrite();
+        location.stripeIndex = stripeIndex;
+        LockStripe( location, true );
+
+        const TableState* pState = m_pState;
+        size_t bucketCount = GetStripeBucketCount( pState );
+        for( size_t bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex )
+        {
+            Bucket* pBucket = GetStripeBucket( pState, stripeIndex, bucketIndex );
+            if( pBucket )
+            {
+                pBucket->entries.Trim();
+            }
+        }
+
+        UnlockStripe( location, true );
     }
 }
 
@@ -629,123 +592,108 @@ bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey
 
     // Initial quick test for an empty table (table can still become empty while we search for the first element, as
     // well).
-    if( m_size == 0 )
+    if( IsEmpty() )
     {
         return false;
     }
 
     // Search through the table for the first element.
-    HELIUM_ASSERT( m_pBuckets );
-    size_t bucketCount = m_bucketCount;
-    for( size_t bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex )
+    Location location;
+    location.stripeIndex = 0;
+    LockStripe( location, true );
+    location.pState = m_pState;
+    location.bucketIndex = 0;
+    if( !SeekNext( location, true ) )
     {
-        Bucket& rBucket = m_pBuckets[ bucketIndex ];
-        rBucket.lock.LockWrite();
-        if( !rBucket.entries.IsEmpty() )
-        {
-            // Leave the lock intact.
-            rAccessor.Set( this, bucketIndex, 0 );
-
-            return true;
-        }
-
-        rBucket.lock.UnlockWrite();
+        return false;
     }
 
-    return false;
+    // Leave the lock intact.
+    rAccessor.Set( this, location );
+
+    return true;
 }
 
-/// Retrieve a constant accessor referencing the first element in this table.
+/// Retrieve an accessor referencing the last element in this table.
 ///
-/// @param[out] rAccessor  Set to reference the first element in this table if one exists, released if this table is
+/// @param[out] rAccessor  Set to reference the last element in this table if one exists, released if this table is
 ///                        empty.
 ///
 /// @return  True if this table is not empty and the accessor was set, false if this table is empty and the accessor was
 ///          released.
 ///
-/// @see Last()
+/// @see First()
 template<
     typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
     typename InternalValue >
-bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::First(
-    ConstAccessor& rAccessor ) const
+bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Last(
+    Accessor& rAccessor )
 {
     rAccessor.Release();
 
-    // Initial quick test for an empty table (table can still become empty while we search for the first element, as
+    // Initial quick test for an empty table (table can still become empty while we search for the last element, as
     // well).
-    if( m_size == 0 )
+    if( IsEmpty() )
     {
         return false;
     }
 
-    // Search through the table for the first element.
-    HELIUM_ASSERT( m_pBuckets );
-    size_t bucketCount = m_bucketCount;
-    for( size_t bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex )
+    // Search through the table for the last element.
+    Location location;
+    location.stripeIndex = m_stripeCount - 1;
+    LockStripe( location, true );
+    location.pState = m_pState;
+    location.bucketIndex = GetStripeBucketCount( location.pState );
+    if( !SeekPrevious( location, true ) )
     {
-        Bucket& rBucket = m_pBuckets[ bucketIndex ];
-        rBucket.lock.LockRead();
-        if( !rBucket.entries.IsEmpty() )
-        {
-            // Leave the lock intact.
-            rAccessor.Set( this, bucketIndex, 0 );
-
-            return true;
-        }
-
-        rBucket.lock.UnlockRead();
+        return false;
     }
 
-    return false;
+    // Leave the lock intact.
+    rAccessor.Set( this, location );
+
+    return true;
 }
 
-/// Retrieve an accessor referencing the last element in this table.
+/// Retrieve a constant accessor referencing the first element in this table.
 ///
-/// @param[out] rAccessor  Set to reference the last element in this table if one exists, released if this table is
+/// @param[out] rAccessor  Set to reference the first element in this table if one exists, released if this table is
 ///                        empty.
 ///
 /// @return  True if this table is not empty and the accessor was set, false if this table is empty and the accessor was
 ///          released.
 ///
-/// @see First()
+/// @see Last()
 template<
     typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
     typename InternalValue >
-bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Last(
-    Accessor& rAccessor )
+bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::First(
+    ConstAccessor& rAccessor ) const
 {
     rAccessor.Release();
 
-    // Initial quick test for an empty table (table can still become empty while we search for the last element, as
+    // Initial quick test for an empty table (table can still become empty while we search for the first element, as
     // well).
-    if( m_size == 0 )
+    if( IsEmpty() )
     {
         return false;
     }
 
-    // Search through the table for the last element.
-    HELIUM_ASSERT( m_pBuckets );
-    size_t bucketCount = m_bucketCount;
-    while( bucketCount != 0 )
+    // Search through the table for the first element.
+    Location location;
+    location.stripeIndex = 0;
+    LockStripe( location, false );
+    location.pState = m_pState;
+    location.bucketIndex = 0;
+    if( !SeekNext( location, false ) )
     {
-        --bucketCount;
-
-        Bucket& rBucket = m_pBuckets[ bucketCount ];
-        rBucket.lock.LockWrite();
-        size_t entryCount = rBucket.entries.GetSize();
-        if( entryCount != 0 )
-        {
-            // Leave the lock intact.
-            rAccessor.Set( this, bucketCount, entryCount - 1 );
-
-            return true;
-        }
-
-        rBucket.lock.UnlockWrite();
+        return false;
     }
 
-    return false;
+    // Leave the lock intact.
+    rAccessor.Set( this, location );
+
+    return true;
 }
 
 /// Retrieve a constant accessor referencing the last element in this table.
@@ -767,33 +715,26 @@ bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey
 
     // Initial quick test for an empty table (table can still become empty while we search for the last element, as
     // well).
-    if( m_size == 0 )
+    if( IsEmpty() )
     {
         return false;
     }
 
     // Search through the table for the last element.
-    HELIUM_ASSERT( m_pBuckets );
-    size_t bucketCount = m_bucketCount;
-    while( bucketCount != 0 )
+    Location location;
+    location.stripeIndex = m_stripeCount - 1;
+    LockStripe( location, false );
+    location.pState = m_pState;
+    location.bucketIndex = GetStripeBucketCount( location.pState );
+    if( !SeekPrevious( location, false ) )
     {
-        --bucketCount;
-
-        Bucket& rBucket = m_pBuckets[ bucketCount ];
-        rBucket.lock.LockRead();
-        size_t entryCount = rBucket.entries.GetSize();
-        if( entryCount != 0 )
-        {
-            // Leave the lock intact.
-            rAccessor.Set( this, bucketCount, entryCount - 1 );
-
-            return true;
-        }
-
-        rBucket.lock.UnlockRead();
+        return false;
     }
 
-    return false;
+    // Leave the lock intact.
+    rAccessor.Set( this, location );
+
+    return true;
 }
 
 /// Search for an entry in this table with the given key, acquiring read-write access to the element if found.
@@ -812,26 +753,30 @@ bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey
 {
     rAccessor.Release();
 
-    size_t bucketIndex = ( m_hasher( rKey ) % m_bucketCount );
+    size_t hash = HashKey( rKey );
 
-    HELIUM_ASSERT( m_pBuckets );
-    Bucket& rBucket = m_pBuckets[ bucketIndex ];
-    rBucket.lock.LockWrite();
+    Location location;
+    location.stripeIndex = hash & ( m_stripeCount - 1 );
+    LockStripe( location, true );
 
-    DynamicArray< InternalValue, Allocator >& rEntries = rBucket.entries;
+    // Since we have exclusive access to the stripe, help with any bucket migration that is in progress.
+    MigrateStripe( location.stripeIndex, MIGRATION_BUCKET_COUNT );
+
+    DynamicArray< InternalValue, Allocator >& rEntries = LocateBucket( hash, location ).entries;
     size_t entryCount = rEntries.GetSize();
     for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
     {
         if( m_keyEquals( m_extractKey( rEntries[ entryIndex ] ), rKey ) )
         {
             // Leave the lock intact.
-            rAccessor.Set( this, bucketIndex, entryIndex );
+            location.elementIndex = entryIndex;
+            rAccessor.Set( this, location );
 
             return true;
         }
     }
 
-    rBucket.lock.UnlockWrite();
+    UnlockStripe( location, true );
 
     return false;
 }
@@ -852,26 +797,27 @@ bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey
 {
     rAccessor.Release();
 
-    size_t bucketIndex = ( m_hasher( rKey ) % m_bucketCount );
+    size_t hash = HashKey( rKey );
 
-    HELIUM_ASSERT( m_pBuckets );
-    Bucket& rBucket = m_pBuckets[ bucketIndex ];
-    rBucket.lock.LockRead();
+    Location location;
+    location.stripeIndex = hash & ( m_stripeCount - 1 );
+    LockStripe( location, false );
 
-    DynamicArray< InternalValue, Allocator >& rEntries = rBucket.entries;
+    DynamicArray< InternalValue, Allocator >& rEntries = LocateBucket( hash, location ).entries;
     size_t entryCount = rEntries.GetSize();
     for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
     {
         if( m_keyEquals( m_extractKey( rEntries[ entryIndex ] ), rKey ) )
         {
             // Leave the lock intact.
-            rAccessor.Set( this, bucketIndex, entryIndex );
+            location.elementIndex = entryIndex;
+            rAccessor.Set( this, location );
 
             return true;
         }
     }
 
-    rBucket.lock.UnlockRead();
+    UnlockStripe( location, false );
 
     return false;
 }
@@ -893,45 +839,61 @@ bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey
 {
     rAccessor.Release();
 
-    // Acquire a read-only lock on the target bucket.
+    // Acquire a read-only lock on the target stripe.
     const Key& rKey = m_extractKey( rValue );
-    size_t bucketIndex = m_hasher( rKey ) % m_bucketCount;
+    size_t hash = HashKey( rKey );
+
+    Location location;
+    location.stripeIndex = hash & ( m_stripeCount - 1 );
 
-    HELIUM_ASSERT( m_pBuckets );
-    Bucket& rBucket = m_pBuckets[ bucketIndex ];
-    rBucket.lock.LockRead();
+    Stripe& rStripe = m_pStripes[ location.stripeIndex ];
+    location.readToken = rStripe.lock.LockRead();
 
-    int32_t currentTag = rBucket.tag;
+    int32_t currentTag = rStripe.tag;
+    Bucket* pBucket = &LocateBucket( hash, location );
 
-    // Loop as long as entries are removed from the list in between lock switches.
+    // Set once this call has added the entry, as a later pass may find it again if entries were removed or moved while
+    // switching locks.
+    bool bInserted = false;
+
+    // Loop as long as entries are removed or moved in between lock switches.
     for( ; ; )
     {
         // Search for an existing entry.
-        DynamicArray< InternalValue, Allocator >& rEntries = rBucket.entries;
-        size_t entryCount = rEntries.GetSize();
+        size_t entryCount = pBucket->entries.GetSize();
         size_t entryIndex;
         for( entryIndex = 0; entryIndex < entryCount; ++entryIndex )
         {
-            if( m_keyEquals( m_extractKey( rEntries[ entryIndex ] ), rKey ) )
+            if( m_keyEquals( m_extractKey( pBucket->entries[ entryIndex ] ), rKey ) )
             {
-                rAccessor.Set( this, bucketIndex, entryIndex );
+                location.elementIndex = entryIndex;
+                rAccessor.Set( this, location );
 
-                return false;
+                if( bInserted )
+                {
+                    CheckGrowth( location.stripeIndex );
+                }
+
+                return bInserted;
             }
         }
 
         // Entry not found, so switch to an exclusive lock so we can attempt to add the new entry.
-        rBucket.lock.UnlockRead();
-        rBucket.lock.LockWrite();
+        rStripe.lock.UnlockRead( location.readToken );
+        rStripe.lock.LockWrite();
+
+        MigrateStripe( location.stripeIndex, MIGRATION_BUCKET_COUNT );
 
-        // If entries were removed, we need to re-search through the entry list, otherwise we know we only need to
-        // search for new entries that may have been added during the lock switch.
-        bool bInserted = false;
+        // If entries were removed or migrated, we need to re-search through the entry list, otherwise we know we only
+        // need to search for new entries that may have been added during the lock switch.
+        Bucket* pPreviousBucket = pBucket;
+        pBucket = &LocateBucket( hash, location );
 
-        int32_t newTag = rBucket.tag;
-        size_t startIndex = ( currentTag == newTag ? entryCount : 0 );
+        int32_t newTag = rStripe.tag;
+        size_t startIndex = ( currentTag == newTag && pBucket == pPreviousBucket ? entryCount : 0 );
         currentTag = newTag;
 
+        DynamicArray< InternalValue, Allocator >& rEntries = pBucket->entries;
         entryCount = rEntries.GetSize();
         for( entryIndex = startIndex; entryIndex < entryCount; ++entryIndex )
         {
@@ -950,23 +912,31 @@ bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey
             rEntries.Add( rValue );
             HELIUM_ASSERT( entryIndex == entryCount );
 
-            AtomicIncrementRelease( m_size );
+            ++rStripe.size;
 
             bInserted = true;
         }
 
         // Switch back to a read lock.
-        rBucket.lock.UnlockWrite();
-        rBucket.lock.LockRead();
+        rStripe.lock.UnlockWrite();
+        location.readToken = rStripe.lock.LockRead();
 
-        // We can finally set the accessor and return if no entries were removed while switching locks.
-        newTag = rBucket.tag;
+        // We can finally set the accessor and return if no entries were removed or migrated while switching locks.
+        newTag = rStripe.tag;
         if( currentTag == newTag )
         {
-            rAccessor.Set( this, bucketIndex, entryIndex );
+            location.elementIndex = entryIndex;
+            rAccessor.Set( this, location );
+
+            if( bInserted )
+            {
+                CheckGrowth( location.stripeIndex );
+            }
 
             return bInserted;
         }
+
+        pBucket = &LocateBucket( hash, location );
     }
 }
 
@@ -987,22 +957,25 @@ bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey
 {
     rAccessor.Release();
 
-    // Acquire a read-write lock on the target bucket.
+    // Acquire a read-write lock on the target stripe.
     const Key& rKey = m_extractKey( rValue );
-    size_t bucketIndex = m_hasher( rKey ) % m_bucketCount;
+    size_t hash = HashKey( rKey );
 
-    HELIUM_ASSERT( m_pBuckets );
-    Bucket& rBucket = m_pBuckets[ bucketIndex ];
-    rBucket.lock.LockWrite();
+    Location location;
+    location.stripeIndex = hash & ( m_stripeCount - 1 );
+    LockStripe( location, true );
+
+    MigrateStripe( location.stripeIndex, MIGRATION_BUCKET_COUNT );
 
     // Search for an existing entry.
-    DynamicArray< InternalValue, Allocator >& rEntries = rBucket.entries;
+    DynamicArray< InternalValue, Allocator >& rEntries = LocateBucket( hash, location ).entries;
     size_t entryCount = rEntries.GetSize();
     for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
     {
         if( m_keyEquals( m_extractKey( rEntries[ entryIndex ] ), rKey ) )
         {
-            rAccessor.Set( this, bucketIndex, entryIndex );
+            location.elementIndex = entryIndex;
+            rAccessor.Set( this, location );
 
             return false;
         }
@@ -1010,9 +983,12 @@ bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey
 
     // Entry not found, so add it to the table.
     rEntries.Add( rValue );
-    AtomicIncrementRelease( m_size );
+    ++m_pStripes[ location.stripeIndex ].size;
+
+    location.elementIndex = entryCount;
+    rAccessor.Set( this, location );
 
-    rAccessor.Set( this, bucketIndex, entryCount );
+    CheckGrowth( location.stripeIndex );
 
     return true;
 }
@@ -1027,32 +1003,36 @@ template<
     typename InternalValue >
 bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Remove( const Key& rKey )
 {
-    // Acquire a read-write lock on the target bucket.
-    size_t bucketIndex = m_hasher( rKey ) % m_bucketCount;
+    // Acquire a read-write lock on the target stripe.
+    size_t hash = HashKey( rKey );
 
-    HELIUM_ASSERT( m_pBuckets );
-    Bucket& rBucket = m_pBuckets[ bucketIndex ];
-    rBucket.lock.LockWrite();
+    Location location;
+    location.stripeIndex = hash & ( m_stripeCount - 1 );
+    LockStripe( location, true );
+
+    MigrateStripe( location.stripeIndex, MIGRATION_BUCKET_COUNT );
 
     // Search for an entry with the specified key.
-    DynamicArray< InternalValue, Allocator >& rEntries = rBucket.entries;
+    DynamicArray< InternalValue, Allocator >& rEntries = LocateBucket( hash, location ).entries;
     size_t entryCount = rEntries.GetSize();
     for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
     {
         if( m_keyEquals( m_extractKey( rEntries[ entryIndex ] ), rKey ) )
         {
             rEntries.RemoveSwap( entryIndex );
-            AtomicIncrementRelease( rBucket.tag );
-            AtomicDecrementRelease( m_size );
 
-            rBucket.lock.UnlockWrite();
+            Stripe& rStripe = m_pStripes[ location.stripeIndex ];
+            AtomicIncrementRelease( rStripe.tag );
+            --rStripe.size;
+
+            UnlockStripe( location, true );
 
             return true;
         }
     }
 
     // Entry not found, so no action has been taken.
-    rBucket.lock.UnlockWrite();
+    UnlockStripe( location, true );
 
     return false;
 }
@@ -1077,13 +1057,14 @@ bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey
     }
 
     // Lock already exists, so just remove the entry.
-    HELIUM_ASSERT( m_pBuckets );
-    Bucket& rBucket = m_pBuckets[ rAccessor.m_bucketIndex ];
+    Location& rLocation = rAccessor.m_location;
+    HELIUM_ASSERT( rLocation.pBucket );
+    HELIUM_ASSERT( rLocation.elementIndex < rLocation.pBucket->entries.GetSize() );
+    rLocation.pBucket->entries.RemoveSwap( rLocation.elementIndex );
 
-    HELIUM_ASSERT( rAccessor.m_elementIndex < rBucket.entries.GetSize() );
-    rBucket.entries.RemoveSwap( rAccessor.m_elementIndex );
-    AtomicIncrementRelease( rBucket.tag );
-    AtomicDecrementRelease( m_size );
+    Stripe& rStripe = m_pStripes[ rLocation.stripeIndex ];
+    AtomicIncrementRelease( rStripe.tag );
+    --rStripe.size;
 
     // Release the accessor (this removes the lock as well).
     rAccessor.Release();
@@ -1091,81 +1072,1212 @@ bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey
     return true;
 }
 
-/// Assignment operator.
+/// Get the number of buckets in the current bucket array.
 ///
-/// @param[in] rSource  Source table from which to copy.
+/// @return  Current bucket count.
 ///
-/// @return  Reference to this object.
+/// @see GetLoadFactor()
 template<
     typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
     typename InternalValue >
-Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >&
-    Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator=(
-        const ConcurrentHashTable& rSource )
+size_t Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetBucketCount() const
 {
-    if( this != &rSource )
-    {
-        Finalize();
-        CopyConstruct( rSource );
-    }
+    return m_pState->bucketCount;
+}
 
-    return *this;
+/// Get the current ratio of entries to buckets.
+///
+/// @return  Current load factor.
+///
+/// @see GetMaxLoadFactor(), GetBucketCount()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+float32_t Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetLoadFactor() const
+{
+    return static_cast< float32_t >( GetSize() ) / static_cast< float32_t >( m_pState->bucketCount );
 }
 
-/// Allocate hash table buckets.
+/// Get the maximum ratio of entries to buckets allowed before the bucket array is grown.
+///
+/// @return  Maximum load factor.
+///
+/// @see SetMaxLoadFactor(), GetLoadFactor()
 template<
     typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
     typename InternalValue >
-void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::AllocateBuckets()
+float32_t Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetMaxLoadFactor() const
 {
-    size_t bucketCount = m_bucketCount;
+    return m_maxLoadFactor;
+}
 
-    void* pBuffer = m_allocator.Allocate( sizeof( Bucket ) * bucketCount );
-    HELIUM_ASSERT( pBuffer );
+/// Set the maximum ratio of entries to buckets allowed before the bucket array is grown.
+///
+/// This is not synchronized with other table operations, so it should be set before the table is shared between
+/// threads.  A value of zero or less disables automatic growth.
+///
+/// @param[in] maxLoadFactor  Maximum load factor.
+///
+/// @see GetMaxLoadFactor(), GetLoadFactor()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::SetMaxLoadFactor( float32_t maxLoadFactor )
+{
+    m_maxLoadFactor = maxLoadFactor;
+}
 
-    Bucket* pBuckets = ArrayInPlaceConstruct< Bucket >( pBuffer, bucketCount );
-    HELIUM_ASSERT( pBuckets == pBuffer );
-    for( size_t bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex )
+/// Get whether entries are currently being migrated to a resized bucket array.
+///
+/// @return  True if a migration is in progress, false if not.
+///
+/// @see GetMigrationProgress(), CompleteMigration()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::IsMigrating() const
+{
+    return ( m_pState->pOldBuckets != NULL );
+}
+
+/// Get the progress of any migration of entries to a resized bucket array.
+///
+/// @return  Fraction of old buckets that have been migrated, in the range [0, 1] (one if no migration is in progress).
+///
+/// @see IsMigrating(), CompleteMigration()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+float32_t Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetMigrationProgress() const
+{
+    const TableState* pState = m_pState;
+    if( !pState->pOldBuckets )
     {
-        pBuckets[ bucketIndex ].tag = 0;
+        return 1.0f;
     }
 
-    m_pBuckets = pBuckets;
+    return static_cast< float32_t >( pState->migratedBucketCount ) / static_cast< float32_t >( pState->oldBucketCount );
 }
 
-/// Allocate and construct a copy of the specified object, assuming all data in this object is uninitialized.
+/// Migrate all remaining entries to the current bucket array and free the bucket arrays retired by previous resizes.
 ///
-/// @param[in] rSource  Object to copy.
+/// Migration normally happens incrementally as entries are inserted and removed.  A bucket array replaced by a resize
+/// spans every lock stripe, and each reader or writer only holds the lock of the stripe it is working in, so the array
+/// may still be in use through any other stripe.  It can therefore only be freed with every stripe locked at once,
+/// which ordinary operations never do, so retired arrays are kept until this is called or the table is destroyed.
+/// Long-running processes with tables that keep growing should call this periodically (such as after a burst of
+/// insertions) to release that memory.
+///
+/// Remaining entries are migrated with one stripe locked at a time, after which all stripes are locked together
+/// briefly to free the retired bucket arrays, so the caller must not hold any accessors for this table.
+///
+/// @see IsMigrating(), GetMigrationProgress()
 template<
     typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
     typename InternalValue >
-void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::CopyConstruct(
-    const ConcurrentHashTable& rSource )
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::CompleteMigration()
 {
-    size_t bucketCount = rSource.m_bucketCount;
-    m_bucketCount = bucketCount;
+    Location location;
 
-    m_size = rSource.m_size;
+    size_t stripeCount = m_stripeCount;
+    for( size_t stripeIndex = 0; stripeIndex < stripeCount && m_pState->pOldBuckets; ++stripeIndex )
+    {
+        location.stripeIndex = stripeIndex;
+        LockStripe( location, true );
+        MigrateStripe( stripeIndex, Invalid< size_t >() );
+        UnlockStripe( location, true );
+    }
 
-    m_hasher = rSource.m_hasher;
-    m_keyEquals = rSource.m_keyEquals;
-    m_extractKey = rSource.m_extractKey;
-    m_allocator = rSource.m_allocator;
+    // With every stripe locked, nothing can be referencing the bucket arrays of any previous table state.  Another
+    // thread may have started growing the table again since the loop above, so finish that migration first.
+    for( size_t stripeIndex = 0; stripeIndex < stripeCount; ++stripeIndex )
+    {
+        location.stripeIndex = stripeIndex;
+        LockStripe( location, true );
+    }
 
-    AllocateBuckets();
+    for( size_t stripeIndex = 0; stripeIndex < stripeCount; ++stripeIndex )
+    {
+        MigrateStripe( stripeIndex, Invalid< size_t >() );
+    }
 
-    for( size_t bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex )
+    ReleaseRetiredStates();
+
+    for( size_t stripeIndex = stripeCount; stripeIndex-- != 0; )
     {
-        m_pBuckets[ bucketIndex ].entries = rSource.m_pBuckets[ bucketIndex ].entries;
+        location.stripeIndex = stripeIndex;
+        UnlockStripe( location, true );
     }
 }
 
-/// Free all allocated resources, but don't clear out any variables unless necessary.
+/// Search for entries in this table with each of the given keys, passing each entry found to a function object.
+///
+/// Keys are grouped by lock stripe so that each stripe is locked only once for the entire batch, and buckets are
+/// prefetched for blocks of keys at a time before they are searched.  The function object is called with a read-only
+/// lock held on the stripe containing the entry, so it must not access this table itself.  Keys are not visited in the
+/// order given.
+///
+/// @param[in] pKeys     Array of keys to locate.
+/// @param[in] keyCount  Number of keys in the key array.
+/// @param[in] function  Function or function object called as function( keyIndex, rEntry ) for each key found, where
+///                      keyIndex is the index of the key in the given array and rEntry is a constant reference to the
+///                      table entry.  The function object is taken by value, so pass a std::ref() wrapper to collect
+///                      results in an existing object.
+///
+/// @return  Number of keys found.
+///
+/// @see Find()
 template<
     typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
     typename InternalValue >
-void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Finalize()
+template< typename Function >
+size_t Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::FindBatch(
+    const Key* pKeys,
+    size_t keyCount,
+    Function function ) const
 {
-    ArrayInPlaceDestruct( m_pBuckets, m_bucketCount );
-    m_allocator.Free( m_pBuckets );
+    HELIUM_ASSERT( pKeys || keyCount == 0 );
+
+    DynamicArray< size_t, Allocator > hashes;
+    hashes.Reserve( keyCount );
+    for( size_t keyIndex = 0; keyIndex < keyCount; ++keyIndex )
+    {
+        hashes.Add( HashKey( pKeys[ keyIndex ] ) );
+    }
+
+    DynamicArray< size_t, Allocator > order;
+    GroupByStripe( hashes.GetData(), keyCount, order );
+
+    size_t foundCount = 0;
+
+    Location location;
+    Bucket* pBuckets[ BATCH_BLOCK_SIZE ];
+
+    size_t stripeMask = m_stripeCount - 1;
+    size_t runStart = 0;
+    while( runStart < keyCount )
+    {
+        location.stripeIndex = hashes[ order[ runStart ] ] & stripeMask;
+
+        size_t runEnd = runStart + 1;
+        while( runEnd < keyCount && ( hashes[ order[ runEnd ] ] & stripeMask ) == location.stripeIndex )
+        {
+            ++runEnd;
+        }
+
+        LockStripe( location, false );
+
+        for( size_t blockStart = runStart; blockStart < runEnd; blockStart += BATCH_BLOCK_SIZE )
+        {
+            size_t blockSize = runEnd - blockStart;
+            if( blockSize > BATCH_BLOCK_SIZE )
+            {
+                blockSize = BATCH_BLOCK_SIZE;
+            }
+
+            LocateBatchBuckets( hashes.GetData(), order.GetData() + blockStart, blockSize, location, pBuckets );
+
+            for( size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex )
+            {
+                size_t keyIndex = order[ blockStart + blockIndex ];
+                const Key& rKey = pKeys[ keyIndex ];
+
+                const DynamicArray< InternalValue, Allocator >& rEntries = pBuckets[ blockIndex ]->entries;
+                size_t entryCount = rEntries.GetSize();
+                for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+                {
+                    const Value& rEntry = rEntries[ entryIndex ];
+                    if( m_keyEquals( m_extractKey( rEntry ), rKey ) )
+                    {
+                        function( keyIndex, rEntry );
+                        ++foundCount;
+
+                        break;
+                    }
+                }
+            }
+        }
+
+        UnlockStripe( location, false );
+
+        runStart = runEnd;
+    }
+
+    return foundCount;
+}
+
+/// Insert copies of each of the given values for which an entry with the same key does not already exist in this table.
+///
+/// Values are grouped by lock stripe so that each stripe is locked only once for the entire batch, and buckets are
+/// prefetched for blocks of values at a time before they are searched and updated.
+///
+/// @param[in]  pValues     Array of values to insert.
+/// @param[in]  valueCount  Number of values in the value array.
+/// @param[out] pInserted   If not null, array of flags (one per value) that will be set to true if the corresponding
+///                         value was inserted, or false if an entry with the same key already existed.
+///
+/// @return  Number of values inserted.
+///
+/// @see Insert()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::InsertBatch(
+    const Value* pValues,
+    size_t valueCount,
+    bool* pInserted )
+{
+    HELIUM_ASSERT( pValues || valueCount == 0 );
+
+    DynamicArray< size_t, Allocator > hashes;
+    hashes.Reserve( valueCount );
+    for( size_t valueIndex = 0; valueIndex < valueCount; ++valueIndex )
+    {
+        hashes.Add( HashKey( m_extractKey( pValues[ valueIndex ] ) ) );
+    }
+
+    DynamicArray< size_t, Allocator > order;
+    GroupByStripe( hashes.GetData(), valueCount, order );
+
+    size_t insertedCount = 0;
+
+    Location location;
+    Bucket* pBuckets[ BATCH_BLOCK_SIZE ];
+
+    size_t stripeMask = m_stripeCount - 1;
+    size_t runStart = 0;
+    while( runStart < valueCount )
+    {
+        location.stripeIndex = hashes[ order[ runStart ] ] & stripeMask;
+
+        size_t runEnd = runStart + 1;
+        while( runEnd < valueCount && ( hashes[ order[ runEnd ] ] & stripeMask ) == location.stripeIndex )
+        {
+            ++runEnd;
+        }
+
+        LockStripe( location, true );
+
+        MigrateStripe( location.stripeIndex, MIGRATION_BUCKET_COUNT );
+
+        Stripe& rStripe = m_pStripes[ location.stripeIndex ];
+        size_t runInsertedCount = 0;
+
+        for( size_t blockStart = runStart; blockStart < runEnd; blockStart += BATCH_BLOCK_SIZE )
+        {
+            size_t blockSize = runEnd - blockStart;
+            if( blockSize > BATCH_BLOCK_SIZE )
+            {
+                blockSize = BATCH_BLOCK_SIZE;
+            }
+
+            LocateBatchBuckets( hashes.GetData(), order.GetData() + blockStart, blockSize, location, pBuckets );
+
+            for( size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex )
+            {
+                size_t valueIndex = order[ blockStart + blockIndex ];
+                const Value& rValue = pValues[ valueIndex ];
+                const Key& rKey = m_extractKey( rValue );
+
+                DynamicArray< InternalValue, Allocator >& rEntries = pBuckets[ blockIndex ]->entries;
+                size_t entryCount = rEntries.GetSize();
+                size_t entryIndex;
+                for( entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+                {
+                    if( m_keyEquals( m_extractKey( rEntries[ entryIndex ] ), rKey ) )
+                    {
+                        break;
+                    }
+                }
+
+                bool bInserted = ( entryIndex >= entryCount );
+                if( bInserted )
+                {
+                    rEntries.Add( rValue );
+                    ++rStripe.size;
+                    ++runInsertedCount;
+                }
+
+                if( pInserted )
+                {
+                    pInserted[ valueIndex ] = bInserted;
+                }
+            }
+        }
+
+        if( runInsertedCount != 0 )
+        {
+            insertedCount += runInsertedCount;
+            CheckGrowth( location.stripeIndex );
+        }
+
+        UnlockStripe( location, true );
+
+        runStart = runEnd;
+    }
+
+    return insertedCount;
+}
+
+/// Remove any entries with the given keys from this table.
+///
+/// Keys are grouped by lock stripe so that each stripe is locked only once for the entire batch, and buckets are
+/// prefetched for blocks of keys at a time before they are searched.
+///
+/// @param[in]  pKeys     Array of keys to remove.
+/// @param[in]  keyCount  Number of keys in the key array.
+/// @param[out] pRemoved  If not null, array of flags (one per key) that will be set to true if an entry with the
+///                       corresponding key was found and removed, or false if not.
+///
+/// @return  Number of entries removed.
+///
+/// @see Remove()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::RemoveBatch(
+    const Key* pKeys,
+    size_t keyCount,
+    bool* pRemoved )
+{
+    HELIUM_ASSERT( pKeys || keyCount == 0 );
+
+    DynamicArray< size_t, Allocator > hashes;
+    hashes.Reserve( keyCount );
+    for( size_t keyIndex = 0; keyIndex < keyCount; ++keyIndex )
+    {
+        hashes.Add( HashKey( pKeys[ keyIndex ] ) );
+    }
+
+    DynamicArray< size_t, Allocator > order;
+    GroupByStripe( hashes.GetData(), keyCount, order );
+
+    size_t removedCount = 0;
+
+    Location location;
+    Bucket* pBuckets[ BATCH_BLOCK_SIZE ];
+
+    size_t stripeMask = m_stripeCount - 1;
+    size_t runStart = 0;
+    while( runStart < keyCount )
+    {
+        location.stripeIndex = hashes[ order[ runStart ] ] & stripeMask;
+
+        size_t runEnd = runStart + 1;
+        while( runEnd < keyCount && ( hashes[ order[ runEnd ] ] & stripeMask ) == location.stripeIndex )
+        {
+            ++runEnd;
+        }
+
+        LockStripe( location, true );
+
+        MigrateStripe( location.stripeIndex, MIGRATION_BUCKET_COUNT );
+
+        Stripe& rStripe = m_pStripes[ location.stripeIndex ];
+        size_t runRemovedCount = 0;
+
+        for( size_t blockStart = runStart; blockStart < runEnd; blockStart += BATCH_BLOCK_SIZE )
+        {
+            size_t blockSize = runEnd - blockStart;
+            if( blockSize > BATCH_BLOCK_SIZE )
+            {
+                blockSize = BATCH_BLOCK_SIZE;
+            }
+
+            LocateBatchBuckets( hashes.GetData(), order.GetData() + blockStart, blockSize, location, pBuckets );
+
+            for( size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex )
+            {
+                size_t keyIndex = order[ blockStart + blockIndex ];
+                const Key& rKey = pKeys[ keyIndex ];
+
+                bool bRemoved = false;
+
+                DynamicArray< InternalValue, Allocator >& rEntries = pBuckets[ blockIndex ]->entries;
+                size_t entryCount = rEntries.GetSize();
+                for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+                {
+                    if( m_keyEquals( m_extractKey( rEntries[ entryIndex ] ), rKey ) )
+                    {
+                        rEntries.RemoveSwap( entryIndex );
+                        --rStripe.size;
+                        ++runRemovedCount;
+                        bRemoved = true;
+
+                        break;
+                    }
+                }
+
+                if( pRemoved )
+                {
+                    pRemoved[ keyIndex ] = bRemoved;
+                }
+            }
+        }
+
+        if( runRemovedCount != 0 )
+        {
+            removedCount += runRemovedCount;
+            AtomicIncrementRelease( rStripe.tag );
+        }
+
+        UnlockStripe( location, true );
+
+        runStart = runEnd;
+    }
+
+    return removedCount;
+}
+
+/// Assignment operator.
+///
+/// @param[in] rSource  Source table from which to copy.
+///
+/// @return  Reference to this object.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >&
+    Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator=(
+        const ConcurrentHashTable& rSource )
+{
+    if( this != &rSource )
+    {
+        Finalize();
+        CopyConstruct( rSource );
+    }
+
+    return *this;
+}
+
+/// Compute the hash value for a key.
+///
+/// @param[in] rKey  Key to hash.
+///
+/// @return  Mixed hash value, used for selecting both lock stripes and buckets.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::HashKey( const Key& rKey ) const
+{
+    return MixHash( m_hasher( rKey ) );
+}
+
+/// Acquire the lock for the lock stripe referenced by a table location.
+///
+/// @param[in,out] rLocation  Location specifying the stripe to lock (the read lock token is updated as well).
+/// @param[in]     bWrite     True to acquire an exclusive (read-write) lock, false to acquire a shared (read-only) lock.
+///
+/// @see UnlockStripe()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::LockStripe(
+    Location& rLocation,
+    bool bWrite ) const
+{
+    HELIUM_ASSERT( rLocation.stripeIndex < m_stripeCount );
+
+    BiasedReadWriteLock& rLock = m_pStripes[ rLocation.stripeIndex ].lock;
+    if( bWrite )
+    {
+        rLock.LockWrite();
+        SetInvalid( rLocation.readToken );
+    }
+    else
+    {
+        rLocation.readToken = rLock.LockRead();
+    }
+}
+
+/// Release the lock for the lock stripe referenced by a table location.
+///
+/// @param[in] rLocation  Location specifying the stripe to unlock.
+/// @param[in] bWrite     True if an exclusive (read-write) lock is held, false if a shared (read-only) lock is held.
+///
+/// @see LockStripe()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::UnlockStripe(
+    const Location& rLocation,
+    bool bWrite ) const
+{
+    HELIUM_ASSERT( rLocation.stripeIndex < m_stripeCount );
+
+    BiasedReadWriteLock& rLock = m_pStripes[ rLocation.stripeIndex ].lock;
+    if( bWrite )
+    {
+        rLock.UnlockWrite();
+    }
+    else
+    {
+        rLock.UnlockRead( rLocation.readToken );
+    }
+}
+
+/// Locate the bucket in which an entry with the given hash is stored.
+///
+/// The stripe covering the bucket (set in the location stripe index) must already be locked.  The current table state
+/// is loaded into the given location.
+///
+/// @param[in]     hash       Mixed key hash.
+/// @param[in,out] rLocation  Location to update with the table state and bucket information (the element index is
+///                           left untouched).
+///
+/// @return  Bucket in which the entry is stored.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+typename Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Bucket&
+    Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::LocateBucket( size_t hash, Location& rLocation ) const
+{
+    HELIUM_ASSERT( rLocation.stripeIndex == ( hash & ( m_stripeCount - 1 ) ) );
+
+    const TableState* pState = m_pState;
+    HELIUM_ASSERT( pState );
+    rLocation.pState = pState;
+
+    size_t stripeCount = m_stripeCount;
+    size_t bucketIndexBase = 0;
+
+    // Entries stay in the old bucket array until their bucket is migrated.
+    if( pState->pOldBuckets )
+    {
+        size_t oldBucketIndex = hash & ( pState->oldBucketCount - 1 );
+        Bucket& rOldBucket = pState->pOldBuckets[ oldBucketIndex ];
+        if( !rOldBucket.bMigrated )
+        {
+            rLocation.pBucket = &rOldBucket;
+            rLocation.bucketIndex = oldBucketIndex / stripeCount;
+
+            return rOldBucket;
+        }
+
+        bucketIndexBase = pState->oldBucketCount / stripeCount;
+    }
+
+    size_t bucketIndex = hash & ( pState->bucketCount - 1 );
+    Bucket& rBucket = pState->pBuckets[ bucketIndex ];
+    rLocation.pBucket = &rBucket;
+    rLocation.bucketIndex = bucketIndexBase + bucketIndex / stripeCount;
+
+    return rBucket;
+}
+
+/// Sort the entries of a batch operation by lock stripe.
+///
+/// A counting sort is used, so the sort is stable and runs in time linear in both the batch size and stripe count.
+///
+/// @param[in]  pHashes  Array of mixed key hashes for the batch entries.
+/// @param[in]  count    Number of entries in the batch.
+/// @param[out] rOrder   Set to the batch entry indices ordered by stripe index.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GroupByStripe(
+    const size_t* pHashes,
+    size_t count,
+    DynamicArray< size_t, Allocator >& rOrder ) const
+{
+    size_t stripeCount = m_stripeCount;
+    size_t stripeMask = stripeCount - 1;
+
+    DynamicArray< size_t, Allocator > stripeOffsets;
+    stripeOffsets.Add( 0, stripeCount + 1 );
+    for( size_t index = 0; index < count; ++index )
+    {
+        ++stripeOffsets[ ( pHashes[ index ] & stripeMask ) + 1 ];
+    }
+
+    for( size_t stripeIndex = 1; stripeIndex < stripeCount; ++stripeIndex )
+    {
+        stripeOffsets[ stripeIndex + 1 ] += stripeOffsets[ stripeIndex ];
+    }
+
+    rOrder.Resize( count );
+    for( size_t index = 0; index < count; ++index )
+    {
+        rOrder[ stripeOffsets[ pHashes[ index ] & stripeMask ]++ ] = index;
+    }
+}
+
+/// Locate the buckets for a block of batch entries covered by the same lock stripe, prefetching each bucket followed by
+/// the entries stored in it.
+///
+/// The stripe covering the buckets (set in the location stripe index) must already be locked.
+///
+/// @param[in]     pHashes   Array of mixed key hashes for all batch entries.
+/// @param[in]     pIndices  Indices of the batch entries in the block.
+/// @param[in]     count     Number of batch entries in the block.
+/// @param[in,out] rLocation  Location of the locked stripe (updated with the current table state).
+/// @param[out]    ppBuckets  Array set to the bucket for each batch entry in the block.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::LocateBatchBuckets(
+    const size_t* pHashes,
+    const size_t* pIndices,
+    size_t count,
+    Location& rLocation,
+    Bucket** ppBuckets ) const
+{
+    for( size_t index = 0; index < count; ++index )
+    {
+        Bucket* pBucket = &LocateBucket( pHashes[ pIndices[ index ] ], rLocation );
+        PrefetchHashData( pBucket );
+        ppBuckets[ index ] = pBucket;
+    }
+
+    for( size_t index = 0; index < count; ++index )
+    {
+        const InternalValue* pEntries = ppBuckets[ index ]->entries.GetData();
+        if( pEntries )
+        {
+            PrefetchHashData( pEntries );
+        }
+    }
+}
+
+/// Get the number of buckets (including any old buckets pending migration) covered by each lock stripe.
+///
+/// @param[in] pState  Table state.
+///
+/// @return  Number of stripe-local buckets.
+///
+/// @see GetStripeBucket()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetStripeBucketCount( const TableState* pState ) const
+{
+    HELIUM_ASSERT( pState );
+
+    size_t bucketCount = pState->bucketCount;
+    if( pState->pOldBuckets )
+    {
+        bucketCount += pState->oldBucketCount;
+    }
+
+    return bucketCount / m_stripeCount;
+}
+
+/// Get a bucket covered by a given lock stripe.
+///
+/// @param[in] pState       Table state.
+/// @param[in] stripeIndex  Lock stripe index.
+/// @param[in] bucketIndex  Stripe-local bucket index.
+///
+/// @return  Bucket, or null if the specified bucket is an old bucket that has already been migrated.
+///
+/// @see GetStripeBucketCount()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+typename Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Bucket*
+    Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetStripeBucket( const TableState* pState, size_t stripeIndex, size_t bucketIndex ) const
+{
+    HELIUM_ASSERT( pState );
+    HELIUM_ASSERT( bucketIndex < GetStripeBucketCount( pState ) );
+
+    size_t stripeCount = m_stripeCount;
+
+    if( pState->pOldBuckets )
+    {
+        size_t oldBucketCount = pState->oldBucketCount / stripeCount;
+        if( bucketIndex < oldBucketCount )
+        {
+            Bucket& rOldBucket = pState->pOldBuckets[ bucketIndex * stripeCount + stripeIndex ];
+
+            return ( rOldBucket.bMigrated ? NULL : &rOldBucket );
+        }
+
+        bucketIndex -= oldBucketCount;
+    }
+
+    return &pState->pBuckets[ bucketIndex * stripeCount + stripeIndex ];
+}
+
+/// Advance a location to the first entry at or after the start of the current stripe-local bucket.
+///
+/// The stripe referenced by the location must already be locked.  If no more entries exist in the current stripe, its
+/// lock is released and the search continues through subsequent stripes.
+///
+/// @param[in,out] rLocation  Location to update.
+/// @param[in]     bWrite     True if stripes should be locked for read-write access, false for read-only access.
+///
+/// @return  True if an entry was found (its stripe is left locked), false if the end of the table was reached (no
+///          stripes are left locked).
+///
+/// @see SeekPrevious()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::SeekNext( Location& rLocation, bool bWrite ) const
+{
+    size_t stripeCount = m_stripeCount;
+    for( ; ; )
+    {
+        const TableState* pState = rLocation.pState;
+        size_t bucketCount = GetStripeBucketCount( pState );
+        for( size_t bucketIndex = rLocation.bucketIndex; bucketIndex < bucketCount; ++bucketIndex )
+        {
+            Bucket* pBucket = GetStripeBucket( pState, rLocation.stripeIndex, bucketIndex );
+            if( pBucket && !pBucket->entries.IsEmpty() )
+            {
+                rLocation.pBucket = pBucket;
+                rLocation.bucketIndex = bucketIndex;
+                rLocation.elementIndex = 0;
+
+                return true;
+            }
+        }
+
+        UnlockStripe( rLocation, bWrite );
+
+        ++rLocation.stripeIndex;
+        if( rLocation.stripeIndex >= stripeCount )
+        {
+            return false;
+        }
+
+        LockStripe( rLocation, bWrite );
+        rLocation.pState = m_pState;
+        rLocation.bucketIndex = 0;
+    }
+}
+
+/// Move a location back to the last entry prior to the start of the current stripe-local bucket.
+///
+/// The stripe referenced by the location must already be locked.  If no more entries exist in the current stripe, its
+/// lock is released and the search continues backward through preceding stripes.
+///
+/// @param[in,out] rLocation  Location to update.
+/// @param[in]     bWrite     True if stripes should be locked for read-write access, false for read-only access.
+///
+/// @return  True if an entry was found (its stripe is left locked), false if the start of the table was reached (no
+///          stripes are left locked).
+///
+/// @see SeekNext()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+bool Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::SeekPrevious( Location& rLocation, bool bWrite ) const
+{
+    for( ; ; )
+    {
+        const TableState* pState = rLocation.pState;
+        size_t bucketIndex = rLocation.bucketIndex;
+        while( bucketIndex != 0 )
+        {
+            --bucketIndex;
+
+            Bucket* pBucket = GetStripeBucket( pState, rLocation.stripeIndex, bucketIndex );
+            if( pBucket )
+            {
+                size_t entryCount = pBucket->entries.GetSize();
+                if( entryCount != 0 )
+                {
+                    rLocation.pBucket = pBucket;
+                    rLocation.bucketIndex = bucketIndex;
+                    rLocation.elementIndex = entryCount - 1;
+
+                    return true;
+                }
+            }
+        }
+
+        UnlockStripe( rLocation, bWrite );
+
+        if( rLocation.stripeIndex == 0 )
+        {
+            return false;
+        }
+
+        --rLocation.stripeIndex;
+
+        LockStripe( rLocation, bWrite );
+        rLocation.pState = m_pState;
+        rLocation.bucketIndex = GetStripeBucketCount( rLocation.pState );
+    }
+}
+
+/// Start growing the bucket array if the maximum load factor has been exceeded.
+///
+/// This only publishes the new bucket array; entries are migrated by subsequent write operations.  Nothing is done if a
+/// migration is already in progress.  To avoid summing the entry counts of every stripe on each insertion, the load
+/// factor is estimated from the given stripe alone (the caller must hold a lock on it).
+///
+/// @param[in] stripeIndex  Index of the stripe into which an entry was just inserted.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::CheckGrowth(
+    size_t stripeIndex )
+{
+    float32_t maxLoadFactor = m_maxLoadFactor;
+    if( maxLoadFactor <= 0.0f )
+    {
+        return;
+    }
+
+    TableState* pState = m_pState;
+    float32_t stripeBucketCount = static_cast< float32_t >( pState->bucketCount / m_stripeCount );
+    if( pState->pOldBuckets ||
+        static_cast< float32_t >( m_pStripes[ stripeIndex ].size ) <= stripeBucketCount * maxLoadFactor )
+    {
+        return;
+    }
+
+    size_t bucketCount = pState->bucketCount * 2;
+    Bucket* pBuckets = AllocateBuckets( bucketCount );
+    TableState* pNewState = CreateState( pBuckets, bucketCount, pState->pBuckets, pState->bucketCount, true );
+    pNewState->pPreviousState = pState;
+
+    if( AtomicCompareExchangeRelease( m_pState, pNewState, pState ) != pState )
+    {
+        // Another thread started growing the table first.
+        DestroyState( pNewState );
+    }
+}
+
+/// Migrate entries from old buckets covered by the given lock stripe into the current bucket array.
+///
+/// The caller must hold an exclusive lock on the given stripe.  If this completes the migration of all old buckets, a
+/// new table state without the old bucket array is published.
+///
+/// @param[in] stripeIndex     Index of the locked stripe.
+/// @param[in] maxBucketCount  Maximum number of old buckets to migrate.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::MigrateStripe( size_t stripeIndex, size_t maxBucketCount )
+{
+    TableState* pState = m_pState;
+    if( !pState->pOldBuckets )
+    {
+        return;
+    }
+
+    size_t stripeCount = m_stripeCount;
+    size_t stripeBucketCount = pState->oldBucketCount / stripeCount;
+
+    size_t& rMigrationIndex = pState->pMigrationIndices[ stripeIndex ];
+    size_t startIndex = rMigrationIndex;
+    size_t endIndex = startIndex + Min( maxBucketCount, stripeBucketCount - startIndex );
+    if( startIndex >= endIndex )
+    {
+        return;
+    }
+
+    // Each old bucket is split between the bucket at the same index and the bucket at the same index offset by the old
+    // bucket count.
+    Bucket* pOldBuckets = pState->pOldBuckets;
+    Bucket* pBuckets = pState->pBuckets;
+    size_t bucketMask = pState->bucketCount - 1;
+
+    for( size_t bucketIndex = startIndex; bucketIndex < endIndex; ++bucketIndex )
+    {
+        Bucket& rOldBucket = pOldBuckets[ bucketIndex * stripeCount + stripeIndex ];
+        HELIUM_ASSERT( !rOldBucket.bMigrated );
+
+        DynamicArray< InternalValue, Allocator >& rOldEntries = rOldBucket.entries;
+        size_t entryCount = rOldEntries.GetSize();
+        for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+        {
+            const InternalValue& rEntry = rOldEntries[ entryIndex ];
+            pBuckets[ HashKey( m_extractKey( rEntry ) ) & bucketMask ].entries.Add( rEntry );
+        }
+
+        rOldEntries.Clear();
+        rOldEntries.Trim();
+        rOldBucket.bMigrated = true;
+    }
+
+    rMigrationIndex = endIndex;
+    AtomicIncrementRelease( m_pStripes[ stripeIndex ].tag );
+
+    size_t migratedCount = endIndex - startIndex;
+    int32_t totalMigratedCount = AtomicAddRelease( pState->migratedBucketCount, static_cast< int32_t >( migratedCount ) );
+    if( static_cast< size_t >( totalMigratedCount ) + migratedCount == pState->oldBucketCount )
+    {
+        // All buckets have been migrated, so publish a state without the old bucket array so that lookups no longer
+        // need to check it.  Only the thread migrating the last bucket can get here, and no new migration can start
+        // until this state is published, so this exchange cannot fail.
+        TableState* pNewState = CreateState( pBuckets, pState->bucketCount, NULL, 0, false );
+        pNewState->pPreviousState = pState;
+
+        HELIUM_VERIFY( AtomicCompareExchangeRelease( m_pState, pNewState, pState ) == pState );
+    }
+}
+
+/// Allocate the lock stripes and the initial bucket array.
+///
+/// The stripe count should be set to the requested initial bucket count prior to calling this function.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::AllocateStripes()
+{
+    size_t stripeCount = 1;
+    while( stripeCount < m_stripeCount )
+    {
+        stripeCount <<= 1;
+    }
+
+    m_stripeCount = stripeCount;
+
+    void* pBuffer = m_allocator.AllocateAligned( std::alignment_of< Stripe >::value, sizeof( Stripe ) * stripeCount );
+    HELIUM_ASSERT( pBuffer );
+
+    Stripe* pStripes = ArrayInPlaceConstruct< Stripe >( pBuffer, stripeCount );
+    HELIUM_ASSERT( pStripes == pBuffer );
+    for( size_t stripeIndex = 0; stripeIndex < stripeCount; ++stripeIndex )
+    {
+        pStripes[ stripeIndex ].tag = 0;
+        pStripes[ stripeIndex ].size = 0;
+    }
+
+    m_pStripes = pStripes;
+
+    m_pState = CreateState( AllocateBuckets( stripeCount ), stripeCount, NULL, 0, true );
+}
+
+/// Allocate a bucket array.
+///
+/// @param[in] bucketCount  Number of buckets to allocate.
+///
+/// @return  Bucket array.
+///
+/// @see FreeBuckets()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+typename Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Bucket*
+    Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::AllocateBuckets( size_t bucketCount )
+{
+    void* pBuffer = m_allocator.Allocate( sizeof( Bucket ) * bucketCount );
+    HELIUM_ASSERT( pBuffer );
+
+    Bucket* pBuckets = ArrayInPlaceConstruct< Bucket >( pBuffer, bucketCount );
+    HELIUM_ASSERT( pBuckets == pBuffer );
+    for( size_t bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex )
+    {
+        pBuckets[ bucketIndex ].bMigrated = false;
+    }
+
+    return pBuckets;
+}
+
+/// Free a bucket array.
+///
+/// @param[in] pBuckets     Bucket array.
+/// @param[in] bucketCount  Number of buckets in the array.
+///
+/// @see AllocateBuckets()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::FreeBuckets( Bucket* pBuckets, size_t bucketCount )
+{
+    ArrayInPlaceDestruct( pBuckets, bucketCount );
+    m_allocator.Free( pBuckets );
+}
+
+/// Create a new table state.
+///
+/// If an old bucket array is provided, migration counters are initialized as well.
+///
+/// @param[in] pBuckets        Current bucket array.
+/// @param[in] bucketCount     Number of buckets in the current bucket array.
+/// @param[in] pOldBuckets     Old bucket array from which to migrate entries (can be null).
+/// @param[in] oldBucketCount  Number of buckets in the old bucket array.
+/// @param[in] bOwnsBuckets    True if the state should free the current bucket array when destroyed.
+///
+/// @return  Newly created table state.
+///
+/// @see DestroyState()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+typename Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::TableState*
+    Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::CreateState(
+        Bucket* pBuckets,
+        size_t bucketCount,
+        Bucket* pOldBuckets,
+        size_t oldBucketCount,
+        bool bOwnsBuckets )
+{
+    TableState* pState = static_cast< TableState* >( m_allocator.Allocate( sizeof( TableState ) ) );
+    HELIUM_ASSERT( pState );
+
+    pState->pBuckets = pBuckets;
+    pState->bucketCount = bucketCount;
+    pState->pOldBuckets = pOldBuckets;
+    pState->oldBucketCount = oldBucketCount;
+    pState->pMigrationIndices = NULL;
+    pState->migratedBucketCount = 0;
+    pState->pPreviousState = NULL;
+    pState->bOwnsBuckets = bOwnsBuckets;
+
+    if( pOldBuckets )
+    {
+        size_t stripeCount = m_stripeCount;
+        pState->pMigrationIndices = static_cast< size_t* >( m_allocator.Allocate( sizeof( size_t ) * stripeCount ) );
+        HELIUM_ASSERT( pState->pMigrationIndices );
+        MemoryZero( pState->pMigrationIndices, sizeof( size_t ) * stripeCount );
+    }
+
+    return pState;
+}
+
+/// Destroy a table state, freeing its current bucket array if it is owned by the state.
+///
+/// @param[in] pState  Table state to destroy.
+///
+/// @see CreateState()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::DestroyState( TableState* pState )
+{
+    HELIUM_ASSERT( pState );
+
+    if( pState->bOwnsBuckets )
+    {
+        FreeBuckets( pState->pBuckets, pState->bucketCount );
+    }
+
+    if( pState->pMigrationIndices )
+    {
+        m_allocator.Free( pState->pMigrationIndices );
+    }
+
+    m_allocator.Free( pState );
+}
+
+/// Free the bucket arrays and migration data of all table states prior to the current state.
+///
+/// The caller must hold an exclusive lock on every stripe, and no migration can be in progress.  The retired state
+/// records themselves are kept until the table is destroyed, as functions such as GetBucketCount() may read them
+/// without holding a stripe lock, but they are small and only two are added each time the table grows.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::ReleaseRetiredStates()
+{
+    TableState* pCurrentState = m_pState;
+    HELIUM_ASSERT( !pCurrentState->pOldBuckets );
+
+    for( TableState* pState = pCurrentState->pPreviousState; pState; pState = pState->pPreviousState )
+    {
+        if( pState->bOwnsBuckets )
+        {
+            // The state that finishes a migration shares the bucket array of the state that started it.
+            if( pState->pBuckets == pCurrentState->pBuckets )
+            {
+                pCurrentState->bOwnsBuckets = true;
+            }
+            else
+            {
+                FreeBuckets( pState->pBuckets, pState->bucketCount );
+            }
+
+            pState->bOwnsBuckets = false;
+        }
+
+        pState->pBuckets = NULL;
+        pState->pOldBuckets = NULL;
+
+        if( pState->pMigrationIndices )
+        {
+            m_allocator.Free( pState->pMigrationIndices );
+            pState->pMigrationIndices = NULL;
+        }
+    }
+}
+
+/// Allocate and construct a copy of the specified object, assuming all data in this object is uninitialized.
+///
+/// Entries are rehashed into a single bucket array in the new table (no migration is carried over).
+///
+/// @param[in] rSource  Object to copy.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::CopyConstruct(
+    const ConcurrentHashTable& rSource )
+{
+    m_stripeCount = rSource.m_stripeCount;
+    m_maxLoadFactor = rSource.m_maxLoadFactor;
+
+    m_hasher = rSource.m_hasher;
+    m_keyEquals = rSource.m_keyEquals;
+    m_extractKey = rSource.m_extractKey;
+    m_allocator = rSource.m_allocator;
+
+    AllocateStripes();
+
+    Location sourceLocation;
+
+    size_t stripeCount = m_stripeCount;
+    for( size_t stripeIndex = 0; stripeIndex < stripeCount; ++stripeIndex )
+    {
+        sourceLocation.stripeIndex = stripeIndex;
+        rSource.LockStripe( sourceLocation, false );
+
+        const TableState* pSourceState = rSource.m_pState;
+        if( stripeIndex == 0 && pSourceState->bucketCount > m_pState->bucketCount )
+        {
+            // Match the source bucket count (bucket counts never shrink, so this only needs to be done once).
+            TableState* pState = m_pState;
+            m_pState = CreateState( AllocateBuckets( pSourceState->bucketCount ), pSourceState->bucketCount, NULL, 0, true );
+            DestroyState( pState );
+        }
+
+        Bucket* pBuckets = m_pState->pBuckets;
+        size_t bucketMask = m_pState->bucketCount - 1;
+        size_t copiedCount = 0;
+
+        size_t bucketCount = rSource.GetStripeBucketCount( pSourceState );
+        for( size_t bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex )
+        {
+            const Bucket* pSourceBucket = rSource.GetStripeBucket( pSourceState, stripeIndex, bucketIndex );
+            if( pSourceBucket )
+            {
+                const DynamicArray< InternalValue, Allocator >& rSourceEntries = pSourceBucket->entries;
+                size_t entryCount = rSourceEntries.GetSize();
+                for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+                {
+                    const InternalValue& rEntry = rSourceEntries[ entryIndex ];
+                    pBuckets[ HashKey( m_extractKey( rEntry ) ) & bucketMask ].entries.Add( rEntry );
+                }
+
+                copiedCount += entryCount;
+            }
+        }
+
+        rSource.UnlockStripe( sourceLocation, false );
+
+        // Entries are rehashed into buckets covered by the same stripe index, as the stripe count is the same.
+        m_pStripes[ stripeIndex ].size = copiedCount;
+    }
+}
+
+/// Free all allocated resources, but don't clear out any variables unless necessary.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::ConcurrentHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Finalize()
+{
+    TableState* pState = m_pState;
+    while( pState )
+    {
+        TableState* pPreviousState = pState->pPreviousState;
+        DestroyState( pState );
+        pState = pPreviousState;
+    }
+
+    ArrayInPlaceDestruct( m_pStripes, m_stripeCount );
+    m_allocator.FreeAligned( m_pStripes );
 }
@@ -4,6 +4,8 @@
 #include "Platform/MemoryHeap.h"
 #include "Platform/Assert.h"
 
+#include <utility>
+
 #include "Foundation/API.h"
 #include "Foundation/Math.h"
 
@@ -132,6 +134,7 @@ namespace Helium
 		DynamicArray( const T* pSource, size_t size );
 		DynamicArray( const DynamicArray& rSource );
 		template< typename OtherAllocator > DynamicArray( const DynamicArray< T, OtherAllocator >& rSource );
+		DynamicArray( DynamicArray&& rSource );
 		~DynamicArray();
 		//@}
 
@@ -161,8 +164,10 @@ namespace Helium
 		void Set( const T* pSource, size_t size );
 
 		void Add( const T& rValue, size_t count = 1 );
+		void Add( T&& rValue );
 		void AddArray( const T* pValues, size_t count );
 		void Insert( size_t index, const T& rValue, size_t count = 1 );
+		void Insert( size_t index, T&& rValue );
 		void InsertArray( size_t index, const T* pValues, size_t count );
 		void Remove( size_t index, size_t count = 1 );
 		void RemoveSwap( size_t index, size_t count = 1 );
@@ -173,6 +178,7 @@ namespace Helium
 		T& GetLast();
 		const T& GetLast() const;
 		size_t Push( const T& rValue );
+		size_t Push( T&& rValue );
 		T Pop();
 
 		void Swap( DynamicArray& rArray );
@@ -196,12 +202,16 @@ namespace Helium
 
 		template <typename U, typename V, typename W, typename X>
 		T* New(const U &u, const V &v, const W &w, const X &x);
+
+		template< typename... Args > T* Emplace( Args&&... args );
+		template< typename... Args > T* EmplaceAt( size_t index, Args&&... args );
 		//@}
 
 		/// @name Overloaded Operators
 		//@{
 		DynamicArray& operator=( const DynamicArray& rSource );
 		template< typename OtherAllocator > DynamicArray& operator=( const DynamicArray< T, OtherAllocator >& rSource );
+		DynamicArray& operator=( DynamicArray&& rSource );
 
 		T& operator[]( ptrdiff_t index );
 		const T& operator[]( ptrdiff_t index ) const;
@@ -222,6 +232,8 @@ namespace Helium
 
 		/// @name Private Utility Functions
 		//@{
+		bool IsElement( const T* pValue ) const;
+
 		size_t GetGrowCapacity( size_t desiredCount ) const;
 		void Grow( size_t capacity );
 
@@ -247,6 +259,14 @@ namespace Helium
 		T* ResizeBuffer( T* pMemory, size_t elementCount, size_t oldCapacity, size_t newCapacity );
 		T* ResizeBuffer( T* pMemory, size_t elementCount, size_t oldCapacity, size_t newCapacity, const std::true_type& rHasTrivialCopyAndDestructor );
 		T* ResizeBuffer( T* pMemory, size_t elementCount, size_t oldCapacity, size_t newCapacity, const std::false_type& rHasTrivialCopyAndDestructor );
+
+		static void MoveConstruct( T* pDest, T* pSource, size_t count );
+		static void MoveConstruct( T* pDest, T* pSource, size_t count, const std::true_type& rHasTrivialCopy );
+		static void MoveConstruct( T* pDest, T* pSource, size_t count, const std::false_type& rHasTrivialCopy );
+
+		static void MoveAssign( T* pDest, T* pSource, size_t count );
+		static void MoveAssign( T* pDest, T* pSource, size_t count, const std::true_type& rHasTrivialAssign );
+		static void MoveAssign( T* pDest, T* pSource, size_t count, const std::false_type& rHasTrivialAssign );
 		//@}
 	};
 }
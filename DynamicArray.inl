@@ -419,6 +419,22 @@ Helium::DynamicArray< T, Allocator >::DynamicArray( const DynamicArray< T, Other
 	CopyConstruct( rSource );
 }
 
+/// Move constructor.
+///
+/// This takes ownership of the buffer of the given array, leaving the given array empty.  No elements are copied.
+///
+/// @param[in] rSource  Array from which to move.
+template< typename T, typename Allocator >
+Helium::DynamicArray< T, Allocator >::DynamicArray( DynamicArray&& rSource )
+	: m_pBuffer( rSource.m_pBuffer )
+	, m_size( rSource.m_size )
+	, m_capacity( rSource.m_capacity )
+{
+	rSource.m_pBuffer = NULL;
+	rSource.m_size = 0;
+	rSource.m_capacity = 0;
+}
+
 /// Destructor.
 template< typename T, typename Allocator >
 Helium::DynamicArray< T, Allocator >::~DynamicArray()
@@ -652,12 +668,30 @@ void Helium::DynamicArray< T, Allocator >::Set( const T* pSource, size_t size )
 template< typename T, typename Allocator >
 void Helium::DynamicArray< T, Allocator >::Add( const T& rValue, size_t count )
 {
+	if( IsElement( &rValue ) && m_size + count > m_capacity )
+	{
+		// Copy the value first, as growing the array would move it.
+		T value( rValue );
+		Add( value, count );
+
+		return;
+	}
+
 	size_t newSize = m_size + count;
 	Grow( newSize );
 	ArrayUninitializedFill( m_pBuffer + m_size, rValue, count );
 	m_size = newSize;
 }
 
+/// Add an element to the end of this array, moving the given value into the new element.
+///
+/// @param[in] rValue  Value to add.
+template< typename T, typename Allocator >
+void Helium::DynamicArray< T, Allocator >::Add( T&& rValue )
+{
+	Emplace( std::move( rValue ) );
+}
+
 /// Add an array of elements to the end of this array.
 ///
 /// @param[in] pValues  Array of values to add.
@@ -683,16 +717,26 @@ void Helium::DynamicArray< T, Allocator >::Insert( size_t index, const T& rValue
 {
 	HELIUM_ASSERT( index <= m_size );
 
+	if( IsElement( &rValue ) )
+	{
+		// Copy the value first, as making room for the new elements would move it.
+		T value( rValue );
+		Insert( index, value, count );
+
+		return;
+	}
+
 	size_t newSize = m_size + count;
 	if( newSize > m_capacity )
 	{
 		size_t newCapacity = GetGrowCapacity( newSize );
 		T* pNewBuffer = Allocate( newCapacity );
 		HELIUM_ASSERT( pNewBuffer );
-		ArrayUninitializedCopy( pNewBuffer, m_pBuffer, index );
 		ArrayUninitializedFill( pNewBuffer + index, rValue, count );
-		ArrayUninitializedCopy( pNewBuffer + index + count, m_pBuffer + index, m_size - index );
+		MoveConstruct( pNewBuffer, m_pBuffer, index );
+		MoveConstruct( pNewBuffer + index + count, m_pBuffer + index, m_size - index );
 
+		ArrayInPlaceDestruct( m_pBuffer, m_size );
 		Free( m_pBuffer );
 
 		m_pBuffer = pNewBuffer;
@@ -703,7 +747,7 @@ void Helium::DynamicArray< T, Allocator >::Insert( size_t index, const T& rValue
 		size_t shiftCount = m_size - index;
 		if( shiftCount <= count )
 		{
-			ArrayUninitializedCopy( m_pBuffer + index + count, m_pBuffer + index, shiftCount );
+			MoveConstruct( m_pBuffer + index + count, m_pBuffer + index, shiftCount );
 			if ( shiftCount != count )
 			{
 				ArrayUninitializedFill( m_pBuffer + m_size, rValue, count - shiftCount );
@@ -713,9 +757,9 @@ void Helium::DynamicArray< T, Allocator >::Insert( size_t index, const T& rValue
 		}
 		else
 		{
-			ArrayUninitializedCopy( m_pBuffer + m_size, m_pBuffer + m_size - count, count );
+			MoveConstruct( m_pBuffer + m_size, m_pBuffer + m_size - count, count );
 
-			ArrayMove( m_pBuffer + index + count, m_pBuffer + index, shiftCount - count );
+			MoveAssign( m_pBuffer + index + count, m_pBuffer + index, shiftCount - count );
 			ArraySet( m_pBuffer + index, rValue, count );
 		}
 	}
@@ -723,6 +767,16 @@ void Helium::DynamicArray< T, Allocator >::Insert( size_t index, const T& rValue
 	m_size = newSize;
 }
 
+/// Insert an element to the middle of this array, moving the given value into the new element.
+///
+/// @param[in] index   Index at which to insert the value.
+/// @param[in] rValue  Value to insert.
+template< typename T, typename Allocator >
+void Helium::DynamicArray< T, Allocator >::Insert( size_t index, T&& rValue )
+{
+	EmplaceAt( index, std::move( rValue ) );
+}
+
 /// Insert an array into to the middle of this array.
 ///
 /// @param[in] index    Index at which to insert values.
@@ -734,16 +788,27 @@ void Helium::DynamicArray< T, Allocator >::InsertArray( size_t index, const T* p
 	HELIUM_ASSERT( index <= m_size );
 	HELIUM_ASSERT( pValues || count == 0 );
 
+	if( count != 0 && ( IsElement( pValues ) || IsElement( pValues + count - 1 ) ) )
+	{
+		// Copy the values first, as making room for the new elements would move them.
+		DynamicArray values;
+		values.AddArray( pValues, count );
+		InsertArray( index, values.GetData(), count );
+
+		return;
+	}
+
 	size_t newSize = m_size + count;
 	if( newSize > m_capacity )
 	{
 		size_t newCapacity = GetGrowCapacity( newSize );
 		T* pNewBuffer = Allocate( newCapacity );
 		HELIUM_ASSERT( pNewBuffer );
-		ArrayUninitializedCopy( pNewBuffer, m_pBuffer, index );
 		ArrayUninitializedCopy( pNewBuffer + index, pValues, count );
-		ArrayUninitializedCopy( pNewBuffer + index + count, m_pBuffer + index, m_size - index );
+		MoveConstruct( pNewBuffer, m_pBuffer, index );
+		MoveConstruct( pNewBuffer + index + count, m_pBuffer + index, m_size - index );
 
+		ArrayInPlaceDestruct( m_pBuffer, m_size );
 		Free( m_pBuffer );
 
 		m_pBuffer = pNewBuffer;
@@ -754,16 +819,16 @@ void Helium::DynamicArray< T, Allocator >::InsertArray( size_t index, const T* p
 		size_t shiftCount = m_size - index;
 		if( shiftCount <= count )
 		{
-			ArrayUninitializedCopy( m_pBuffer + index + count, m_pBuffer + index, shiftCount );
+			MoveConstruct( m_pBuffer + index + count, m_pBuffer + index, shiftCount );
 			ArrayUninitializedCopy( m_pBuffer + m_size, pValues + shiftCount, count - shiftCount );
 
 			ArrayCopy( m_pBuffer + index, pValues, shiftCount );
 		}
 		else
 		{
-			ArrayUninitializedCopy( m_pBuffer + m_size, m_pBuffer + m_size - count, count );
+			MoveConstruct( m_pBuffer + m_size, m_pBuffer + m_size - count, count );
 
-			ArrayMove( m_pBuffer + index + count, m_pBuffer + index, shiftCount - count );
+			MoveAssign( m_pBuffer + index + count, m_pBuffer + index, shiftCount - count );
 			ArrayCopy( m_pBuffer + index, pValues, count );
 		}
 	}
@@ -790,7 +855,7 @@ void Helium::DynamicArray< T, Allocator >::Remove( size_t index, size_t count )
 
 	size_t newSize = m_size - count;
 
-	ArrayMove( m_pBuffer + index, m_pBuffer + shiftStartIndex, m_size - shiftStartIndex );
+	MoveAssign( m_pBuffer + index, m_pBuffer + shiftStartIndex, m_size - shiftStartIndex );
 	ArrayInPlaceDestruct( m_pBuffer + newSize, count );
 	m_size = newSize;
 }
@@ -821,12 +886,12 @@ void Helium::DynamicArray< T, Allocator >::RemoveSwap( size_t index, size_t coun
 	{
 		// We're removing more elements from the array than exist past the end of the range being removed, so
 		// perform a normal shift and destroy.
-		ArrayMove( m_pBuffer + index, m_pBuffer + shiftStartIndex, trailingCount );
+		MoveAssign( m_pBuffer + index, m_pBuffer + shiftStartIndex, trailingCount );
 	}
 	else
 	{
 		// Swap elements from the end of the array into the empty space.
-		ArrayCopy( m_pBuffer + index, m_pBuffer + newSize, count );
+		MoveAssign( m_pBuffer + index, m_pBuffer + newSize, count );
 	}
 
 	ArrayInPlaceDestruct( m_pBuffer + newSize, count );
@@ -914,13 +979,29 @@ size_t Helium::DynamicArray< T, Allocator >::Push( const T& rValue )
 	return index;
 }
 
+/// Push an element onto the end of this array, moving the given value into the new element.
+///
+/// @param[in] rValue  Value to push.
+///
+/// @return  Index of the pushed element.
+///
+/// @see Pop()
+template< typename T, typename Allocator >
+size_t Helium::DynamicArray< T, Allocator >::Push( T&& rValue )
+{
+	size_t index = m_size;
+	Emplace( std::move( rValue ) );
+
+	return index;
+}
+
 /// Remove the last element from this array.
 ///
 /// @see Push()
 template< typename T, typename Allocator >
 T Helium::DynamicArray< T, Allocator >::Pop()
 {
-	T previousLast = GetLast();
+	T previousLast = std::move( GetLast() );
 	HELIUM_ASSERT( m_size != 0 );
 	Remove( m_size - 1 );
 	return previousLast;
@@ -984,67 +1065,148 @@ T* Helium::DynamicArray< T, Allocator >::New()
 	return pObject;
 }
 
+/// Allocate a new object as a new element in this array.
+///
+/// @param[in] u  Constructor argument.
+///
+/// @return  Pointer to the new object.
 template < typename T, typename Allocator >
 template < typename U >
 T* Helium::DynamicArray< T, Allocator >::New(const U &u)
 {
-	size_t newSize = m_size + 1;
-	Grow( newSize );
-			
-	T* pObject = new( m_pBuffer + m_size ) T( u );
-			
-	HELIUM_ASSERT( pObject );
-			
-	m_size = newSize;
-			
-	return pObject;
+	return Emplace( u );
 }
-		
+
+/// Allocate a new object as a new element in this array.
+///
+/// @param[in] u  First constructor argument.
+/// @param[in] v  Second constructor argument.
+///
+/// @return  Pointer to the new object.
 template < typename T, typename Allocator >
 template < typename U, typename V >
 T* Helium::DynamicArray< T, Allocator >::New(const U &u, const V &v)
 {
-	size_t newSize = m_size + 1;
-	Grow( newSize );
-			
-	T* pObject = new( m_pBuffer + m_size ) T( u, v );
-			
-	HELIUM_ASSERT( pObject );
-			
-	m_size = newSize;
-			
-	return pObject;
+	return Emplace( u, v );
 }
-		
+
+/// Allocate a new object as a new element in this array.
+///
+/// @param[in] u  First constructor argument.
+/// @param[in] v  Second constructor argument.
+/// @param[in] w  Third constructor argument.
+///
+/// @return  Pointer to the new object.
 template < typename T, typename Allocator >
 template < typename U, typename V, typename W >
 T* Helium::DynamicArray< T, Allocator >::New(const U &u, const V &v, const W &w)
+{
+	return Emplace( u, v, w );
+}
+
+/// Allocate a new object as a new element in this array.
+///
+/// @param[in] u  First constructor argument.
+/// @param[in] v  Second constructor argument.
+/// @param[in] w  Third constructor argument.
+/// @param[in] x  Fourth constructor argument.
+///
+/// @return  Pointer to the new object.
+template < typename T, typename Allocator >
+template < typename U, typename V, typename W, typename X >
+T* Helium::DynamicArray< T, Allocator >::New(const U &u, const V &v, const W &w, const X &x)
+{
+	return Emplace( u, v, w, x );
+}
+
+/// Construct a new element in place at the end of this array.
+///
+/// @param[in] args  Arguments to forward to the element constructor.
+///
+/// @return  Pointer to the new element.
+///
+/// @see EmplaceAt()
+template< typename T, typename Allocator >
+template< typename... Args >
+T* Helium::DynamicArray< T, Allocator >::Emplace( Args&&... args )
 {
 	size_t newSize = m_size + 1;
-	Grow( newSize );
-			
-	T* pObject = new( m_pBuffer + m_size ) T( u, v, w );
-			
+	T* pObject;
+	if( newSize > m_capacity )
+	{
+		// Construct the new value before growing, as the arguments may refer to elements that are about to be moved.
+		T value( std::forward< Args >( args )... );
+
+		Grow( newSize );
+		pObject = new( m_pBuffer + m_size ) T( std::move( value ) );
+	}
+	else
+	{
+		pObject = new( m_pBuffer + m_size ) T( std::forward< Args >( args )... );
+	}
+
 	HELIUM_ASSERT( pObject );
-			
+
 	m_size = newSize;
-			
+
 	return pObject;
 }
 
-template < typename T, typename Allocator >
-template < typename U, typename V, typename W, typename X >
-T* Helium::DynamicArray< T, Allocator >::New(const U &u, const V &v, const W &w, const X &x)
+/// Construct a new element in place in the middle of this array.
+///
+/// Elements following the insertion point are moved (not copied) to make room for the new element.
+///
+/// @param[in] index  Index at which to construct the new element.
+/// @param[in] args   Arguments to forward to the element constructor.
+///
+/// @return  Pointer to the new element.
+///
+/// @see Emplace()
+template< typename T, typename Allocator >
+template< typename... Args >
+T* Helium::DynamicArray< T, Allocator >::EmplaceAt( size_t index, Args&&... args )
 {
+	HELIUM_ASSERT( index <= m_size );
+
 	size_t newSize = m_size + 1;
-	Grow( newSize );
-			
-	T* pObject = new( m_pBuffer + m_size ) T( u, v, w, x );
-			
+	T* pObject;
+	if( newSize > m_capacity )
+	{
+		size_t newCapacity = GetGrowCapacity( newSize );
+		T* pNewBuffer = Allocate( newCapacity );
+		HELIUM_ASSERT( pNewBuffer );
+
+		// Construct the new element before moving the existing elements, as the arguments may refer to them.
+		pObject = new( pNewBuffer + index ) T( std::forward< Args >( args )... );
+		MoveConstruct( pNewBuffer, m_pBuffer, index );
+		MoveConstruct( pNewBuffer + index + 1, m_pBuffer + index, m_size - index );
+
+		ArrayInPlaceDestruct( m_pBuffer, m_size );
+		Free( m_pBuffer );
+
+		m_pBuffer = pNewBuffer;
+		m_capacity = newCapacity;
+	}
+	else if( index == m_size )
+	{
+		pObject = new( m_pBuffer + index ) T( std::forward< Args >( args )... );
+	}
+	else
+	{
+		// Construct the new value up front, as the arguments may refer to elements that are about to be shifted.
+		T value( std::forward< Args >( args )... );
+
+		MoveConstruct( m_pBuffer + m_size, m_pBuffer + m_size - 1, 1 );
+		MoveAssign( m_pBuffer + index + 1, m_pBuffer + index, m_size - 1 - index );
+
+		pObject = m_pBuffer + index;
+		*pObject = std::move( value );
+	}
+
 	HELIUM_ASSERT( pObject );
-			
+
 	m_size = newSize;
-			
+
 	return pObject;
 }
 
@@ -1078,6 +1240,33 @@ Helium::DynamicArray< T, Allocator >& Helium::DynamicArray< T, Allocator >::oper
 	return Assign( rSource );
 }
 
+/// Move assignment operator.
+///
+/// This destroys the current contents of this array and takes ownership of the buffer of the given array, leaving the
+/// given array empty.  No elements are copied.
+///
+/// @param[in] rSource  Array from which to move.
+///
+/// @return  Reference to this array.
+template< typename T, typename Allocator >
+Helium::DynamicArray< T, Allocator >& Helium::DynamicArray< T, Allocator >::operator=( DynamicArray&& rSource )
+{
+	if( this != &rSource )
+	{
+		Finalize();
+
+		m_pBuffer = rSource.m_pBuffer;
+		m_size = rSource.m_size;
+		m_capacity = rSource.m_capacity;
+
+		rSource.m_pBuffer = NULL;
+		rSource.m_size = 0;
+		rSource.m_capacity = 0;
+	}
+
+	return *this;
+}
+
 /// Get the array element at the specified index.
 ///
 /// @param[in] index  Array index.
@@ -1160,6 +1349,17 @@ bool Helium::DynamicArray< T, Allocator >::operator!=( const DynamicArray< T, Ot
 	return !Equals( rOther );
 }
 
+/// Get whether the given pointer refers to an element in this array.
+///
+/// @param[in] pValue  Pointer to test.
+///
+/// @return  True if the pointer refers to an element in this array, false if not.
+template< typename T, typename Allocator >
+bool Helium::DynamicArray< T, Allocator >::IsElement( const T* pValue ) const
+{
+	return ( pValue >= m_pBuffer && pValue < m_pBuffer + m_size );
+}
+
 /// Get the capacity to which this array should grow if growing to support the desired number of elements.
 ///
 /// @param[in] desiredCount  Desired minimum capacity.
@@ -1428,6 +1628,9 @@ T* Helium::DynamicArray< T, Allocator >::ResizeBuffer(
 
 /// ResizeBuffer() implementation for types without either a trivial copy constructor or a trivial destructor.
 ///
+/// Existing elements are moved into the new buffer, so elements that own resources (such as strings) can simply hand
+/// them off instead of reallocating them.
+///
 /// @param[in] pMemory                       Base address of the array being resized.
 /// @param[in] elementCount                  Number of elements that have actually been constructed in the buffer.
 /// @param[in] oldCapacity                   Current array capacity.
@@ -1450,7 +1653,7 @@ T* Helium::DynamicArray< T, Allocator >::ResizeBuffer( T* pMemory, size_t elemen
 		{
 			pNewMemory = Allocate( newCapacity );
 			HELIUM_ASSERT( pNewMemory );
-			ArrayUninitializedCopy( pNewMemory, pMemory, elementCount );
+			MoveConstruct( pNewMemory, pMemory, elementCount );
 		}
 
 		ArrayInPlaceDestruct( pMemory, elementCount );
@@ -1459,3 +1662,98 @@ T* Helium::DynamicArray< T, Allocator >::ResizeBuffer( T* pMemory, size_t elemen
 
 	return pNewMemory;
 }
+
+/// Move-construct elements into uninitialized memory.
+///
+/// The source elements are left in a valid but unspecified state, and must still be destroyed by the caller.
+///
+/// @param[in] pDest    Uninitialized memory in which to construct elements.
+/// @param[in] pSource  Elements from which to move (must not overlap the destination).
+/// @param[in] count    Number of elements to move.
+template< typename T, typename Allocator >
+void Helium::DynamicArray< T, Allocator >::MoveConstruct( T* pDest, T* pSource, size_t count )
+{
+	MoveConstruct( pDest, pSource, count, std::integral_constant< bool, std::has_trivial_copy< T >::value >() );
+}
+
+/// MoveConstruct() implementation for types with a trivial copy constructor.
+///
+/// @param[in] pDest            Uninitialized memory in which to construct elements.
+/// @param[in] pSource          Elements from which to move (must not overlap the destination).
+/// @param[in] count            Number of elements to move.
+/// @param[in] rHasTrivialCopy  std::true_type.
+template< typename T, typename Allocator >
+void Helium::DynamicArray< T, Allocator >::MoveConstruct( T* pDest, T* pSource, size_t count, const std::true_type& /*rHasTrivialCopy*/ )
+{
+	ArrayUninitializedCopy( pDest, pSource, count );
+}
+
+/// MoveConstruct() implementation for types without a trivial copy constructor.
+///
+/// @param[in] pDest            Uninitialized memory in which to construct elements.
+/// @param[in] pSource          Elements from which to move (must not overlap the destination).
+/// @param[in] count            Number of elements to move.
+/// @param[in] rHasTrivialCopy  std::false_type.
+template< typename T, typename Allocator >
+void Helium::DynamicArray< T, Allocator >::MoveConstruct( T* pDest, T* pSource, size_t count, const std::false_type& /*rHasTrivialCopy*/ )
+{
+	HELIUM_ASSERT( pDest || count == 0 );
+	HELIUM_ASSERT( pSource || count == 0 );
+
+	for( size_t index = 0; index < count; ++index )
+	{
+		new( pDest + index ) T( std::move( pSource[ index ] ) );
+	}
+}
+
+/// Move-assign elements between (possibly overlapping) ranges of constructed elements.
+///
+/// @param[in] pDest    Elements to which to move.
+/// @param[in] pSource  Elements from which to move.
+/// @param[in] count    Number of elements to move.
+template< typename T, typename Allocator >
+void Helium::DynamicArray< T, Allocator >::MoveAssign( T* pDest, T* pSource, size_t count )
+{
+	MoveAssign( pDest, pSource, count, std::integral_constant< bool, std::has_trivial_assign< T >::value >() );
+}
+
+/// MoveAssign() implementation for types with a trivial assignment operator.
+///
+/// @param[in] pDest              Elements to which to move.
+/// @param[in] pSource            Elements from which to move.
+/// @param[in] count              Number of elements to move.
+/// @param[in] rHasTrivialAssign  std::true_type.
+template< typename T, typename Allocator >
+void Helium::DynamicArray< T, Allocator >::MoveAssign( T* pDest, T* pSource, size_t count, const std::true_type& /*rHasTrivialAssign*/ )
+{
+	ArrayMove( pDest, pSource, count );
+}
+
+/// MoveAssign() implementation for types without a trivial assignment operator.
+///
+/// @param[in] pDest              Elements to which to move.
+/// @param[in] pSource            Elements from which to move.
+/// @param[in] count              Number of elements to move.
+/// @param[in] rHasTrivialAssign  std::false_type.
+template< typename T, typename Allocator >
+void Helium::DynamicArray< T, Allocator >::MoveAssign( T* pDest, T* pSource, size_t count, const std::false_type& /*rHasTrivialAssign*/ )
+{
+	HELIUM_ASSERT( pDest || count == 0 );
+	HELIUM_ASSERT( pSource || count == 0 );
+
+	if( pDest < pSource )
+	{
+		for( size_t index = 0; index < count; ++index )
+		{
+			pDest[ index ] = std::move( pSource[ index ] );
+		}
+	}
+	else if( pDest > pSource )
+	{
+		while( count != 0 )
+		{
+			--count;
+			pDest[ count ] = std::move( pSource[ count ] );
+		}
+	}
+}
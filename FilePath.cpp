@@ -16,9 +16,9 @@ using namespace Helium;
 
 const FilePath FilePath::NULL_FILE_PATH;
 
-void FilePath::Init( const char* path )
+void FilePath::Init( const CharStringView& path )
 {
-	m_Path = path;
+	m_Path.assign( path.GetData() ? path.GetData() : "", path.GetSize() );
 
 	std::replace( m_Path.begin(), m_Path.end(), Helium::PathSeparator, s_InternalPathSeparator );
 }
@@ -28,6 +28,16 @@ FilePath::FilePath( const std::string& path )
 	Init( path.c_str() );
 }
 
+FilePath::FilePath( const char* path )
+{
+	Init( path );
+}
+
+FilePath::FilePath( const CharStringView& path )
+{
+	Init( path );
+}
+
 FilePath::FilePath( const FilePath& path )
 {
 	Init( path.m_Path.c_str() );
@@ -68,6 +78,11 @@ Helium::FilePath FilePath::operator+( const std::string& rhs ) const
 	return Helium::FilePath( Get() + rhs );
 }
 
+Helium::FilePath FilePath::operator+( const CharStringView& rhs ) const
+{
+	return Helium::FilePath( std::string( Get() ).append( rhs.GetData() ? rhs.GetData() : "", rhs.GetSize() ) );
+}
+
 Helium::FilePath FilePath::operator+( const Helium::FilePath& rhs ) const
 {
 	// you shouldn't use this on an absolute path
@@ -87,6 +102,13 @@ Helium::FilePath& FilePath::operator+=( const std::string& rhs )
 	return *this;
 }
 
+Helium::FilePath& FilePath::operator+=( const CharStringView& rhs )
+{
+	m_Path.append( rhs.GetData() ? rhs.GetData() : "", rhs.GetSize() );
+	std::replace( m_Path.begin(), m_Path.end(), Helium::PathSeparator, s_InternalPathSeparator );
+	return *this;
+}
+
 Helium::FilePath& FilePath::operator+=( const Helium::FilePath& rhs )
 {
 	// you shouldn't use this on an absolute path
@@ -238,7 +260,17 @@ void FilePath::Set( const std::string& path )
 
 void FilePath::Set( const String& path )
 {
-	Init( path.GetData() );
+	Init( path );
+}
+
+void FilePath::Set( const char* path )
+{
+	Init( path );
+}
+
+void FilePath::Set( const CharStringView& path )
+{
+	Init( path );
 }
 
 void FilePath::Clear()
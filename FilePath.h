@@ -18,7 +18,7 @@ namespace Helium
 	private:
 		std::string m_Path;
 
-		void Init( const char* path );
+		void Init( const CharStringView& path );
 
 	public:
 		static void Normalize( std::string& path );
@@ -31,6 +31,8 @@ namespace Helium
 
 	public:
 		explicit FilePath( const std::string& path = TXT( "" ) );
+		explicit FilePath( const char* path );
+		explicit FilePath( const CharStringView& path );
 		FilePath( const FilePath& path );
 
 		const char* operator*() const;
@@ -42,15 +44,19 @@ namespace Helium
 
 		FilePath operator+( const char* rhs ) const;
 		FilePath operator+( const std::string& rhs ) const;
+		FilePath operator+( const CharStringView& rhs ) const;
 		FilePath operator+( const FilePath& rhs ) const;
 
 		FilePath& operator+=( const char* rhs );
 		FilePath& operator+=( const std::string& rhs );
+		FilePath& operator+=( const CharStringView& rhs );
 		FilePath& operator+=( const Helium::FilePath& rhs );
 
 		const std::string& Get() const;
 		void Set( const std::string& path );
 		void Set( const String& path );
+		void Set( const char* path );
+		void Set( const CharStringView& path );
 		void Clear();
 
 		void TrimToExisting();
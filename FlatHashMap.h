@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Foundation/FlatHashTable.h"
+
+#include "Foundation/Functions.h"
+#include "Foundation/HashFunctions.h"
+
+namespace Helium
+{
+    /// Non-thread safe open-addressing hash map container.
+    ///
+    /// Entries are stored inline in a single slot array, so lookups are considerably more cache-friendly than with
+    /// HashMap.  Inserting entries may invalidate iterators and references to existing entries.
+    ///
+    /// @see FlatHashTable
+    template<
+        typename Key,
+        typename Data,
+        typename HashFunction = Hash< Key >,
+        typename EqualKey = Equals< Key >,
+        typename Allocator = DefaultAllocator >
+    class FlatHashMap
+        : public FlatHashTable<
+            KeyValue< Key, Data >, Key, HashFunction, SelectKey< KeyValue< Key, Data > >, EqualKey, Allocator,
+            Pair< Key, Data > >
+    {
+    public:
+        /// Parent class type.
+        typedef FlatHashTable<
+            KeyValue< Key, Data >, Key, HashFunction, SelectKey< KeyValue< Key, Data > >, EqualKey, Allocator,
+            Pair< Key, Data > >
+                Base;
+
+        /// Type for hash map keys.
+        typedef typename Base::KeyType KeyType;
+        /// Type for hash map data.
+        typedef Data DataType;
+        /// Type for hash map entries.
+        typedef typename Base::ValueType ValueType;
+
+        /// Type for key hashing function.
+        typedef typename Base::HasherType HasherType;
+        /// Type for testing two keys for equality.
+        typedef typename Base::KeyEqualType KeyEqualType;
+        /// Allocator type.
+        typedef typename Base::AllocatorType AllocatorType;
+
+        /// Iterator type.
+        typedef typename Base::Iterator Iterator;
+        /// Constant iterator type.
+        typedef typename Base::ConstIterator ConstIterator;
+
+        /// @name Construction/Destruction
+        //@{
+        explicit FlatHashMap( size_t elementCount = 0 );
+        FlatHashMap( const FlatHashMap& rSource );
+        template< typename OtherAllocator > FlatHashMap(
+            const FlatHashMap< Key, Data, HashFunction, EqualKey, OtherAllocator >& rSource );
+        ~FlatHashMap();
+        //@}
+
+        /// @name Overloaded Operators
+        //@{
+        FlatHashMap& operator=( const FlatHashMap& rSource );
+        template< typename OtherAllocator > FlatHashMap& operator=(
+            const FlatHashMap< Key, Data, HashFunction, EqualKey, OtherAllocator >& rSource );
+        //@}
+    };
+}
+
+#include "Foundation/FlatHashMap.inl"
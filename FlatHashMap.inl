@@ -0,0 +1,71 @@
+/// Constructor.
+///
+/// @param[in] elementCount  Number of entries for which to initially reserve space.
+template< typename Key, typename Data, typename HashFunction, typename EqualKey, typename Allocator >
+Helium::FlatHashMap< Key, Data, HashFunction, EqualKey, Allocator >::FlatHashMap( size_t elementCount )
+    : Base( HashFunction(), EqualKey(), SelectKey< KeyValue< Key, Data > >() )
+{
+    Base::Reserve( elementCount );
+}
+
+/// Copy constructor.
+///
+/// @param[in] rSource  Source hash set from which to copy.
+template< typename Key, typename Data, typename HashFunction, typename EqualKey, typename Allocator >
+Helium::FlatHashMap< Key, Data, HashFunction, EqualKey, Allocator >::FlatHashMap( const FlatHashMap& rSource )
+    : Base( rSource )
+{
+}
+
+/// Copy constructor.
+///
+/// @param[in] rSource  Source hash set from which to copy.
+template< typename Key, typename Data, typename HashFunction, typename EqualKey, typename Allocator >
+template< typename OtherAllocator >
+Helium::FlatHashMap< Key, Data, HashFunction, EqualKey, Allocator >::FlatHashMap(
+    const FlatHashMap< Key, Data, HashFunction, EqualKey, OtherAllocator >& rSource )
+    : Base( rSource )
+{
+}
+
+/// Destructor.
+template< typename Key, typename Data, typename HashFunction, typename EqualKey, typename Allocator >
+Helium::FlatHashMap< Key, Data, HashFunction, EqualKey, Allocator >::~FlatHashMap()
+{
+}
+
+/// Assignment operator.
+///
+/// @param[in] rSource  Source hash map from which to copy.
+///
+/// @return  Reference to this object.
+template< typename Key, typename Data, typename HashFunction, typename EqualKey, typename Allocator >
+Helium::FlatHashMap< Key, Data, HashFunction, EqualKey, Allocator >&
+    Helium::FlatHashMap< Key, Data, HashFunction, EqualKey, Allocator >::operator=( const FlatHashMap& rSource )
+{
+    if( this != &rSource )
+    {
+        Base::operator=( rSource );
+    }
+
+    return *this;
+}
+
+/// Assignment operator.
+///
+/// @param[in] rSource  Source hash map from which to copy.
+///
+/// @return  Reference to this object.
+template< typename Key, typename Data, typename HashFunction, typename EqualKey, typename Allocator >
+template< typename OtherAllocator >
+Helium::FlatHashMap< Key, Data, HashFunction, EqualKey, Allocator >&
+    Helium::FlatHashMap< Key, Data, HashFunction, EqualKey, Allocator >::operator=(
+        const FlatHashMap< Key, Data, HashFunction, EqualKey, OtherAllocator >& rSource )
+{
+    if( this != &rSource )
+    {
+        Base::operator=( rSource );
+    }
+
+    return *this;
+}
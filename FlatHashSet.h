@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Foundation/FlatHashTable.h"
+
+#include "Foundation/Functions.h"
+#include "Foundation/HashFunctions.h"
+
+namespace Helium
+{
+    /// Non-thread safe open-addressing hash set container.
+    ///
+    /// Entries are stored inline in a single slot array, so lookups are considerably more cache-friendly than with
+    /// HashSet.  Inserting entries may invalidate iterators and references to existing entries.
+    ///
+    /// @see FlatHashTable
+    template<
+        typename Key,
+        typename HashFunction = Hash< Key >,
+        typename EqualKey = Equals< Key >,
+        typename Allocator = DefaultAllocator >
+    class FlatHashSet : public FlatHashTable< const Key, const Key, HashFunction, Identity< const Key >, EqualKey, Allocator, Key >
+    {
+    public:
+        /// Parent class type.
+        typedef FlatHashTable< const Key, const Key, HashFunction, Identity< const Key >, EqualKey, Allocator, Key > Base;
+
+        /// Type for hash set keys.
+        typedef typename Base::KeyType KeyType;
+        /// Type for hash set entries.
+        typedef typename Base::ValueType ValueType;
+
+        /// Type for key hashing function.
+        typedef typename Base::HasherType HasherType;
+        /// Type for testing two keys for equality.
+        typedef typename Base::KeyEqualType KeyEqualType;
+        /// Allocator type.
+        typedef typename Base::AllocatorType AllocatorType;
+
+        /// Iterator type.
+        typedef typename Base::Iterator Iterator;
+        /// Constant iterator type.
+        typedef typename Base::ConstIterator ConstIterator;
+
+        /// @name Construction/Destruction
+        //@{
+        explicit FlatHashSet( size_t elementCount = 0 );
+        FlatHashSet( const FlatHashSet& rSource );
+        template< typename OtherAllocator > FlatHashSet(
+            const FlatHashSet< Key, HashFunction, EqualKey, OtherAllocator >& rSource );
+        ~FlatHashSet();
+        //@}
+
+        /// @name Overloaded Operators
+        //@{
+        FlatHashSet& operator=( const FlatHashSet& rSource );
+        template< typename OtherAllocator > FlatHashSet& operator=(
+            const FlatHashSet< Key, HashFunction, EqualKey, OtherAllocator >& rSource );
+        //@}
+    };
+}
+
+#include "Foundation/FlatHashSet.inl"
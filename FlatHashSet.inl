@@ -0,0 +1,71 @@
+/// Constructor.
+///
+/// @param[in] elementCount  Number of entries for which to initially reserve space.
+template< typename Key, typename HashFunction, typename EqualKey, typename Allocator >
+Helium::FlatHashSet< Key, HashFunction, EqualKey, Allocator >::FlatHashSet( size_t elementCount )
+    : Base( HashFunction(), EqualKey(), Identity< const Key >() )
+{
+    Base::Reserve( elementCount );
+}
+
+/// Copy constructor.
+///
+/// @param[in] rSource  Source hash set from which to copy.
+template< typename Key, typename HashFunction, typename EqualKey, typename Allocator >
+Helium::FlatHashSet< Key, HashFunction, EqualKey, Allocator >::FlatHashSet( const FlatHashSet& rSource )
+    : Base( rSource )
+{
+}
+
+/// Copy constructor.
+///
+/// @param[in] rSource  Source hash set from which to copy.
+template< typename Key, typename HashFunction, typename EqualKey, typename Allocator >
+template< typename OtherAllocator >
+Helium::FlatHashSet< Key, HashFunction, EqualKey, Allocator >::FlatHashSet(
+    const FlatHashSet< Key, HashFunction, EqualKey, OtherAllocator >& rSource )
+    : Base( rSource )
+{
+}
+
+/// Destructor.
+template< typename Key, typename HashFunction, typename EqualKey, typename Allocator >
+Helium::FlatHashSet< Key, HashFunction, EqualKey, Allocator >::~FlatHashSet()
+{
+}
+
+/// Assignment operator.
+///
+/// @param[in] rSource  Source hash set from which to copy.
+///
+/// @return  Reference to this object.
+template< typename Key, typename HashFunction, typename EqualKey, typename Allocator >
+Helium::FlatHashSet< Key, HashFunction, EqualKey, Allocator >&
+    Helium::FlatHashSet< Key, HashFunction, EqualKey, Allocator >::operator=( const FlatHashSet& rSource )
+{
+    if( this != &rSource )
+    {
+        Base::operator=( rSource );
+    }
+
+    return *this;
+}
+
+/// Assignment operator.
+///
+/// @param[in] rSource  Source hash set from which to copy.
+///
+/// @return  Reference to this object.
+template< typename Key, typename HashFunction, typename EqualKey, typename Allocator >
+template< typename OtherAllocator >
+Helium::FlatHashSet< Key, HashFunction, EqualKey, Allocator >&
+    Helium::FlatHashSet< Key, HashFunction, EqualKey, Allocator >::operator=(
+        const FlatHashSet< Key, HashFunction, EqualKey, OtherAllocator >& rSource )
+{
+    if( this != &rSource )
+    {
+        Base::operator=( rSource );
+    }
+
+    return *this;
+}
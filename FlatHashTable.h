@@ -0,0 +1,421 @@
+#pragma once
+
+#include "Platform/MemoryHeap.h"
+
+#include "Foundation/Math.h"
+#include "Foundation/HashFunctions.h"
+#include "Foundation/Pair.h"
+
+#if defined( HELIUM_CPU_X86 ) && ( defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+# define HELIUM_FLAT_HASH_SSE2 1
+# include <emmintrin.h>
+# if defined( __AVX2__ )
+#  define HELIUM_FLAT_HASH_AVX2 1
+#  include <immintrin.h>
+# endif
+#endif
+
+namespace Helium
+{
+    /// Control byte values used by open-addressing hash tables.  Control bytes for occupied slots store the low seven
+    /// bits of the entry's hash (always non-negative), while unoccupied slots use the negative values below.
+    namespace FlatHashControls
+    {
+        enum FlatHashControl
+        {
+            Empty   = -128,  // slot has not been occupied since the last rehash (terminates probing)
+            Deleted = -2,    // slot held an entry that has since been removed (probing continues past it)
+        };
+    }
+
+    /// Set of matching slots within a control byte group.
+    ///
+    /// Each matching slot is represented by one set bit, with the bit for slot "n" located at bit "n << Shift".
+    template< typename T, size_t Width, size_t Shift >
+    class FlatHashBitMask
+    {
+    public:
+        /// @name Construction/Destruction
+        //@{
+        explicit FlatHashBitMask( T bits );
+        //@}
+
+        /// @name Mask Access
+        //@{
+        bool IsEmpty() const;
+
+        size_t GetLowestIndex() const;
+        void ClearLowest();
+
+        size_t GetTrailingZeros() const;
+        size_t GetLeadingZeros() const;
+        //@}
+
+    private:
+        /// Match bits.
+        T m_bits;
+    };
+
+    /// Portable group of control bytes, matched eight bytes at a time using 64-bit integer arithmetic.
+    class FlatHashGroupPortable
+    {
+    public:
+        /// Number of control bytes examined per group.
+        static const size_t WIDTH = 8;
+
+        /// Match result type.
+        typedef FlatHashBitMask< uint64_t, WIDTH, 3 > BitMask;
+
+        /// @name Construction/Destruction
+        //@{
+        inline explicit FlatHashGroupPortable( const int8_t* pControl );
+        //@}
+
+        /// @name Matching
+        //@{
+        inline BitMask Match( int8_t hash ) const;
+        inline BitMask MatchEmpty() const;
+        inline BitMask MatchEmptyOrDeleted() const;
+        //@}
+
+    private:
+        /// Group control bytes, packed in little-endian order.
+        uint64_t m_control;
+    };
+
+#if HELIUM_FLAT_HASH_SSE2
+    /// Group of control bytes matched sixteen bytes at a time using SSE2.
+    class FlatHashGroupSse2
+    {
+    public:
+        /// Number of control bytes examined per group.
+        static const size_t WIDTH = 16;
+
+        /// Match result type.
+        typedef FlatHashBitMask< uint32_t, WIDTH, 0 > BitMask;
+
+        /// @name Construction/Destruction
+        //@{
+        inline explicit FlatHashGroupSse2( const int8_t* pControl );
+        //@}
+
+        /// @name Matching
+        //@{
+        inline BitMask Match( int8_t hash ) const;
+        inline BitMask MatchEmpty() const;
+        inline BitMask MatchEmptyOrDeleted() const;
+        //@}
+
+    private:
+        /// Group control bytes.
+        __m128i m_control;
+    };
+#endif
+
+#if HELIUM_FLAT_HASH_AVX2
+    /// Group of control bytes matched thirty-two bytes at a time using AVX2.
+    class FlatHashGroupAvx2
+    {
+    public:
+        /// Number of control bytes examined per group.
+        static const size_t WIDTH = 32;
+
+        /// Match result type.
+        typedef FlatHashBitMask< uint32_t, WIDTH, 0 > BitMask;
+
+        /// @name Construction/Destruction
+        //@{
+        inline explicit FlatHashGroupAvx2( const int8_t* pControl );
+        //@}
+
+        /// @name Matching
+        //@{
+        inline BitMask Match( int8_t hash ) const;
+        inline BitMask MatchEmpty() const;
+        inline BitMask MatchEmptyOrDeleted() const;
+        //@}
+
+    private:
+        /// Group control bytes.
+        __m256i m_control;
+    };
+#endif
+
+    /// Control byte group implementation used by FlatHashTable (widest implementation supported by the target).
+#if HELIUM_FLAT_HASH_AVX2
+    typedef FlatHashGroupAvx2 FlatHashGroup;
+#elif HELIUM_FLAT_HASH_SSE2
+    typedef FlatHashGroupSse2 FlatHashGroup;
+#else
+    typedef FlatHashGroupPortable FlatHashGroup;
+#endif
+
+    template<
+        typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+        typename InternalValue >
+    class FlatHashTable;
+
+    /// Constant open-addressing hash table iterator.
+    template<
+        typename Value,
+        typename Key,
+        typename HashFunction,
+        typename ExtractKey,
+        typename EqualKey,
+        typename Allocator,
+        typename InternalValue >
+    class ConstFlatHashTableIterator
+    {
+        friend class FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >;
+
+    public:
+        /// Hash table value type.
+        typedef Value ValueType;
+
+        /// Type for pointers to hash table elements.
+        typedef Value* PointerType;
+        /// Type for references to hash table elements.
+        typedef Value& ReferenceType;
+        /// Type for constant pointers to hash table elements.
+        typedef const Value* ConstPointerType;
+        /// Type for constant references to hash table elements.
+        typedef const Value& ConstReferenceType;
+
+        /// Hash table type.
+        typedef FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue > TableType;
+
+        /// @name Construction/Destruction
+        //@{
+        ConstFlatHashTableIterator();
+        //@}
+
+        /// @name Overloaded Operators
+        //@{
+        const Value& operator*() const;
+        const Value* operator->() const;
+
+        ConstFlatHashTableIterator& operator++();
+        ConstFlatHashTableIterator operator++( int );
+        ConstFlatHashTableIterator& operator--();
+        ConstFlatHashTableIterator operator--( int );
+
+        bool operator==( const ConstFlatHashTableIterator& rOther ) const;
+        bool operator!=( const ConstFlatHashTableIterator& rOther ) const;
+        bool operator<( const ConstFlatHashTableIterator& rOther ) const;
+        bool operator>( const ConstFlatHashTableIterator& rOther ) const;
+        bool operator<=( const ConstFlatHashTableIterator& rOther ) const;
+        bool operator>=( const ConstFlatHashTableIterator& rOther ) const;
+        //@}
+
+    protected:
+        /// Hash table currently referenced by this iterator.
+        TableType* m_pTable;
+        /// Current table slot index.
+        size_t m_slotIndex;
+
+        /// @name Construction/Destruction, Protected
+        //@{
+        ConstFlatHashTableIterator( const TableType* pTable, size_t slotIndex );
+        //@}
+    };
+
+    /// Non-constant open-addressing hash table iterator.
+    template<
+        typename Value,
+        typename Key,
+        typename HashFunction,
+        typename ExtractKey,
+        typename EqualKey,
+        typename Allocator,
+        typename InternalValue >
+    class FlatHashTableIterator :
+        public ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >
+    {
+        friend class FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >;
+
+    public:
+        /// Hash table value type.
+        typedef Value ValueType;
+
+        /// Type for pointers to hash table elements.
+        typedef Value* PointerType;
+        /// Type for references to hash table elements.
+        typedef Value& ReferenceType;
+        /// Type for constant pointers to hash table elements.
+        typedef const Value* ConstPointerType;
+        /// Type for constant references to hash table elements.
+        typedef const Value& ConstReferenceType;
+
+        /// Hash table type.
+        typedef FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue > TableType;
+
+        /// @name Construction/Destruction
+        //@{
+        FlatHashTableIterator();
+        //@}
+
+        /// @name Overloaded Operators
+        //@{
+        Value& operator*() const;
+        Value* operator->() const;
+
+        FlatHashTableIterator& operator++();
+        FlatHashTableIterator operator++( int );
+        FlatHashTableIterator& operator--();
+        FlatHashTableIterator operator--( int );
+        //@}
+
+    protected:
+        /// @name Construction/Destruction, Protected
+        //@{
+        FlatHashTableIterator( TableType* pTable, size_t slotIndex );
+        //@}
+    };
+
+    /// Base class for non-thread safe open-addressing hash table containers.
+    ///
+    /// Unlike HashTable, which stores each bucket in a separately allocated array, all entries are stored inline in a
+    /// single slot array alongside an array of one-byte control values (Swiss table layout).  Each control byte holds
+    /// seven bits of the hash of the entry in its slot, so lookups can reject nearly all non-matching slots by
+    /// scanning a group of control bytes at a time without touching the entries themselves.  An empty table performs
+    /// no allocations.
+    ///
+    /// Inserting new entries may reallocate the slot array, which invalidates all existing iterators and any pointers
+    /// or references to entries in the table.
+    template<
+        typename Value,
+        typename Key,
+        typename HashFunction,
+        typename ExtractKey,
+        typename EqualKey,
+        typename Allocator,
+        typename InternalValue >
+    class FlatHashTable
+    {
+        friend class ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >;
+        friend class FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >;
+
+        template< typename, typename, typename, typename, typename, typename, typename > friend class FlatHashTable;
+
+    public:
+        /// Type for hash table keys.
+        typedef Key KeyType;
+        /// Type for hash table entries.
+        typedef Value ValueType;
+
+        /// Internal value type (type used for actual value storage).
+        typedef InternalValue InternalValueType;
+
+        /// Type for key hashing function.
+        typedef HashFunction HasherType;
+        /// Type for testing two keys for equality.
+        typedef EqualKey KeyEqualType;
+        /// Allocator type.
+        typedef Allocator AllocatorType;
+
+        /// Iterator type.
+        typedef FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >
+            Iterator;
+        /// Constant iterator type.
+        typedef ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >
+            ConstIterator;
+
+        /// @name Hash Table Operations
+        //@{
+        size_t GetSize() const;
+        bool IsEmpty() const;
+
+        size_t GetCapacity() const;
+        void Reserve( size_t elementCount );
+
+        void Clear();
+        void Trim();
+
+        Iterator Begin();
+        ConstIterator Begin() const;
+        Iterator End();
+        ConstIterator End() const;
+
+        Iterator Find( const Key& rKey );
+        ConstIterator Find( const Key& rKey ) const;
+
+        Pair< Iterator, bool > Insert( const ValueType& rValue );
+        bool Insert( ConstIterator& rIterator, const ValueType& rValue );
+
+        bool Remove( const Key& rKey );
+        void Remove( Iterator iterator );
+
+        void Swap( FlatHashTable& rTable );
+        //@}
+
+    protected:
+        /// Control byte group type.
+        typedef FlatHashGroup Group;
+
+        /// Slot control bytes (followed by a copy of the first group of control bytes so that groups can be loaded
+        /// from any slot without wrapping).
+        int8_t* m_pControl;
+        /// Entry slots.
+        InternalValue* m_pSlots;
+        /// Number of slots (zero or a power of two no smaller than the group width).
+        size_t m_capacity;
+
+        /// Number of elements currently in the hash table.
+        size_t m_size;
+        /// Number of entries that can be added to never-used slots before the table needs to be rehashed.
+        size_t m_growthLeft;
+
+        /// Key hashing functor.
+        HasherType m_hasher;
+        /// Key equal comparison functor.
+        EqualKey m_keyEquals;
+        /// Key extraction functor.
+        ExtractKey m_extractKey;
+        /// Allocator functor.
+        AllocatorType m_allocator;
+
+        /// @name Construction/Destruction, Protected
+        //@{
+        FlatHashTable(
+            const HashFunction& rHasher, const EqualKey& rKeyEquals, const ExtractKey& rExtractKey,
+            const Allocator& rAllocator = Allocator() );
+        FlatHashTable( const HashFunction& rHasher, const EqualKey& rKeyEquals, const Allocator& rAllocator = Allocator() );
+        FlatHashTable( const FlatHashTable& rSource );
+        template< typename OtherAllocator > FlatHashTable(
+            const FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, OtherAllocator, InternalValue >& rSource );
+        ~FlatHashTable();
+        //@}
+
+        /// @name Overloaded Operators, Protected
+        //@{
+        FlatHashTable& operator=( const FlatHashTable& rSource );
+        template< typename OtherAllocator > FlatHashTable& operator=(
+            const FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, OtherAllocator, InternalValue >& rSource );
+        //@}
+
+    private:
+        /// @name Private Utility Functions
+        //@{
+        size_t HashKey( const Key& rKey ) const;
+        size_t FindSlot( const Key& rKey, size_t hash ) const;
+        size_t FindFirstNonFull( size_t hash ) const;
+        size_t PrepareInsert( size_t hash );
+        void EraseSlot( size_t slotIndex );
+        void SetControl( size_t slotIndex, int8_t control );
+
+        size_t GetNextFullSlot( size_t slotIndex ) const;
+
+        void Resize( size_t capacity );
+        void AllocateSlots( size_t capacity );
+
+        template< typename OtherAllocator > void CopyConstruct(
+            const FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, OtherAllocator, InternalValue >& rSource );
+        void Finalize();
+
+        static size_t GetGrowthCapacity( size_t capacity );
+        static size_t GetMinimumCapacity( size_t elementCount );
+        //@}
+    };
+}
+
+#include "Foundation/FlatHashTable.inl"
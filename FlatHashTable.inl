@@ -0,0 +1,1424 @@
+/// Constructor.
+///
+/// @param[in] bits  Match bits.
+template< typename T, size_t Width, size_t Shift >
+Helium::FlatHashBitMask< T, Width, Shift >::FlatHashBitMask( T bits )
+    : m_bits( bits )
+{
+}
+
+/// Get whether this mask has no matching slots.
+///
+/// @return  True if no slots matched, false if at least one slot matched.
+template< typename T, size_t Width, size_t Shift >
+bool Helium::FlatHashBitMask< T, Width, Shift >::IsEmpty() const
+{
+    return ( m_bits == 0 );
+}
+
+/// Get the group index of the lowest matching slot.
+///
+/// @return  Index of the first matching slot within the group.
+///
+/// @see ClearLowest()
+template< typename T, size_t Width, size_t Shift >
+size_t Helium::FlatHashBitMask< T, Width, Shift >::GetLowestIndex() const
+{
+    HELIUM_ASSERT( m_bits != 0 );
+
+    return ( CountTrailingZeros( m_bits ) >> Shift );
+}
+
+/// Remove the lowest matching slot from this mask.
+///
+/// @see GetLowestIndex()
+template< typename T, size_t Width, size_t Shift >
+void Helium::FlatHashBitMask< T, Width, Shift >::ClearLowest()
+{
+    m_bits &= m_bits - 1;
+}
+
+/// Get the number of non-matching slots at the start of the group.
+///
+/// @return  Number of slots preceding the first matching slot, or the group width if no slots matched.
+///
+/// @see GetLeadingZeros()
+template< typename T, size_t Width, size_t Shift >
+size_t Helium::FlatHashBitMask< T, Width, Shift >::GetTrailingZeros() const
+{
+    return ( m_bits != 0 ? CountTrailingZeros( m_bits ) >> Shift : Width );
+}
+
+/// Get the number of non-matching slots at the end of the group.
+///
+/// @return  Number of slots following the last matching slot, or the group width if no slots matched.
+///
+/// @see GetTrailingZeros()
+template< typename T, size_t Width, size_t Shift >
+size_t Helium::FlatHashBitMask< T, Width, Shift >::GetLeadingZeros() const
+{
+    const size_t extraBitCount = sizeof( T ) * 8 - ( Width << Shift );
+
+    return ( m_bits != 0 ? CountLeadingZeros( static_cast< T >( m_bits << extraBitCount ) ) >> Shift : Width );
+}
+
+/// Constructor.
+///
+/// @param[in] pControl  Pointer to the first control byte in the group.
+Helium::FlatHashGroupPortable::FlatHashGroupPortable( const int8_t* pControl )
+{
+    HELIUM_ASSERT( pControl );
+
+#if HELIUM_ENDIAN_LITTLE
+    MemoryCopy( &m_control, pControl, sizeof( m_control ) );
+#else
+    uint64_t control = 0;
+    for( size_t byteIndex = 0; byteIndex < WIDTH; ++byteIndex )
+    {
+        control |= static_cast< uint64_t >( static_cast< uint8_t >( pControl[ byteIndex ] ) ) << ( byteIndex * 8 );
+    }
+
+    m_control = control;
+#endif
+}
+
+/// Find the slots in this group whose control bytes match the given hash bits.
+///
+/// This may occasionally report false positives (a byte adjacent to a true match), which are harmless since the caller
+/// always compares the actual keys of matching slots.
+///
+/// @param[in] hash  Seven-bit hash value to match.
+///
+/// @return  Mask of matching slots.
+Helium::FlatHashGroupPortable::BitMask Helium::FlatHashGroupPortable::Match( int8_t hash ) const
+{
+    const uint64_t lsbs = 0x0101010101010101ULL;
+    const uint64_t msbs = 0x8080808080808080ULL;
+
+    uint64_t x = m_control ^ ( lsbs * static_cast< uint8_t >( hash ) );
+
+    return BitMask( ( x - lsbs ) & ~x & msbs );
+}
+
+/// Find the slots in this group that are empty.
+///
+/// @return  Mask of empty slots.
+Helium::FlatHashGroupPortable::BitMask Helium::FlatHashGroupPortable::MatchEmpty() const
+{
+    const uint64_t msbs = 0x8080808080808080ULL;
+
+    // Empty is the only control value with the high bit set and bit 1 cleared.
+    return BitMask( ( m_control & ( ~m_control << 6 ) ) & msbs );
+}
+
+/// Find the slots in this group that are either empty or hold a deleted entry.
+///
+/// @return  Mask of empty or deleted slots.
+Helium::FlatHashGroupPortable::BitMask Helium::FlatHashGroupPortable::MatchEmptyOrDeleted() const
+{
+    const uint64_t msbs = 0x8080808080808080ULL;
+
+    return BitMask( m_control & msbs );
+}
+
+#if HELIUM_FLAT_HASH_SSE2
+/// Constructor.
+///
+/// @param[in] pControl  Pointer to the first control byte in the group.
+Helium::FlatHashGroupSse2::FlatHashGroupSse2( const int8_t* pControl )
+    : m_control( _mm_loadu_si128( reinterpret_cast< const __m128i* >( pControl ) ) )
+{
+    HELIUM_ASSERT( pControl );
+}
+
+/// Find the slots in this group whose control bytes match the given hash bits.
+///
+/// @param[in] hash  Seven-bit hash value to match.
+///
+/// @return  Mask of matching slots.
+Helium::FlatHashGroupSse2::BitMask Helium::FlatHashGroupSse2::Match( int8_t hash ) const
+{
+    return BitMask( static_cast< uint32_t >( _mm_movemask_epi8( _mm_cmpeq_epi8( m_control, _mm_set1_epi8( hash ) ) ) ) );
+}
+
+/// Find the slots in this group that are empty.
+///
+/// @return  Mask of empty slots.
+Helium::FlatHashGroupSse2::BitMask Helium::FlatHashGroupSse2::MatchEmpty() const
+{
+    return BitMask( static_cast< uint32_t >(
+        _mm_movemask_epi8( _mm_cmpeq_epi8( m_control, _mm_set1_epi8( static_cast< int8_t >( FlatHashControls::Empty ) ) ) ) ) );
+}
+
+/// Find the slots in this group that are either empty or hold a deleted entry.
+///
+/// @return  Mask of empty or deleted slots.
+Helium::FlatHashGroupSse2::BitMask Helium::FlatHashGroupSse2::MatchEmptyOrDeleted() const
+{
+    // Only the sign bit of each control byte is needed, since all unoccupied control values are negative.
+    return BitMask( static_cast< uint32_t >( _mm_movemask_epi8( m_control ) ) );
+}
+#endif  // HELIUM_FLAT_HASH_SSE2
+
+#if HELIUM_FLAT_HASH_AVX2
+/// Constructor.
+///
+/// @param[in] pControl  Pointer to the first control byte in the group.
+Helium::FlatHashGroupAvx2::FlatHashGroupAvx2( const int8_t* pControl )
+    : m_control( _mm256_loadu_si256( reinterpret_cast< const __m256i* >( pControl ) ) )
+{
+    HELIUM_ASSERT( pControl );
+}
+
+/// Find the slots in this group whose control bytes match the given hash bits.
+///
+/// @param[in] hash  Seven-bit hash value to match.
+///
+/// @return  Mask of matching slots.
+Helium::FlatHashGroupAvx2::BitMask Helium::FlatHashGroupAvx2::Match( int8_t hash ) const
+{
+    return BitMask( static_cast< uint32_t >( _mm256_movemask_epi8( _mm256_cmpeq_epi8( m_control, _mm256_set1_epi8( hash ) ) ) ) );
+}
+
+/// Find the slots in this group that are empty.
+///
+/// @return  Mask of empty slots.
+Helium::FlatHashGroupAvx2::BitMask Helium::FlatHashGroupAvx2::MatchEmpty() const
+{
+    return BitMask( static_cast< uint32_t >(
+        _mm256_movemask_epi8( _mm256_cmpeq_epi8( m_control, _mm256_set1_epi8( static_cast< int8_t >( FlatHashControls::Empty ) ) ) ) ) );
+}
+
+/// Find the slots in this group that are either empty or hold a deleted entry.
+///
+/// @return  Mask of empty or deleted slots.
+Helium::FlatHashGroupAvx2::BitMask Helium::FlatHashGroupAvx2::MatchEmptyOrDeleted() const
+{
+    // Only the sign bit of each control byte is needed, since all unoccupied control values are negative.
+    return BitMask( static_cast< uint32_t >( _mm256_movemask_epi8( m_control ) ) );
+}
+#endif  // HELIUM_FLAT_HASH_AVX2
+
+/// Constructor.
+///
+/// Creates an uninitialized iterator.  Using this is not safe until it is initialized.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::ConstFlatHashTableIterator()
+{
+}
+
+/// Constructor.
+///
+/// @param[in] pTable     Table to iterate.
+/// @param[in] slotIndex  Current table slot index.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::ConstFlatHashTableIterator(
+    const TableType* pTable, size_t slotIndex )
+    : m_pTable( const_cast< TableType* >( pTable ) )
+    , m_slotIndex( slotIndex )
+{
+}
+
+/// Access the current hash table entry.
+///
+/// @return  Constant reference to the current hash table entry.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+const Value& Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator*() const
+{
+    HELIUM_ASSERT( m_pTable );
+    HELIUM_ASSERT( m_slotIndex < m_pTable->m_capacity );
+    HELIUM_ASSERT( m_pTable->m_pControl[ m_slotIndex ] >= 0 );
+
+    return m_pTable->m_pSlots[ m_slotIndex ];
+}
+
+/// Access the current hash table entry.
+///
+/// @return  Constant pointer to the current hash table entry.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+const Value* Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator->() const
+{
+    HELIUM_ASSERT( m_pTable );
+    HELIUM_ASSERT( m_slotIndex < m_pTable->m_capacity );
+    HELIUM_ASSERT( m_pTable->m_pControl[ m_slotIndex ] >= 0 );
+
+    return &m_pTable->m_pSlots[ m_slotIndex ];
+}
+
+/// Increment this iterator to the next hash table entry.
+///
+/// @return  Reference to this iterator.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >&
+    Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator++()
+{
+    HELIUM_ASSERT( m_pTable );
+    HELIUM_ASSERT( m_slotIndex < m_pTable->m_capacity );
+
+    m_slotIndex = m_pTable->GetNextFullSlot( m_slotIndex + 1 );
+
+    return *this;
+}
+
+/// Post-increment this iterator to the next hash table entry.
+///
+/// @return  Copy of this iterator at the location prior to incrementing.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >
+    Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator++( int )
+{
+    ConstFlatHashTableIterator iterator = *this;
+    ++( *this );
+
+    return iterator;
+}
+
+/// Decrement this iterator to the previous hash table entry.
+///
+/// @return  Reference to this iterator.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >&
+    Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator--()
+{
+    HELIUM_ASSERT( m_pTable );
+    HELIUM_ASSERT( m_slotIndex <= m_pTable->m_capacity );  // Allow decrementing from the End() iterator.
+
+    const int8_t* pControl = m_pTable->m_pControl;
+
+    size_t slotIndex = m_slotIndex;
+    while( slotIndex != 0 )
+    {
+        --slotIndex;
+
+        if( pControl[ slotIndex ] >= 0 )
+        {
+            m_slotIndex = slotIndex;
+
+            return *this;
+        }
+    }
+
+    HELIUM_BREAK_MSG( TXT( "Attempted backward FlatHashTable iteration past the start of the table" ) );
+
+    m_slotIndex = 0;
+
+    return *this;
+}
+
+/// Post-decrement this iterator to the previous hash table entry.
+///
+/// @return  Copy of this iterator at the location prior to decrementing.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >
+    Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator--( int )
+{
+    ConstFlatHashTableIterator iterator = *this;
+    --( *this );
+
+    return iterator;
+}
+
+/// Get whether this iterator references the same hash table location as another iterator.
+///
+/// @param[in] rOther  Iterator against which to compare.
+///
+/// @return  True if this iterator references the same hash table location as the given iterator, false if not.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+bool Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator==(
+    const ConstFlatHashTableIterator& rOther ) const
+{
+    return ( m_pTable == rOther.m_pTable && m_slotIndex == rOther.m_slotIndex );
+}
+
+/// Get whether this iterator does not reference the same hash table location as another iterator.
+///
+/// @param[in] rOther  Iterator against which to compare.
+///
+/// @return  True if this iterator does not reference the same hash table location as the given iterator, false if
+///          they do match.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+bool Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator!=(
+    const ConstFlatHashTableIterator& rOther ) const
+{
+    return ( m_pTable != rOther.m_pTable || m_slotIndex != rOther.m_slotIndex );
+}
+
+/// Get whether this iterator references a hash table location that precedes that of another iterator.
+///
+/// @param[in] rOther  Iterator against which to compare.
+///
+/// @return  True if this iterator references a hash table location that precedes that of the given iterator, false if
+///          not.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+bool Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator<(
+    const ConstFlatHashTableIterator& rOther ) const
+{
+    return ( m_pTable < rOther.m_pTable || ( m_pTable == rOther.m_pTable && m_slotIndex < rOther.m_slotIndex ) );
+}
+
+/// Get whether this iterator references a hash table location that succeeds that of another iterator.
+///
+/// @param[in] rOther  Iterator against which to compare.
+///
+/// @return  True if this iterator references a hash table location that succeeds that of the given iterator, false if
+///          not.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+bool Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator>(
+    const ConstFlatHashTableIterator& rOther ) const
+{
+    return ( m_pTable > rOther.m_pTable || ( m_pTable == rOther.m_pTable && m_slotIndex > rOther.m_slotIndex ) );
+}
+
+/// Get whether this iterator references a hash table location that matches or precedes that of another iterator.
+///
+/// @param[in] rOther  Iterator against which to compare.
+///
+/// @return  True if this iterator references a hash table location that matches or precedes that of the given iterator,
+///          false if not.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+bool Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator<=(
+    const ConstFlatHashTableIterator& rOther ) const
+{
+    return ( m_pTable < rOther.m_pTable || ( m_pTable == rOther.m_pTable && m_slotIndex <= rOther.m_slotIndex ) );
+}
+
+/// Get whether this iterator references a hash table location that matches or succeeds that of another iterator.
+///
+/// @param[in] rOther  Iterator against which to compare.
+///
+/// @return  True if this iterator references a hash table location that matches or succeeds that of the given iterator,
+///          false if not.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+bool Helium::ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator>=(
+    const ConstFlatHashTableIterator& rOther ) const
+{
+    return ( m_pTable > rOther.m_pTable || ( m_pTable == rOther.m_pTable && m_slotIndex >= rOther.m_slotIndex ) );
+}
+
+/// Constructor.
+///
+/// Creates an uninitialized iterator.  Using this is not safe until it is initialized.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::FlatHashTableIterator()
+{
+}
+
+/// Constructor.
+///
+/// @param[in] pTable     Table to iterate.
+/// @param[in] slotIndex  Current table slot index.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::FlatHashTableIterator(
+    TableType* pTable, size_t slotIndex )
+    : ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >( pTable, slotIndex )
+{
+}
+
+/// Access the current hash table entry.
+///
+/// @return  Reference to the current hash table entry.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Value& Helium::FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator*() const
+{
+    HELIUM_ASSERT( this->m_pTable );
+    HELIUM_ASSERT( this->m_slotIndex < this->m_pTable->m_capacity );
+    HELIUM_ASSERT( this->m_pTable->m_pControl[ this->m_slotIndex ] >= 0 );
+
+    return this->m_pTable->m_pSlots[ this->m_slotIndex ];
+}
+
+/// Access the current hash table entry.
+///
+/// @return  Pointer to the current hash table entry.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Value* Helium::FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator->() const
+{
+    HELIUM_ASSERT( this->m_pTable );
+    HELIUM_ASSERT( this->m_slotIndex < this->m_pTable->m_capacity );
+    HELIUM_ASSERT( this->m_pTable->m_pControl[ this->m_slotIndex ] >= 0 );
+
+    return &this->m_pTable->m_pSlots[ this->m_slotIndex ];
+}
+
+/// Increment this iterator to the next hash table entry.
+///
+/// @return  Reference to this iterator.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >&
+    Helium::FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator++()
+{
+    ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator++();
+
+    return *this;
+}
+
+/// Post-increment this iterator to the next hash table entry.
+///
+/// @return  Copy of this iterator at the location prior to incrementing.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >
+    Helium::FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator++( int )
+{
+    FlatHashTableIterator iterator = *this;
+    ++( *this );
+
+    return iterator;
+}
+
+/// Decrement this iterator to the previous hash table entry.
+///
+/// @return  Reference to this iterator.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >&
+    Helium::FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator--()
+{
+    ConstFlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator--();
+
+    return *this;
+}
+
+/// Post-decrement this iterator to the previous hash table entry.
+///
+/// @return  Copy of this iterator at the location prior to decrementing.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >
+    Helium::FlatHashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator--( int )
+{
+    FlatHashTableIterator iterator = *this;
+    --( *this );
+
+    return iterator;
+}
+
+/// Constructor.
+///
+/// No memory is allocated until the first entry is inserted (or Reserve() is called).
+///
+/// @param[in] rHasher      Key hashing functor.
+/// @param[in] rKeyEquals   Key equal comparison functor.
+/// @param[in] rExtractKey  Key extraction functor.
+/// @param[in] rAllocator   Allocator functor.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::FlatHashTable(
+    const HashFunction& rHasher,
+    const EqualKey& rKeyEquals,
+    const ExtractKey& rExtractKey,
+    const Allocator& rAllocator )
+    : m_pControl( NULL )
+    , m_pSlots( NULL )
+    , m_capacity( 0 )
+    , m_size( 0 )
+    , m_growthLeft( 0 )
+    , m_hasher( rHasher )
+    , m_keyEquals( rKeyEquals )
+    , m_extractKey( rExtractKey )
+    , m_allocator( rAllocator )
+{
+}
+
+/// Constructor.
+///
+/// No memory is allocated until the first entry is inserted (or Reserve() is called).
+///
+/// @param[in] rHasher      Key hashing functor.
+/// @param[in] rKeyEquals   Key equal comparison functor.
+/// @param[in] rAllocator   Allocator functor.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::FlatHashTable(
+    const HashFunction& rHasher,
+    const EqualKey& rKeyEquals,
+    const Allocator& rAllocator )
+    : m_pControl( NULL )
+    , m_pSlots( NULL )
+    , m_capacity( 0 )
+    , m_size( 0 )
+    , m_growthLeft( 0 )
+    , m_hasher( rHasher )
+    , m_keyEquals( rKeyEquals )
+    , m_allocator( rAllocator )
+{
+}
+
+/// Copy constructor.
+///
+/// @param[in] rSource  Hash table from which to construct a copy.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::FlatHashTable(
+    const FlatHashTable& rSource )
+{
+    CopyConstruct( rSource );
+}
+
+/// Copy constructor.
+///
+/// @param[in] rSource  Hash table from which to construct a copy.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+template< typename OtherAllocator >
+Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::FlatHashTable(
+    const FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, OtherAllocator, InternalValue >& rSource )
+{
+    CopyConstruct( rSource );
+}
+
+/// Destructor.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::~FlatHashTable()
+{
+    Finalize();
+}
+
+/// Get the number of entries currently in this table.
+///
+/// @return  Number of hash table entries.
+///
+/// @see IsEmpty()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetSize() const
+{
+    return m_size;
+}
+
+/// Get whether this table is currently empty.
+///
+/// @return  True if this table is empty, false if not.
+///
+/// @see GetSize()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+bool Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::IsEmpty() const
+{
+    return ( m_size == 0 );
+}
+
+/// Get the number of entry slots currently allocated for this table.
+///
+/// Note that the table is rehashed before all slots are filled in order to keep probe sequences short.
+///
+/// @return  Number of allocated slots.
+///
+/// @see Reserve()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetCapacity() const
+{
+    return m_capacity;
+}
+
+/// Make sure this table can hold at least the specified number of entries without needing to be rehashed.
+///
+/// This will never reduce the current capacity.  All iterators into this table are invalidated if the slot array is
+/// reallocated.
+///
+/// @param[in] elementCount  Number of entries for which to reserve space.
+///
+/// @see GetCapacity(), Trim()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Reserve( size_t elementCount )
+{
+    size_t capacity = GetMinimumCapacity( elementCount );
+    if( capacity > m_capacity )
+    {
+        Resize( capacity );
+    }
+}
+
+/// Clear out all entries in this table.
+///
+/// The slot array is retained for reuse; call Trim() afterward to free it.
+///
+/// @see Trim()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Clear()
+{
+    size_t capacity = m_capacity;
+    if( capacity == 0 )
+    {
+        return;
+    }
+
+    int8_t* pControl = m_pControl;
+    InternalValue* pSlots = m_pSlots;
+    for( size_t slotIndex = 0; slotIndex < capacity; ++slotIndex )
+    {
+        if( pControl[ slotIndex ] >= 0 )
+        {
+            pSlots[ slotIndex ].~InternalValue();
+        }
+    }
+
+    MemorySet( pControl, FlatHashControls::Empty, capacity + Group::WIDTH );
+
+    m_size = 0;
+    m_growthLeft = GetGrowthCapacity( capacity );
+}
+
+/// Shrink the slot array to the smallest capacity that can hold the current contents of this table.
+///
+/// All iterators into this table are invalidated if the slot array is reallocated.
+///
+/// @see Clear(), Reserve()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Trim()
+{
+    if( m_size == 0 )
+    {
+        Finalize();
+
+        m_pControl = NULL;
+        m_pSlots = NULL;
+        m_capacity = 0;
+        m_growthLeft = 0;
+
+        return;
+    }
+
+    size_t capacity = GetMinimumCapacity( m_size );
+    if( capacity < m_capacity )
+    {
+        Resize( capacity );
+    }
+}
+
+/// Retrieve an iterator referencing the beginning of this table.
+///
+/// @return  Iterator at the beginning of this table.
+///
+/// @see End()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+typename Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Iterator
+    Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Begin()
+{
+    return Iterator( this, GetNextFullSlot( 0 ) );
+}
+
+/// Retrieve a constant iterator referencing the beginning of this table.
+///
+/// @return  Constant iterator at the beginning of this table.
+///
+/// @see End()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+typename Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::ConstIterator
+    Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Begin() const
+{
+    return ConstIterator( this, GetNextFullSlot( 0 ) );
+}
+
+/// Retrieve an iterator referencing the end of this table.
+///
+/// @return  Iterator at the end of this table.
+///
+/// @see Begin()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+typename Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Iterator
+    Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::End()
+{
+    return Iterator( this, m_capacity );
+}
+
+/// Retrieve a constant iterator referencing the end of this table.
+///
+/// @return  Constant iterator at the end of this table.
+///
+/// @see Begin()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+typename Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::ConstIterator
+    Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::End() const
+{
+    return ConstIterator( this, m_capacity );
+}
+
+/// Search for an entry in this table with the given key, acquiring read-write access to the element if found.
+///
+/// @param[in] rKey  Key to locate.
+///
+/// @return  Iterator referencing the element in this table with the given key if found, otherwise referencing the table
+///          end if not found.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+typename Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Iterator
+    Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Find( const Key& rKey )
+{
+    if( m_size != 0 )
+    {
+        size_t slotIndex = FindSlot( rKey, HashKey( rKey ) );
+        if( IsValid( slotIndex ) )
+        {
+            return Iterator( this, slotIndex );
+        }
+    }
+
+    return End();
+}
+
+/// Search for an entry in this table with the given key, acquiring read-only access to the element if found.
+///
+/// @param[in] rKey  Key to locate.
+///
+/// @return  Constant iterator referencing the element in this table with the given key if found, otherwise referencing
+///          the table end if not found.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+typename Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::ConstIterator
+    Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Find( const Key& rKey ) const
+{
+    if( m_size != 0 )
+    {
+        size_t slotIndex = FindSlot( rKey, HashKey( rKey ) );
+        if( IsValid( slotIndex ) )
+        {
+            return ConstIterator( this, slotIndex );
+        }
+    }
+
+    return End();
+}
+
+/// Locate the entry in this table with a key that matches that of a given value, inserting a copy of the given value if
+/// one does not already exist.
+///
+/// @param[in] rValue  Value containing the key to find as well as providing the value to insert if an entry does not
+///                    already exist with the given key.
+///
+/// @return  Pair containing an iterator and a boolean value.  The iterator will be set to reference the entry in this
+///          table with the given key, while the boolean value will be set to true if the entry was inserted, false if
+///          an entry already existed in this table (in which case the value won't automatically be inserted.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::Pair< typename Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Iterator, bool >
+    Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Insert( const Value& rValue )
+{
+    Pair< Iterator, bool > result;
+    result.Second() = Insert( result.First(), rValue );
+
+    return result;
+}
+
+/// Locate the entry in this table with a key that matches that of a given value, inserting a copy of the given value if
+/// one does not already exist.
+///
+/// Inserting a new entry may reallocate the slot array, in which case any existing iterators into this table are
+/// invalidated.
+///
+/// @param[out] rIterator  Iterator set to reference the entry in this table with the given key.
+/// @param[in]  rValue     Value containing the key to find as well as providing the value to insert if an entry does
+///                        not already exist with the given key.
+///
+/// @return  True if a new entry was inserted, false if one already exists.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+bool Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Insert(
+    ConstIterator& rIterator,
+    const Value& rValue )
+{
+    const Key& rKey = m_extractKey( rValue );
+    size_t hash = HashKey( rKey );
+
+    // Search for an existing entry.
+    if( m_size != 0 )
+    {
+        size_t slotIndex = FindSlot( rKey, hash );
+        if( IsValid( slotIndex ) )
+        {
+            rIterator = ConstIterator( this, slotIndex );
+
+            return false;
+        }
+    }
+
+    // Entry not found, so add it to the table.
+    size_t slotIndex = PrepareInsert( hash );
+    new( m_pSlots + slotIndex ) InternalValue( rValue );
+    ++m_size;
+
+    rIterator = ConstIterator( this, slotIndex );
+
+    return true;
+}
+
+/// Remove any entry with the specified key from this table.
+///
+/// @param[in] rKey  Key to locate.
+///
+/// @return  True if an entry was found and removed, false if not.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+bool Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Remove( const Key& rKey )
+{
+    if( m_size == 0 )
+    {
+        return false;
+    }
+
+    size_t slotIndex = FindSlot( rKey, HashKey( rKey ) );
+    if( IsInvalid( slotIndex ) )
+    {
+        // Entry not found, so no action has been taken.
+        return false;
+    }
+
+    EraseSlot( slotIndex );
+
+    return true;
+}
+
+/// Remove the entry referenced by the specified iterator.
+///
+/// Removal never reallocates the slot array, so iterators to other entries remain valid.
+///
+/// @param[in] iterator  Iterator for the entry to remove.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Remove(
+    Iterator iterator )
+{
+    HELIUM_ASSERT( iterator.m_pTable == this );
+    HELIUM_ASSERT( iterator.m_slotIndex < m_capacity );
+    HELIUM_ASSERT( m_pControl[ iterator.m_slotIndex ] >= 0 );
+
+    EraseSlot( iterator.m_slotIndex );
+}
+
+/// Swap the contents of this table with another table.
+///
+/// @param[in] rTable  Table with which to swap.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Swap(
+    FlatHashTable& rTable )
+{
+    int8_t* pControl = m_pControl;
+    InternalValue* pSlots = m_pSlots;
+    size_t capacity = m_capacity;
+    size_t size = m_size;
+    size_t growthLeft = m_growthLeft;
+    HasherType hasher = m_hasher;
+    EqualKey keyEquals = m_keyEquals;
+    ExtractKey extractKey = m_extractKey;
+    AllocatorType allocator = m_allocator;
+
+    m_pControl = rTable.m_pControl;
+    m_pSlots = rTable.m_pSlots;
+    m_capacity = rTable.m_capacity;
+    m_size = rTable.m_size;
+    m_growthLeft = rTable.m_growthLeft;
+    m_hasher = rTable.m_hasher;
+    m_keyEquals = rTable.m_keyEquals;
+    m_extractKey = rTable.m_extractKey;
+    m_allocator = rTable.m_allocator;
+
+    rTable.m_pControl = pControl;
+    rTable.m_pSlots = pSlots;
+    rTable.m_capacity = capacity;
+    rTable.m_size = size;
+    rTable.m_growthLeft = growthLeft;
+    rTable.m_hasher = hasher;
+    rTable.m_keyEquals = keyEquals;
+    rTable.m_extractKey = extractKey;
+    rTable.m_allocator = allocator;
+}
+
+/// Assignment operator.
+///
+/// @param[in] rSource  Source table from which to copy.
+///
+/// @return  Reference to this object.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >&
+    Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator=(
+        const FlatHashTable& rSource )
+{
+    if( this != &rSource )
+    {
+        Finalize();
+        CopyConstruct( rSource );
+    }
+
+    return *this;
+}
+
+/// Assignment operator.
+///
+/// @param[in] rSource  Source table from which to copy.
+///
+/// @return  Reference to this object.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+template< typename OtherAllocator >
+Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >&
+    Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::operator=(
+        const FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, OtherAllocator, InternalValue >& rSource )
+{
+    if( reinterpret_cast< const void* >( this ) != reinterpret_cast< const void* >( &rSource ) )
+    {
+        Finalize();
+        CopyConstruct( rSource );
+    }
+
+    return *this;
+}
+
+/// Compute the hash value for a key.
+///
+/// The result of the hash functor is mixed so that both the slot index (upper bits) and the control byte (lower seven
+/// bits) are well distributed, even for trivial hash functions such as the default integer and pointer hashes.
+///
+/// @param[in] rKey  Key to hash.
+///
+/// @return  Mixed hash value.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::HashKey( const Key& rKey ) const
+{
+    return MixHash( m_hasher( rKey ) );
+}
+
+/// Locate the slot holding the entry with the given key.
+///
+/// @param[in] rKey  Key to locate.
+/// @param[in] hash  Mixed hash value of the key.
+///
+/// @return  Index of the slot containing the entry if found, an invalid index if not found.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::FindSlot( const Key& rKey, size_t hash ) const
+{
+    HELIUM_ASSERT( m_capacity != 0 );
+
+    int8_t hashBits = static_cast< int8_t >( hash & 0x7f );
+    size_t mask = m_capacity - 1;
+    size_t offset = ( hash >> 7 ) & mask;
+    size_t probeStep = 0;
+
+    for( ; ; )
+    {
+        Group group( m_pControl + offset );
+        for( typename Group::BitMask match = group.Match( hashBits ); !match.IsEmpty(); match.ClearLowest() )
+        {
+            size_t slotIndex = ( offset + match.GetLowestIndex() ) & mask;
+            if( m_keyEquals( m_extractKey( m_pSlots[ slotIndex ] ), rKey ) )
+            {
+                return slotIndex;
+            }
+        }
+
+        // An empty slot terminates the probe sequence, as the key would have been inserted there.
+        if( !group.MatchEmpty().IsEmpty() )
+        {
+            return Invalid< size_t >();
+        }
+
+        probeStep += Group::WIDTH;
+        offset = ( offset + probeStep ) & mask;
+        HELIUM_ASSERT( probeStep <= m_capacity );
+    }
+}
+
+/// Locate the first empty or deleted slot in the probe sequence for the given hash.
+///
+/// @param[in] hash  Mixed hash value.
+///
+/// @return  Index of the first slot available for insertion.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::FindFirstNonFull( size_t hash ) const
+{
+    HELIUM_ASSERT( m_capacity != 0 );
+
+    size_t mask = m_capacity - 1;
+    size_t offset = ( hash >> 7 ) & mask;
+    size_t probeStep = 0;
+
+    for( ; ; )
+    {
+        typename Group::BitMask match = Group( m_pControl + offset ).MatchEmptyOrDeleted();
+        if( !match.IsEmpty() )
+        {
+            return ( offset + match.GetLowestIndex() ) & mask;
+        }
+
+        probeStep += Group::WIDTH;
+        offset = ( offset + probeStep ) & mask;
+        HELIUM_ASSERT( probeStep <= m_capacity );
+    }
+}
+
+/// Claim a slot for a new entry with the given hash, growing or rehashing the table first if necessary.
+///
+/// The control byte for the slot is updated, but the entry itself is left for the caller to construct.
+///
+/// @param[in] hash  Mixed hash value of the new entry.
+///
+/// @return  Index of the slot in which to construct the new entry.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::PrepareInsert( size_t hash )
+{
+    size_t slotIndex = Invalid< size_t >();
+    if( m_capacity != 0 )
+    {
+        slotIndex = FindFirstNonFull( hash );
+    }
+
+    // Reusing a deleted slot doesn't reduce the number of empty slots, so we only need to check for growth when the
+    // target slot is empty.
+    if( m_capacity == 0 || ( m_growthLeft == 0 && m_pControl[ slotIndex ] != FlatHashControls::Deleted ) )
+    {
+        size_t capacity = m_capacity;
+        if( capacity == 0 )
+        {
+            capacity = Group::WIDTH;
+        }
+        else if( m_size * 32 > GetGrowthCapacity( capacity ) * 25 )
+        {
+            // Mostly full of live entries, so double the capacity.  Otherwise, the table is cluttered with deleted
+            // slots and simply rehashing in place is enough to reclaim them.
+            capacity *= 2;
+        }
+
+        Resize( capacity );
+        slotIndex = FindFirstNonFull( hash );
+    }
+
+    HELIUM_ASSERT( m_pControl[ slotIndex ] < 0 );
+    if( m_pControl[ slotIndex ] == FlatHashControls::Empty )
+    {
+        HELIUM_ASSERT( m_growthLeft != 0 );
+        --m_growthLeft;
+    }
+
+    SetControl( slotIndex, static_cast< int8_t >( hash & 0x7f ) );
+
+    return slotIndex;
+}
+
+/// Destroy the entry in the specified slot and mark the slot as unoccupied.
+///
+/// @param[in] slotIndex  Index of the slot to erase.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::EraseSlot( size_t slotIndex )
+{
+    HELIUM_ASSERT( slotIndex < m_capacity );
+    HELIUM_ASSERT( m_pControl[ slotIndex ] >= 0 );
+
+    m_pSlots[ slotIndex ].~InternalValue();
+    --m_size;
+
+    // If no group-wide window containing this slot has ever been full, no probe sequence could have passed over this
+    // slot, so it can be marked as empty instead of deleted (keeping probe sequences short).
+    size_t mask = m_capacity - 1;
+    size_t previousIndex = ( slotIndex - Group::WIDTH ) & mask;
+    typename Group::BitMask emptyAfter = Group( m_pControl + slotIndex ).MatchEmpty();
+    typename Group::BitMask emptyBefore = Group( m_pControl + previousIndex ).MatchEmpty();
+
+    bool bWasNeverFull =
+        !emptyBefore.IsEmpty() && !emptyAfter.IsEmpty() &&
+        emptyAfter.GetTrailingZeros() + emptyBefore.GetLeadingZeros() < Group::WIDTH;
+    if( bWasNeverFull )
+    {
+        SetControl( slotIndex, FlatHashControls::Empty );
+        ++m_growthLeft;
+    }
+    else
+    {
+        SetControl( slotIndex, FlatHashControls::Deleted );
+    }
+}
+
+/// Set the control byte for a slot, updating the mirrored copy at the end of the control array as necessary.
+///
+/// @param[in] slotIndex  Slot index.
+/// @param[in] control    Control byte value.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::SetControl( size_t slotIndex, int8_t control )
+{
+    HELIUM_ASSERT( slotIndex < m_capacity );
+
+    m_pControl[ slotIndex ] = control;
+    if( slotIndex < Group::WIDTH )
+    {
+        m_pControl[ m_capacity + slotIndex ] = control;
+    }
+}
+
+/// Get the index of the first occupied slot at or after the given slot index.
+///
+/// @param[in] slotIndex  Index of the first slot to check.
+///
+/// @return  Index of the next occupied slot, or the table capacity if no more slots are occupied.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetNextFullSlot( size_t slotIndex ) const
+{
+    const int8_t* pControl = m_pControl;
+    size_t capacity = m_capacity;
+    while( slotIndex < capacity && pControl[ slotIndex ] < 0 )
+    {
+        ++slotIndex;
+    }
+
+    return slotIndex;
+}
+
+/// Reallocate the slot array and reinsert all entries.
+///
+/// @param[in] capacity  New slot capacity (must be a power of two no smaller than the group width).
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Resize( size_t capacity )
+{
+    HELIUM_ASSERT( capacity >= Group::WIDTH );
+    HELIUM_ASSERT( IsPowerOfTwo( capacity ) );
+    HELIUM_ASSERT( GetGrowthCapacity( capacity ) >= m_size );
+
+    int8_t* pOldControl = m_pControl;
+    InternalValue* pOldSlots = m_pSlots;
+    size_t oldCapacity = m_capacity;
+
+    AllocateSlots( capacity );
+
+    for( size_t oldSlotIndex = 0; oldSlotIndex < oldCapacity; ++oldSlotIndex )
+    {
+        if( pOldControl[ oldSlotIndex ] >= 0 )
+        {
+            InternalValue& rEntry = pOldSlots[ oldSlotIndex ];
+            size_t hash = HashKey( m_extractKey( rEntry ) );
+
+            size_t slotIndex = FindFirstNonFull( hash );
+            SetControl( slotIndex, static_cast< int8_t >( hash & 0x7f ) );
+
+            new( m_pSlots + slotIndex ) InternalValue( rEntry );
+            rEntry.~InternalValue();
+        }
+    }
+
+    m_growthLeft = GetGrowthCapacity( capacity ) - m_size;
+
+    if( pOldControl )
+    {
+        m_allocator.FreeAligned( pOldControl );
+    }
+}
+
+/// Allocate a new slot array with all slots marked as empty, replacing the current array pointers without freeing them.
+///
+/// @param[in] capacity  Slot capacity.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::AllocateSlots( size_t capacity )
+{
+    HELIUM_ASSERT( capacity >= Group::WIDTH );
+
+    // Control bytes and slots share a single allocation, with the slots following the control bytes (including the
+    // mirrored control bytes for the first group).
+    size_t alignment = Max< size_t >( std::alignment_of< InternalValue >::value, 16 );
+    size_t controlSize = Align( capacity + Group::WIDTH, alignment );
+
+    void* pBuffer = m_allocator.AllocateAligned( alignment, controlSize + sizeof( InternalValue ) * capacity );
+    HELIUM_ASSERT( pBuffer );
+
+    int8_t* pControl = static_cast< int8_t* >( pBuffer );
+    MemorySet( pControl, FlatHashControls::Empty, capacity + Group::WIDTH );
+
+    m_pControl = pControl;
+    m_pSlots = reinterpret_cast< InternalValue* >( static_cast< uint8_t* >( pBuffer ) + controlSize );
+    m_capacity = capacity;
+}
+
+/// Allocate and construct a copy of the specified object, assuming all data in this object is uninitialized.
+///
+/// @param[in] rSource  Object to copy.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+template< typename OtherAllocator >
+void Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::CopyConstruct(
+    const FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, OtherAllocator, InternalValue >& rSource )
+{
+    m_pControl = NULL;
+    m_pSlots = NULL;
+    m_capacity = 0;
+
+    m_size = rSource.m_size;
+    m_growthLeft = 0;
+
+    m_hasher = rSource.m_hasher;
+    m_keyEquals = rSource.m_keyEquals;
+    m_extractKey = rSource.m_extractKey;
+
+    size_t capacity = rSource.m_capacity;
+    if( capacity == 0 )
+    {
+        return;
+    }
+
+    // Since the capacity and hash function match, the source layout (including deleted slots) can be copied as-is.
+    AllocateSlots( capacity );
+    MemoryCopy( m_pControl, rSource.m_pControl, capacity + Group::WIDTH );
+    m_growthLeft = rSource.m_growthLeft;
+
+    const int8_t* pControl = m_pControl;
+    for( size_t slotIndex = 0; slotIndex < capacity; ++slotIndex )
+    {
+        if( pControl[ slotIndex ] >= 0 )
+        {
+            new( m_pSlots + slotIndex ) InternalValue( rSource.m_pSlots[ slotIndex ] );
+        }
+    }
+}
+
+/// Free all allocated resources, but don't clear out any variables unless necessary.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Finalize()
+{
+    size_t capacity = m_capacity;
+    if( capacity == 0 )
+    {
+        return;
+    }
+
+    const int8_t* pControl = m_pControl;
+    InternalValue* pSlots = m_pSlots;
+    for( size_t slotIndex = 0; slotIndex < capacity; ++slotIndex )
+    {
+        if( pControl[ slotIndex ] >= 0 )
+        {
+            pSlots[ slotIndex ].~InternalValue();
+        }
+    }
+
+    m_allocator.FreeAligned( m_pControl );
+}
+
+/// Get the number of entries that can be stored in a slot array of the given capacity before it needs to be grown.
+///
+/// Tables are kept at most 7/8 full so that every probe sequence is guaranteed to reach an empty slot.
+///
+/// @param[in] capacity  Slot capacity.
+///
+/// @return  Maximum number of entries.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetGrowthCapacity( size_t capacity )
+{
+    return capacity - capacity / 8;
+}
+
+/// Get the smallest slot capacity that can hold the given number of entries.
+///
+/// @param[in] elementCount  Number of entries.
+///
+/// @return  Slot capacity, or zero if no entries need to be stored.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::FlatHashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetMinimumCapacity( size_t elementCount )
+{
+    if( elementCount == 0 )
+    {
+        return 0;
+    }
+
+    size_t capacity = Group::WIDTH;
+    while( GetGrowthCapacity( capacity ) < elementCount )
+    {
+        capacity *= 2;
+    }
+
+    return capacity;
+}
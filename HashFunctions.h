@@ -3,8 +3,15 @@
 #include "Platform/Types.h"
 #include "Foundation/API.h"
 
+#if HELIUM_CC_CL && defined( HELIUM_CPU_X86 )
+# include <xmmintrin.h>
+#endif
+
 namespace Helium
 {
+    inline size_t MixHash( size_t hash );
+    inline void PrefetchHashData( const void* pAddress );
+
     /// Default integer hash function.
     template< typename T >
     class Hash
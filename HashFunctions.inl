@@ -1,3 +1,47 @@
+/// Scramble the bits of a hash value.
+///
+/// Containers that select buckets or lock stripes using the low bits of a hash (power-of-two table sizes) use this to
+/// distribute the results of trivial hash functions, such as the default integer and pointer hashes, across all bits.
+///
+/// @param[in] hash  Hash value to mix.
+///
+/// @return  Mixed hash value.
+size_t Helium::MixHash( size_t hash )
+{
+#if HELIUM_WORDSIZE == 64
+    uint64_t mixed = static_cast< uint64_t >( hash );
+    mixed ^= mixed >> 33;
+    mixed *= 0xff51afd7ed558ccdULL;
+    mixed ^= mixed >> 33;
+#else
+    uint32_t mixed = static_cast< uint32_t >( hash );
+    mixed ^= mixed >> 16;
+    mixed *= 0x85ebca6bU;
+    mixed ^= mixed >> 13;
+    mixed *= 0xc2b2ae35U;
+    mixed ^= mixed >> 16;
+#endif
+
+    return static_cast< size_t >( mixed );
+}
+
+/// Hint that the memory at the given address will be read soon.
+///
+/// Batch operations on hash containers use this to start fetching the buckets for upcoming keys while earlier keys are
+/// still being processed.  This has no effect on platforms without a prefetch instruction.
+///
+/// @param[in] pAddress  Address to prefetch.
+void Helium::PrefetchHashData( const void* pAddress )
+{
+#if HELIUM_CC_GCC || HELIUM_CC_CLANG
+    __builtin_prefetch( pAddress );
+#elif HELIUM_CC_CL && defined( HELIUM_CPU_X86 )
+    _mm_prefetch( static_cast< const char* >( pAddress ), _MM_HINT_T0 );
+#else
+    HELIUM_UNREF( pAddress );
+#endif
+}
+
 /// Default hash function.
 ///
 /// @param[in] rKey  Key for which to compute a hash value.
@@ -0,0 +1,50 @@
+#include "FoundationPch.h"
+#include "Foundation/HashTable.h"
+
+using namespace Helium;
+
+/// Prime bucket counts used when growing hash tables (each entry is roughly double the previous entry).
+static const uint32_t HASH_TABLE_PRIME_BUCKET_COUNTS[] =
+{
+    3, 7, 17, 37, 79, 163, 331, 673, 1361, 2729, 5471, 10949, 21911, 43853, 87719, 175447, 350899, 701819, 1403641,
+    2807303, 5614657, 11229331, 22458671, 44917381, 89834777, 179669557, 359339171, 718678369, 1437356741, 2874713497U,
+    4294967291U
+};
+
+/// Get the bucket count to use for a hash table that requires at least the given number of buckets.
+///
+/// Bucket counts are selected from a table of prime numbers that roughly double in size, giving a good distribution
+/// for hash functions that are weak in their low bits (such as the default integer and pointer hashes).
+///
+/// @param[in] minimumBucketCount  Minimum number of buckets needed.
+///
+/// @return  Smallest prime bucket count from the internal table that is at least the requested count, or the requested
+///          count itself if it exceeds the largest table entry.
+size_t Helium::GetHashTableBucketCount( size_t minimumBucketCount )
+{
+    size_t primeCount = sizeof( HASH_TABLE_PRIME_BUCKET_COUNTS ) / sizeof( HASH_TABLE_PRIME_BUCKET_COUNTS[ 0 ] );
+
+    // Binary search for the first prime that is not less than the requested count.
+    size_t lowIndex = 0;
+    size_t highIndex = primeCount;
+    while( lowIndex < highIndex )
+    {
+        size_t midIndex = ( lowIndex + highIndex ) / 2;
+        if( HASH_TABLE_PRIME_BUCKET_COUNTS[ midIndex ] < minimumBucketCount )
+        {
+            lowIndex = midIndex + 1;
+        }
+        else
+        {
+            highIndex = midIndex;
+        }
+    }
+
+    if( lowIndex < primeCount )
+    {
+        return HASH_TABLE_PRIME_BUCKET_COUNTS[ lowIndex ];
+    }
+
+    // Past the end of the prime table, so fall back to the next odd count.
+    return ( minimumBucketCount | 1 );
+}
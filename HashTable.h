@@ -1,10 +1,16 @@
 #pragma once
 
 #include "Foundation/DynamicArray.h"
+#include "Foundation/HashFunctions.h"
 #include "Foundation/Pair.h"
 
 namespace Helium
 {
+    /// @defgroup hashtablesupport Hash Table Support
+    //@{
+    HELIUM_FOUNDATION_API size_t GetHashTableBucketCount( size_t minimumBucketCount );
+    //@}
+
     template<
         typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
         typename InternalValue >
@@ -146,6 +152,8 @@ namespace Helium
     public:
         /// Default hash table bucket count (prime numbers are recommended).
         static const size_t DEFAULT_BUCKET_COUNT = 37;
+        /// Number of keys for which buckets are prefetched at a time by batch operations.
+        static const size_t BATCH_BLOCK_SIZE = 16;
 
         /// Type for hash table keys.
         typedef Key KeyType;
@@ -173,6 +181,14 @@ namespace Helium
         size_t GetSize() const;
         bool IsEmpty() const;
 
+        size_t GetBucketCount() const;
+        float32_t GetLoadFactor() const;
+        float32_t GetMaxLoadFactor() const;
+        void SetMaxLoadFactor( float32_t maxLoadFactor );
+
+        void Rehash( size_t bucketCount );
+        void Reserve( size_t elementCount );
+
         void Clear();
         void Trim();
 
@@ -194,6 +210,14 @@ namespace Helium
         void Swap( HashTable& rTable );
         //@}
 
+        /// @name Batch Operations
+        //@{
+        size_t FindBatch( const Key* pKeys, size_t keyCount, Iterator* pIterators );
+        size_t FindBatch( const Key* pKeys, size_t keyCount, ConstIterator* pIterators ) const;
+        size_t InsertBatch( const ValueType* pValues, size_t valueCount, bool* pInserted = NULL );
+        size_t RemoveBatch( const Key* pKeys, size_t keyCount, bool* pRemoved = NULL );
+        //@}
+
     protected:
         /// Hash table bucket.
         typedef DynamicArray< InternalValue, Allocator > Bucket;
@@ -205,6 +229,8 @@ namespace Helium
 
         /// Number of elements currently in the hash table.
         size_t m_size;
+        /// Maximum ratio of elements to buckets before the bucket array is automatically grown.
+        float32_t m_maxLoadFactor;
 
         /// Key hashing functor.
         HasherType m_hasher;
@@ -240,6 +266,8 @@ namespace Helium
         /// @name Private Utility Functions
         //@{
         void AllocateBuckets();
+        void GrowForInsert();
+        void PrefetchBuckets( const size_t* pBucketIndices, size_t count ) const;
 
         template< typename OtherAllocator > void CopyConstruct(
             const HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, OtherAllocator, InternalValue >& rSource );
@@ -391,6 +391,9 @@ Helium::HashTableIterator< Value, Key, HashFunction, ExtractKey, EqualKey, Alloc
 
 /// Constructor.
 ///
+/// The table starts out with a maximum load factor of one, so the bucket array will be grown automatically once the
+/// number of entries exceeds the number of buckets (see SetMaxLoadFactor()).
+///
 /// @param[in] bucketCount  Number of buckets to allocate in the table.  Prime numbers are recommended for more
 ///                         efficient distribution.  This will be clamped to a minimum of one.
 /// @param[in] rHasher      Key hashing functor.
@@ -408,6 +411,7 @@ Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, In
     const Allocator& rAllocator )
     : m_bucketCount( Max<size_t>( bucketCount, 1 ) )
     , m_size( 0 )
+    , m_maxLoadFactor( 1.0f )
     , m_hasher( rHasher )
     , m_keyEquals( rKeyEquals )
     , m_extractKey( rExtractKey )
@@ -418,6 +422,9 @@ Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, In
 
 /// Constructor.
 ///
+/// The table starts out with a maximum load factor of one, so the bucket array will be grown automatically once the
+/// number of entries exceeds the number of buckets (see SetMaxLoadFactor()).
+///
 /// @param[in] bucketCount  Number of buckets to allocate in the table.  Prime numbers are recommended for more
 ///                         efficient distribution.  This will be clamped to a minimum of one.
 /// @param[in] rHasher      Key hashing functor.
@@ -433,6 +440,7 @@ Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, In
     const Allocator& rAllocator )
     : m_bucketCount( Max< size_t >( bucketCount, 1 ) )
     , m_size( 0 )
+    , m_maxLoadFactor( 1.0f )
     , m_hasher( rHasher )
     , m_keyEquals( rKeyEquals )
     , m_allocator( rAllocator )
@@ -500,6 +508,136 @@ bool Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocato
     return ( m_size == 0 );
 }
 
+/// Get the number of buckets currently allocated for this table.
+///
+/// @return  Hash table bucket count.
+///
+/// @see GetLoadFactor(), Rehash()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetBucketCount() const
+{
+    return m_bucketCount;
+}
+
+/// Get the current average number of entries per bucket.
+///
+/// @return  Ratio of entries to buckets.
+///
+/// @see GetMaxLoadFactor(), GetBucketCount()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+float32_t Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetLoadFactor() const
+{
+    return static_cast< float32_t >( m_size ) / static_cast< float32_t >( m_bucketCount );
+}
+
+/// Get the load factor above which the bucket array is automatically grown when inserting new entries.
+///
+/// @return  Maximum load factor, or zero if automatic growth is disabled.
+///
+/// @see SetMaxLoadFactor(), GetLoadFactor()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+float32_t Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GetMaxLoadFactor() const
+{
+    return m_maxLoadFactor;
+}
+
+/// Set the load factor above which the bucket array is automatically grown when inserting new entries.
+///
+/// Lowering the maximum load factor below the current load factor does not immediately rehash the table; the bucket
+/// array will be resized by the next insertion of a new entry (or by an explicit call to Rehash() or Reserve()).
+///
+/// @param[in] maxLoadFactor  Maximum ratio of entries to buckets, or zero to disable automatic growth (in which case
+///                           the table keeps its bucket count until Rehash() or Reserve() is called).
+///
+/// @see GetMaxLoadFactor(), GetLoadFactor()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::SetMaxLoadFactor( float32_t maxLoadFactor )
+{
+    HELIUM_ASSERT( maxLoadFactor >= 0.0f );
+    m_maxLoadFactor = Max( maxLoadFactor, 0.0f );
+}
+
+/// Redistribute the entries in this table across a new set of buckets.
+///
+/// The requested bucket count will be rounded up to the next prime number, and will also be raised as necessary so
+/// that the current contents of the table fit within the maximum load factor.  All iterators into this table are
+/// invalidated if the bucket count changes.
+///
+/// @param[in] bucketCount  Desired number of buckets.
+///
+/// @see Reserve(), GetBucketCount()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Rehash( size_t bucketCount )
+{
+    float32_t maxLoadFactor = m_maxLoadFactor;
+    if( maxLoadFactor > 0.0f )
+    {
+        size_t minimumBucketCount = static_cast< size_t >( Ceil( static_cast< float32_t >( m_size ) / maxLoadFactor ) );
+        bucketCount = Max( bucketCount, minimumBucketCount );
+    }
+
+    bucketCount = GetHashTableBucketCount( bucketCount );
+    if( bucketCount == m_bucketCount )
+    {
+        return;
+    }
+
+    Bucket* pOldBuckets = m_pBuckets;
+    size_t oldBucketCount = m_bucketCount;
+
+    m_bucketCount = bucketCount;
+    AllocateBuckets();
+
+    Bucket* pNewBuckets = m_pBuckets;
+    for( size_t oldBucketIndex = 0; oldBucketIndex < oldBucketCount; ++oldBucketIndex )
+    {
+        Bucket& rOldEntries = pOldBuckets[ oldBucketIndex ];
+        size_t entryCount = rOldEntries.GetSize();
+        for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+        {
+            // The old buckets are destroyed once all entries are redistributed, so entries can be moved out of them.
+            InternalValue& rEntry = rOldEntries[ entryIndex ];
+            size_t bucketIndex = m_hasher( m_extractKey( rEntry ) ) % bucketCount;
+            pNewBuckets[ bucketIndex ].Add( std::move( rEntry ) );
+        }
+    }
+
+    ArrayInPlaceDestruct( pOldBuckets, oldBucketCount );
+    m_allocator.Free( pOldBuckets );
+}
+
+/// Make sure this table has enough buckets to hold the specified number of entries without exceeding the maximum load
+/// factor.
+///
+/// This will never reduce the current bucket count.  All iterators into this table are invalidated if the bucket count
+/// changes.
+///
+/// @param[in] elementCount  Number of entries for which to reserve space.
+///
+/// @see Rehash(), GetMaxLoadFactor()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::Reserve( size_t elementCount )
+{
+    float32_t maxLoadFactor = ( m_maxLoadFactor > 0.0f ? m_maxLoadFactor : 1.0f );
+    size_t bucketCount = static_cast< size_t >( Ceil( static_cast< float32_t >( elementCount ) / maxLoadFactor ) );
+    if( bucketCount > m_bucketCount )
+    {
+        Rehash( bucketCount );
+    }
+}
+
 /// Clear out all entries in this table.
 ///
 /// @see Trim()
@@ -701,6 +839,9 @@ Helium::Pair< typename Helium::HashTable< Value, Key, HashFunction, ExtractKey,
 /// Locate the entry in this table with a key that matches that of a given value, inserting a copy of the given value if
 /// one does not already exist.
 ///
+/// Inserting a new entry may grow the bucket array if the maximum load factor would otherwise be exceeded, in which case
+/// any existing iterators into this table are invalidated.
+///
 /// @param[out] rIterator  Iterator set to reference the entry in this table with the given key.
 /// @param[in]  rValue     Value containing the key to find as well as providing the value to insert if an entry does
 ///                        not already exist with the given key.
@@ -730,11 +871,21 @@ bool Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocato
         }
     }
 
-    // Entry not found, so add it to the table.
-    rEntries.Add( rValue );
+    // Entry not found, so add it to the table, growing the bucket array first if the new entry would push us past the
+    // maximum load factor.
+    if( m_maxLoadFactor > 0.0f &&
+        static_cast< float32_t >( m_size + 1 ) > static_cast< float32_t >( m_bucketCount ) * m_maxLoadFactor )
+    {
+        GrowForInsert();
+        bucketIndex = m_hasher( rKey ) % m_bucketCount;
+    }
+
+    Bucket& rTargetEntries = m_pBuckets[ bucketIndex ];
+    size_t elementIndex = rTargetEntries.GetSize();
+    rTargetEntries.Add( rValue );
     ++m_size;
 
-    rIterator = ConstIterator( this, bucketIndex, entryCount );
+    rIterator = ConstIterator( this, bucketIndex, elementIndex );
 
     return true;
 }
@@ -816,13 +967,15 @@ void Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocato
         Bucket& rEntries = m_pBuckets[ bucketIndex ];
         size_t elementCount = rEntries.GetSize();
         rEntries.Remove( elementIndex, elementCount - elementIndex );
+        m_size -= elementCount - elementIndex;
 
         elementIndex = 0;
     }
 
     if( endBucketIndex < m_bucketCount )
     {
-        this->rEntries.Remove( elementIndex, endElementIndex - elementIndex );
+        m_pBuckets[ endBucketIndex ].Remove( elementIndex, endElementIndex - elementIndex );
+        m_size -= endElementIndex - elementIndex;
     }
 }
 
@@ -838,6 +991,7 @@ void Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocato
     Bucket* pBuckets = m_pBuckets;
     size_t bucketCount = m_bucketCount;
     size_t size = m_size;
+    float32_t maxLoadFactor = m_maxLoadFactor;
     HasherType hasher = m_hasher;
     EqualKey keyEquals = m_keyEquals;
     ExtractKey extractKey = m_extractKey;
@@ -846,6 +1000,7 @@ void Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocato
     m_pBuckets = rTable.m_pBuckets;
     m_bucketCount = rTable.m_bucketCount;
     m_size = rTable.m_size;
+    m_maxLoadFactor = rTable.m_maxLoadFactor;
     m_hasher = rTable.m_hasher;
     m_keyEquals = rTable.m_keyEquals;
     m_extractKey = rTable.m_extractKey;
@@ -854,12 +1009,319 @@ void Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocato
     rTable.m_pBuckets = pBuckets;
     rTable.m_bucketCount = bucketCount;
     rTable.m_size = size;
+    rTable.m_maxLoadFactor = maxLoadFactor;
     rTable.m_hasher = hasher;
     rTable.m_keyEquals = keyEquals;
     rTable.m_extractKey = extractKey;
     rTable.m_allocator = allocator;
 }
 
+/// Search for entries in this table with each of the given keys.
+///
+/// Buckets are prefetched for blocks of keys at a time before they are searched, hiding much of the memory latency of
+/// looking up large numbers of keys in a table that does not fit in cache.
+///
+/// @param[in]  pKeys       Array of keys to locate.
+/// @param[in]  keyCount    Number of keys in the key array.
+/// @param[out] pIterators  Array of iterators (one per key) that will be set to reference the entry in this table with
+///                         the corresponding key if found, or the table end if not found.
+///
+/// @return  Number of keys found.
+///
+/// @see Find()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::FindBatch(
+    const Key* pKeys,
+    size_t keyCount,
+    Iterator* pIterators )
+{
+    HELIUM_ASSERT( pKeys || keyCount == 0 );
+    HELIUM_ASSERT( pIterators || keyCount == 0 );
+
+    if( m_size == 0 )
+    {
+        for( size_t keyIndex = 0; keyIndex < keyCount; ++keyIndex )
+        {
+            pIterators[ keyIndex ] = End();
+        }
+
+        return 0;
+    }
+
+    size_t foundCount = 0;
+
+    size_t bucketIndices[ BATCH_BLOCK_SIZE ];
+    for( size_t blockStart = 0; blockStart < keyCount; blockStart += BATCH_BLOCK_SIZE )
+    {
+        size_t blockSize = keyCount - blockStart;
+        if( blockSize > BATCH_BLOCK_SIZE )
+        {
+            blockSize = BATCH_BLOCK_SIZE;
+        }
+
+        for( size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex )
+        {
+            bucketIndices[ blockIndex ] = m_hasher( pKeys[ blockStart + blockIndex ] ) % m_bucketCount;
+        }
+
+        PrefetchBuckets( bucketIndices, blockSize );
+
+        for( size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex )
+        {
+            const Key& rKey = pKeys[ blockStart + blockIndex ];
+            Iterator& rIterator = pIterators[ blockStart + blockIndex ];
+            rIterator = End();
+
+            size_t bucketIndex = bucketIndices[ blockIndex ];
+            Bucket& rEntries = m_pBuckets[ bucketIndex ];
+            size_t entryCount = rEntries.GetSize();
+            for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+            {
+                if( m_keyEquals( m_extractKey( rEntries[ entryIndex ] ), rKey ) )
+                {
+                    rIterator = Iterator( this, bucketIndex, entryIndex );
+                    ++foundCount;
+
+                    break;
+                }
+            }
+        }
+    }
+
+    return foundCount;
+}
+
+/// Search for entries in this table with each of the given keys.
+///
+/// Buckets are prefetched for blocks of keys at a time before they are searched, hiding much of the memory latency of
+/// looking up large numbers of keys in a table that does not fit in cache.
+///
+/// @param[in]  pKeys       Array of keys to locate.
+/// @param[in]  keyCount    Number of keys in the key array.
+/// @param[out] pIterators  Array of constant iterators (one per key) that will be set to reference the entry in this
+///                         table with the corresponding key if found, or the table end if not found.
+///
+/// @return  Number of keys found.
+///
+/// @see Find()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::FindBatch(
+    const Key* pKeys,
+    size_t keyCount,
+    ConstIterator* pIterators ) const
+{
+    HELIUM_ASSERT( pKeys || keyCount == 0 );
+    HELIUM_ASSERT( pIterators || keyCount == 0 );
+
+    if( m_size == 0 )
+    {
+        for( size_t keyIndex = 0; keyIndex < keyCount; ++keyIndex )
+        {
+            pIterators[ keyIndex ] = End();
+        }
+
+        return 0;
+    }
+
+    size_t foundCount = 0;
+
+    size_t bucketIndices[ BATCH_BLOCK_SIZE ];
+    for( size_t blockStart = 0; blockStart < keyCount; blockStart += BATCH_BLOCK_SIZE )
+    {
+        size_t blockSize = keyCount - blockStart;
+        if( blockSize > BATCH_BLOCK_SIZE )
+        {
+            blockSize = BATCH_BLOCK_SIZE;
+        }
+
+        for( size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex )
+        {
+            bucketIndices[ blockIndex ] = m_hasher( pKeys[ blockStart + blockIndex ] ) % m_bucketCount;
+        }
+
+        PrefetchBuckets( bucketIndices, blockSize );
+
+        for( size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex )
+        {
+            const Key& rKey = pKeys[ blockStart + blockIndex ];
+            ConstIterator& rIterator = pIterators[ blockStart + blockIndex ];
+            rIterator = End();
+
+            size_t bucketIndex = bucketIndices[ blockIndex ];
+            const Bucket& rEntries = m_pBuckets[ bucketIndex ];
+            size_t entryCount = rEntries.GetSize();
+            for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+            {
+                if( m_keyEquals( m_extractKey( rEntries[ entryIndex ] ), rKey ) )
+                {
+                    rIterator = ConstIterator( this, bucketIndex, entryIndex );
+                    ++foundCount;
+
+                    break;
+                }
+            }
+        }
+    }
+
+    return foundCount;
+}
+
+/// Insert copies of each of the given values for which an entry with the same key does not already exist in this table.
+///
+/// The bucket array is grown up front to hold all of the given values (if automatic growth is enabled), after which
+/// buckets are prefetched for blocks of values at a time before they are searched and updated.  All existing iterators
+/// into this table are invalidated if the bucket array is grown.
+///
+/// @param[in]  pValues     Array of values to insert.
+/// @param[in]  valueCount  Number of values in the value array.
+/// @param[out] pInserted   If not null, array of flags (one per value) that will be set to true if the corresponding
+///                         value was inserted, or false if an entry with the same key already existed.
+///
+/// @return  Number of values inserted.
+///
+/// @see Insert()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::InsertBatch(
+    const Value* pValues,
+    size_t valueCount,
+    bool* pInserted )
+{
+    HELIUM_ASSERT( pValues || valueCount == 0 );
+
+    if( m_maxLoadFactor > 0.0f )
+    {
+        Reserve( m_size + valueCount );
+    }
+
+    size_t insertedCount = 0;
+
+    size_t bucketIndices[ BATCH_BLOCK_SIZE ];
+    for( size_t blockStart = 0; blockStart < valueCount; blockStart += BATCH_BLOCK_SIZE )
+    {
+        size_t blockSize = valueCount - blockStart;
+        if( blockSize > BATCH_BLOCK_SIZE )
+        {
+            blockSize = BATCH_BLOCK_SIZE;
+        }
+
+        for( size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex )
+        {
+            bucketIndices[ blockIndex ] = m_hasher( m_extractKey( pValues[ blockStart + blockIndex ] ) ) % m_bucketCount;
+        }
+
+        PrefetchBuckets( bucketIndices, blockSize );
+
+        for( size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex )
+        {
+            const Value& rValue = pValues[ blockStart + blockIndex ];
+            const Key& rKey = m_extractKey( rValue );
+
+            Bucket& rEntries = m_pBuckets[ bucketIndices[ blockIndex ] ];
+            size_t entryCount = rEntries.GetSize();
+            size_t entryIndex;
+            for( entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+            {
+                if( m_keyEquals( m_extractKey( rEntries[ entryIndex ] ), rKey ) )
+                {
+                    break;
+                }
+            }
+
+            bool bInserted = ( entryIndex >= entryCount );
+            if( bInserted )
+            {
+                rEntries.Add( rValue );
+                ++m_size;
+                ++insertedCount;
+            }
+
+            if( pInserted )
+            {
+                pInserted[ blockStart + blockIndex ] = bInserted;
+            }
+        }
+    }
+
+    return insertedCount;
+}
+
+/// Remove any entries with the given keys from this table.
+///
+/// Buckets are prefetched for blocks of keys at a time before they are searched.
+///
+/// @param[in]  pKeys     Array of keys to remove.
+/// @param[in]  keyCount  Number of keys in the key array.
+/// @param[out] pRemoved  If not null, array of flags (one per key) that will be set to true if an entry with the
+///                       corresponding key was found and removed, or false if not.
+///
+/// @return  Number of entries removed.
+///
+/// @see Remove()
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+size_t Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::RemoveBatch(
+    const Key* pKeys,
+    size_t keyCount,
+    bool* pRemoved )
+{
+    HELIUM_ASSERT( pKeys || keyCount == 0 );
+
+    size_t removedCount = 0;
+
+    size_t bucketIndices[ BATCH_BLOCK_SIZE ];
+    for( size_t blockStart = 0; blockStart < keyCount; blockStart += BATCH_BLOCK_SIZE )
+    {
+        size_t blockSize = keyCount - blockStart;
+        if( blockSize > BATCH_BLOCK_SIZE )
+        {
+            blockSize = BATCH_BLOCK_SIZE;
+        }
+
+        for( size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex )
+        {
+            bucketIndices[ blockIndex ] = m_hasher( pKeys[ blockStart + blockIndex ] ) % m_bucketCount;
+        }
+
+        PrefetchBuckets( bucketIndices, blockSize );
+
+        for( size_t blockIndex = 0; blockIndex < blockSize; ++blockIndex )
+        {
+            const Key& rKey = pKeys[ blockStart + blockIndex ];
+
+            bool bRemoved = false;
+
+            Bucket& rEntries = m_pBuckets[ bucketIndices[ blockIndex ] ];
+            size_t entryCount = rEntries.GetSize();
+            for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+            {
+                if( m_keyEquals( m_extractKey( rEntries[ entryIndex ] ), rKey ) )
+                {
+                    rEntries.RemoveSwap( entryIndex );
+                    --m_size;
+                    ++removedCount;
+                    bRemoved = true;
+
+                    break;
+                }
+            }
+
+            if( pRemoved )
+            {
+                pRemoved[ blockStart + blockIndex ] = bRemoved;
+            }
+        }
+    }
+
+    return removedCount;
+}
+
 /// Assignment operator.
 ///
 /// @param[in] rSource  Source table from which to copy.
@@ -918,6 +1380,49 @@ void Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocato
     HELIUM_ASSERT( m_pBuckets == pBuffer );
 }
 
+/// Grow the bucket array ahead of inserting a new entry that would exceed the maximum load factor.
+///
+/// The bucket count is at least doubled so that the cost of rehashing remains amortized constant per insertion.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::GrowForInsert()
+{
+    HELIUM_ASSERT( m_maxLoadFactor > 0.0f );
+
+    size_t requiredBucketCount = static_cast< size_t >(
+        Ceil( static_cast< float32_t >( m_size + 1 ) / m_maxLoadFactor ) );
+    Rehash( Max( requiredBucketCount, m_bucketCount * 2 + 1 ) );
+}
+
+/// Prefetch the buckets with the given indices, followed by the entries stored in each bucket.
+///
+/// @param[in] pBucketIndices  Array of bucket indices.
+/// @param[in] count           Number of bucket indices in the array.
+template<
+    typename Value, typename Key, typename HashFunction, typename ExtractKey, typename EqualKey, typename Allocator,
+    typename InternalValue >
+void Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocator, InternalValue >::PrefetchBuckets(
+    const size_t* pBucketIndices,
+    size_t count ) const
+{
+    for( size_t index = 0; index < count; ++index )
+    {
+        PrefetchHashData( &m_pBuckets[ pBucketIndices[ index ] ] );
+    }
+
+    // By the time all bucket prefetches have been issued, the first buckets should be available to begin fetching their
+    // entry storage.
+    for( size_t index = 0; index < count; ++index )
+    {
+        const InternalValue* pEntries = m_pBuckets[ pBucketIndices[ index ] ].GetData();
+        if( pEntries )
+        {
+            PrefetchHashData( pEntries );
+        }
+    }
+}
+
 /// Allocate and construct a copy of the specified object, assuming all data in this object is uninitialized.
 ///
 /// @param[in] rSource  Object to copy.
@@ -932,6 +1437,7 @@ void Helium::HashTable< Value, Key, HashFunction, ExtractKey, EqualKey, Allocato
     m_bucketCount = bucketCount;
 
     m_size = rSource.m_size;
+    m_maxLoadFactor = rSource.m_maxLoadFactor;
 
     m_hasher = rSource.m_hasher;
     m_keyEquals = rSource.m_keyEquals;
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "Foundation/DynamicArray.h"
+
+namespace Helium
+{
+	/// Resizable array with storage for a fixed number of elements embedded in the array object itself (not
+	/// thread-safe).
+	///
+	/// Up to N elements are stored inline without allocating any memory.  Memory is only allocated from the Allocator
+	/// once the array grows beyond N elements.  This provides the same interface as DynamicArray, so it can be used in
+	/// its place for arrays that usually hold only a handful of elements.
+	///
+	/// Note that, unlike DynamicArray, moving or swapping an array whose elements are stored inline moves each element
+	/// individually, so pointers to the elements of such an array do not remain valid.
+	template< typename T, size_t N, typename Allocator = DefaultAllocator >
+	class InlineDynamicArray
+	{
+	public:
+		/// Type for array element values.
+		typedef T ValueType;
+
+		/// Type for pointers to array elements.
+		typedef T* PointerType;
+		/// Type for references to array elements.
+		typedef T& ReferenceType;
+		/// Type for constant pointers to array elements.
+		typedef const T* ConstPointerType;
+		/// Type for constant references to array elements.
+		typedef const T& ConstReferenceType;
+
+		/// Iterator type.
+		typedef ArrayIterator< T > Iterator;
+		/// Constant iterator type.
+		typedef ConstArrayIterator< T > ConstIterator;
+
+		/// Number of elements stored inline.
+		static const size_t INLINE_CAPACITY = N;
+
+		/// @name Construction/Destruction
+		//@{
+		InlineDynamicArray();
+		InlineDynamicArray( const T* pSource, size_t size );
+		InlineDynamicArray( const InlineDynamicArray& rSource );
+		template< size_t OtherN, typename OtherAllocator > InlineDynamicArray(
+			const InlineDynamicArray< T, OtherN, OtherAllocator >& rSource );
+		InlineDynamicArray( InlineDynamicArray&& rSource );
+		~InlineDynamicArray();
+		//@}
+
+		/// @name Array Operations
+		//@{
+		size_t GetSize() const;
+		bool IsEmpty() const;
+		void Resize( size_t size );
+
+		size_t GetCapacity() const;
+		void Reserve( size_t capacity );
+		void Trim();
+
+		bool IsInline() const;
+
+		T* GetData();
+		const T* GetData() const;
+
+		void Clear();
+
+		Iterator Begin();
+		ConstIterator Begin() const;
+		Iterator End();
+		ConstIterator End() const;
+
+		T& GetElement( size_t index );
+		const T& GetElement( size_t index ) const;
+
+		void Set( const T* pSource, size_t size );
+
+		void Add( const T& rValue, size_t count = 1 );
+		void Add( T&& rValue );
+		void AddArray( const T* pValues, size_t count );
+		void Insert( size_t index, const T& rValue, size_t count = 1 );
+		void Insert( size_t index, T&& rValue );
+		void InsertArray( size_t index, const T* pValues, size_t count );
+		void Remove( size_t index, size_t count = 1 );
+		void RemoveSwap( size_t index, size_t count = 1 );
+		void RemoveAll();
+
+		T& GetFirst();
+		const T& GetFirst() const;
+		T& GetLast();
+		const T& GetLast() const;
+		size_t Push( const T& rValue );
+		size_t Push( T&& rValue );
+		T Pop();
+
+		void Swap( InlineDynamicArray& rArray );
+
+		uint32_t GetIndex( const ConstIterator& itr ) const;
+		uint32_t GetIndexOfPointer( const T* pPtr ) const;
+		//@}
+
+		/// @name In-place Object Creation
+		//@{
+		T* New();
+
+		template< typename U >
+		T* New( const U& u );
+
+		template< typename U, typename V >
+		T* New( const U& u, const V& v );
+
+		template< typename U, typename V, typename W >
+		T* New( const U& u, const V& v, const W& w );
+
+		template< typename U, typename V, typename W, typename X >
+		T* New( const U& u, const V& v, const W& w, const X& x );
+
+		template< typename... Args > T* Emplace( Args&&... args );
+		template< typename... Args > T* EmplaceAt( size_t index, Args&&... args );
+		//@}
+
+		/// @name Overloaded Operators
+		//@{
+		InlineDynamicArray& operator=( const InlineDynamicArray& rSource );
+		template< size_t OtherN, typename OtherAllocator > InlineDynamicArray& operator=(
+			const InlineDynamicArray< T, OtherN, OtherAllocator >& rSource );
+		InlineDynamicArray& operator=( InlineDynamicArray&& rSource );
+
+		T& operator[]( ptrdiff_t index );
+		const T& operator[]( ptrdiff_t index ) const;
+
+		bool operator==( const InlineDynamicArray& rOther ) const;
+		template< size_t OtherN, typename OtherAllocator > bool operator==(
+			const InlineDynamicArray< T, OtherN, OtherAllocator >& rOther ) const;
+		bool operator!=( const InlineDynamicArray& rOther ) const;
+		template< size_t OtherN, typename OtherAllocator > bool operator!=(
+			const InlineDynamicArray< T, OtherN, OtherAllocator >& rOther ) const;
+		//@}
+
+	private:
+		/// Array buffer (either the inline buffer or allocated memory).
+		T* m_pBuffer;
+		/// Used buffer size.
+		size_t m_size;
+		/// Buffer capacity.
+		size_t m_capacity;
+		/// Inline element storage.
+		typename std::aligned_storage< sizeof( T ) * N, std::alignment_of< T >::value >::type m_inlineBuffer;
+
+		/// @name Private Utility Functions
+		//@{
+		T* GetInlineBuffer();
+		bool IsElement( const T* pValue ) const;
+
+		size_t GetGrowCapacity( size_t desiredCount ) const;
+		void Grow( size_t capacity );
+		void Relocate( size_t capacity );
+		T* OpenGap( size_t index, size_t count );
+
+		void MoveConstruct( InlineDynamicArray& rSource );
+		void Finalize();
+
+		template< size_t OtherN, typename OtherAllocator > InlineDynamicArray& Assign(
+			const InlineDynamicArray< T, OtherN, OtherAllocator >& rSource );
+
+		template< size_t OtherN, typename OtherAllocator > bool Equals(
+			const InlineDynamicArray< T, OtherN, OtherAllocator >& rOther ) const;
+
+		T* Allocate( size_t count );
+		T* Allocate( size_t count, const std::true_type& rNeedsAlignment );
+		T* Allocate( size_t count, const std::false_type& rNeedsAlignment );
+
+		void Free( T* pMemory );
+		void Free( T* pMemory, const std::true_type& rNeedsAlignment );
+		void Free( T* pMemory, const std::false_type& rNeedsAlignment );
+
+		static void MoveConstruct( T* pDest, T* pSource, size_t count );
+		static void MoveAssign( T* pDest, T* pSource, size_t count );
+		//@}
+	};
+}
+
+#include "Foundation/InlineDynamicArray.inl"
@@ -0,0 +1,1138 @@
+/// Constructor.
+///
+/// This creates an empty array using the inline buffer.  No memory is allocated at this time.
+template< typename T, size_t N, typename Allocator >
+Helium::InlineDynamicArray< T, N, Allocator >::InlineDynamicArray()
+	: m_pBuffer( reinterpret_cast< T* >( &m_inlineBuffer ) )
+	, m_size( 0 )
+	, m_capacity( N )
+{
+}
+
+/// Constructor.
+///
+/// This creates a copy of the given array.
+///
+/// @param[in] pSource  Array from which to copy.
+/// @param[in] size     Number of elements in the given array.
+template< typename T, size_t N, typename Allocator >
+Helium::InlineDynamicArray< T, N, Allocator >::InlineDynamicArray( const T* pSource, size_t size )
+	: m_pBuffer( reinterpret_cast< T* >( &m_inlineBuffer ) )
+	, m_size( 0 )
+	, m_capacity( N )
+{
+	HELIUM_ASSERT( pSource || size == 0 );
+	AddArray( pSource, size );
+}
+
+/// Copy constructor.
+///
+/// @param[in] rSource  Array from which to copy.
+template< typename T, size_t N, typename Allocator >
+Helium::InlineDynamicArray< T, N, Allocator >::InlineDynamicArray( const InlineDynamicArray& rSource )
+	: m_pBuffer( reinterpret_cast< T* >( &m_inlineBuffer ) )
+	, m_size( 0 )
+	, m_capacity( N )
+{
+	AddArray( rSource.GetData(), rSource.GetSize() );
+}
+
+/// Copy constructor.
+///
+/// @param[in] rSource  Array from which to copy.
+template< typename T, size_t N, typename Allocator >
+template< size_t OtherN, typename OtherAllocator >
+Helium::InlineDynamicArray< T, N, Allocator >::InlineDynamicArray( const InlineDynamicArray< T, OtherN, OtherAllocator >& rSource )
+	: m_pBuffer( reinterpret_cast< T* >( &m_inlineBuffer ) )
+	, m_size( 0 )
+	, m_capacity( N )
+{
+	AddArray( rSource.GetData(), rSource.GetSize() );
+}
+
+/// Move constructor.
+///
+/// If the given array has spilled into allocated memory, this takes ownership of that memory.  Otherwise, its elements
+/// are moved individually into the inline buffer of this array.  The given array is left empty.
+///
+/// @param[in] rSource  Array from which to move.
+template< typename T, size_t N, typename Allocator >
+Helium::InlineDynamicArray< T, N, Allocator >::InlineDynamicArray( InlineDynamicArray&& rSource )
+	: m_pBuffer( reinterpret_cast< T* >( &m_inlineBuffer ) )
+	, m_size( 0 )
+	, m_capacity( N )
+{
+	MoveConstruct( rSource );
+}
+
+/// Destructor.
+template< typename T, size_t N, typename Allocator >
+Helium::InlineDynamicArray< T, N, Allocator >::~InlineDynamicArray()
+{
+	Finalize();
+}
+
+/// Get the number of elements in this array.
+///
+/// @return  Number of elements in this array.
+///
+/// @see GetCapacity(), Resize(), IsEmpty()
+template< typename T, size_t N, typename Allocator >
+size_t Helium::InlineDynamicArray< T, N, Allocator >::GetSize() const
+{
+	return m_size;
+}
+
+/// Get whether this array is currently empty.
+///
+/// @return  True if this array is empty, false if not.
+///
+/// @see GetSize()
+template< typename T, size_t N, typename Allocator >
+bool Helium::InlineDynamicArray< T, N, Allocator >::IsEmpty() const
+{
+	return( m_size == 0 );
+}
+
+/// Resize this array, retaining any existing data that fits within the new size.
+///
+/// If the new size is smaller than the current size, no memory will be freed for the array buffer itself, but the
+/// destructor of elements that no longer fit into the array will be called as appropriate.
+///
+/// @param[in] size  New array size.
+///
+/// @see GetSize()
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Resize( size_t size )
+{
+	if( size != m_size )
+	{
+		if( size < m_size )
+		{
+			ArrayInPlaceDestruct( m_pBuffer + size, m_size - size );
+		}
+		else
+		{
+			Grow( size );
+			ArrayInPlaceConstruct< T >( m_pBuffer + m_size, size - m_size );
+		}
+
+		m_size = size;
+	}
+}
+
+/// Get the maximum number of elements which this array can contain without requiring reallocation of memory.
+///
+/// This is never less than the inline capacity N.
+///
+/// @return  Current array capacity.
+///
+/// @see GetSize(), Reserve()
+template< typename T, size_t N, typename Allocator >
+size_t Helium::InlineDynamicArray< T, N, Allocator >::GetCapacity() const
+{
+	return m_capacity;
+}
+
+/// Explicitly increase the capacity of this array to support at least the specified number of elements.
+///
+/// If the requested capacity is less than the current capacity, no memory will be reallocated.
+///
+/// @param[in] capacity  Desired capacity.
+///
+/// @see GetCapacity()
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Reserve( size_t capacity )
+{
+	if( capacity > m_capacity )
+	{
+		Relocate( capacity );
+	}
+}
+
+/// Resize the allocated array memory to match the size actually in use.
+///
+/// If the elements fit within the inline buffer, they are moved back into it and the allocated memory is freed.
+///
+/// @see GetCapacity()
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Trim()
+{
+	if( m_capacity != m_size && !IsInline() )
+	{
+		Relocate( m_size );
+	}
+}
+
+/// Get whether the elements of this array are currently stored in the inline buffer.
+///
+/// @return  True if the inline buffer is in use, false if the array has spilled into allocated memory.
+template< typename T, size_t N, typename Allocator >
+bool Helium::InlineDynamicArray< T, N, Allocator >::IsInline() const
+{
+	return( m_pBuffer == reinterpret_cast< const T* >( &m_inlineBuffer ) );
+}
+
+/// Get a pointer to the base of the array buffer.
+///
+/// @return  Array buffer.
+template< typename T, size_t N, typename Allocator >
+T* Helium::InlineDynamicArray< T, N, Allocator >::GetData()
+{
+	return m_pBuffer;
+}
+
+/// Get a pointer to the base of the array buffer.
+///
+/// @return  Array buffer.
+template< typename T, size_t N, typename Allocator >
+const T* Helium::InlineDynamicArray< T, N, Allocator >::GetData() const
+{
+	return m_pBuffer;
+}
+
+/// Resize the array to zero and free all allocated memory, reverting to the inline buffer.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Clear()
+{
+	Finalize();
+
+	m_pBuffer = GetInlineBuffer();
+	m_size = 0;
+	m_capacity = N;
+}
+
+/// Retrieve an iterator referencing the beginning of this array.
+///
+/// @return  Iterator at the beginning of this array.
+///
+/// @see End()
+template< typename T, size_t N, typename Allocator >
+typename Helium::InlineDynamicArray< T, N, Allocator >::Iterator Helium::InlineDynamicArray< T, N, Allocator >::Begin()
+{
+	return Iterator( m_pBuffer );
+}
+
+/// Retrieve an iterator referencing the end of this array.
+///
+/// @return  Iterator at the end of this array.
+///
+/// @see Begin()
+template< typename T, size_t N, typename Allocator >
+typename Helium::InlineDynamicArray< T, N, Allocator >::Iterator Helium::InlineDynamicArray< T, N, Allocator >::End()
+{
+	return Iterator( m_pBuffer + m_size );
+}
+
+/// Retrieve a constant iterator referencing the beginning of this array.
+///
+/// @return  Constant iterator at the beginning of this array.
+///
+/// @see End()
+template< typename T, size_t N, typename Allocator >
+typename Helium::InlineDynamicArray< T, N, Allocator >::ConstIterator Helium::InlineDynamicArray< T, N, Allocator >::Begin() const
+{
+	return ConstIterator( m_pBuffer );
+}
+
+/// Retrieve a constant iterator referencing the end of this array.
+///
+/// @return  Constant iterator at the end of this array.
+///
+/// @see Begin()
+template< typename T, size_t N, typename Allocator >
+typename Helium::InlineDynamicArray< T, N, Allocator >::ConstIterator Helium::InlineDynamicArray< T, N, Allocator >::End() const
+{
+	return ConstIterator( m_pBuffer + m_size );
+}
+
+/// Get the array element at the specified index.
+///
+/// @param[in] index  Array index.
+///
+/// @return  Reference to the element at the specified index.
+template< typename T, size_t N, typename Allocator >
+T& Helium::InlineDynamicArray< T, N, Allocator >::GetElement( size_t index )
+{
+	HELIUM_ASSERT( index < m_size );
+	return m_pBuffer[ index ];
+}
+
+/// Get the array element at the specified index.
+///
+/// @param[in] index  Array index.
+///
+/// @return  Constant reference to the element at the specified index.
+template< typename T, size_t N, typename Allocator >
+const T& Helium::InlineDynamicArray< T, N, Allocator >::GetElement( size_t index ) const
+{
+	HELIUM_ASSERT( index < m_size );
+	return m_pBuffer[ index ];
+}
+
+/// Set this array to a copy of a C-style array.
+///
+/// @param[in] pSource  Array from which to copy (must not be part of this array).
+/// @param[in] size     Number of elements in the given array.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Set( const T* pSource, size_t size )
+{
+	HELIUM_ASSERT( pSource || size == 0 );
+	HELIUM_ASSERT( !IsElement( pSource ) || size == 0 );
+
+	ArrayInPlaceDestruct( m_pBuffer, m_size );
+	m_size = 0;
+
+	AddArray( pSource, size );
+}
+
+/// Add an element to the end of this array.
+///
+/// @param[in] rValue  Value to add.
+/// @param[in] count   Number of copies of the specified value to add.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Add( const T& rValue, size_t count )
+{
+	if( IsElement( &rValue ) )
+	{
+		// Copy the value first, as growing the array would move it.
+		T value( rValue );
+		Add( value, count );
+
+		return;
+	}
+
+	size_t newSize = m_size + count;
+	Grow( newSize );
+	ArrayUninitializedFill( m_pBuffer + m_size, rValue, count );
+	m_size = newSize;
+}
+
+/// Add an element to the end of this array, moving the given value into the new element.
+///
+/// @param[in] rValue  Value to add.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Add( T&& rValue )
+{
+	Emplace( std::move( rValue ) );
+}
+
+/// Add an array of elements to the end of this array.
+///
+/// @param[in] pValues  Array of values to add (must not be part of this array).
+/// @param[in] count    Number of elements in the given array.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::AddArray( const T* pValues, size_t count )
+{
+	InsertArray( m_size, pValues, count );
+}
+
+/// Insert an element to the middle of this array.
+///
+/// @param[in] index   Index at which to insert values.
+/// @param[in] rValue  Value to insert.
+/// @param[in] count   Number of copies of the specified value to insert.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Insert( size_t index, const T& rValue, size_t count )
+{
+	HELIUM_ASSERT( index <= m_size );
+
+	if( IsElement( &rValue ) )
+	{
+		// Copy the value first, as making room for the new elements would move it.
+		T value( rValue );
+		Insert( index, value, count );
+
+		return;
+	}
+
+	T* pGap = OpenGap( index, count );
+	ArrayUninitializedFill( pGap, rValue, count );
+	m_size += count;
+}
+
+/// Insert an element to the middle of this array, moving the given value into the new element.
+///
+/// @param[in] index   Index at which to insert the value.
+/// @param[in] rValue  Value to insert.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Insert( size_t index, T&& rValue )
+{
+	EmplaceAt( index, std::move( rValue ) );
+}
+
+/// Insert an array into to the middle of this array.
+///
+/// @param[in] index    Index at which to insert values.
+/// @param[in] pValues  Array of values to insert (must not be part of this array).
+/// @param[in] count    Number of elements to copy from the array.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::InsertArray( size_t index, const T* pValues, size_t count )
+{
+	HELIUM_ASSERT( index <= m_size );
+	HELIUM_ASSERT( pValues || count == 0 );
+	HELIUM_ASSERT( !IsElement( pValues ) || count == 0 );
+
+	if( count != 0 )
+	{
+		T* pGap = OpenGap( index, count );
+		ArrayUninitializedCopy( pGap, pValues, count );
+		m_size += count;
+	}
+}
+
+/// Remove elements from this array.
+///
+/// This will retain the order of elements in this array.  If order is not a concern, RemoveSwap() can be used instead
+/// to reduce the number of elements moved.
+///
+/// @param[in] index  Index from which to remove elements.
+/// @param[in] count  Number of elements to remove.
+///
+/// @see RemoveSwap(), RemoveAll()
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Remove( size_t index, size_t count )
+{
+	HELIUM_ASSERT( index <= m_size );
+
+	size_t shiftStartIndex = index + count;
+	HELIUM_ASSERT( shiftStartIndex <= m_size );
+
+	size_t newSize = m_size - count;
+
+	MoveAssign( m_pBuffer + index, m_pBuffer + shiftStartIndex, m_size - shiftStartIndex );
+	ArrayInPlaceDestruct( m_pBuffer + newSize, count );
+	m_size = newSize;
+}
+
+/// Remove elements from this array, swapping in elements from the end of the array in order to reduce the number of
+/// elements moved.
+///
+/// Note that the order of existing elements in this array is not guaranteed to be retained when using this function.
+///
+/// @param[in] index  Index from which to remove elements.
+/// @param[in] count  Number of elements to remove.
+///
+/// @see Remove(), RemoveAll()
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::RemoveSwap( size_t index, size_t count )
+{
+	HELIUM_ASSERT( index <= m_size );
+
+	size_t shiftStartIndex = index + count;
+	HELIUM_ASSERT( shiftStartIndex <= m_size );
+
+	size_t newSize = m_size - count;
+
+	size_t trailingCount = m_size - shiftStartIndex;
+	if( trailingCount <= count )
+	{
+		// We're removing more elements from the array than exist past the end of the range being removed, so
+		// perform a normal shift and destroy.
+		MoveAssign( m_pBuffer + index, m_pBuffer + shiftStartIndex, trailingCount );
+	}
+	else
+	{
+		// Swap elements from the end of the array into the empty space.
+		MoveAssign( m_pBuffer + index, m_pBuffer + newSize, count );
+	}
+
+	ArrayInPlaceDestruct( m_pBuffer + newSize, count );
+	m_size = newSize;
+}
+
+/// Remove all elements from this array without modifying its capacity.
+///
+/// @see Remove(), Clear()
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::RemoveAll()
+{
+	Remove( 0, m_size );
+}
+
+/// Get the first element in this array.
+///
+/// @return  Reference to the first element in this array.
+///
+/// @see GetLast()
+template< typename T, size_t N, typename Allocator >
+T& Helium::InlineDynamicArray< T, N, Allocator >::GetFirst()
+{
+	HELIUM_ASSERT( m_size != 0 );
+
+	return m_pBuffer[ 0 ];
+}
+
+/// Get the last element in this array.
+///
+/// @return  Reference to the last element in this array.
+///
+/// @see GetFirst()
+template< typename T, size_t N, typename Allocator >
+T& Helium::InlineDynamicArray< T, N, Allocator >::GetLast()
+{
+	HELIUM_ASSERT( m_size != 0 );
+
+	return m_pBuffer[ m_size - 1 ];
+}
+
+/// Get the first element in this array.
+///
+/// @return  Constant reference to the first element in this array.
+///
+/// @see GetLast()
+template< typename T, size_t N, typename Allocator >
+const T& Helium::InlineDynamicArray< T, N, Allocator >::GetFirst() const
+{
+	HELIUM_ASSERT( m_size != 0 );
+
+	return m_pBuffer[ 0 ];
+}
+
+/// Get the last element in this array.
+///
+/// @return  Constant reference to the last element in this array.
+///
+/// @see GetFirst()
+template< typename T, size_t N, typename Allocator >
+const T& Helium::InlineDynamicArray< T, N, Allocator >::GetLast() const
+{
+	HELIUM_ASSERT( m_size != 0 );
+
+	return m_pBuffer[ m_size - 1 ];
+}
+
+/// Push an element onto the end of this array.
+///
+/// @param[in] rValue  Value to push.
+///
+/// @return  Index of the pushed element.
+///
+/// @see Pop()
+template< typename T, size_t N, typename Allocator >
+size_t Helium::InlineDynamicArray< T, N, Allocator >::Push( const T& rValue )
+{
+	size_t index = m_size;
+	Add( rValue );
+
+	return index;
+}
+
+/// Push an element onto the end of this array, moving the given value into the new element.
+///
+/// @param[in] rValue  Value to push.
+///
+/// @return  Index of the pushed element.
+///
+/// @see Pop()
+template< typename T, size_t N, typename Allocator >
+size_t Helium::InlineDynamicArray< T, N, Allocator >::Push( T&& rValue )
+{
+	size_t index = m_size;
+	Emplace( std::move( rValue ) );
+
+	return index;
+}
+
+/// Remove the last element from this array.
+///
+/// @return  Value of the removed element.
+///
+/// @see Push()
+template< typename T, size_t N, typename Allocator >
+T Helium::InlineDynamicArray< T, N, Allocator >::Pop()
+{
+	HELIUM_ASSERT( m_size != 0 );
+	T previousLast = std::move( GetLast() );
+	Remove( m_size - 1 );
+
+	return previousLast;
+}
+
+/// Swap the contents of this array with another array.
+///
+/// Allocated buffers are exchanged without copying, while elements stored inline are moved individually.
+///
+/// @param[in] rArray  Array with which to swap.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Swap( InlineDynamicArray& rArray )
+{
+	if( this != &rArray )
+	{
+		InlineDynamicArray temporary( std::move( rArray ) );
+		rArray = std::move( *this );
+		*this = std::move( temporary );
+	}
+}
+
+/// Find the index that accesses the provided iterator location.
+///
+/// @param[in] itr  Iterator to find the index of.
+template< typename T, size_t N, typename Allocator >
+uint32_t Helium::InlineDynamicArray< T, N, Allocator >::GetIndex( const ConstIterator& itr ) const
+{
+	const T* pPtr = &itr.operator*();
+	return GetIndexOfPointer( pPtr );
+}
+
+/// Find the index that accesses the provided pointer.
+///
+/// @param[in] pPtr  Pointer to find the index of.
+template< typename T, size_t N, typename Allocator >
+uint32_t Helium::InlineDynamicArray< T, N, Allocator >::GetIndexOfPointer( const T* pPtr ) const
+{
+	HELIUM_ASSERT( IsElement( pPtr ) );
+
+	return static_cast< uint32_t >( pPtr - m_pBuffer );
+}
+
+/// Allocate a new object as a new element in this array.
+///
+/// @return  Pointer to the new object.
+template< typename T, size_t N, typename Allocator >
+T* Helium::InlineDynamicArray< T, N, Allocator >::New()
+{
+	size_t newSize = m_size + 1;
+	Grow( newSize );
+
+	T* pObject = new( m_pBuffer + m_size ) T;
+	HELIUM_ASSERT( pObject );
+
+	m_size = newSize;
+
+	return pObject;
+}
+
+/// Allocate a new object as a new element in this array.
+///
+/// @param[in] u  Constructor argument.
+///
+/// @return  Pointer to the new object.
+template< typename T, size_t N, typename Allocator >
+template< typename U >
+T* Helium::InlineDynamicArray< T, N, Allocator >::New( const U& u )
+{
+	return Emplace( u );
+}
+
+/// Allocate a new object as a new element in this array.
+///
+/// @param[in] u  First constructor argument.
+/// @param[in] v  Second constructor argument.
+///
+/// @return  Pointer to the new object.
+template< typename T, size_t N, typename Allocator >
+template< typename U, typename V >
+T* Helium::InlineDynamicArray< T, N, Allocator >::New( const U& u, const V& v )
+{
+	return Emplace( u, v );
+}
+
+/// Allocate a new object as a new element in this array.
+///
+/// @param[in] u  First constructor argument.
+/// @param[in] v  Second constructor argument.
+/// @param[in] w  Third constructor argument.
+///
+/// @return  Pointer to the new object.
+template< typename T, size_t N, typename Allocator >
+template< typename U, typename V, typename W >
+T* Helium::InlineDynamicArray< T, N, Allocator >::New( const U& u, const V& v, const W& w )
+{
+	return Emplace( u, v, w );
+}
+
+/// Allocate a new object as a new element in this array.
+///
+/// @param[in] u  First constructor argument.
+/// @param[in] v  Second constructor argument.
+/// @param[in] w  Third constructor argument.
+/// @param[in] x  Fourth constructor argument.
+///
+/// @return  Pointer to the new object.
+template< typename T, size_t N, typename Allocator >
+template< typename U, typename V, typename W, typename X >
+T* Helium::InlineDynamicArray< T, N, Allocator >::New( const U& u, const V& v, const W& w, const X& x )
+{
+	return Emplace( u, v, w, x );
+}
+
+/// Construct a new element in place at the end of this array.
+///
+/// @param[in] args  Arguments to forward to the element constructor.
+///
+/// @return  Pointer to the new element.
+///
+/// @see EmplaceAt()
+template< typename T, size_t N, typename Allocator >
+template< typename... Args >
+T* Helium::InlineDynamicArray< T, N, Allocator >::Emplace( Args&&... args )
+{
+	return EmplaceAt( m_size, std::forward< Args >( args )... );
+}
+
+/// Construct a new element in place in the middle of this array.
+///
+/// @param[in] index  Index at which to construct the new element.
+/// @param[in] args   Arguments to forward to the element constructor.
+///
+/// @return  Pointer to the new element.
+///
+/// @see Emplace()
+template< typename T, size_t N, typename Allocator >
+template< typename... Args >
+T* Helium::InlineDynamicArray< T, N, Allocator >::EmplaceAt( size_t index, Args&&... args )
+{
+	HELIUM_ASSERT( index <= m_size );
+
+	T* pObject;
+	if( index == m_size && m_size < m_capacity )
+	{
+		pObject = new( m_pBuffer + index ) T( std::forward< Args >( args )... );
+	}
+	else
+	{
+		// Construct the new value up front, as the arguments may refer to elements that are about to be moved.
+		T value( std::forward< Args >( args )... );
+		pObject = new( OpenGap( index, 1 ) ) T( std::move( value ) );
+	}
+
+	HELIUM_ASSERT( pObject );
+	++m_size;
+
+	return pObject;
+}
+
+/// Set this array to the contents of the given array.
+///
+/// The capacity of this array is retained if it is large enough to hold the contents of the given array.
+///
+/// @param[in] rSource  Array from which to copy.
+///
+/// @return  Reference to this array.
+template< typename T, size_t N, typename Allocator >
+Helium::InlineDynamicArray< T, N, Allocator >& Helium::InlineDynamicArray< T, N, Allocator >::operator=( const InlineDynamicArray& rSource )
+{
+	return Assign( rSource );
+}
+
+/// Set this array to the contents of the given array.
+///
+/// The capacity of this array is retained if it is large enough to hold the contents of the given array.
+///
+/// @param[in] rSource  Array from which to copy.
+///
+/// @return  Reference to this array.
+template< typename T, size_t N, typename Allocator >
+template< size_t OtherN, typename OtherAllocator >
+Helium::InlineDynamicArray< T, N, Allocator >& Helium::InlineDynamicArray< T, N, Allocator >::operator=( 
+	const InlineDynamicArray< T, OtherN, OtherAllocator >& rSource )
+{
+	return Assign( rSource );
+}
+
+/// Move assignment operator.
+///
+/// If the given array has spilled into allocated memory, this takes ownership of that memory.  Otherwise, its elements
+/// are moved individually into the inline buffer of this array.  The given array is left empty.
+///
+/// @param[in] rSource  Array from which to move.
+///
+/// @return  Reference to this array.
+template< typename T, size_t N, typename Allocator >
+Helium::InlineDynamicArray< T, N, Allocator >& Helium::InlineDynamicArray< T, N, Allocator >::operator=( InlineDynamicArray&& rSource )
+{
+	if( this != &rSource )
+	{
+		Clear();
+		MoveConstruct( rSource );
+	}
+
+	return *this;
+}
+
+/// Get the array element at the specified index.
+///
+/// @param[in] index  Array index.
+///
+/// @return  Reference to the element at the specified index.
+template< typename T, size_t N, typename Allocator >
+T& Helium::InlineDynamicArray< T, N, Allocator >::operator[]( ptrdiff_t index )
+{
+	HELIUM_ASSERT( static_cast< size_t >( index ) < m_size );
+	return m_pBuffer[ index ];
+}
+
+/// Get the array element at the specified index.
+///
+/// @param[in] index  Array index.
+///
+/// @return  Constant reference to the element at the specified index.
+template< typename T, size_t N, typename Allocator >
+const T& Helium::InlineDynamicArray< T, N, Allocator >::operator[]( ptrdiff_t index ) const
+{
+	HELIUM_ASSERT( static_cast< size_t >( index ) < m_size );
+	return m_pBuffer[ index ];
+}
+
+/// Equality comparison operator.
+///
+/// @param[in] rOther  Array with which to compare.
+///
+/// @return  True if this array and the given array have the same number of elements, each element matches, and the
+///          elements are in the same order; false if the arrays differ.
+template< typename T, size_t N, typename Allocator >
+bool Helium::InlineDynamicArray< T, N, Allocator >::operator==( const InlineDynamicArray& rOther ) const
+{
+	return Equals( rOther );
+}
+
+/// Equality comparison operator.
+///
+/// @param[in] rOther  Array with which to compare.
+///
+/// @return  True if this array and the given array have the same number of elements, each element matches, and the
+///          elements are in the same order; false if the arrays differ.
+template< typename T, size_t N, typename Allocator >
+template< size_t OtherN, typename OtherAllocator >
+bool Helium::InlineDynamicArray< T, N, Allocator >::operator==( 
+	const InlineDynamicArray< T, OtherN, OtherAllocator >& rOther ) const
+{
+	return Equals( rOther );
+}
+
+/// Inequality comparison operator.
+///
+/// @param[in] rOther  Array with which to compare.
+///
+/// @return  True if this array and the given array differ in size, element value, or element order, false if they match.
+template< typename T, size_t N, typename Allocator >
+bool Helium::InlineDynamicArray< T, N, Allocator >::operator!=( const InlineDynamicArray& rOther ) const
+{
+	return !Equals( rOther );
+}
+
+/// Inequality comparison operator.
+///
+/// @param[in] rOther  Array with which to compare.
+///
+/// @return  True if this array and the given array differ in size, element value, or element order, false if they match.
+template< typename T, size_t N, typename Allocator >
+template< size_t OtherN, typename OtherAllocator >
+bool Helium::InlineDynamicArray< T, N, Allocator >::operator!=( 
+	const InlineDynamicArray< T, OtherN, OtherAllocator >& rOther ) const
+{
+	return !Equals( rOther );
+}
+
+/// Get the inline element buffer.
+///
+/// @return  Inline buffer.
+template< typename T, size_t N, typename Allocator >
+T* Helium::InlineDynamicArray< T, N, Allocator >::GetInlineBuffer()
+{
+	return reinterpret_cast< T* >( &m_inlineBuffer );
+}
+
+/// Get whether the given pointer refers to an element in this array.
+///
+/// @param[in] pValue  Pointer to test.
+///
+/// @return  True if the pointer refers to an element in this array, false if not.
+template< typename T, size_t N, typename Allocator >
+bool Helium::InlineDynamicArray< T, N, Allocator >::IsElement( const T* pValue ) const
+{
+	return ( pValue >= m_pBuffer && pValue < m_pBuffer + m_size );
+}
+
+/// Get the capacity to which this array should grow if growing to support the desired number of elements.
+///
+/// @param[in] desiredCount  Desired minimum capacity.
+///
+/// @return  Recommended capacity.
+template< typename T, size_t N, typename Allocator >
+size_t Helium::InlineDynamicArray< T, N, Allocator >::GetGrowCapacity( size_t desiredCount ) const
+{
+	HELIUM_ASSERT( desiredCount > m_capacity );
+	return Max< size_t >( desiredCount, m_capacity + m_capacity / 2 + 1 );
+}
+
+/// Increase the capacity of this array according to the normal growth rules.
+///
+/// @param[in] capacity  Minimum capacity.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Grow( size_t capacity )
+{
+	if( capacity > m_capacity )
+	{
+		Relocate( GetGrowCapacity( capacity ) );
+	}
+}
+
+/// Move the elements of this array to a buffer of the specified capacity.
+///
+/// If the requested capacity fits within the inline buffer, the elements are moved into the inline buffer instead (if
+/// they are not already stored there).
+///
+/// @param[in] capacity  New capacity (must be at least the current size).
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Relocate( size_t capacity )
+{
+	HELIUM_ASSERT( capacity >= m_size );
+
+	T* pNewBuffer;
+	if( capacity <= N )
+	{
+		if( IsInline() )
+		{
+			return;
+		}
+
+		pNewBuffer = GetInlineBuffer();
+		capacity = N;
+	}
+	else
+	{
+		pNewBuffer = Allocate( capacity );
+		HELIUM_ASSERT( pNewBuffer );
+	}
+
+	MoveConstruct( pNewBuffer, m_pBuffer, m_size );
+	ArrayInPlaceDestruct( m_pBuffer, m_size );
+	if( !IsInline() )
+	{
+		Free( m_pBuffer );
+	}
+
+	m_pBuffer = pNewBuffer;
+	m_capacity = capacity;
+}
+
+/// Make room for a range of new elements in the middle of this array, growing the array buffer if necessary.
+///
+/// Elements following the insertion point are moved (not copied) out of the way.  The array size is not updated; the
+/// caller is responsible for constructing the new elements and updating the size accordingly.
+///
+/// @param[in] index  Index at which elements will be inserted.
+/// @param[in] count  Number of elements to make room for.
+///
+/// @return  Pointer to the first of the uninitialized elements.
+template< typename T, size_t N, typename Allocator >
+T* Helium::InlineDynamicArray< T, N, Allocator >::OpenGap( size_t index, size_t count )
+{
+	HELIUM_ASSERT( index <= m_size );
+
+	size_t newSize = m_size + count;
+	if( newSize > m_capacity )
+	{
+		size_t newCapacity = GetGrowCapacity( newSize );
+		T* pNewBuffer = Allocate( newCapacity );
+		HELIUM_ASSERT( pNewBuffer );
+
+		MoveConstruct( pNewBuffer, m_pBuffer, index );
+		MoveConstruct( pNewBuffer + index + count, m_pBuffer + index, m_size - index );
+
+		ArrayInPlaceDestruct( m_pBuffer, m_size );
+		if( !IsInline() )
+		{
+			Free( m_pBuffer );
+		}
+
+		m_pBuffer = pNewBuffer;
+		m_capacity = newCapacity;
+	}
+	else
+	{
+		// Shift the trailing elements into uninitialized memory, starting from the end so that no element is
+		// overwritten before it has been moved.
+		for( size_t elementIndex = m_size; elementIndex > index; )
+		{
+			--elementIndex;
+			new( m_pBuffer + elementIndex + count ) T( std::move( m_pBuffer[ elementIndex ] ) );
+			m_pBuffer[ elementIndex ].~T();
+		}
+	}
+
+	return m_pBuffer + index;
+}
+
+/// Take over the contents of another array, assuming this array is empty and using its inline buffer.
+///
+/// @param[in] rSource  Array from which to move.  This will be left empty.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::MoveConstruct( InlineDynamicArray& rSource )
+{
+	HELIUM_ASSERT( IsInline() );
+	HELIUM_ASSERT( m_size == 0 );
+
+	if( rSource.IsInline() )
+	{
+		MoveConstruct( m_pBuffer, rSource.m_pBuffer, rSource.m_size );
+		ArrayInPlaceDestruct( rSource.m_pBuffer, rSource.m_size );
+		m_size = rSource.m_size;
+	}
+	else
+	{
+		m_pBuffer = rSource.m_pBuffer;
+		m_size = rSource.m_size;
+		m_capacity = rSource.m_capacity;
+
+		rSource.m_pBuffer = rSource.GetInlineBuffer();
+		rSource.m_capacity = N;
+	}
+
+	rSource.m_size = 0;
+}
+
+/// Destroy all elements and free any allocated memory, but don't clear out any variables.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Finalize()
+{
+	ArrayInPlaceDestruct( m_pBuffer, m_size );
+	if( !IsInline() )
+	{
+		Free( m_pBuffer );
+	}
+}
+
+/// Assignment operator implementation.
+///
+/// @param[in] rSource  Array from which to copy.
+///
+/// @return  Reference to this array.
+template< typename T, size_t N, typename Allocator >
+template< size_t OtherN, typename OtherAllocator >
+Helium::InlineDynamicArray< T, N, Allocator >& Helium::InlineDynamicArray< T, N, Allocator >::Assign(
+	const InlineDynamicArray< T, OtherN, OtherAllocator >& rSource )
+{
+	if( static_cast< const void* >( this ) != static_cast< const void* >( &rSource ) )
+	{
+		Set( rSource.GetData(), rSource.GetSize() );
+	}
+
+	return *this;
+}
+
+/// Test whether this array has the same elements (in the same order) as the given array.
+///
+/// @param[in] rOther  Array with which to compare.
+///
+/// @return  True if this array and the given array have the same number of elements, each element matches, and the
+///          elements are in the same order; false if the arrays differ.
+template< typename T, size_t N, typename Allocator >
+template< size_t OtherN, typename OtherAllocator >
+bool Helium::InlineDynamicArray< T, N, Allocator >::Equals(
+	const InlineDynamicArray< T, OtherN, OtherAllocator >& rOther ) const
+{
+	size_t size = m_size;
+	if( size != rOther.GetSize() )
+	{
+		return false;
+	}
+
+	const T* pThisBuffer = m_pBuffer;
+	const T* pOtherBuffer = rOther.GetData();
+	for( size_t index = 0; index < size; ++index )
+	{
+		if( !( pThisBuffer[ index ] == pOtherBuffer[ index ] ) )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/// Allocate memory for the specified number of elements, accounting for non-standard alignment requirements.
+///
+/// @param[in] count  Number of elements for which to allocate.
+///
+/// @return  Pointer to the allocated memory.
+template< typename T, size_t N, typename Allocator >
+T* Helium::InlineDynamicArray< T, N, Allocator >::Allocate( size_t count )
+{
+	return Allocate( count, std::integral_constant< bool, ( std::alignment_of< T >::value > 8 ) >() );
+}
+
+/// Allocate() implementation for types requiring a specific alignment.
+///
+/// @param[in] count            Number of elements for which to allocate.
+/// @param[in] rNeedsAlignment  std::true_type.
+///
+/// @return  Pointer to the allocated memory.
+template< typename T, size_t N, typename Allocator >
+T* Helium::InlineDynamicArray< T, N, Allocator >::Allocate( size_t count, const std::true_type& /*rNeedsAlignment*/ )
+{
+	return static_cast< T* >( Allocator().AllocateAligned( std::alignment_of< T >::value, sizeof( T ) * count ) );
+}
+
+/// Allocate() implementation for types that can use the default alignment.
+///
+/// @param[in] count            Number of elements for which to allocate.
+/// @param[in] rNeedsAlignment  std::false_type.
+///
+/// @return  Pointer to the allocated memory.
+template< typename T, size_t N, typename Allocator >
+T* Helium::InlineDynamicArray< T, N, Allocator >::Allocate( size_t count, const std::false_type& /*rNeedsAlignment*/ )
+{
+	return static_cast< T* >( Allocator().Allocate( sizeof( T ) * count ) );
+}
+
+/// Free memory, accounting for non-standard alignment requirements.
+///
+/// @param[in] pMemory  Memory to free.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Free( T* pMemory )
+{
+	Free( pMemory, std::integral_constant< bool, ( std::alignment_of< T >::value > 8 ) >() );
+}
+
+/// Free() implementation for types requiring a specific alignment.
+///
+/// @param[in] pMemory          Memory to free.
+/// @param[in] rNeedsAlignment  std::true_type.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Free( T* pMemory, const std::true_type& /*rNeedsAlignment*/ )
+{
+	Allocator().FreeAligned( pMemory );
+}
+
+/// Free() implementation for types that can use the default alignment.
+///
+/// @param[in] pMemory          Memory to free.
+/// @param[in] rNeedsAlignment  std::false_type.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::Free( T* pMemory, const std::false_type& /*rNeedsAlignment*/ )
+{
+	Allocator().Free( pMemory );
+}
+
+/// Move-construct elements into uninitialized memory.
+///
+/// @param[in] pDest    Uninitialized memory in which to construct elements.
+/// @param[in] pSource  Elements from which to move (must not overlap the destination).
+/// @param[in] count    Number of elements to move.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::MoveConstruct( T* pDest, T* pSource, size_t count )
+{
+	for( size_t index = 0; index < count; ++index )
+	{
+		new( pDest + index ) T( std::move( pSource[ index ] ) );
+	}
+}
+
+/// Move-assign elements to a lower address within a range of constructed elements.
+///
+/// @param[in] pDest    Elements to which to move.
+/// @param[in] pSource  Elements from which to move (must not precede the destination).
+/// @param[in] count    Number of elements to move.
+template< typename T, size_t N, typename Allocator >
+void Helium::InlineDynamicArray< T, N, Allocator >::MoveAssign( T* pDest, T* pSource, size_t count )
+{
+	HELIUM_ASSERT( pDest <= pSource || count == 0 );
+
+	for( size_t index = 0; index < count; ++index )
+	{
+		pDest[ index ] = std::move( pSource[ index ] );
+	}
+}
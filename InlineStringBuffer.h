@@ -0,0 +1,147 @@
+#pragma once
+
+#include "Platform/Types.h"
+#include "Platform/MemoryHeap.h"
+#include "Platform/Utility.h"
+
+#include "Foundation/API.h"
+#include "Foundation/Math.h"
+
+namespace Helium
+{
+	/// Compact character buffer used for string storage, with short contents stored in the buffer object itself (not
+	/// thread-safe).
+	///
+	/// The buffer object is exactly the size of a pointer and two size values (24 bytes on 64-bit platforms).  Memory
+	/// allocated from the Allocator is referenced through the pointer, size, and capacity fields.  Short contents are
+	/// instead stored directly over those fields, with the last byte of the object used as a tag holding the inline
+	/// size.  The same byte overlaps the capacity field when memory has been allocated, and a flag bit that can never be
+	/// set in the inline size distinguishes the two layouts.
+	///
+	/// The last character type element of the object is always reserved for the tag, so INLINE_CAPACITY elements can
+	/// be stored without allocating memory (23 for 8-bit characters on 64-bit platforms).
+	///
+	/// Only the operations needed by StringBase are provided.  Character types must be trivially copyable.
+	template< typename CharType, typename Allocator = DefaultAllocator >
+	class InlineStringBuffer
+	{
+	private:
+		/// Buffer fields used once the contents have been moved into allocated memory.
+		struct HeapData
+		{
+			/// Allocated buffer.
+			CharType* pBuffer;
+			/// Used buffer size.
+			size_t size;
+			/// Buffer capacity, encoded along with HEAP_FLAG.
+			size_t capacity;
+		};
+
+	public:
+		/// Number of character type elements stored without allocating memory.
+		static const size_t INLINE_CAPACITY = ( sizeof( HeapData ) - 1 ) / sizeof( CharType );
+
+		/// @name Construction/Destruction
+		//@{
+		InlineStringBuffer();
+		InlineStringBuffer( const InlineStringBuffer& rSource );
+		InlineStringBuffer( InlineStringBuffer&& rSource );
+		~InlineStringBuffer();
+		//@}
+
+		/// @name Buffer Operations
+		//@{
+		size_t GetSize() const;
+		bool IsEmpty() const;
+		void Resize( size_t size );
+
+		size_t GetCapacity() const;
+		void Reserve( size_t capacity );
+		void Trim();
+
+		bool IsInline() const;
+
+		CharType* GetData();
+		const CharType* GetData() const;
+
+		void Clear();
+
+		CharType& GetElement( size_t index );
+		const CharType& GetElement( size_t index ) const;
+
+		void Set( const CharType* pSource, size_t size );
+
+		void Add( CharType value, size_t count = 1 );
+		void AddArray( const CharType* pValues, size_t count );
+		void Insert( size_t index, CharType value, size_t count = 1 );
+		void InsertArray( size_t index, const CharType* pValues, size_t count );
+		void Remove( size_t index, size_t count = 1 );
+
+		CharType& GetFirst();
+		const CharType& GetFirst() const;
+		size_t Push( CharType value );
+		//@}
+
+		/// @name Overloaded Operators
+		//@{
+		InlineStringBuffer& operator=( const InlineStringBuffer& rSource );
+		template< typename OtherAllocator > InlineStringBuffer& operator=(
+			const InlineStringBuffer< CharType, OtherAllocator >& rSource );
+		InlineStringBuffer& operator=( InlineStringBuffer&& rSource );
+
+		CharType& operator[]( ptrdiff_t index );
+		const CharType& operator[]( ptrdiff_t index ) const;
+		//@}
+
+	private:
+		/// Index of the tag byte (the last byte of the buffer object).
+		static const size_t TAG_INDEX = sizeof( HeapData ) - 1;
+
+#if HELIUM_ENDIAN_LITTLE
+		/// Flag set in the encoded heap capacity when the contents are stored in allocated memory.
+		static const size_t HEAP_FLAG = static_cast< size_t >( 1 ) << ( sizeof( size_t ) * 8 - 1 );
+		/// Bit of the tag byte overlapping HEAP_FLAG.
+		static const uint8_t TAG_HEAP_FLAG = 0x80;
+		/// Shift applied to values stored alongside the flag bit (the heap capacity and the inline size).
+		static const size_t FIELD_SHIFT = 0;
+#else
+		/// Flag set in the encoded heap capacity when the contents are stored in allocated memory.
+		static const size_t HEAP_FLAG = 1;
+		/// Bit of the tag byte overlapping HEAP_FLAG.
+		static const uint8_t TAG_HEAP_FLAG = 0x01;
+		/// Shift applied to values stored alongside the flag bit (the heap capacity and the inline size).
+		static const size_t FIELD_SHIFT = 1;
+#endif
+
+		union
+		{
+			/// Buffer fields when using allocated memory.
+			HeapData m_heap;
+			/// Inline character storage.
+			CharType m_inline[ sizeof( HeapData ) / sizeof( CharType ) ];
+			/// Raw bytes of the buffer object, used to access the tag byte.
+			uint8_t m_bytes[ sizeof( HeapData ) ];
+		};
+
+		/// @name Private Utility Functions
+		//@{
+		void SetSize( size_t size );
+		void SetHeap( CharType* pBuffer, size_t capacity );
+		void SetInlineEmpty();
+		bool IsElement( const CharType* pValue ) const;
+
+		size_t GetGrowCapacity( size_t desiredCount ) const;
+		void Grow( size_t capacity );
+		void Relocate( size_t capacity );
+		CharType* OpenGap( size_t index, size_t count );
+
+		void MoveConstruct( InlineStringBuffer& rSource );
+		void Finalize();
+
+		static CharType* Allocate( size_t count );
+		static void Free( CharType* pMemory );
+		//@}
+	};
+}
+
+#include "Foundation/InlineStringBuffer.inl"
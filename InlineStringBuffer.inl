@@ -0,0 +1,583 @@
+/// Constructor.
+///
+/// This creates an empty buffer using the inline storage.  No memory is allocated at this time.
+template< typename CharType, typename Allocator >
+Helium::InlineStringBuffer< CharType, Allocator >::InlineStringBuffer()
+{
+	SetInlineEmpty();
+}
+
+/// Copy constructor.
+///
+/// @param[in] rSource  Buffer from which to copy.
+template< typename CharType, typename Allocator >
+Helium::InlineStringBuffer< CharType, Allocator >::InlineStringBuffer( const InlineStringBuffer& rSource )
+{
+	SetInlineEmpty();
+	AddArray( rSource.GetData(), rSource.GetSize() );
+}
+
+/// Move constructor.
+///
+/// Both inline contents and allocated memory are taken over by copying the buffer fields.  The given buffer is left
+/// empty.
+///
+/// @param[in] rSource  Buffer from which to move.
+template< typename CharType, typename Allocator >
+Helium::InlineStringBuffer< CharType, Allocator >::InlineStringBuffer( InlineStringBuffer&& rSource )
+{
+	MoveConstruct( rSource );
+}
+
+/// Destructor.
+template< typename CharType, typename Allocator >
+Helium::InlineStringBuffer< CharType, Allocator >::~InlineStringBuffer()
+{
+	Finalize();
+}
+
+/// Get the number of elements in this buffer.
+///
+/// @return  Number of elements in this buffer.
+///
+/// @see GetCapacity(), Resize(), IsEmpty()
+template< typename CharType, typename Allocator >
+size_t Helium::InlineStringBuffer< CharType, Allocator >::GetSize() const
+{
+	return ( IsInline() ? static_cast< size_t >( m_bytes[ TAG_INDEX ] >> FIELD_SHIFT ) : m_heap.size );
+}
+
+/// Get whether this buffer is currently empty.
+///
+/// @return  True if this buffer is empty, false if not.
+///
+/// @see GetSize()
+template< typename CharType, typename Allocator >
+bool Helium::InlineStringBuffer< CharType, Allocator >::IsEmpty() const
+{
+	return( GetSize() == 0 );
+}
+
+/// Resize this buffer, retaining any existing data that fits within the new size.
+///
+/// If the new size is smaller than the current size, no memory will be freed.  New elements are left uninitialized.
+///
+/// @param[in] size  New buffer size.
+///
+/// @see GetSize()
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::Resize( size_t size )
+{
+	Grow( size );
+	SetSize( size );
+}
+
+/// Get the maximum number of elements which this buffer can contain without requiring reallocation of memory.
+///
+/// This is never less than INLINE_CAPACITY.
+///
+/// @return  Current buffer capacity.
+///
+/// @see GetSize(), Reserve()
+template< typename CharType, typename Allocator >
+size_t Helium::InlineStringBuffer< CharType, Allocator >::GetCapacity() const
+{
+	return ( IsInline() ? INLINE_CAPACITY : ( m_heap.capacity & ~HEAP_FLAG ) >> FIELD_SHIFT );
+}
+
+/// Explicitly increase the capacity of this buffer to support at least the specified number of elements.
+///
+/// If the requested capacity is less than the current capacity, no memory will be reallocated.
+///
+/// @param[in] capacity  Desired capacity.
+///
+/// @see GetCapacity()
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::Reserve( size_t capacity )
+{
+	if( capacity > GetCapacity() )
+	{
+		Relocate( capacity );
+	}
+}
+
+/// Resize the allocated buffer memory to match the size actually in use.
+///
+/// If the contents fit within the inline storage, they are moved back into it and the allocated memory is freed.
+///
+/// @see GetCapacity()
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::Trim()
+{
+	if( !IsInline() && GetCapacity() != m_heap.size )
+	{
+		Relocate( m_heap.size );
+	}
+}
+
+/// Get whether the contents of this buffer are currently stored inline.
+///
+/// @return  True if the inline storage is in use, false if the contents have been moved into allocated memory.
+template< typename CharType, typename Allocator >
+bool Helium::InlineStringBuffer< CharType, Allocator >::IsInline() const
+{
+	return( ( m_bytes[ TAG_INDEX ] & TAG_HEAP_FLAG ) == 0 );
+}
+
+/// Get a pointer to the base of the buffer.
+///
+/// @return  Buffer data.
+template< typename CharType, typename Allocator >
+CharType* Helium::InlineStringBuffer< CharType, Allocator >::GetData()
+{
+	return ( IsInline() ? m_inline : m_heap.pBuffer );
+}
+
+/// Get a pointer to the base of the buffer.
+///
+/// @return  Buffer data.
+template< typename CharType, typename Allocator >
+const CharType* Helium::InlineStringBuffer< CharType, Allocator >::GetData() const
+{
+	return ( IsInline() ? m_inline : m_heap.pBuffer );
+}
+
+/// Resize the buffer to zero and free all allocated memory, reverting to the inline storage.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::Clear()
+{
+	Finalize();
+	SetInlineEmpty();
+}
+
+/// Get the buffer element at the specified index.
+///
+/// @param[in] index  Buffer index.
+///
+/// @return  Reference to the element at the specified index.
+template< typename CharType, typename Allocator >
+CharType& Helium::InlineStringBuffer< CharType, Allocator >::GetElement( size_t index )
+{
+	HELIUM_ASSERT( index < GetSize() );
+	return GetData()[ index ];
+}
+
+/// Get the buffer element at the specified index.
+///
+/// @param[in] index  Buffer index.
+///
+/// @return  Constant reference to the element at the specified index.
+template< typename CharType, typename Allocator >
+const CharType& Helium::InlineStringBuffer< CharType, Allocator >::GetElement( size_t index ) const
+{
+	HELIUM_ASSERT( index < GetSize() );
+	return GetData()[ index ];
+}
+
+/// Set this buffer to a copy of a C-style array.
+///
+/// @param[in] pSource  Array from which to copy (must not be part of this buffer).
+/// @param[in] size     Number of elements in the given array.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::Set( const CharType* pSource, size_t size )
+{
+	HELIUM_ASSERT( pSource || size == 0 );
+	HELIUM_ASSERT( !IsElement( pSource ) || size == 0 );
+
+	SetSize( 0 );
+	AddArray( pSource, size );
+}
+
+/// Add an element to the end of this buffer.
+///
+/// @param[in] value  Value to add.
+/// @param[in] count  Number of copies of the specified value to add.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::Add( CharType value, size_t count )
+{
+	Insert( GetSize(), value, count );
+}
+
+/// Add an array of elements to the end of this buffer.
+///
+/// @param[in] pValues  Array of values to add (must not be part of this buffer).
+/// @param[in] count    Number of elements in the given array.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::AddArray( const CharType* pValues, size_t count )
+{
+	InsertArray( GetSize(), pValues, count );
+}
+
+/// Insert an element to the middle of this buffer.
+///
+/// @param[in] index  Index at which to insert values.
+/// @param[in] value  Value to insert.
+/// @param[in] count  Number of copies of the specified value to insert.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::Insert( size_t index, CharType value, size_t count )
+{
+	size_t newSize = GetSize() + count;
+	CharType* pGap = OpenGap( index, count );
+	for( size_t valueIndex = 0; valueIndex < count; ++valueIndex )
+	{
+		pGap[ valueIndex ] = value;
+	}
+
+	SetSize( newSize );
+}
+
+/// Insert an array into to the middle of this buffer.
+///
+/// @param[in] index    Index at which to insert values.
+/// @param[in] pValues  Array of values to insert (must not be part of this buffer).
+/// @param[in] count    Number of elements to copy from the array.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::InsertArray(
+	size_t index,
+	const CharType* pValues,
+	size_t count )
+{
+	HELIUM_ASSERT( pValues || count == 0 );
+	HELIUM_ASSERT( !IsElement( pValues ) || count == 0 );
+
+	if( count != 0 )
+	{
+		size_t newSize = GetSize() + count;
+		CharType* pGap = OpenGap( index, count );
+		MemoryCopy( pGap, pValues, sizeof( CharType ) * count );
+		SetSize( newSize );
+	}
+}
+
+/// Remove elements from this buffer.
+///
+/// @param[in] index  Index from which to remove elements.
+/// @param[in] count  Number of elements to remove.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::Remove( size_t index, size_t count )
+{
+	size_t size = GetSize();
+	HELIUM_ASSERT( index <= size );
+
+	size_t shiftStartIndex = index + count;
+	HELIUM_ASSERT( shiftStartIndex <= size );
+
+	CharType* pBuffer = GetData();
+	MemoryMove( pBuffer + index, pBuffer + shiftStartIndex, sizeof( CharType ) * ( size - shiftStartIndex ) );
+	SetSize( size - count );
+}
+
+/// Get the first element in this buffer.
+///
+/// @return  Reference to the first element in this buffer.
+template< typename CharType, typename Allocator >
+CharType& Helium::InlineStringBuffer< CharType, Allocator >::GetFirst()
+{
+	HELIUM_ASSERT( GetSize() != 0 );
+
+	return GetData()[ 0 ];
+}
+
+/// Get the first element in this buffer.
+///
+/// @return  Constant reference to the first element in this buffer.
+template< typename CharType, typename Allocator >
+const CharType& Helium::InlineStringBuffer< CharType, Allocator >::GetFirst() const
+{
+	HELIUM_ASSERT( GetSize() != 0 );
+
+	return GetData()[ 0 ];
+}
+
+/// Push an element onto the end of this buffer.
+///
+/// @param[in] value  Value to push.
+///
+/// @return  Index of the pushed element.
+template< typename CharType, typename Allocator >
+size_t Helium::InlineStringBuffer< CharType, Allocator >::Push( CharType value )
+{
+	size_t index = GetSize();
+	Insert( index, value );
+
+	return index;
+}
+
+/// Set this buffer to the contents of the given buffer.
+///
+/// The capacity of this buffer is retained if it is large enough to hold the contents of the given buffer.
+///
+/// @param[in] rSource  Buffer from which to copy.
+///
+/// @return  Reference to this buffer.
+template< typename CharType, typename Allocator >
+Helium::InlineStringBuffer< CharType, Allocator >& Helium::InlineStringBuffer< CharType, Allocator >::operator=(
+	const InlineStringBuffer& rSource )
+{
+	if( this != &rSource )
+	{
+		Set( rSource.GetData(), rSource.GetSize() );
+	}
+
+	return *this;
+}
+
+/// Set this buffer to the contents of the given buffer.
+///
+/// The capacity of this buffer is retained if it is large enough to hold the contents of the given buffer.
+///
+/// @param[in] rSource  Buffer from which to copy.
+///
+/// @return  Reference to this buffer.
+template< typename CharType, typename Allocator >
+template< typename OtherAllocator >
+Helium::InlineStringBuffer< CharType, Allocator >& Helium::InlineStringBuffer< CharType, Allocator >::operator=(
+	const InlineStringBuffer< CharType, OtherAllocator >& rSource )
+{
+	if( static_cast< const void* >( this ) != static_cast< const void* >( &rSource ) )
+	{
+		Set( rSource.GetData(), rSource.GetSize() );
+	}
+
+	return *this;
+}
+
+/// Move assignment operator.
+///
+/// Both inline contents and allocated memory are taken over by copying the buffer fields.  The given buffer is left
+/// empty.
+///
+/// @param[in] rSource  Buffer from which to move.
+///
+/// @return  Reference to this buffer.
+template< typename CharType, typename Allocator >
+Helium::InlineStringBuffer< CharType, Allocator >& Helium::InlineStringBuffer< CharType, Allocator >::operator=(
+	InlineStringBuffer&& rSource )
+{
+	if( this != &rSource )
+	{
+		Finalize();
+		MoveConstruct( rSource );
+	}
+
+	return *this;
+}
+
+/// Get the buffer element at the specified index.
+///
+/// @param[in] index  Buffer index.
+///
+/// @return  Reference to the element at the specified index.
+template< typename CharType, typename Allocator >
+CharType& Helium::InlineStringBuffer< CharType, Allocator >::operator[]( ptrdiff_t index )
+{
+	HELIUM_ASSERT( static_cast< size_t >( index ) < GetSize() );
+	return GetData()[ index ];
+}
+
+/// Get the buffer element at the specified index.
+///
+/// @param[in] index  Buffer index.
+///
+/// @return  Constant reference to the element at the specified index.
+template< typename CharType, typename Allocator >
+const CharType& Helium::InlineStringBuffer< CharType, Allocator >::operator[]( ptrdiff_t index ) const
+{
+	HELIUM_ASSERT( static_cast< size_t >( index ) < GetSize() );
+	return GetData()[ index ];
+}
+
+/// Update the number of elements in use, in either the tag byte or the heap fields.
+///
+/// @param[in] size  New buffer size (must not exceed the current capacity).
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::SetSize( size_t size )
+{
+	HELIUM_ASSERT( size <= GetCapacity() );
+
+	if( IsInline() )
+	{
+		m_bytes[ TAG_INDEX ] = static_cast< uint8_t >( size << FIELD_SHIFT );
+	}
+	else
+	{
+		m_heap.size = size;
+	}
+}
+
+/// Switch to allocated memory, setting the buffer pointer and capacity.  The size field is not updated.
+///
+/// @param[in] pBuffer   Allocated buffer.
+/// @param[in] capacity  Buffer capacity.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::SetHeap( CharType* pBuffer, size_t capacity )
+{
+	HELIUM_ASSERT( pBuffer );
+	HELIUM_ASSERT( ( ( capacity << FIELD_SHIFT ) & HEAP_FLAG ) == 0 );
+
+	m_heap.pBuffer = pBuffer;
+	m_heap.capacity = ( capacity << FIELD_SHIFT ) | HEAP_FLAG;
+}
+
+/// Reset this buffer to empty inline storage without freeing any allocated memory.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::SetInlineEmpty()
+{
+	m_bytes[ TAG_INDEX ] = 0;
+}
+
+/// Get whether the given pointer refers to an element in this buffer.
+///
+/// @param[in] pValue  Pointer to test.
+///
+/// @return  True if the pointer refers to an element in this buffer, false if not.
+template< typename CharType, typename Allocator >
+bool Helium::InlineStringBuffer< CharType, Allocator >::IsElement( const CharType* pValue ) const
+{
+	const CharType* pBuffer = GetData();
+
+	return ( pValue >= pBuffer && pValue < pBuffer + GetSize() );
+}
+
+/// Get the capacity to which this buffer should grow if growing to support the desired number of elements.
+///
+/// @param[in] desiredCount  Desired minimum capacity.
+///
+/// @return  Recommended capacity.
+template< typename CharType, typename Allocator >
+size_t Helium::InlineStringBuffer< CharType, Allocator >::GetGrowCapacity( size_t desiredCount ) const
+{
+	size_t capacity = GetCapacity();
+	HELIUM_ASSERT( desiredCount > capacity );
+
+	return Max< size_t >( desiredCount, capacity + capacity / 2 + 1 );
+}
+
+/// Increase the capacity of this buffer according to the normal growth rules.
+///
+/// @param[in] capacity  Minimum capacity.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::Grow( size_t capacity )
+{
+	if( capacity > GetCapacity() )
+	{
+		Relocate( GetGrowCapacity( capacity ) );
+	}
+}
+
+/// Move the contents of this buffer to storage of the specified capacity.
+///
+/// If the requested capacity fits within the inline storage, the contents are moved into the inline storage instead
+/// (if they are not already stored there).
+///
+/// @param[in] capacity  New capacity (must be at least the current size).
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::Relocate( size_t capacity )
+{
+	size_t size = GetSize();
+	HELIUM_ASSERT( capacity >= size );
+
+	if( capacity <= INLINE_CAPACITY )
+	{
+		if( IsInline() )
+		{
+			return;
+		}
+
+		// The inline storage overlaps the heap fields, so read them before copying the contents over them.
+		CharType* pOldBuffer = m_heap.pBuffer;
+		MemoryCopy( m_inline, pOldBuffer, sizeof( CharType ) * size );
+		Free( pOldBuffer );
+
+		m_bytes[ TAG_INDEX ] = static_cast< uint8_t >( size << FIELD_SHIFT );
+
+		return;
+	}
+
+	CharType* pNewBuffer = Allocate( capacity );
+	HELIUM_ASSERT( pNewBuffer );
+	MemoryCopy( pNewBuffer, GetData(), sizeof( CharType ) * size );
+	Finalize();
+
+	SetHeap( pNewBuffer, capacity );
+	m_heap.size = size;
+}
+
+/// Make room for a range of new elements in the middle of this buffer, growing the buffer if necessary.
+///
+/// The buffer size is not updated; the caller is responsible for filling in the new elements and updating the size
+/// accordingly.
+///
+/// @param[in] index  Index at which elements will be inserted.
+/// @param[in] count  Number of elements to make room for.
+///
+/// @return  Pointer to the first of the new elements.
+template< typename CharType, typename Allocator >
+CharType* Helium::InlineStringBuffer< CharType, Allocator >::OpenGap( size_t index, size_t count )
+{
+	size_t size = GetSize();
+	HELIUM_ASSERT( index <= size );
+
+	size_t newSize = size + count;
+	if( newSize > GetCapacity() )
+	{
+		size_t newCapacity = GetGrowCapacity( newSize );
+		CharType* pNewBuffer = Allocate( newCapacity );
+		HELIUM_ASSERT( pNewBuffer );
+
+		const CharType* pOldBuffer = GetData();
+		MemoryCopy( pNewBuffer, pOldBuffer, sizeof( CharType ) * index );
+		MemoryCopy( pNewBuffer + index + count, pOldBuffer + index, sizeof( CharType ) * ( size - index ) );
+		Finalize();
+
+		SetHeap( pNewBuffer, newCapacity );
+		m_heap.size = size;
+	}
+	else
+	{
+		CharType* pBuffer = GetData();
+		MemoryMove( pBuffer + index + count, pBuffer + index, sizeof( CharType ) * ( size - index ) );
+	}
+
+	return GetData() + index;
+}
+
+/// Take over the contents of another buffer, overwriting the fields of this buffer.
+///
+/// @param[in] rSource  Buffer from which to move.  This will be left empty.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::MoveConstruct( InlineStringBuffer& rSource )
+{
+	MemoryCopy( m_bytes, rSource.m_bytes, sizeof( m_bytes ) );
+	rSource.SetInlineEmpty();
+}
+
+/// Free any allocated memory, but don't clear out any fields.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::Finalize()
+{
+	if( !IsInline() )
+	{
+		Free( m_heap.pBuffer );
+	}
+}
+
+/// Allocate memory for the specified number of elements.
+///
+/// @param[in] count  Number of elements for which to allocate.
+///
+/// @return  Pointer to the allocated memory.
+template< typename CharType, typename Allocator >
+CharType* Helium::InlineStringBuffer< CharType, Allocator >::Allocate( size_t count )
+{
+	return static_cast< CharType* >( Allocator().Allocate( sizeof( CharType ) * count ) );
+}
+
+/// Free memory allocated using Allocate().
+///
+/// @param[in] pMemory  Memory to free.
+template< typename CharType, typename Allocator >
+void Helium::InlineStringBuffer< CharType, Allocator >::Free( CharType* pMemory )
+{
+	Allocator().Free( pMemory );
+}
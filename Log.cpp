@@ -369,12 +369,9 @@ void Log::UnlockMutex()
 	g_Mutex.Unlock();
 }
 
-void Log::PrintString(const char* string, Stream stream, Level level, ConsoleColor color, int indent, char* output, uint32_t outputSize)
+// determine if any trace file is capturing the stream for the current thread (call with the mutex held)
+static bool IsTraced( Stream stream )
 {
-	Helium::MutexScopeLock mutex (g_Mutex);
-
-	// check trace files
-	bool trace = false;
 	M_OutputFile::iterator itr = g_TraceFiles.begin();
 	M_OutputFile::iterator end = g_TraceFiles.end();
 	for( ; itr != end; ++itr )
@@ -382,12 +379,28 @@ void Log::PrintString(const char* string, Stream stream, Level level, ConsoleCol
 		if ( ( (*itr).second.m_StreamType & stream ) == stream
 			&& ( (*itr).second.m_ThreadId == ThreadId () || (*itr).second.m_ThreadId == Thread::GetCurrentId() ) )
 		{
-			trace = true;
+			return true;
 		}
 	}
 
+	return false;
+}
+
+// determine if the stream and level are enabled for display (call with the mutex held)
+static bool IsDisplayed( Stream stream, Level level )
+{
+	return ( g_Streams & stream ) == stream && level <= g_Level;
+}
+
+void Log::PrintString(const char* string, Stream stream, Level level, ConsoleColor color, int indent, char* output, uint32_t outputSize)
+{
+	Helium::MutexScopeLock mutex (g_Mutex);
+
+	// check trace files
+	bool trace = IsTraced( stream );
+
 	// determine if we should be displayed
-	bool display = ( g_Streams & stream ) == stream && level <= g_Level;
+	bool display = IsDisplayed( stream, level );
 
 	// check for nothing to do
 	if ( trace || display || output )
@@ -438,8 +451,8 @@ void Log::PrintString(const char* string, Stream stream, Level level, ConsoleCol
 			// output to trace file(s)
 			static bool stampNewLine = true;
 
-			itr = g_TraceFiles.begin();
-			end = g_TraceFiles.end();
+			M_OutputFile::iterator itr = g_TraceFiles.begin();
+			M_OutputFile::iterator end = g_TraceFiles.end();
 			for( ; itr != end; ++itr )
 			{
 				if ( ( (*itr).second.m_StreamType & stream ) == stream
@@ -682,6 +695,50 @@ void Log::Error(Level level, const char *fmt,...)
 	va_end(args);
 }
 
+void Log::FormatArgs(Stream stream, Level level, const char* pFormatString, const FormatArgument< char >* pArguments, size_t argumentCount)
+{
+	{
+		Helium::MutexScopeLock mutex (g_Mutex);
+
+		// skip formatting entirely if no trace file or display would receive the statement
+		if ( !IsTraced( stream ) && !IsDisplayed( stream, level ) )
+		{
+			return;
+		}
+	}
+
+	const char* prefix = "";
+	switch (stream)
+	{
+	case Streams::Debug:
+		prefix = TXT( "DEBUG: " );
+		break;
+
+	case Streams::Profile:
+		prefix = TXT( "PROFILE: " );
+		break;
+
+	case Streams::Warning:
+		prefix = TXT( "WARNING: " );
+		break;
+
+	case Streams::Error:
+		prefix = TXT( "ERROR: " );
+		break;
+
+	default:
+		break;
+	}
+
+	// format on the stack, outside of the log mutex
+	char string[MAX_PRINT_SIZE];
+	size_t prefixLength = StringLength( prefix );
+	MemoryCopy( string, prefix, prefixLength );
+	StringFormatArgs( string + prefixLength, MAX_PRINT_SIZE - prefixLength, pFormatString, pArguments, argumentCount );
+
+	PrintString(string, stream, level, Log::GetStreamColor( stream ), stream == Streams::Normal ? -1 : 0);
+}
+
 Log::Heading::Heading(const char *fmt, ...)
 {
 	Helium::MutexScopeLock mutex (g_Mutex);
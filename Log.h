@@ -9,6 +9,11 @@
 #include "Foundation/API.h"
 #include "Foundation/SmartPtr.h"
 #include "Foundation/Event.h"
+#include "Foundation/StringFormat.h"
+
+/// Print a log statement using a compile-time checked format string.
+#define HELIUM_LOG_FORMAT( STREAM, LEVEL, ... ) \
+	do { HELIUM_FORMAT_CHECK( __VA_ARGS__ ); Helium::Log::Format( STREAM, LEVEL, __VA_ARGS__ ); } while( 0 )
 
 namespace Helium
 {
@@ -187,6 +192,11 @@ namespace Helium
 		HELIUM_FOUNDATION_API void Error(const char *fmt,...);
 		HELIUM_FOUNDATION_API void Error(Level level, const char *fmt,...);
 
+		// make a statement using typed formatting (see StringFormat()), skipping formatting if nothing would print it
+		inline void Format(Stream stream, Level level, const char* pFormatString);
+		template< typename... Args > void Format(Stream stream, Level level, const char* pFormatString, const Args&... args);
+		HELIUM_FOUNDATION_API void FormatArgs(Stream stream, Level level, const char* pFormatString, const FormatArgument< char >* pArguments, size_t argumentCount);
+
 		// stack-based indention helper object indents all output while on the stack
 		class HELIUM_FOUNDATION_API Indentation
 		{
@@ -54,4 +54,34 @@ Helium::Log::Indentation::Indentation()
 Helium::Log::Indentation::~Indentation()
 {
     UnIndent();
-}
\ No newline at end of file
+}
+
+/// Print a statement using a typed format string with no arguments.
+///
+/// @param[in] stream         Stream to which to print.
+/// @param[in] level          Verbosity level of the statement.
+/// @param[in] pFormatString  Format string (see StringFormat()).
+///
+/// @see FormatArgs()
+void Helium::Log::Format( Stream stream, Level level, const char* pFormatString )
+{
+    FormatArgs( stream, level, pFormatString, NULL, 0 );
+}
+
+/// Print a statement using a typed format string.
+///
+/// Formatting is skipped entirely if no display or trace file would print the statement.
+///
+/// @param[in] stream         Stream to which to print.
+/// @param[in] level          Verbosity level of the statement.
+/// @param[in] pFormatString  Format string (see StringFormat()).
+/// @param[in] args           Arguments referenced by the format string placeholders.
+///
+/// @see FormatArgs(), HELIUM_LOG_FORMAT()
+template< typename... Args >
+void Helium::Log::Format( Stream stream, Level level, const char* pFormatString, const Args&... args )
+{
+    const FormatArgument< char > arguments[] = { args... };
+
+    FormatArgs( stream, level, pFormatString, arguments, sizeof...( Args ) );
+}
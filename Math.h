@@ -114,6 +114,13 @@ namespace Helium
 	inline size_t Log2( uint32_t value );
 	inline size_t Log2( uint64_t value );
 
+	inline size_t CountTrailingZeros( uint32_t value );
+	inline size_t CountTrailingZeros( uint64_t value );
+	inline size_t CountLeadingZeros( uint32_t value );
+	inline size_t CountLeadingZeros( uint64_t value );
+	inline size_t CountSetBits( uint32_t value );
+	inline size_t CountSetBits( uint64_t value );
+
 	inline float32_t Floor( float32_t value );
 	inline float64_t Floor( float64_t value );
 	inline float32_t Ceil( float32_t value );
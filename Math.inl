@@ -281,6 +281,143 @@ size_t Helium::Log2( uint64_t value )
 #endif
 }
 
+/// Count the number of consecutive zero bits starting from the least significant bit of an unsigned 32-bit integer.
+///
+/// @param[in] value  Unsigned 32-bit integer (must be non-zero).
+///
+/// @return  Index of the lowest set bit.
+///
+/// @see CountLeadingZeros( uint32_t ), CountTrailingZeros( uint64_t )
+size_t Helium::CountTrailingZeros( uint32_t value )
+{
+	HELIUM_ASSERT( value != 0 );
+
+#if HELIUM_CC_CL
+	unsigned long bitIndex = 0;
+	HELIUM_VERIFY( _BitScanForward( &bitIndex, value ) );
+
+	return bitIndex;
+#elif HELIUM_CC_GCC || HELIUM_CC_CLANG
+	return static_cast< size_t >( __builtin_ctz( value ) );
+#else
+#warning Compiling unoptimized CountTrailingZeros() implementation.  Please evaluate the availability of more optimal implementations for the current platform/compiler.
+	size_t bitIndex = 0;
+	while( !( value & 1 ) )
+	{
+		value >>= 1;
+		++bitIndex;
+	}
+
+	return bitIndex;
+#endif
+}
+
+/// Count the number of consecutive zero bits starting from the least significant bit of an unsigned 64-bit integer.
+///
+/// @param[in] value  Unsigned 64-bit integer (must be non-zero).
+///
+/// @return  Index of the lowest set bit.
+///
+/// @see CountLeadingZeros( uint64_t ), CountTrailingZeros( uint32_t )
+size_t Helium::CountTrailingZeros( uint64_t value )
+{
+	HELIUM_ASSERT( value != 0 );
+
+#if HELIUM_CC_CL
+	unsigned long bitIndex = 0;
+
+#if HELIUM_WORDSIZE == 64
+	HELIUM_VERIFY( _BitScanForward64( &bitIndex, value ) );
+#else
+	if( !_BitScanForward( &bitIndex, static_cast< uint32_t >( value ) ) )
+	{
+		HELIUM_VERIFY( _BitScanForward( &bitIndex, static_cast< uint32_t >( value >> 32 ) ) );
+		bitIndex += 32;
+	}
+#endif
+
+	return bitIndex;
+#elif HELIUM_CC_GCC || HELIUM_CC_CLANG
+	return static_cast< size_t >( __builtin_ctzll( static_cast< unsigned long long >( value ) ) );
+#else
+#warning Compiling unoptimized CountTrailingZeros() implementation.  Please evaluate the availability of more optimal implementations for the current platform/compiler.
+	size_t bitIndex = 0;
+	while( !( value & 1 ) )
+	{
+		value >>= 1;
+		++bitIndex;
+	}
+
+	return bitIndex;
+#endif
+}
+
+/// Count the number of consecutive zero bits starting from the most significant bit of an unsigned 32-bit integer.
+///
+/// @param[in] value  Unsigned 32-bit integer (must be non-zero).
+///
+/// @return  Number of leading zero bits.
+///
+/// @see Log2( uint32_t ), CountTrailingZeros( uint32_t )
+size_t Helium::CountLeadingZeros( uint32_t value )
+{
+	return ( 31 - Log2( value ) );
+}
+
+/// Count the number of consecutive zero bits starting from the most significant bit of an unsigned 64-bit integer.
+///
+/// @param[in] value  Unsigned 64-bit integer (must be non-zero).
+///
+/// @return  Number of leading zero bits.
+///
+/// @see Log2( uint64_t ), CountTrailingZeros( uint64_t )
+size_t Helium::CountLeadingZeros( uint64_t value )
+{
+	return ( 63 - Log2( value ) );
+}
+
+/// Count the number of set bits in an unsigned 32-bit integer.
+///
+/// @param[in] value  Unsigned 32-bit integer.
+///
+/// @return  Number of set bits.
+///
+/// @see CountSetBits( uint64_t )
+size_t Helium::CountSetBits( uint32_t value )
+{
+#if HELIUM_CC_GCC || HELIUM_CC_CLANG
+	return static_cast< size_t >( __builtin_popcount( value ) );
+#else
+	// The POPCNT instruction is not guaranteed to be available, so count bits in parallel within the word.
+	value = value - ( ( value >> 1 ) & 0x55555555 );
+	value = ( value & 0x33333333 ) + ( ( value >> 2 ) & 0x33333333 );
+	value = ( value + ( value >> 4 ) ) & 0x0f0f0f0f;
+
+	return static_cast< size_t >( ( value * 0x01010101 ) >> 24 );
+#endif
+}
+
+/// Count the number of set bits in an unsigned 64-bit integer.
+///
+/// @param[in] value  Unsigned 64-bit integer.
+///
+/// @return  Number of set bits.
+///
+/// @see CountSetBits( uint32_t )
+size_t Helium::CountSetBits( uint64_t value )
+{
+#if HELIUM_CC_GCC || HELIUM_CC_CLANG
+	return static_cast< size_t >( __builtin_popcountll( static_cast< unsigned long long >( value ) ) );
+#else
+	// The POPCNT instruction is not guaranteed to be available, so count bits in parallel within the word.
+	value = value - ( ( value >> 1 ) & 0x5555555555555555ULL );
+	value = ( value & 0x3333333333333333ULL ) + ( ( value >> 2 ) & 0x3333333333333333ULL );
+	value = ( value + ( value >> 4 ) ) & 0x0f0f0f0f0f0f0f0fULL;
+
+	return static_cast< size_t >( ( value * 0x0101010101010101ULL ) >> 56 );
+#endif
+}
+
 /// Round a floating-point value down to the largest integral value less than or equal to it.
 ///
 /// @param[in] value  Floating-point value.
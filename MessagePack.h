@@ -2,7 +2,7 @@
 
 #include "Platform/Exception.h"
 
-#include "Foundation/DynamicArray.h"
+#include "Foundation/InlineDynamicArray.h"
 #include "Foundation/Endian.h"
 #include "Foundation/Stream.h"
 #include "Foundation/String.h"
@@ -117,7 +117,7 @@ namespace Helium
 			uint32_t             length;
 			int64_t              lengthOffset;
 		};
-		DynamicArray< ContainerState > containerState;
+		InlineDynamicArray< ContainerState, 8 > containerState;
 	};
 
 	class HELIUM_FOUNDATION_API MessagePackReader
@@ -175,7 +175,7 @@ namespace Helium
 			MessagePackContainer container;
 			uint32_t             length;
 		};
-		DynamicArray< ContainerState > containerState;
+		InlineDynamicArray< ContainerState, 8 > containerState;
 	};
 }
 
@@ -0,0 +1,346 @@
+#include "FoundationPch.h"
+#include "Foundation/MonotonicArena.h"
+
+#include "Platform/Thread.h"
+
+#include "Foundation/Math.h"
+
+using namespace Helium;
+
+/// Arena bound to each thread by the innermost active MonotonicArenaScope.
+static Helium::ThreadLocalPointer g_CurrentArena;
+
+/// Constructor.
+///
+/// No memory is allocated until the first allocation is made from the arena.
+///
+/// @param[in] blockSize  Default size of each memory block, in bytes.
+MonotonicArena::MonotonicArena( size_t blockSize )
+    : m_pFirstBlock( NULL )
+    , m_pCurrentBlock( NULL )
+    , m_currentOffset( 0 )
+    , m_pLastAllocation( NULL )
+    , m_blockSize( blockSize != 0 ? blockSize : DEFAULT_BLOCK_SIZE )
+{
+}
+
+/// Destructor.
+MonotonicArena::~MonotonicArena()
+{
+    HELIUM_ASSERT( GetCurrent() != this );
+
+    Release();
+}
+
+/// Allocate a block of memory with a specific alignment.
+///
+/// @param[in] alignment  Allocation alignment (must be a power of two).
+/// @param[in] size       Number of bytes to allocate.
+///
+/// @return  Base address of the allocation.
+///
+/// @see Allocate(), ReallocateAligned()
+void* MonotonicArena::AllocateAligned( size_t alignment, size_t size )
+{
+    HELIUM_ASSERT( IsPowerOfTwo( alignment ) );
+    alignment = Max( alignment, sizeof( size_t ) );
+
+    void* pMemory = NULL;
+    if( m_pCurrentBlock )
+    {
+        pMemory = AllocateFromBlock( m_pCurrentBlock, m_currentOffset, alignment, size );
+    }
+
+    if( !pMemory )
+    {
+        m_pCurrentBlock = GetNextBlock( alignment, size );
+        m_currentOffset = 0;
+
+        pMemory = AllocateFromBlock( m_pCurrentBlock, m_currentOffset, alignment, size );
+        HELIUM_ASSERT( pMemory );
+    }
+
+    m_pLastAllocation = pMemory;
+
+    return pMemory;
+}
+
+/// Resize an allocation with a specific alignment.
+///
+/// The most recent allocation is resized in place if there is enough room left in its block.  Any other allocation
+/// is copied to a new allocation, and its previous memory is not reclaimed until the arena is reset or rewound.
+///
+/// @param[in] pMemory    Base address of the allocation to resize (can be null).
+/// @param[in] alignment  Allocation alignment (must be a power of two).
+/// @param[in] size       New allocation size, in bytes.
+///
+/// @return  Base address of the resized allocation, or null if the size is zero.
+///
+/// @see Reallocate(), AllocateAligned()
+void* MonotonicArena::ReallocateAligned( void* pMemory, size_t alignment, size_t size )
+{
+    if( !pMemory )
+    {
+        return AllocateAligned( alignment, size );
+    }
+
+    if( size == 0 )
+    {
+        Free( pMemory );
+
+        return NULL;
+    }
+
+    HELIUM_ASSERT( IsPowerOfTwo( alignment ) );
+    alignment = Max( alignment, sizeof( size_t ) );
+
+    size_t* pHeader = static_cast< size_t* >( pMemory ) - 1;
+    if( pMemory == m_pLastAllocation && ( reinterpret_cast< uintptr_t >( pMemory ) & ( alignment - 1 ) ) == 0 )
+    {
+        HELIUM_ASSERT( m_pCurrentBlock );
+        size_t offset = static_cast< size_t >(
+            static_cast< uint8_t* >( pMemory ) - reinterpret_cast< uint8_t* >( m_pCurrentBlock + 1 ) );
+        if( size <= m_pCurrentBlock->size - offset )
+        {
+            *pHeader = size;
+            m_currentOffset = offset + size;
+
+            return pMemory;
+        }
+    }
+
+    size_t previousSize = *pHeader;
+    void* pNewMemory = AllocateAligned( alignment, size );
+    MemoryCopy( pNewMemory, pMemory, Min( previousSize, size ) );
+
+    return pNewMemory;
+}
+
+/// Release an allocation.
+///
+/// Memory is only reclaimed if this is the most recent allocation made from this arena.  Otherwise, the memory remains
+/// in use until the arena is reset or rewound.
+///
+/// @param[in] pMemory  Base address of the allocation to release (can be null).
+///
+/// @see FreeAligned()
+void MonotonicArena::Free( void* pMemory )
+{
+    if( pMemory && pMemory == m_pLastAllocation )
+    {
+        HELIUM_ASSERT( m_pCurrentBlock );
+        m_currentOffset = static_cast< size_t >(
+            reinterpret_cast< uint8_t* >( static_cast< size_t* >( pMemory ) - 1 ) -
+            reinterpret_cast< uint8_t* >( m_pCurrentBlock + 1 ) );
+        m_pLastAllocation = NULL;
+    }
+}
+
+/// Release all memory allocated from this arena.
+///
+/// Memory blocks are kept for reuse by subsequent allocations.
+///
+/// @see Release(), Rewind()
+void MonotonicArena::Reset()
+{
+    m_pCurrentBlock = m_pFirstBlock;
+    m_currentOffset = 0;
+    m_pLastAllocation = NULL;
+}
+
+/// Release all memory allocated from this arena and free all memory blocks.
+///
+/// @see Reset()
+void MonotonicArena::Release()
+{
+    DefaultAllocator allocator;
+
+    Block* pBlock = m_pFirstBlock;
+    while( pBlock )
+    {
+        Block* pNextBlock = pBlock->pNext;
+        allocator.Free( pBlock );
+        pBlock = pNextBlock;
+    }
+
+    m_pFirstBlock = NULL;
+    m_pCurrentBlock = NULL;
+    m_currentOffset = 0;
+    m_pLastAllocation = NULL;
+}
+
+/// Get the current allocation position in this arena.
+///
+/// @return  Marker for the current allocation position.
+///
+/// @see Rewind()
+MonotonicArena::Marker MonotonicArena::GetMarker() const
+{
+    Marker marker;
+    marker.pBlock = m_pCurrentBlock;
+    marker.offset = m_currentOffset;
+
+    return marker;
+}
+
+/// Release all memory allocated from this arena since a marker was retrieved.
+///
+/// Memory blocks are kept for reuse by subsequent allocations.  Markers retrieved after the given marker are no longer
+/// valid once this is called.
+///
+/// @param[in] rMarker  Allocation position to which the arena should be rewound.
+///
+/// @see GetMarker(), Reset()
+void MonotonicArena::Rewind( const Marker& rMarker )
+{
+    if( rMarker.pBlock )
+    {
+        m_pCurrentBlock = static_cast< Block* >( rMarker.pBlock );
+        m_currentOffset = rMarker.offset;
+    }
+    else
+    {
+        // The arena had no blocks when the marker was retrieved.
+        m_pCurrentBlock = m_pFirstBlock;
+        m_currentOffset = 0;
+    }
+
+    m_pLastAllocation = NULL;
+}
+
+/// Get the number of bytes currently allocated from this arena.
+///
+/// This includes allocation headers and alignment padding.
+///
+/// @return  Number of bytes in use.
+///
+/// @see GetReservedSize()
+size_t MonotonicArena::GetUsedSize() const
+{
+    return ( m_pCurrentBlock ? m_pCurrentBlock->precedingUsedSize + m_currentOffset : 0 );
+}
+
+/// Get the number of bytes of memory block space reserved by this arena.
+///
+/// @return  Combined size of all memory blocks.
+///
+/// @see GetUsedSize()
+size_t MonotonicArena::GetReservedSize() const
+{
+    size_t reservedSize = 0;
+    for( const Block* pBlock = m_pFirstBlock; pBlock; pBlock = pBlock->pNext )
+    {
+        reservedSize += pBlock->size;
+    }
+
+    return reservedSize;
+}
+
+/// Get the arena bound to the current thread.
+///
+/// @return  Arena bound by the innermost active MonotonicArenaScope on this thread, or null if no scope is active.
+MonotonicArena* MonotonicArena::GetCurrent()
+{
+    return static_cast< MonotonicArena* >( g_CurrentArena.GetPointer() );
+}
+
+/// Allocate memory from a block.
+///
+/// A size header is stored immediately before the returned address.
+///
+/// @param[in]     pBlock     Block from which to allocate.
+/// @param[in,out] rOffset    Offset of the next free byte in the block, updated to the end of the allocation.
+/// @param[in]     alignment  Allocation alignment (a power of two no smaller than the header size).
+/// @param[in]     size       Number of bytes to allocate.
+///
+/// @return  Base address of the allocation, or null if the block does not have enough room.
+void* MonotonicArena::AllocateFromBlock( Block* pBlock, size_t& rOffset, size_t alignment, size_t size )
+{
+    HELIUM_ASSERT( pBlock );
+
+    uintptr_t blockBase = reinterpret_cast< uintptr_t >( pBlock + 1 );
+    uintptr_t address = Align( blockBase + rOffset + sizeof( size_t ), alignment );
+    size_t offset = static_cast< size_t >( address - blockBase );
+    if( offset > pBlock->size || size > pBlock->size - offset )
+    {
+        return NULL;
+    }
+
+    reinterpret_cast< size_t* >( address )[ -1 ] = size;
+    rOffset = offset + size;
+
+    return reinterpret_cast< void* >( address );
+}
+
+/// Advance to the next memory block with enough room for an allocation.
+///
+/// The block following the current block is reused if it is large enough.  Otherwise, a new block is allocated and
+/// inserted after the current block.
+///
+/// @param[in] alignment  Allocation alignment (a power of two no smaller than the header size).
+/// @param[in] size       Number of bytes to allocate.
+///
+/// @return  Block from which to make the allocation.
+MonotonicArena::Block* MonotonicArena::GetNextBlock( size_t alignment, size_t size )
+{
+    // Reserve enough room for the worst-case header and alignment padding.
+    size_t requiredSize = size + alignment + sizeof( size_t );
+    HELIUM_ASSERT( requiredSize > size );
+
+    size_t precedingUsedSize = GetUsedSize();
+
+    Block* pNextBlock = ( m_pCurrentBlock ? m_pCurrentBlock->pNext : m_pFirstBlock );
+    if( !pNextBlock || pNextBlock->size < requiredSize )
+    {
+        size_t blockSize = Max( m_blockSize, requiredSize );
+        Block* pBlock = static_cast< Block* >( DefaultAllocator().Allocate( sizeof( Block ) + blockSize ) );
+        HELIUM_ASSERT( pBlock );
+        pBlock->pNext = pNextBlock;
+        pBlock->size = blockSize;
+
+        if( m_pCurrentBlock )
+        {
+            m_pCurrentBlock->pNext = pBlock;
+        }
+        else
+        {
+            m_pFirstBlock = pBlock;
+        }
+
+        pNextBlock = pBlock;
+    }
+
+    pNextBlock->precedingUsedSize = precedingUsedSize;
+
+    return pNextBlock;
+}
+
+/// Bind an arena to the current thread.
+///
+/// @param[in] pArena  Arena to bind, or null to unbind the current arena.
+void MonotonicArena::SetCurrent( MonotonicArena* pArena )
+{
+    g_CurrentArena.SetPointer( pArena );
+}
+
+/// Constructor.
+///
+/// @param[in] rArena  Arena to bind to the current thread.
+MonotonicArenaScope::MonotonicArenaScope( MonotonicArena& rArena )
+    : m_rArena( rArena )
+    , m_pPreviousArena( MonotonicArena::GetCurrent() )
+    , m_marker( rArena.GetMarker() )
+{
+    MonotonicArena::SetCurrent( &rArena );
+}
+
+/// Destructor.
+///
+/// Rewinds the arena to its position when this scope began and restores the previously bound arena.
+MonotonicArenaScope::~MonotonicArenaScope()
+{
+    HELIUM_ASSERT( MonotonicArena::GetCurrent() == &m_rArena );
+
+    m_rArena.Rewind( m_marker );
+    MonotonicArena::SetCurrent( m_pPreviousArena );
+}
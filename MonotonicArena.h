@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Platform/Types.h"
+#include "Platform/Utility.h"
+#include "Platform/MemoryHeap.h"
+
+#include "Foundation/API.h"
+
+namespace Helium
+{
+    /// Monotonic (bump pointer) memory arena.
+    ///
+    /// Allocations are carved sequentially out of large memory blocks and are not individually released.  Instead, all
+    /// memory allocated from the arena is released at once by calling Reset(), or rewound to an earlier point using
+    /// GetMarker() and Rewind().  Neither operation frees the underlying blocks, which are kept for reuse, so an arena
+    /// used for per-frame or per-request data stops allocating from the system once it has warmed up.
+    ///
+    /// The arena implements the same Allocate()/Reallocate()/Free() interface as DefaultAllocator.  Free() only
+    /// reclaims memory when releasing the most recent allocation, and Reallocate() resizes the most recent allocation
+    /// in place when possible, which keeps the common case of a single growing container cheap.
+    ///
+    /// Arenas are not thread-safe.  Containers allocate memory from an arena using MonotonicArenaAllocator, which
+    /// uses the arena bound to the current thread by MonotonicArenaScope.
+    class HELIUM_FOUNDATION_API MonotonicArena : NonCopyable
+    {
+    public:
+        /// Default size of each memory block, in bytes.
+        static const size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+        /// Alignment of allocations made without an explicit alignment.
+        static const size_t DEFAULT_ALIGNMENT = 16;
+
+        /// Arena allocation position.
+        struct Marker
+        {
+            /// Block containing the position.
+            void* pBlock;
+            /// Byte offset of the position within the block.
+            size_t offset;
+        };
+
+        /// @name Construction/Destruction
+        //@{
+        explicit MonotonicArena( size_t blockSize = DEFAULT_BLOCK_SIZE );
+        ~MonotonicArena();
+        //@}
+
+        /// @name Allocation Interface
+        //@{
+        inline void* Allocate( size_t size );
+        void* AllocateAligned( size_t alignment, size_t size );
+        inline void* Reallocate( void* pMemory, size_t size );
+        void* ReallocateAligned( void* pMemory, size_t alignment, size_t size );
+        void Free( void* pMemory );
+        inline void FreeAligned( void* pMemory );
+        inline size_t GetMemorySize( void* pMemory );
+        //@}
+
+        /// @name Arena Management
+        //@{
+        void Reset();
+        void Release();
+
+        Marker GetMarker() const;
+        void Rewind( const Marker& rMarker );
+
+        inline size_t GetBlockSize() const;
+        size_t GetUsedSize() const;
+        size_t GetReservedSize() const;
+        //@}
+
+        /// @name Thread Binding
+        //@{
+        static MonotonicArena* GetCurrent();
+        //@}
+
+    private:
+        friend class MonotonicArenaScope;
+
+        /// Memory block header (block memory immediately follows the header).
+        struct Block
+        {
+            /// Next block in the chain.
+            Block* pNext;
+            /// Number of bytes available after the header.
+            size_t size;
+            /// Number of bytes used in all blocks preceding this block in the chain.
+            size_t precedingUsedSize;
+        };
+
+        /// First block in the chain.
+        Block* m_pFirstBlock;
+        /// Block from which memory is currently being allocated.
+        Block* m_pCurrentBlock;
+        /// Byte offset of the next free byte in the current block.
+        size_t m_currentOffset;
+        /// Most recent allocation (the only allocation that can be resized in place or freed).
+        void* m_pLastAllocation;
+        /// Default block size.
+        size_t m_blockSize;
+
+        /// @name Private Utility Functions
+        //@{
+        void* AllocateFromBlock( Block* pBlock, size_t& rOffset, size_t alignment, size_t size );
+        Block* GetNextBlock( size_t alignment, size_t size );
+
+        static void SetCurrent( MonotonicArena* pArena );
+        //@}
+    };
+
+    /// Binds a monotonic arena to the current thread for the lifetime of the scope object.
+    ///
+    /// While the scope is active, MonotonicArenaAllocator allocates from its arena on this thread.  Scopes can be
+    /// nested; the previously bound arena is restored when a scope ends.  When a scope ends, the arena is also rewound
+    /// to the position it had when the scope began, releasing everything allocated within the scope in constant time,
+    /// so any containers using MonotonicArenaAllocator must be destroyed (or cleared of memory) before their scope
+    /// ends.
+    class HELIUM_FOUNDATION_API MonotonicArenaScope : NonCopyable
+    {
+    public:
+        /// @name Construction/Destruction
+        //@{
+        explicit MonotonicArenaScope( MonotonicArena& rArena );
+        ~MonotonicArenaScope();
+        //@}
+
+        /// @name Data Access
+        //@{
+        inline MonotonicArena& GetArena() const;
+        //@}
+
+    private:
+        /// Arena bound by this scope.
+        MonotonicArena& m_rArena;
+        /// Arena bound to the thread prior to this scope.
+        MonotonicArena* m_pPreviousArena;
+        /// Arena position when the scope began.
+        MonotonicArena::Marker m_marker;
+    };
+
+    /// Allocator for containers that allocates memory from the thread's current monotonic arena.
+    ///
+    /// This is a stateless allocator that can be used as the Allocator template parameter of any Foundation container
+    /// (DynamicArray, HashMap, StringBase, and so on).  All allocations are made from the arena bound to the calling
+    /// thread by the innermost active MonotonicArenaScope, and one must be active when memory is allocated.  A
+    /// container that grows while a nested scope is active moves its memory into the nested scope, so containers should
+    /// only be modified within the scope in which they were created.
+    class MonotonicArenaAllocator
+    {
+    public:
+        /// @name Allocation Interface
+        //@{
+        inline void* Allocate( size_t size );
+        inline void* AllocateAligned( size_t alignment, size_t size );
+        inline void* Reallocate( void* pMemory, size_t size );
+        inline void* ReallocateAligned( void* pMemory, size_t alignment, size_t size );
+        inline void Free( void* pMemory );
+        inline void FreeAligned( void* pMemory );
+        inline size_t GetMemorySize( void* pMemory );
+        //@}
+    };
+}
+
+#include "Foundation/MonotonicArena.inl"
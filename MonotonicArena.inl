@@ -0,0 +1,162 @@
+/// Allocate a block of memory with the default alignment.
+///
+/// @param[in] size  Number of bytes to allocate.
+///
+/// @return  Base address of the allocation.
+///
+/// @see AllocateAligned(), Reallocate()
+void* Helium::MonotonicArena::Allocate( size_t size )
+{
+    return AllocateAligned( DEFAULT_ALIGNMENT, size );
+}
+
+/// Resize an allocation, preserving the default alignment.
+///
+/// @param[in] pMemory  Base address of the allocation to resize (can be null).
+/// @param[in] size     New allocation size, in bytes.
+///
+/// @return  Base address of the resized allocation, or null if the size is zero.
+///
+/// @see ReallocateAligned(), Allocate()
+void* Helium::MonotonicArena::Reallocate( void* pMemory, size_t size )
+{
+    return ReallocateAligned( pMemory, DEFAULT_ALIGNMENT, size );
+}
+
+/// Release an aligned allocation.
+///
+/// @param[in] pMemory  Base address of the allocation to release (can be null).
+///
+/// @see Free()
+void Helium::MonotonicArena::FreeAligned( void* pMemory )
+{
+    Free( pMemory );
+}
+
+/// Get the size of an allocation.
+///
+/// @param[in] pMemory  Base address of the allocation.
+///
+/// @return  Size of the allocation in bytes, or zero if the address is null.
+size_t Helium::MonotonicArena::GetMemorySize( void* pMemory )
+{
+    return ( pMemory ? static_cast< const size_t* >( pMemory )[ -1 ] : 0 );
+}
+
+/// Get the size of each memory block allocated by this arena.
+///
+/// Allocations larger than the block size are made from a dedicated block large enough to hold them.
+///
+/// @return  Default block size, in bytes.
+size_t Helium::MonotonicArena::GetBlockSize() const
+{
+    return m_blockSize;
+}
+
+/// Get the arena bound by this scope.
+///
+/// @return  Scope arena.
+Helium::MonotonicArena& Helium::MonotonicArenaScope::GetArena() const
+{
+    return m_rArena;
+}
+
+/// Allocate memory from the current thread's arena.
+///
+/// @param[in] size  Number of bytes to allocate.
+///
+/// @return  Base address of the allocation.
+///
+/// @see MonotonicArena::Allocate()
+void* Helium::MonotonicArenaAllocator::Allocate( size_t size )
+{
+    MonotonicArena* pArena = MonotonicArena::GetCurrent();
+    HELIUM_ASSERT( pArena );
+
+    return pArena->Allocate( size );
+}
+
+/// Allocate aligned memory from the current thread's arena.
+///
+/// @param[in] alignment  Allocation alignment (must be a power of two).
+/// @param[in] size       Number of bytes to allocate.
+///
+/// @return  Base address of the allocation.
+///
+/// @see MonotonicArena::AllocateAligned()
+void* Helium::MonotonicArenaAllocator::AllocateAligned( size_t alignment, size_t size )
+{
+    MonotonicArena* pArena = MonotonicArena::GetCurrent();
+    HELIUM_ASSERT( pArena );
+
+    return pArena->AllocateAligned( alignment, size );
+}
+
+/// Resize an allocation using the current thread's arena.
+///
+/// @param[in] pMemory  Base address of the allocation to resize (can be null).
+/// @param[in] size     New allocation size, in bytes.
+///
+/// @return  Base address of the resized allocation, or null if the size is zero.
+///
+/// @see MonotonicArena::Reallocate()
+void* Helium::MonotonicArenaAllocator::Reallocate( void* pMemory, size_t size )
+{
+    MonotonicArena* pArena = MonotonicArena::GetCurrent();
+    HELIUM_ASSERT( pArena );
+
+    return pArena->Reallocate( pMemory, size );
+}
+
+/// Resize an aligned allocation using the current thread's arena.
+///
+/// @param[in] pMemory    Base address of the allocation to resize (can be null).
+/// @param[in] alignment  Allocation alignment (must be a power of two).
+/// @param[in] size       New allocation size, in bytes.
+///
+/// @return  Base address of the resized allocation, or null if the size is zero.
+///
+/// @see MonotonicArena::ReallocateAligned()
+void* Helium::MonotonicArenaAllocator::ReallocateAligned( void* pMemory, size_t alignment, size_t size )
+{
+    MonotonicArena* pArena = MonotonicArena::GetCurrent();
+    HELIUM_ASSERT( pArena );
+
+    return pArena->ReallocateAligned( pMemory, alignment, size );
+}
+
+/// Release an allocation.
+///
+/// Memory is only reclaimed if the allocation is the most recent allocation made from the current thread's arena.
+///
+/// @param[in] pMemory  Base address of the allocation to release (can be null).
+///
+/// @see MonotonicArena::Free()
+void Helium::MonotonicArenaAllocator::Free( void* pMemory )
+{
+    MonotonicArena* pArena = MonotonicArena::GetCurrent();
+    if( pArena )
+    {
+        pArena->Free( pMemory );
+    }
+}
+
+/// Release an aligned allocation.
+///
+/// @param[in] pMemory  Base address of the allocation to release (can be null).
+///
+/// @see Free()
+void Helium::MonotonicArenaAllocator::FreeAligned( void* pMemory )
+{
+    Free( pMemory );
+}
+
+/// Get the size of an allocation.
+///
+/// @param[in] pMemory  Base address of the allocation.
+///
+/// @return  Size of the allocation in bytes, or zero if the address is null.
+size_t Helium::MonotonicArenaAllocator::GetMemorySize( void* pMemory )
+{
+    return ( pMemory ? static_cast< const size_t* >( pMemory )[ -1 ] : 0 );
+}
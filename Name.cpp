@@ -4,10 +4,16 @@
 
 using namespace Helium;
 
-NameBase< CharNameTable >::TableBucket* CharNameTable::sm_pTable = NULL;
+NameBase< CharNameTable >::Table* volatile CharNameTable::sm_pTable = NULL;
+BiasedReadWriteLock* CharNameTable::sm_pTableLock = NULL;
 StackMemoryHeap<>* CharNameTable::sm_pNameMemoryHeap = NULL;
+SpinLock* CharNameTable::sm_pNameMemoryHeapLock = NULL;
+ThreadLocalPointer* CharNameTable::sm_pThreadBlock = NULL;
 char CharNameTable::sm_emptyString[ 1 ] = { '\0' };
 
-NameBase< WideNameTable >::TableBucket* WideNameTable::sm_pTable = NULL;
+NameBase< WideNameTable >::Table* volatile WideNameTable::sm_pTable = NULL;
+BiasedReadWriteLock* WideNameTable::sm_pTableLock = NULL;
 StackMemoryHeap<>* WideNameTable::sm_pNameMemoryHeap = NULL;
+SpinLock* WideNameTable::sm_pNameMemoryHeapLock = NULL;
+ThreadLocalPointer* WideNameTable::sm_pThreadBlock = NULL;
 wchar_t WideNameTable::sm_emptyString[ 1 ] = { L'\0' };
\ No newline at end of file
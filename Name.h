@@ -4,10 +4,13 @@
 
 #include "Platform/Trace.h"
 #include "Platform/Locks.h"
+#include "Platform/Thread.h"
 
+#include "Foundation/BiasedReadWriteLock.h"
 #include "Foundation/String.h"
 #include "Foundation/StringConverter.h"
 #include "Foundation/HashFunctions.h"
+#include "Foundation/Stream.h"
 
 namespace Helium
 {
@@ -18,6 +21,13 @@ namespace Helium
     };
 
     /// Base support for string table entry types.
+    ///
+    /// Name strings are interned in an open-addressing hash table that can be searched without taking any locks.  Each
+    /// interned string is preceded in memory by a header caching its hash and length, so lookups rarely need to compare
+    /// string contents and the table can be grown without rehashing any strings.  New entries are claimed with an
+    /// atomic compare-exchange on an empty table slot while a read-biased lock is held for shared access (only growing
+    /// the table requires exclusive access), and the memory for new strings is carved out of blocks reserved by each
+    /// thread, so threads interning different names in parallel do not contend with each other.
     template< typename TableType >
     class NameBase
     {
@@ -25,26 +35,105 @@ namespace Helium
         /// Character type.
         typedef typename TableType::CharType CharType;
 
-        /// Number of name hash table buckets (prime numbers are recommended).
-        static const size_t TABLE_BUCKET_COUNT = 37;
+        /// Initial number of name hash table slots (power of two).
+        static const size_t INITIAL_TABLE_CAPACITY = 4096;
         /// Name stack memory heap block size.
         static const size_t STACK_HEAP_BLOCK_SIZE = sizeof( CharType ) * 8192;
+        /// Size of each block of name entry memory reserved by a single thread.
+        static const size_t THREAD_BLOCK_SIZE = STACK_HEAP_BLOCK_SIZE / 4;
+        /// Number of strings hashed and searched together by SetBatch().
+        static const size_t BATCH_BLOCK_SIZE = 16;
 
-        /// Name hash table bucket.
-        class TableBucket
+        /// Name table snapshot signature ("HNMT").
+        static const uint32_t SNAPSHOT_SIGNATURE = 0x544d4e48;
+        /// Name table snapshot format version.
+        static const uint32_t SNAPSHOT_VERSION = 1;
+
+#if HELIUM_WORDSIZE == 64
+        /// String hash (FNV-1a) offset basis.
+        static const size_t HASH_OFFSET_BASIS = static_cast< size_t >( 14695981039346656037ULL );
+        /// String hash (FNV-1a) prime.
+        static const size_t HASH_PRIME = static_cast< size_t >( 1099511628211ULL );
+#else
+        /// String hash (FNV-1a) offset basis.
+        static const size_t HASH_OFFSET_BASIS = static_cast< size_t >( 2166136261U );
+        /// String hash (FNV-1a) prime.
+        static const size_t HASH_PRIME = static_cast< size_t >( 16777619U );
+#endif
+
+        /// String with a precomputed length and hash.
+        ///
+        /// When constructed in a constant expression (i.e. from a string literal), the hash is computed at compile
+        /// time, so setting a name from a literal only needs to perform the table lookup.
+        class Literal
         {
         public:
-            /// @name Access
+            /// @name Construction/Destruction
             //@{
-            const CharType* Find( const CharType* pString, size_t& rEntryCount );
-            const CharType* Add( const CharType* pString, size_t previousEntryCount );
+            constexpr Literal( const CharType* pLiteralString, size_t literalLength );
             //@}
 
-        private:
-            /// Array of name pointers.
-            DynamicArray< const CharType* > m_entries;
-            /// Read-write lock for synchronizing access.
-            ReadWriteLock m_lock;
+            /// String (not necessarily null-terminated).
+            const CharType* pString;
+            /// String length.
+            size_t length;
+            /// String hash.
+            size_t hash;
+        };
+
+        /// Cached name entry information (stored immediately before the string of each name entry).
+        struct EntryHeader
+        {
+            /// String hash.
+            size_t hash;
+            /// String length (not including the null terminator).
+            size_t length;
+        };
+
+        /// Name hash table.
+        struct Table
+        {
+            /// Name entry slots (null if unused).
+            const CharType* volatile* pSlots;
+            /// Number of slots (power of two).
+            size_t capacity;
+            /// Number of slots in use.
+            volatile int32_t entryCount;
+            /// Table that this table replaced (kept until shutdown, as lock-free searches may still be using it).
+            Table* pPreviousTable;
+        };
+
+        /// Name table snapshot header.
+        ///
+        /// A snapshot consists of this header, followed by the table slot index (one size_t per slot, holding the
+        /// offset of the slot's entry within the entry data plus one, or zero for unused slots), followed by the entry
+        /// data (each entry header and null-terminated string, padded to a multiple of the entry header size).
+        /// Snapshots are stored in the native byte order and word size, and can only be loaded by a matching build.
+        struct SnapshotHeader
+        {
+            /// Snapshot signature (SNAPSHOT_SIGNATURE).
+            uint32_t signature;
+            /// Snapshot format version (SNAPSHOT_VERSION).
+            uint32_t version;
+            /// Size of each string character.
+            uint32_t characterSize;
+            /// Size of each slot index and entry header field.
+            uint32_t wordSize;
+            /// Number of entries.
+            uint64_t entryCount;
+            /// Number of table slots.
+            uint64_t capacity;
+            /// Size of the entry data, in bytes.
+            uint64_t entryDataSize;
+        };
+
+        /// Name entry memory block reserved by a single thread.
+        struct ThreadBlock
+        {
+            /// Next free byte in the block.
+            uint8_t* pCurrent;
+            /// End of the block.
+            uint8_t* pEnd;
         };
 
         /// @name Construction/Destruction
@@ -53,14 +142,20 @@ namespace Helium
         NameBase( ENullName );
         explicit NameBase( const CharType* pString );
         explicit NameBase( const StringBase< CharType >& rString );
+        explicit NameBase( const StringView< CharType >& rString );
+        explicit NameBase( const Literal& rLiteral );
         //@}
 
         /// @name Name Access
         //@{
         const CharType* Get() const;
         const CharType* GetDirect() const;
+        size_t GetLength() const;
+        size_t GetHash() const;
         void Set( const CharType* pString );
         void Set( const StringBase< CharType >& rString );
+        void Set( const StringView< CharType >& rString );
+        void Set( const Literal& rLiteral );
 
         bool IsEmpty() const;
         void Clear();
@@ -78,6 +173,17 @@ namespace Helium
         bool operator!=( const NameBase& rName ) const;
         //@}
 
+        /// @name Bulk Name Interning
+        //@{
+        static void SetBatch( NameBase* pNames, const CharType* const* ppStrings, size_t count );
+        //@}
+
+        /// @name Name Table Snapshots
+        //@{
+        static bool SaveSnapshot( Stream& rStream );
+        static bool LoadSnapshot( const void* pData, size_t size );
+        //@}
+
         /// @name Static Initialization
         //@{
         static void Shutdown();
@@ -86,6 +192,25 @@ namespace Helium
     private:
         /// Name entry.
         const CharType* m_pEntry;
+
+        /// @name Private Static Utility Functions
+        //@{
+        static void Initialize();
+        static const CharType* Intern( const CharType* pString, size_t hash, size_t length );
+
+        static size_t HashString( const CharType* pString, size_t& rLength );
+        static size_t HashCharacters( const CharType* pString, size_t length );
+        static constexpr size_t HashLiteral( const CharType* pString, size_t length, size_t hash );
+        static bool EntryMatches( const CharType* pEntry, const CharType* pString, size_t hash, size_t length );
+        static const CharType* FindEntry( const Table* pTable, const CharType* pString, size_t hash, size_t length );
+        static const CharType* InsertEntry(
+            Table* pTable, const CharType* pString, size_t hash, size_t length, bool& rbAdded );
+        static size_t GetEntrySize( size_t length );
+        static CharType* CreateEntry( const CharType* pString, size_t hash, size_t length );
+
+        static Table* CreateTable( size_t capacity );
+        static void GrowTable( Table* pTable, size_t capacity );
+        //@}
     };
 
     /// CharString name table.
@@ -99,9 +224,15 @@ namespace Helium
 
     private:
         /// Name hash table.
-        static NameBase< CharNameTable >::TableBucket* sm_pTable;
+        static NameBase< CharNameTable >::Table* volatile sm_pTable;
+        /// Lock held for shared access when adding name entries and exclusive access when growing the table.
+        static BiasedReadWriteLock* sm_pTableLock;
         /// Stack-based memory heap for name entry allocations.
         static StackMemoryHeap<>* sm_pNameMemoryHeap;
+        /// Lock for synchronizing access to the name memory heap.
+        static SpinLock* sm_pNameMemoryHeapLock;
+        /// Name entry memory block reserved by the current thread.
+        static ThreadLocalPointer* sm_pThreadBlock;
         /// Empty name string.
         static char sm_emptyString[ 1 ];
     };
@@ -120,9 +251,15 @@ namespace Helium
 
     private:
         /// Name hash table.
-        static NameBase< WideNameTable >::TableBucket* sm_pTable;
+        static NameBase< WideNameTable >::Table* volatile sm_pTable;
+        /// Lock held for shared access when adding name entries and exclusive access when growing the table.
+        static BiasedReadWriteLock* sm_pTableLock;
         /// Stack-based memory heap for name entry allocations.
         static StackMemoryHeap<>* sm_pNameMemoryHeap;
+        /// Lock for synchronizing access to the name memory heap.
+        static SpinLock* sm_pNameMemoryHeapLock;
+        /// Name entry memory block reserved by the current thread.
+        static ThreadLocalPointer* sm_pThreadBlock;
         /// Empty name string.
         static wchar_t sm_emptyString[ 1 ];
     };
@@ -140,6 +277,38 @@ namespace Helium
     public:
         inline size_t operator()( const NameBase< TableType >& rKey ) const;
     };
+
+    /// @name Name Literals
+    //@{
+    inline constexpr CharName::Literal operator"" _name( const char* pString, size_t length );
+    inline constexpr WideName::Literal operator"" _name( const wchar_t* pString, size_t length );
+    //@}
 }
 
+/// Get a name for a string literal, resolving the name table entry only once.
+///
+/// The string hash is computed at compile time, and the resulting name is cached in a local static variable, so after
+/// the first evaluation the name costs no more than a pointer load.  Names cached this way must not be used after the
+/// name table has been shut down.  When compiling as C++11, the literal length is limited by the compiler's constexpr
+/// recursion depth (see NameBase::HashLiteral()).
+///
+/// @param[in] NAME_TYPE  Name type (CharName or WideName).
+/// @param[in] STRING     String literal.
+#define HELIUM_NAME_LITERAL_CACHE( NAME_TYPE, STRING ) \
+    ( []() -> const NAME_TYPE& \
+    { \
+        static constexpr NAME_TYPE::Literal literal( STRING, sizeof( STRING ) / sizeof( ( STRING )[ 0 ] ) - 1 ); \
+        static const NAME_TYPE name( literal ); \
+        return name; \
+    }() )
+
+/// Get a Name for a string literal.
+///
+/// @see HELIUM_NAME_LITERAL_CACHE
+#define HELIUM_NAME( STRING ) HELIUM_NAME_LITERAL_CACHE( Helium::Name, STRING )
+/// Get a WideName for a wide string literal.
+///
+/// @see HELIUM_NAME_LITERAL_CACHE
+#define HELIUM_WIDE_NAME( STRING ) HELIUM_NAME_LITERAL_CACHE( Helium::WideName, STRING )
+
 #include "Foundation/Name.inl"
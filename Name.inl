@@ -34,6 +34,24 @@ Helium::NameBase< TableType >::NameBase( const StringBase< CharType >& rString )
     Set( rString );
 }
 
+/// Constructor.
+///
+/// @param[in] rString  String view to which the contents of this name should be initialized.
+template< typename TableType >
+Helium::NameBase< TableType >::NameBase( const StringView< CharType >& rString )
+{
+    Set( rString );
+}
+
+/// Constructor.
+///
+/// @param[in] rLiteral  String (with precomputed hash) to which the contents of this name should be initialized.
+template< typename TableType >
+Helium::NameBase< TableType >::NameBase( const Literal& rLiteral )
+{
+    Set( rLiteral );
+}
+
 /// Get the string contents for this name.
 ///
 /// @return  Null-terminated name string.  Even if this entry is empty, this will never return a null pointer.
@@ -53,6 +71,28 @@ const typename Helium::NameBase< TableType >::CharType* Helium::NameBase< TableT
     return m_pEntry;
 }
 
+/// Get the length of this name.
+///
+/// The length is cached with the name table entry, so this does not need to scan the string.
+///
+/// @return  Number of characters in this name (not including the null terminator).
+template< typename TableType >
+size_t Helium::NameBase< TableType >::GetLength() const
+{
+    return ( m_pEntry ? ( reinterpret_cast< const EntryHeader* >( m_pEntry ) - 1 )->length : 0 );
+}
+
+/// Get the hash of this name's string.
+///
+/// The hash is cached with the name table entry, and matches the hash computed for literals at compile time.
+///
+/// @return  Hash of this name's string, or zero if this name is null.
+template< typename TableType >
+size_t Helium::NameBase< TableType >::GetHash() const
+{
+    return ( m_pEntry ? ( reinterpret_cast< const EntryHeader* >( m_pEntry ) - 1 )->hash : 0 );
+}
+
 /// Set this name.
 ///
 /// @param[in] pString  String to which this name should be set (can be null).
@@ -69,43 +109,65 @@ void Helium::NameBase< TableType >::Set( const CharType* pString )
         return;
     }
 
-    // Lazily initialize the hash table.  Note that this is not inherently thread-safe, but there should always be
-    // at least one name created before any sub-threads are spawned.
-    if( !TableType::sm_pNameMemoryHeap )
-    {
-        TableType::sm_pNameMemoryHeap = new StackMemoryHeap<>( STACK_HEAP_BLOCK_SIZE );
-        HELIUM_ASSERT( TableType::sm_pNameMemoryHeap );
-
-        HELIUM_ASSERT( !TableType::sm_pTable );
-        TableType::sm_pTable = new TableBucket [ TABLE_BUCKET_COUNT ];
-        HELIUM_ASSERT( TableType::sm_pTable );
-    }
-
-    HELIUM_ASSERT( TableType::sm_pTable );
+    size_t length;
+    size_t hash = HashString( pString, length );
+    m_pEntry = Intern( pString, hash, length );
+}
 
-    // Compute the string's hash table index and retrieve the corresponding bucket.
-    uint32_t bucketIndex = StringHash( pString ) % TABLE_BUCKET_COUNT;
-    TableBucket& rBucket = TableType::sm_pTable[ bucketIndex ];
+/// Set this name.
+///
+/// @param[in] rString  String to which this name should be set.
+///
+/// @see Get()
+template< typename TableType >
+void Helium::NameBase< TableType >::Set( const StringBase< CharType >& rString )
+{
+    Set( StringView< CharType >( rString ) );
+}
 
-    // Locate the string in the table.  If it does not exist, add it.
-    size_t entryCount = 0;
-    m_pEntry = rBucket.Find( pString, entryCount );
-    if( !m_pEntry )
+/// Set this name.
+///
+/// The string does not need to be null-terminated, so names can be set directly from pieces of a larger string
+/// without copying them first.
+///
+/// @param[in] rString  String view to which this name should be set.
+///
+/// @see Get()
+template< typename TableType >
+void Helium::NameBase< TableType >::Set( const StringView< CharType >& rString )
+{
+    size_t length = rString.GetSize();
+    if( length == 0 )
     {
-        m_pEntry = rBucket.Add( pString, entryCount );
-        HELIUM_ASSERT( m_pEntry );
+        m_pEntry = NULL;
+
+        return;
     }
+
+    const CharType* pString = rString.GetData();
+    size_t hash = HashCharacters( pString, length );
+    m_pEntry = Intern( pString, hash, length );
 }
 
 /// Set this name.
 ///
-/// @param[in] rString  String to which this name should be set.
+/// This skips hashing the string, using the hash stored with the literal instead.
+///
+/// @param[in] rLiteral  String (with precomputed hash) to which this name should be set.
 ///
 /// @see Get()
 template< typename TableType >
-void Helium::NameBase< TableType >::Set( const StringBase< CharType >& rString )
+void Helium::NameBase< TableType >::Set( const Literal& rLiteral )
 {
-    Set( rString.GetData() );
+    if( rLiteral.length == 0 )
+    {
+        m_pEntry = NULL;
+
+        return;
+    }
+
+    HELIUM_ASSERT( rLiteral.pString );
+    m_pEntry = Intern( rLiteral.pString, rLiteral.hash, rLiteral.length );
 }
 
 /// Get whether this name is empty (null).
@@ -217,103 +279,804 @@ bool Helium::NameBase< TableType >::operator!=( const NameBase& rName ) const
     return ( m_pEntry != rName.m_pEntry );
 }
 
+/// Set an array of names in a single pass.
+///
+/// Strings are processed in small blocks: each block is hashed up front and the table slots it will probe are
+/// prefetched, existing entries are resolved without locking, and any remaining strings are added while holding the
+/// table lock only once for the entire block.  If the table is too small to hold the names it already contains plus the
+/// entire batch, it is grown once before any strings are added.
+///
+/// @param[out] pNames     Array of names to set.
+/// @param[in]  ppStrings  Array of strings to which each name should be set (each can be null).
+/// @param[in]  count      Number of names to set.
+///
+/// @see Set()
+template< typename TableType >
+void Helium::NameBase< TableType >::SetBatch( NameBase* pNames, const CharType* const* ppStrings, size_t count )
+{
+    HELIUM_ASSERT( pNames || count == 0 );
+    HELIUM_ASSERT( ppStrings || count == 0 );
+
+    if( count == 0 )
+    {
+        return;
+    }
+
+    if( !TableType::sm_pNameMemoryHeap )
+    {
+        Initialize();
+    }
+
+    // Make room for the existing names plus the entire batch up front so that a batch of new names does not trigger
+    // a series of table doublings.
+    Table* pTable = TableType::sm_pTable;
+    HELIUM_ASSERT( pTable );
+    size_t requiredCount = static_cast< size_t >( pTable->entryCount ) + count;
+    if( pTable->capacity / 2 < requiredCount )
+    {
+        size_t capacity = pTable->capacity;
+        while( capacity / 2 < requiredCount )
+        {
+            capacity *= 2;
+        }
+
+        GrowTable( pTable, capacity );
+    }
+
+    BiasedReadWriteLock& rTableLock = *TableType::sm_pTableLock;
+
+    size_t hashes[ BATCH_BLOCK_SIZE ];
+    size_t lengths[ BATCH_BLOCK_SIZE ];
+    size_t missIndices[ BATCH_BLOCK_SIZE ];
+
+    for( size_t blockStart = 0; blockStart < count; blockStart += BATCH_BLOCK_SIZE )
+    {
+        size_t blockCount = count - blockStart;
+        if( blockCount > BATCH_BLOCK_SIZE )
+        {
+            blockCount = BATCH_BLOCK_SIZE;
+        }
+
+        const CharType* const* ppBlockStrings = ppStrings + blockStart;
+        NameBase* pBlockNames = pNames + blockStart;
+
+        // Hash the block of strings, prefetching the first slot each search will probe.
+        pTable = TableType::sm_pTable;
+        const CharType* volatile* pSlots = pTable->pSlots;
+        size_t slotMask = pTable->capacity - 1;
+        for( size_t stringIndex = 0; stringIndex < blockCount; ++stringIndex )
+        {
+            const CharType* pString = ppBlockStrings[ stringIndex ];
+            if( !pString || pString[ 0 ] == static_cast< CharType >( 0 ) )
+            {
+                lengths[ stringIndex ] = 0;
+
+                continue;
+            }
+
+            hashes[ stringIndex ] = HashString( pString, lengths[ stringIndex ] );
+            PrefetchHashData( const_cast< const CharType* const* >( pSlots + ( hashes[ stringIndex ] & slotMask ) ) );
+        }
+
+        // Resolve existing entries without locking, collecting the strings that still need to be added.
+        size_t missCount = 0;
+        for( size_t stringIndex = 0; stringIndex < blockCount; ++stringIndex )
+        {
+            if( lengths[ stringIndex ] == 0 )
+            {
+                pBlockNames[ stringIndex ].m_pEntry = NULL;
+
+                continue;
+            }
+
+            const CharType* pEntry = FindEntry(
+                pTable,
+                ppBlockStrings[ stringIndex ],
+                hashes[ stringIndex ],
+                lengths[ stringIndex ] );
+            if( pEntry )
+            {
+                pBlockNames[ stringIndex ].m_pEntry = pEntry;
+            }
+            else
+            {
+                missIndices[ missCount++ ] = stringIndex;
+            }
+        }
+
+        if( missCount == 0 )
+        {
+            continue;
+        }
+
+        // Add the missing entries, preventing the table from being replaced while doing so.
+        size_t readToken = rTableLock.LockRead();
+
+        pTable = TableType::sm_pTable;
+        HELIUM_ASSERT( pTable );
+
+        bool bGrow = false;
+        for( size_t missIndex = 0; missIndex < missCount; ++missIndex )
+        {
+            size_t stringIndex = missIndices[ missIndex ];
+
+            bool bAdded;
+            pBlockNames[ stringIndex ].m_pEntry = InsertEntry(
+                pTable,
+                ppBlockStrings[ stringIndex ],
+                hashes[ stringIndex ],
+                lengths[ stringIndex ],
+                bAdded );
+            if( bAdded &&
+                static_cast< size_t >( AtomicIncrement( pTable->entryCount ) ) > pTable->capacity / 2 )
+            {
+                bGrow = true;
+            }
+        }
+
+        rTableLock.UnlockRead( readToken );
+
+        if( bGrow )
+        {
+            GrowTable( pTable, pTable->capacity * 2 );
+        }
+    }
+}
+
+/// Write the contents of the name table to a stream.
+///
+/// The snapshot can later be passed to LoadSnapshot() (typically by memory-mapping the file to which it was written)
+/// to restore the table without hashing or copying any strings.  Names cannot be added while the snapshot is being
+/// written.
+///
+/// @param[in] rStream  Stream to which the snapshot should be written.
+///
+/// @return  True if the snapshot was written successfully, false if a stream write failed.
+///
+/// @see LoadSnapshot()
+template< typename TableType >
+bool Helium::NameBase< TableType >::SaveSnapshot( Stream& rStream )
+{
+    if( !TableType::sm_pNameMemoryHeap )
+    {
+        Initialize();
+    }
+
+    BiasedReadWriteLock& rTableLock = *TableType::sm_pTableLock;
+    rTableLock.LockWrite();
+
+    const Table* pTable = TableType::sm_pTable;
+    HELIUM_ASSERT( pTable );
+
+    const CharType* volatile* pSlots = pTable->pSlots;
+    size_t capacity = pTable->capacity;
+
+    size_t entryDataSize = 0;
+    for( size_t slotIndex = 0; slotIndex < capacity; ++slotIndex )
+    {
+        const CharType* pEntry = pSlots[ slotIndex ];
+        if( pEntry )
+        {
+            entryDataSize += GetEntrySize( ( reinterpret_cast< const EntryHeader* >( pEntry ) - 1 )->length );
+        }
+    }
+
+    SnapshotHeader header;
+    header.signature = SNAPSHOT_SIGNATURE;
+    header.version = SNAPSHOT_VERSION;
+    header.characterSize = sizeof( CharType );
+    header.wordSize = sizeof( size_t );
+    header.entryCount = static_cast< uint64_t >( pTable->entryCount );
+    header.capacity = capacity;
+    header.entryDataSize = entryDataSize;
+
+    bool bSuccess = ( rStream.Write( &header, sizeof( header ), 1 ) == 1 );
+
+    // Write the slot index, buffering the offsets to avoid a stream call per slot.
+    const size_t offsetBufferSize = 256;
+    size_t offsetBuffer[ offsetBufferSize ];
+    size_t bufferedOffsetCount = 0;
+    size_t entryOffset = 0;
+    for( size_t slotIndex = 0; bSuccess && slotIndex < capacity; ++slotIndex )
+    {
+        size_t slotValue = 0;
+
+        const CharType* pEntry = pSlots[ slotIndex ];
+        if( pEntry )
+        {
+            slotValue = entryOffset + 1;
+            entryOffset += GetEntrySize( ( reinterpret_cast< const EntryHeader* >( pEntry ) - 1 )->length );
+        }
+
+        offsetBuffer[ bufferedOffsetCount++ ] = slotValue;
+        if( bufferedOffsetCount == offsetBufferSize || slotIndex + 1 == capacity )
+        {
+            bSuccess = ( rStream.Write( offsetBuffer, sizeof( size_t ), bufferedOffsetCount ) == bufferedOffsetCount );
+            bufferedOffsetCount = 0;
+        }
+    }
+
+    // Write the entry data in the same order as the slot index.
+    static const uint8_t padding[ sizeof( EntryHeader ) ] = { 0 };
+    for( size_t slotIndex = 0; bSuccess && slotIndex < capacity; ++slotIndex )
+    {
+        const CharType* pEntry = pSlots[ slotIndex ];
+        if( pEntry )
+        {
+            const EntryHeader* pHeader = reinterpret_cast< const EntryHeader* >( pEntry ) - 1;
+            size_t stringSize = sizeof( CharType ) * ( pHeader->length + 1 );
+            size_t paddingSize = GetEntrySize( pHeader->length ) - sizeof( EntryHeader ) - stringSize;
+
+            bSuccess = ( rStream.Write( pHeader, sizeof( EntryHeader ), 1 ) == 1 &&
+                         rStream.Write( pEntry, stringSize, 1 ) == 1 &&
+                         ( paddingSize == 0 || rStream.Write( padding, paddingSize, 1 ) == 1 ) );
+        }
+    }
+
+    rTableLock.UnlockWrite();
+
+    return bSuccess;
+}
+
+/// Restore the name table from a snapshot written by SaveSnapshot().
+///
+/// Name entries are used in place, so restoring a snapshot only requires building the table slot array from the
+/// snapshot's slot index; no strings are hashed, compared, or copied.  The snapshot data is typically a memory-mapped
+/// file, and must remain valid (but can be read-only) until Shutdown() is called.  This must be called before any
+/// names have been set and before any other threads use names.
+///
+/// @param[in] pData  Snapshot data (must be aligned to at least eight bytes).
+/// @param[in] size   Size of the snapshot data, in bytes.
+///
+/// @return  True if the snapshot was loaded, false if it is invalid, was written by an incompatible build, or names
+///          have already been added to the table.
+///
+/// @see SaveSnapshot()
+template< typename TableType >
+bool Helium::NameBase< TableType >::LoadSnapshot( const void* pData, size_t size )
+{
+    HELIUM_ASSERT( pData );
+    HELIUM_ASSERT( ( reinterpret_cast< uintptr_t >( pData ) & ( sizeof( uint64_t ) - 1 ) ) == 0 );
+
+    if( size < sizeof( SnapshotHeader ) )
+    {
+        return false;
+    }
+
+    const SnapshotHeader* pHeader = static_cast< const SnapshotHeader* >( pData );
+    if( pHeader->signature != SNAPSHOT_SIGNATURE ||
+        pHeader->version != SNAPSHOT_VERSION ||
+        pHeader->characterSize != sizeof( CharType ) ||
+        pHeader->wordSize != sizeof( size_t ) )
+    {
+        return false;
+    }
+
+    size_t capacity = static_cast< size_t >( pHeader->capacity );
+    size_t entryDataSize = static_cast< size_t >( pHeader->entryDataSize );
+    if( capacity < INITIAL_TABLE_CAPACITY ||
+        !IsPowerOfTwo( capacity ) ||
+        pHeader->entryCount > capacity / 2 ||
+        capacity > ( size - sizeof( SnapshotHeader ) ) / sizeof( size_t ) ||
+        entryDataSize != size - sizeof( SnapshotHeader ) - sizeof( size_t ) * capacity )
+    {
+        return false;
+    }
+
+    if( !TableType::sm_pNameMemoryHeap )
+    {
+        Initialize();
+    }
+
+    Table* pOldTable = TableType::sm_pTable;
+    HELIUM_ASSERT( pOldTable );
+    if( pOldTable->entryCount != 0 )
+    {
+        return false;
+    }
+
+    const size_t* pSlotIndex = reinterpret_cast< const size_t* >( pHeader + 1 );
+    const uint8_t* pEntryData = reinterpret_cast< const uint8_t* >( pSlotIndex + capacity );
+
+    Table* pTable = CreateTable( capacity );
+    HELIUM_ASSERT( pTable );
+
+    const CharType* volatile* pSlots = pTable->pSlots;
+    size_t entryCount = 0;
+    for( size_t slotIndex = 0; slotIndex < capacity; ++slotIndex )
+    {
+        size_t slotValue = pSlotIndex[ slotIndex ];
+        if( slotValue != 0 )
+        {
+            // Make sure the entry lies within the entry data and is null-terminated before using it.
+            size_t entryOffset = slotValue - 1;
+            bool bValid =
+                ( entryOffset & ( sizeof( size_t ) - 1 ) ) == 0 &&
+                entryDataSize >= sizeof( EntryHeader ) &&
+                entryOffset <= entryDataSize - sizeof( EntryHeader );
+            if( bValid )
+            {
+                const EntryHeader* pEntryHeader = reinterpret_cast< const EntryHeader* >( pEntryData + entryOffset );
+                size_t length = pEntryHeader->length;
+                bValid =
+                    length < ( entryDataSize - entryOffset - sizeof( EntryHeader ) ) / sizeof( CharType ) &&
+                    reinterpret_cast< const CharType* >( pEntryHeader + 1 )[ length ] == static_cast< CharType >( 0 );
+            }
+
+            if( !bValid )
+            {
+                DefaultAllocator().Free( pTable );
+
+                return false;
+            }
+
+            pSlots[ slotIndex ] = reinterpret_cast< const CharType* >( pEntryData + entryOffset + sizeof( EntryHeader ) );
+            ++entryCount;
+        }
+    }
+
+    if( entryCount != pHeader->entryCount )
+    {
+        DefaultAllocator().Free( pTable );
+
+        return false;
+    }
+
+    pTable->entryCount = static_cast< int32_t >( entryCount );
+    pTable->pPreviousTable = pOldTable;
+
+    AtomicExchangeRelease< Table >( TableType::sm_pTable, pTable );
+
+    return true;
+}
+
 /// Release the name table and free all allocated memory.
 ///
-/// This should only be called immediately prior to application exit.
+/// This should only be called immediately prior to application exit, after all other threads that have used names have
+/// exited.
 template< typename TableType >
 void Helium::NameBase< TableType >::Shutdown()
 {
     HELIUM_TRACE( TraceLevels::Info, TXT( "Shutting down Name table.\n" ) );
 
-    delete [] TableType::sm_pTable;
+    DefaultAllocator allocator;
+
+    Table* pTable = TableType::sm_pTable;
+    while( pTable )
+    {
+        Table* pPreviousTable = pTable->pPreviousTable;
+        allocator.Free( pTable );
+        pTable = pPreviousTable;
+    }
+
     TableType::sm_pTable = NULL;
 
+    delete TableType::sm_pTableLock;
+    TableType::sm_pTableLock = NULL;
+
+    delete TableType::sm_pThreadBlock;
+    TableType::sm_pThreadBlock = NULL;
+
+    delete TableType::sm_pNameMemoryHeapLock;
+    TableType::sm_pNameMemoryHeapLock = NULL;
+
     delete TableType::sm_pNameMemoryHeap;
     TableType::sm_pNameMemoryHeap = NULL;
 
     HELIUM_TRACE( TraceLevels::Info, TXT( "Name table shutdown complete.\n" ) );
 }
 
-/// Find an existing string in this table.
+/// Allocate the name table and the name memory heap.
 ///
-/// @param[in]  pString      String to find.
-/// @param[out] rEntryCount  Number of entries in this bucket when the search was performed.
+/// Note that this is not inherently thread-safe, but there should always be at least one name created before any
+/// sub-threads are spawned.
+template< typename TableType >
+void Helium::NameBase< TableType >::Initialize()
+{
+    HELIUM_ASSERT( !TableType::sm_pNameMemoryHeap );
+
+    TableType::sm_pNameMemoryHeap = new StackMemoryHeap<>( STACK_HEAP_BLOCK_SIZE );
+    HELIUM_ASSERT( TableType::sm_pNameMemoryHeap );
+    TableType::sm_pNameMemoryHeapLock = new SpinLock;
+    HELIUM_ASSERT( TableType::sm_pNameMemoryHeapLock );
+    TableType::sm_pThreadBlock = new ThreadLocalPointer;
+    HELIUM_ASSERT( TableType::sm_pThreadBlock );
+
+    HELIUM_ASSERT( !TableType::sm_pTable );
+    TableType::sm_pTableLock = new BiasedReadWriteLock;
+    HELIUM_ASSERT( TableType::sm_pTableLock );
+    TableType::sm_pTable = CreateTable( INITIAL_TABLE_CAPACITY );
+}
+
+/// Locate the name table entry for a string, adding a new entry if one does not already exist.
 ///
-/// @return  Entry string if found, null if not found.
+/// @param[in] pString  String to locate (must not be null or empty).
+/// @param[in] hash     String hash.
+/// @param[in] length   String length.
 ///
-/// @see Add()
+/// @return  Name table entry string.
 template< typename TableType >
-const typename Helium::NameBase< TableType >::CharType* Helium::NameBase< TableType >::TableBucket::Find(
+const typename Helium::NameBase< TableType >::CharType* Helium::NameBase< TableType >::Intern(
     const CharType* pString,
-    size_t& rEntryCount )
+    size_t hash,
+    size_t length )
+{
+    HELIUM_ASSERT( pString );
+    HELIUM_ASSERT( length != 0 );
+
+    // Lazily initialize the hash table.
+    if( !TableType::sm_pNameMemoryHeap )
+    {
+        Initialize();
+    }
+
+    // Search for an existing entry without locking (existing entries are never moved or removed from a table, and old
+    // tables are kept around until shutdown).
+    const CharType* pEntry = FindEntry( TableType::sm_pTable, pString, hash, length );
+    if( pEntry )
+    {
+        return pEntry;
+    }
+
+    // Entry not found, so try to add it while preventing the table from being replaced.
+    BiasedReadWriteLock& rTableLock = *TableType::sm_pTableLock;
+    size_t readToken = rTableLock.LockRead();
+
+    Table* pTable = TableType::sm_pTable;
+    HELIUM_ASSERT( pTable );
+
+    bool bAdded;
+    pEntry = InsertEntry( pTable, pString, hash, length, bAdded );
+
+    // Keep the table at most half full so that probe sequences stay short.
+    bool bGrow = bAdded &&
+        static_cast< size_t >( AtomicIncrement( pTable->entryCount ) ) > pTable->capacity / 2;
+
+    rTableLock.UnlockRead( readToken );
+
+    if( bGrow )
+    {
+        GrowTable( pTable, pTable->capacity * 2 );
+    }
+
+    return pEntry;
+}
+
+/// Compute the hash of a string (FNV-1a), along with its length.
+///
+/// @param[in]  pString  Null-terminated string.
+/// @param[out] rLength  Length of the string (not including the null terminator).
+///
+/// @return  String hash.
+template< typename TableType >
+size_t Helium::NameBase< TableType >::HashString( const CharType* pString, size_t& rLength )
 {
     HELIUM_ASSERT( pString );
 
-    ScopeReadLock readLock( m_lock );
+    size_t hash = HASH_OFFSET_BASIS;
+
+    const CharType* pCharacter = pString;
+    for( ; *pCharacter != static_cast< CharType >( 0 ); ++pCharacter )
+    {
+        hash = ( hash ^ static_cast< size_t >( *pCharacter ) ) * HASH_PRIME;
+    }
+
+    rLength = static_cast< size_t >( pCharacter - pString );
+
+    return hash;
+}
+
+/// Compute the hash of a string of known length (FNV-1a, matching HashString()).
+///
+/// @param[in] pString  String to hash (not necessarily null-terminated).
+/// @param[in] length   Number of characters to hash.
+///
+/// @return  String hash.
+template< typename TableType >
+size_t Helium::NameBase< TableType >::HashCharacters( const CharType* pString, size_t length )
+{
+    HELIUM_ASSERT( pString || length == 0 );
+
+    size_t hash = HASH_OFFSET_BASIS;
+    for( size_t characterIndex = 0; characterIndex < length; ++characterIndex )
+    {
+        hash = ( hash ^ static_cast< size_t >( pString[ characterIndex ] ) ) * HASH_PRIME;
+    }
+
+    return hash;
+}
+
+/// Compute the hash of a string of known length (FNV-1a, matching HashString()).
+///
+/// This can be evaluated at compile time.  When compiled as C++14 or later, it is a simple loop.  C++11 constexpr
+/// functions are limited to a single expression, so it is otherwise written as a recursive expression with one level of
+/// recursion per character, and compile-time hashing of literals longer than the compiler's constexpr recursion limit
+/// (512 by default for GCC and Clang) fails to compile.
+///
+/// @param[in] pString  String to hash.
+/// @param[in] length   Number of characters to hash.
+/// @param[in] hash     Hash of the characters preceding the given string (HASH_OFFSET_BASIS for the full string).
+///
+/// @return  String hash.
+template< typename TableType >
+constexpr size_t Helium::NameBase< TableType >::HashLiteral(
+    const CharType* pString,
+    size_t length,
+    size_t hash )
+{
+#if __cplusplus >= 201402L || ( defined( _MSVC_LANG ) && _MSVC_LANG >= 201402L )
+    for( size_t characterIndex = 0; characterIndex < length; ++characterIndex )
+    {
+        hash = ( hash ^ static_cast< size_t >( pString[ characterIndex ] ) ) * HASH_PRIME;
+    }
+
+    return hash;
+#else
+    return ( length == 0
+        ? hash
+        : HashLiteral( pString + 1, length - 1, ( hash ^ static_cast< size_t >( *pString ) ) * HASH_PRIME ) );
+#endif
+}
+
+/// Check whether a name table entry matches the given string.
+///
+/// @param[in] pEntry   Name table entry string.
+/// @param[in] pString  String to compare.
+/// @param[in] hash     Hash of the string to compare.
+/// @param[in] length   Length of the string to compare.
+///
+/// @return  True if the entry matches the given string, false if not.
+template< typename TableType >
+bool Helium::NameBase< TableType >::EntryMatches(
+    const CharType* pEntry,
+    const CharType* pString,
+    size_t hash,
+    size_t length )
+{
+    HELIUM_ASSERT( pEntry );
+
+    const EntryHeader* pHeader = reinterpret_cast< const EntryHeader* >( pEntry ) - 1;
 
-    const CharType** ppEntries = m_entries.GetData();
-    size_t entryCount = m_entries.GetSize();
-    HELIUM_ASSERT( ppEntries || entryCount == 0 );
+    return ( pHeader->hash == hash && pHeader->length == length &&
+             MemoryCompare( pEntry, pString, sizeof( CharType ) * length ) == 0 );
+}
 
-    rEntryCount = entryCount;
+/// Search a name table for an existing entry for the given string.
+///
+/// @param[in] pTable   Name table to search.
+/// @param[in] pString  String to locate.
+/// @param[in] hash     Hash of the string to locate.
+/// @param[in] length   Length of the string to locate.
+///
+/// @return  Name table entry string if found, null if not found.
+template< typename TableType >
+const typename Helium::NameBase< TableType >::CharType* Helium::NameBase< TableType >::FindEntry(
+    const Table* pTable,
+    const CharType* pString,
+    size_t hash,
+    size_t length )
+{
+    HELIUM_ASSERT( pTable );
 
-    for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+    const CharType* volatile* pSlots = pTable->pSlots;
+    size_t slotMask = pTable->capacity - 1;
+    for( size_t slotIndex = hash & slotMask; ; slotIndex = ( slotIndex + 1 ) & slotMask )
     {
-        const CharType* pEntry = ppEntries[ entryIndex ];
-        if( CompareString( pEntry, pString ) == 0 )
+        const CharType* pEntry = pSlots[ slotIndex ];
+        if( !pEntry )
+        {
+            return NULL;
+        }
+
+        if( EntryMatches( pEntry, pString, hash, length ) )
         {
             return pEntry;
         }
     }
-
-    return NULL;
 }
 
-/// Add a string to this table if it does not already exist.
+/// Add an entry for the given string to a name table, unless another thread has already done so.
 ///
-/// @param[in] pString             String to locate or add.
-/// @param[in] previousEntryCount  Number of entries already checked during a previous Find() call (existing entries
-///                                are not expected to change).  In other words, the entry index from which to start
-///                                checking for any additional string entries that may have been added since the
-///                                previous Find() call.
+/// The table lock must be held for shared access by the caller (so that the table is not replaced while adding the
+/// entry), and the table must not be full.
 ///
-/// @return  Pointer to the string table entry for the string.
+/// @param[in]  pTable   Name table to which the entry should be added.
+/// @param[in]  pString  String to add.
+/// @param[in]  hash     Hash of the string to add.
+/// @param[in]  length   Length of the string to add.
+/// @param[out] rbAdded  Set to true if a new entry was added, false if a matching entry was found.
 ///
-/// @see Find()
+/// @return  Name table entry string.
 template< typename TableType >
-const typename Helium::NameBase< TableType >::CharType* Helium::NameBase< TableType >::TableBucket::Add(
+const typename Helium::NameBase< TableType >::CharType* Helium::NameBase< TableType >::InsertEntry(
+    Table* pTable,
     const CharType* pString,
-    size_t previousEntryCount )
+    size_t hash,
+    size_t length,
+    bool& rbAdded )
 {
-    HELIUM_ASSERT( pString );
+    HELIUM_ASSERT( pTable );
 
-    ScopeWriteLock writeLock( m_lock );
+    const CharType* volatile* pSlots = pTable->pSlots;
+    size_t slotMask = pTable->capacity - 1;
+    size_t slotIndex = hash & slotMask;
 
-    const CharType** ppEntries = m_entries.GetData();
-    size_t entryCount = m_entries.GetSize();
-    HELIUM_ASSERT( ppEntries || entryCount == 0 );
-    HELIUM_ASSERT( previousEntryCount <= entryCount );
-    for( size_t entryIndex = previousEntryCount; entryIndex < entryCount; ++entryIndex )
+    CharType* pNewEntry = NULL;
+    for( ; ; )
     {
-        const CharType* pEntry = ppEntries[ entryIndex ];
-        if( CompareString( pEntry, pString ) == 0 )
+        const CharType* pEntry = pSlots[ slotIndex ];
+        if( !pEntry )
+        {
+            if( !pNewEntry )
+            {
+                pNewEntry = CreateEntry( pString, hash, length );
+            }
+
+            pEntry = AtomicCompareExchangeRelease< const CharType >( pSlots[ slotIndex ], pNewEntry, NULL );
+            if( !pEntry )
+            {
+                rbAdded = true;
+
+                return pNewEntry;
+            }
+        }
+
+        // If another thread added the same string first, the entry we created (if any) is simply left unused.
+        if( EntryMatches( pEntry, pString, hash, length ) )
         {
+            rbAdded = false;
+
             return pEntry;
         }
+
+        slotIndex = ( slotIndex + 1 ) & slotMask;
+    }
+}
+
+/// Get the amount of memory used by a name table entry (including its header).
+///
+/// @param[in] length  Length of the entry string.
+///
+/// @return  Entry size, in bytes.
+template< typename TableType >
+size_t Helium::NameBase< TableType >::GetEntrySize( size_t length )
+{
+    return Align( sizeof( EntryHeader ) + sizeof( CharType ) * ( length + 1 ), sizeof( EntryHeader ) );
+}
+
+/// Allocate and initialize a new name table entry.
+///
+/// Entries are allocated from a block of memory reserved by the calling thread, so only threads that need to reserve
+/// a new block contend on the name memory heap lock.
+///
+/// @param[in] pString  Entry string (does not need to be null-terminated).
+/// @param[in] hash     Hash of the entry string.
+/// @param[in] length   Length of the entry string.
+///
+/// @return  Entry string.
+template< typename TableType >
+typename Helium::NameBase< TableType >::CharType* Helium::NameBase< TableType >::CreateEntry(
+    const CharType* pString,
+    size_t hash,
+    size_t length )
+{
+    size_t entrySize = GetEntrySize( length );
+
+    void* pEntryMemory;
+    if( entrySize > THREAD_BLOCK_SIZE / 4 )
+    {
+        // Allocate large entries directly from the heap instead of wasting the remainder of the current thread block.
+        ScopeLock< SpinLock > heapLock( *TableType::sm_pNameMemoryHeapLock );
+        pEntryMemory = TableType::sm_pNameMemoryHeap->Allocate( entrySize );
     }
+    else
+    {
+        ThreadBlock* pBlock = static_cast< ThreadBlock* >( TableType::sm_pThreadBlock->GetPointer() );
+        if( !pBlock || static_cast< size_t >( pBlock->pEnd - pBlock->pCurrent ) < entrySize )
+        {
+            {
+                ScopeLock< SpinLock > heapLock( *TableType::sm_pNameMemoryHeapLock );
+                pBlock = static_cast< ThreadBlock* >( TableType::sm_pNameMemoryHeap->Allocate( THREAD_BLOCK_SIZE ) );
+            }
 
-    size_t newEntryAllocSize = sizeof( CharType ) * ( StringLength( pString ) + 1 );
+            HELIUM_ASSERT( pBlock );
+            pBlock->pCurrent = reinterpret_cast< uint8_t* >( pBlock ) + Align( sizeof( ThreadBlock ), sizeof( EntryHeader ) );
+            pBlock->pEnd = reinterpret_cast< uint8_t* >( pBlock ) + THREAD_BLOCK_SIZE;
 
-    HELIUM_ASSERT( TableType::sm_pNameMemoryHeap );
-    CharType* pEntry = static_cast< CharType* >( TableType::sm_pNameMemoryHeap->Allocate( newEntryAllocSize ) );
-    HELIUM_ASSERT( pEntry );
-    MemoryCopy( pEntry, pString, newEntryAllocSize );
+            TableType::sm_pThreadBlock->SetPointer( pBlock );
+        }
+
+        pEntryMemory = pBlock->pCurrent;
+        pBlock->pCurrent += entrySize;
+    }
+
+    HELIUM_ASSERT( pEntryMemory );
 
-    m_entries.Push( pEntry );
+    EntryHeader* pHeader = static_cast< EntryHeader* >( pEntryMemory );
+    pHeader->hash = hash;
+    pHeader->length = length;
+
+    CharType* pEntry = reinterpret_cast< CharType* >( pHeader + 1 );
+    MemoryCopy( pEntry, pString, sizeof( CharType ) * length );
+    pEntry[ length ] = 0;
 
     return pEntry;
 }
 
+/// Allocate a new, empty name table.
+///
+/// @param[in] capacity  Number of table slots (must be a power of two).
+///
+/// @return  Newly allocated table.
+template< typename TableType >
+typename Helium::NameBase< TableType >::Table* Helium::NameBase< TableType >::CreateTable( size_t capacity )
+{
+    HELIUM_ASSERT( IsPowerOfTwo( capacity ) );
+
+    size_t slotOffset = Align( sizeof( Table ), sizeof( void* ) );
+    size_t slotArraySize = sizeof( const CharType* ) * capacity;
+
+    DefaultAllocator allocator;
+    void* pTableMemory = allocator.Allocate( slotOffset + slotArraySize );
+    HELIUM_ASSERT( pTableMemory );
+
+    Table* pTable = static_cast< Table* >( pTableMemory );
+    pTable->pSlots = reinterpret_cast< const CharType* volatile* >( static_cast< uint8_t* >( pTableMemory ) + slotOffset );
+    pTable->capacity = capacity;
+    pTable->entryCount = 0;
+    pTable->pPreviousTable = NULL;
+    MemoryZero( const_cast< const CharType** >( pTable->pSlots ), slotArraySize );
+
+    return pTable;
+}
+
+/// Replace the given name table with a larger one, unless another thread has already done so.
+///
+/// Entries are reinserted using their cached hashes, so no strings need to be rehashed or compared.
+///
+/// @param[in] pTable    Table that was found to be over its maximum load.
+/// @param[in] capacity  Number of slots in the new table (must be a power of two).
+template< typename TableType >
+void Helium::NameBase< TableType >::GrowTable( Table* pTable, size_t capacity )
+{
+    BiasedReadWriteLock& rTableLock = *TableType::sm_pTableLock;
+    rTableLock.LockWrite();
+
+    if( TableType::sm_pTable == pTable && capacity > pTable->capacity )
+    {
+        Table* pNewTable = CreateTable( capacity );
+        HELIUM_ASSERT( pNewTable );
+
+        const CharType* volatile* pNewSlots = pNewTable->pSlots;
+        size_t newSlotMask = pNewTable->capacity - 1;
+
+        const CharType* volatile* pSlots = pTable->pSlots;
+        size_t oldCapacity = pTable->capacity;
+        for( size_t slotIndex = 0; slotIndex < oldCapacity; ++slotIndex )
+        {
+            const CharType* pEntry = pSlots[ slotIndex ];
+            if( pEntry )
+            {
+                size_t newSlotIndex = ( reinterpret_cast< const EntryHeader* >( pEntry ) - 1 )->hash & newSlotMask;
+                while( pNewSlots[ newSlotIndex ] )
+                {
+                    newSlotIndex = ( newSlotIndex + 1 ) & newSlotMask;
+                }
+
+                pNewSlots[ newSlotIndex ] = pEntry;
+            }
+        }
+
+        pNewTable->entryCount = pTable->entryCount;
+        pNewTable->pPreviousTable = pTable;
+
+        // Publish the new table (the exchange ensures the table contents are visible before the table pointer).
+        AtomicExchangeRelease< Table >( TableType::sm_pTable, pNewTable );
+    }
+
+    rTableLock.UnlockWrite();
+}
+
 /// Default Name hash.
 ///
 /// @param[in] rKey  Key for which to compute a hash value.
@@ -322,6 +1085,42 @@ const typename Helium::NameBase< TableType >::CharType* Helium::NameBase< TableT
 template< typename TableType >
 size_t Helium::Hash< Helium::NameBase< TableType > >::operator()( const NameBase< TableType >& rKey ) const
 {
-    // Each name entry has a unique name pointer, so we can use the pointer itself as our hash.
-    return static_cast< size_t >( reinterpret_cast< uintptr_t >( rKey.GetDirect() ) );
+    // Use the string hash cached with the name entry, which is stable across runs (unlike the entry address).
+    return rKey.GetHash();
+}
+
+/// Constructor.
+///
+/// @param[in] pLiteralString  String (not necessarily null-terminated).
+/// @param[in] literalLength   String length.
+template< typename TableType >
+constexpr Helium::NameBase< TableType >::Literal::Literal(
+    const CharType* pLiteralString,
+    size_t literalLength )
+    : pString( pLiteralString )
+    , length( literalLength )
+    , hash( HashLiteral( pLiteralString, literalLength, HASH_OFFSET_BASIS ) )
+{
+}
+
+/// Create a Name literal ("string"_name), hashing the string at compile time when used in a constant expression.
+///
+/// @param[in] pString  String literal.
+/// @param[in] length   String length.
+///
+/// @return  Name literal.
+inline constexpr Helium::CharName::Literal Helium::operator"" _name( const char* pString, size_t length )
+{
+    return CharName::Literal( pString, length );
+}
+
+/// Create a WideName literal (L"string"_name), hashing the string at compile time when used in a constant expression.
+///
+/// @param[in] pString  String literal.
+/// @param[in] length   String length.
+///
+/// @return  WideName literal.
+inline constexpr Helium::WideName::Literal Helium::operator"" _name( const wchar_t* pString, size_t length )
+{
+    return WideName::Literal( pString, length );
 }
@@ -0,0 +1,70 @@
+#include "FoundationPch.h"
+#include "Foundation/ObjectPool.h"
+
+using namespace Helium;
+
+/// List of the object pool thread caches assigned to a thread, flushed when the thread exits.
+struct ObjectPoolThreadCacheList
+{
+    /// First cache in the list.
+    ObjectPoolThreadCacheHeader* pHead;
+
+    /// Destructor.
+    ///
+    /// This is called when the owning thread exits, and flushes each cache still in the list.
+    ~ObjectPoolThreadCacheList()
+    {
+        while( pHead )
+        {
+            ObjectPoolThreadCacheHeader* pCache = pHead;
+            pHead = pCache->pNextThreadCache;
+            pCache->pNextThreadCache = NULL;
+
+            HELIUM_ASSERT( pCache->pThreadExitFunction );
+            pCache->pThreadExitFunction( pCache );
+        }
+    }
+};
+
+/// Thread caches assigned to the calling thread.
+static thread_local ObjectPoolThreadCacheList g_ThreadCaches;
+
+/// Register an object pool thread cache to be flushed when the calling thread exits.
+///
+/// @param[in] pCache  Thread cache assigned to the calling thread.
+///
+/// @see UnregisterObjectPoolThreadCache()
+void Helium::RegisterObjectPoolThreadCache( ObjectPoolThreadCacheHeader* pCache )
+{
+    HELIUM_ASSERT( pCache );
+
+    pCache->pNextThreadCache = g_ThreadCaches.pHead;
+    g_ThreadCaches.pHead = pCache;
+}
+
+/// Remove an object pool thread cache from the list of caches to flush when the calling thread exits.
+///
+/// @param[in] pCache  Thread cache previously registered by the calling thread.
+///
+/// @see RegisterObjectPoolThreadCache()
+void Helium::UnregisterObjectPoolThreadCache( ObjectPoolThreadCacheHeader* pCache )
+{
+    HELIUM_ASSERT( pCache );
+
+    // Threads rarely use more than a handful of pools, so a linear search is fine.
+    ObjectPoolThreadCacheHeader** ppLink = &g_ThreadCaches.pHead;
+    while( *ppLink )
+    {
+        if( *ppLink == pCache )
+        {
+            *ppLink = pCache->pNextThreadCache;
+            pCache->pNextThreadCache = NULL;
+
+            return;
+        }
+
+        ppLink = &( *ppLink )->pNextThreadCache;
+    }
+
+    HELIUM_BREAK_MSG( TXT( "Object pool thread cache not registered with the calling thread" ) );
+}
@@ -1,24 +1,56 @@
 #pragma once
 
+#include "Platform/Atomic.h"
 #include "Platform/Locks.h"
+#include "Platform/Thread.h"
 
 #include "Foundation/API.h"
 #include "Foundation/Math.h"
 
 namespace Helium
 {
+    /// Fields shared by the thread caches of every ObjectPool type, used to flush each cache when its thread exits.
+    struct ObjectPoolThreadCacheHeader
+    {
+        /// Function called from the owning thread when it exits.
+        void ( *pThreadExitFunction )( ObjectPoolThreadCacheHeader* pCache );
+        /// Next cache registered by the same thread.
+        ObjectPoolThreadCacheHeader* pNextThreadCache;
+        /// Cache state (managed by the owning ObjectPool).
+        volatile int32_t state;
+    };
+
+    /// @defgroup objectpoolthreadexit ObjectPool Thread Exit Support
+    //@{
+    HELIUM_FOUNDATION_API void RegisterObjectPoolThreadCache( ObjectPoolThreadCacheHeader* pCache );
+    HELIUM_FOUNDATION_API void UnregisterObjectPoolThreadCache( ObjectPoolThreadCacheHeader* pCache );
+    //@}
+
     /// Thread-safe object allocation pool.
     ///
     /// This provides a mechanism for managing a pool from which objects of a single type can be created and destroyed.
     /// Objects are allocated in blocks, and released objects are never destroyed until the pool itself is destroyed.
-    /// Synchronization of object requests and releases is handled using a spin lock in order to attempt to minimize the
-    /// overhead of allocating an object.  Synchronization with block allocation is performed using a read-write lock;
-    /// allocation and release calls always acquire a non-exclusive read-only lock, while an exclusive write lock is
-    /// acquired when the pool is empty and a new block needs to be allocated.
+    ///
+    /// Each thread keeps a small cache of free objects, so most allocation and release calls do not touch any shared
+    /// state.  When a thread's cache runs empty or overflows, objects are exchanged with a shared depot in batches
+    /// ("magazines") of MAGAZINE_SIZE objects.  The depot is a lock-free list of magazines, so threads only ever
+    /// block when the pool is empty and a new block needs to be allocated, which is synchronized using a read-write
+    /// lock (also acquired in read-only mode by GetIndex() and GetObject()).
+    ///
+    /// Objects held in a thread's cache are not available to other threads, so Allocate() can fail on a pool with a
+    /// block limit while other threads still hold cached objects.  When a thread exits, its cache is flushed
+    /// automatically, returning any cached objects to the depot and leaving the cache record to be adopted by the next
+    /// thread that uses the pool.  FlushThreadCache() does the same immediately, for threads that are done with a pool
+    /// but keep running.
     template< typename T, typename Allocator = DefaultAllocator >
     class ObjectPool : NonCopyable
     {
     public:
+        /// Number of objects exchanged between a thread cache and the shared depot at a time.
+        static const size_t MAGAZINE_SIZE = 32;
+        /// Maximum number of free objects held in each thread's cache.
+        static const size_t THREAD_CACHE_SIZE = MAGAZINE_SIZE * 2;
+
         /// @name Construction/Destruction
         //@{
         ObjectPool( size_t blockSize, size_t blockCountMax = Invalid< size_t >() );
@@ -29,6 +61,8 @@ namespace Helium
         //@{
         T* Allocate();
         void Release( T* pObject );
+
+        void FlushThreadCache();
         //@}
 
         /// @name Indexing
@@ -47,12 +81,61 @@ namespace Helium
             Block* pNext;
         };
 
-        /// Free object list.
-        T* volatile * volatile m_ppFreeObjects;
-        /// Free object count.
-        volatile size_t m_freeObjectCount;
-        /// Free object list spin lock.
-        SpinLock m_freeObjectSpinLock;
+        /// Batch of free objects in the shared depot.
+        struct Magazine
+        {
+            /// Next magazine in the list.
+            Magazine* pNext;
+            /// Number of objects in this magazine.
+            size_t objectCount;
+            /// Free objects.
+            T* pObjects[ MAGAZINE_SIZE ];
+        };
+
+        /// Lock-free magazine list.
+        ///
+        /// Magazines are pushed using a compare-and-swap on the list head.  Magazines are popped by detaching the
+        /// entire list with an atomic exchange and pushing back the remainder, which avoids the ABA problem of popping
+        /// a single node with a compare-and-swap.
+        struct MagazineList
+        {
+            /// First magazine in the list.
+            Magazine* volatile pHead;
+            /// Number of pop operations in progress (during which the list may appear empty).
+            volatile int32_t popCount;
+        };
+
+        /// Thread cache states.
+        enum ECacheState
+        {
+            CACHE_STATE_FREE,      ///< Not assigned to a thread, and available for adoption.
+            CACHE_STATE_IN_USE,    ///< Assigned to a thread.
+            CACHE_STATE_EXITING,   ///< Being flushed by its exiting thread.
+            CACHE_STATE_ORPHANED,  ///< Pool destroyed while assigned to a thread, to be freed when the thread exits.
+        };
+
+        /// Per-thread cache of free objects.
+        struct ThreadCache : ObjectPoolThreadCacheHeader
+        {
+            /// Pool to which this cache belongs.
+            ObjectPool* pPool;
+            /// Next thread cache created for this pool.
+            ThreadCache* pNext;
+            /// Number of free objects in this cache.
+            size_t objectCount;
+            /// Free objects.
+            T* pObjects[ THREAD_CACHE_SIZE ];
+        };
+
+        /// Magazines filled with free objects.
+        MagazineList m_fullMagazines;
+        /// Empty magazines available for reuse.
+        MagazineList m_emptyMagazines;
+
+        /// Thread cache for the current thread.
+        ThreadLocalPointer m_threadCache;
+        /// List of all thread caches created for this pool (including flushed caches available for adoption).
+        ThreadCache* volatile m_pThreadCaches;
 
         /// Read-write lock for synchronizing with block allocations.
         mutable ReadWriteLock m_poolBlockAllocationLock;
@@ -69,7 +152,20 @@ namespace Helium
 
         /// @name Utility Functions
         //@{
-        void AllocateBlock();
+        T* AllocateSlow( ThreadCache* pCache );
+        void AllocateBlock( ThreadCache* pCache );
+
+        ThreadCache* GetThreadCache();
+        bool RefillThreadCache( ThreadCache* pCache );
+        void DrainThreadCache( ThreadCache* pCache );
+        void EmptyThreadCache( ThreadCache* pCache );
+        Magazine* GetEmptyMagazine();
+
+        static void OnThreadExit( ObjectPoolThreadCacheHeader* pCache );
+
+        static void PushMagazine( MagazineList& rList, Magazine* pMagazine );
+        static Magazine* PopMagazine( MagazineList& rList );
+        static void FreeMagazines( MagazineList& rList );
         //@}
     };
 }
@@ -6,17 +6,20 @@
 ///                           allocated.
 template< typename T, typename Allocator >
 Helium::ObjectPool< T, Allocator >::ObjectPool( size_t blockSize, size_t blockCountMax )
-    : m_ppFreeObjects( NULL )
-    , m_freeObjectCount( 0 )
+    : m_pThreadCaches( NULL )
     , m_pHeadBlock( NULL )
     , m_blockSize( Max< size_t >( blockSize, 1 ) )
     , m_allocatedBlockCount( 0 )
     , m_blockCountMax( Max< size_t >( blockCountMax, 1 ) )
 {
-    // Allocate the initial block.
-    AllocateBlock();
-    HELIUM_ASSERT( m_ppFreeObjects );
-    HELIUM_ASSERT( m_freeObjectCount == m_blockSize );
+    m_fullMagazines.pHead = NULL;
+    m_fullMagazines.popCount = 0;
+    m_emptyMagazines.pHead = NULL;
+    m_emptyMagazines.popCount = 0;
+
+    // Allocate the initial block, placing all of its objects in the shared depot.
+    AllocateBlock( NULL );
+    HELIUM_ASSERT( m_fullMagazines.pHead );
     HELIUM_ASSERT( m_pHeadBlock );
     HELIUM_ASSERT( m_allocatedBlockCount == 1 );
 }
@@ -25,10 +28,33 @@ Helium::ObjectPool< T, Allocator >::ObjectPool( size_t blockSize, size_t blockCo
 template< typename T, typename Allocator >
 Helium::ObjectPool< T, Allocator >::~ObjectPool()
 {
-    // Blocks are allocated as part of the object array associated with them, so we only need to free the buffer
-    // addresses.
     Allocator allocator;
 
+    // Free the thread caches first, as threads that are exiting may still be flushing their caches into the depot.
+    // Caches still assigned to running threads are left for those threads to free when they exit.
+    ThreadCache* pNextCache = m_pThreadCaches;
+    while( pNextCache )
+    {
+        ThreadCache* pCache = pNextCache;
+        pNextCache = pNextCache->pNext;
+
+        int32_t state;
+        while( ( state = AtomicCompareExchangeAcquire(
+            pCache->state,
+            static_cast< int32_t >( CACHE_STATE_ORPHANED ),
+            static_cast< int32_t >( CACHE_STATE_IN_USE ) ) ) == CACHE_STATE_EXITING )
+        {
+            Thread::Yield();
+        }
+
+        if( state == CACHE_STATE_FREE )
+        {
+            allocator.Free( pCache );
+        }
+    }
+
+    // Blocks are allocated as part of the object array associated with them, so we only need to free the buffer
+    // addresses.
     Block* pNextBlock = m_pHeadBlock;
     while( pNextBlock )
     {
@@ -40,8 +66,9 @@ Helium::ObjectPool< T, Allocator >::~ObjectPool()
         allocator.FreeAligned( pObjects );
     }
 
-    // Free the free object pool array.
-    allocator.Free( const_cast< T** >( m_ppFreeObjects ) );
+    // Free the free object magazines.
+    FreeMagazines( m_fullMagazines );
+    FreeMagazines( m_emptyMagazines );
 }
 
 /// Allocate an object from this pool.
@@ -53,66 +80,22 @@ Helium::ObjectPool< T, Allocator >::~ObjectPool()
 template< typename T, typename Allocator >
 T* Helium::ObjectPool< T, Allocator >::Allocate()
 {
-    {
-        // Acquire a reader lock on the pool to synchronize block allocations.
-        ScopeReadLock readLock( m_poolBlockAllocationLock );
-
-        // Synchronize access to the free object list.
-        ScopeLock< SpinLock > scopeLock( m_freeObjectSpinLock );
-
-        size_t freeObjectCount = m_freeObjectCount;
-        if( freeObjectCount != 0 )
-        {
-            // An object is in the free list, so grab it, release all locks, and return it.
-            --freeObjectCount;
-
-            T* pObject = m_ppFreeObjects[ freeObjectCount ];
-            HELIUM_ASSERT( pObject );
-
-            m_freeObjectCount = freeObjectCount;
+    ThreadCache* pCache = GetThreadCache();
+    HELIUM_ASSERT( pCache );
 
-            return pObject;
-        }
-    }
-
-    // Acquire a heavy-weight lock for checking for and allocating new blocks.
-    ScopeWriteLock writeLock( m_poolBlockAllocationLock );
-
-    // Check if the free list is still empty (in case another thread managed to release an object or lock and
-    // allocate a new block before we could acquire the write lock.
-    size_t freeObjectCount = m_freeObjectCount;
-    if( freeObjectCount != 0 )
+    size_t objectCount = pCache->objectCount;
+    if( objectCount != 0 )
     {
-        // Free list is no longer empty, so grab an object normally.
-        --freeObjectCount;
+        --objectCount;
+        pCache->objectCount = objectCount;
 
-        T* pObject = m_ppFreeObjects[ freeObjectCount ];
+        T* pObject = pCache->pObjects[ objectCount ];
         HELIUM_ASSERT( pObject );
 
-        m_freeObjectCount = freeObjectCount;
-
         return pObject;
     }
 
-    // Free list is still empty, so attempt to allocate a new block if possible.
-    if( m_allocatedBlockCount == m_blockCountMax )
-    {
-        // Out of blocks that we can allocate.
-        return NULL;
-    }
-
-    AllocateBlock();
-
-    freeObjectCount = m_freeObjectCount;
-    HELIUM_ASSERT( freeObjectCount != 0 );
-    --freeObjectCount;
-
-    T* pObject = m_ppFreeObjects[ freeObjectCount ];
-    HELIUM_ASSERT( pObject );
-
-    m_freeObjectCount = freeObjectCount;
-
-    return pObject;
+    return AllocateSlow( pCache );
 }
 
 /// Release an object previously retrieved using Allocate() back into this pool.
@@ -125,22 +108,42 @@ void Helium::ObjectPool< T, Allocator >::Release( T* pObject )
 {
     HELIUM_ASSERT( pObject );
 
-    // Acquire a reader lock on the pool to synchronize block allocations.
-    ScopeReadLock readLock( m_poolBlockAllocationLock );
+    ThreadCache* pCache = GetThreadCache();
+    HELIUM_ASSERT( pCache );
+
+    if( pCache->objectCount == THREAD_CACHE_SIZE )
+    {
+        DrainThreadCache( pCache );
+    }
 
-    // Synchronize access to the free object list.
-    ScopeLock< SpinLock > scopeLock( m_freeObjectSpinLock );
+    pCache->pObjects[ pCache->objectCount ] = pObject;
+    ++pCache->objectCount;
+}
 
-    // Release the object to the pool.
-    size_t freeObjectCount = m_freeObjectCount;
+/// Return all objects cached by the calling thread to the shared depot and release its cache for use by other
+/// threads.
+///
+/// This is done automatically when a thread exits, but can be called by a thread that is done with this pool and
+/// keeps running.  If the thread uses the pool again afterward, it is simply assigned a cache again.
+///
+/// @see Allocate(), Release()
+template< typename T, typename Allocator >
+void Helium::ObjectPool< T, Allocator >::FlushThreadCache()
+{
+    ThreadCache* pCache = static_cast< ThreadCache* >( m_threadCache.GetPointer() );
+    if( !pCache )
+    {
+        return;
+    }
 
-    HELIUM_ASSERT( m_ppFreeObjects );
-    m_ppFreeObjects[ freeObjectCount ] = pObject;
-    ++freeObjectCount;
+    m_threadCache.SetPointer( NULL );
+    UnregisterObjectPoolThreadCache( pCache );
 
-    HELIUM_ASSERT( freeObjectCount <= m_blockSize * m_allocatedBlockCount );
+    EmptyThreadCache( pCache );
+    HELIUM_ASSERT( pCache->objectCount == 0 );
 
-    m_freeObjectCount = freeObjectCount;
+    // Make the cache available for adoption by another thread.
+    AtomicExchangeRelease( pCache->state, static_cast< int32_t >( CACHE_STATE_FREE ) );
 }
 
 /// Get a unique index associated with the given object
@@ -208,9 +211,68 @@ T* Helium::ObjectPool< T, Allocator >::GetObject( size_t index ) const
     return NULL;
 }
 
+/// Allocate an object when the calling thread's cache is empty.
+///
+/// @param[in] pCache  Cache for the calling thread.
+///
+/// @return  Pointer to an object instance if one could be retrieved, null if the pool is empty and no more blocks
+///          can be allocated.
+template< typename T, typename Allocator >
+T* Helium::ObjectPool< T, Allocator >::AllocateSlow( ThreadCache* pCache )
+{
+    HELIUM_ASSERT( pCache );
+    HELIUM_ASSERT( pCache->objectCount == 0 );
+
+    if( !RefillThreadCache( pCache ) )
+    {
+        // Acquire a heavy-weight lock for checking for and allocating new blocks.
+        ScopeWriteLock writeLock( m_poolBlockAllocationLock );
+
+        // Check if the depot is still empty (in case another thread managed to release objects or allocate a new block
+        // before we could acquire the write lock).  Other threads popping from the depot detach its contents for a
+        // short time, so wait for them to finish before deciding that the depot is really empty.
+        for( ; ; )
+        {
+            if( RefillThreadCache( pCache ) )
+            {
+                break;
+            }
+
+            if( m_fullMagazines.popCount == 0 && !m_fullMagazines.pHead )
+            {
+                // Depot is still empty, so attempt to allocate a new block if possible.
+                if( m_allocatedBlockCount == m_blockCountMax )
+                {
+                    // Out of blocks that we can allocate.
+                    return NULL;
+                }
+
+                AllocateBlock( pCache );
+
+                break;
+            }
+
+            Thread::Yield();
+        }
+    }
+
+    size_t objectCount = pCache->objectCount;
+    HELIUM_ASSERT( objectCount != 0 );
+    --objectCount;
+    pCache->objectCount = objectCount;
+
+    T* pObject = pCache->pObjects[ objectCount ];
+    HELIUM_ASSERT( pObject );
+
+    return pObject;
+}
+
 /// Allocate a new block of objects.  Assumes any necessary locks are in place.
+///
+/// @param[in] pCache  If not null, the thread cache (which must be empty) in which to place the first magazine's worth
+///                    of new objects.  All other objects are added to the shared depot.
 template< typename T, typename Allocator >
-void Helium::ObjectPool< T, Allocator >::AllocateBlock()
+void Helium::ObjectPool< T, Allocator >::AllocateBlock( ThreadCache* pCache )
 {
     Allocator allocator;
 
@@ -234,41 +296,315 @@ void Helium::ObjectPool< T, Allocator >::AllocateBlock()
 
     Block* pBlock = reinterpret_cast< Block* >( static_cast< uint8_t* >( pBuffer ) + alignedBufferSize );
     pBlock->pObjects = pObjects;
-	pBlock->pNext = NULL;
-
-	// We need to insert the new block on the end, otherwise object indexes
-	// will no longer correpond to the same object
-	Block *pLastBlock = m_pHeadBlock;
-	if (pLastBlock)
-	{
-		while (pLastBlock->pNext)
-		{
-			pLastBlock = pLastBlock->pNext;
-		}
-
-		pLastBlock->pNext = pBlock;
-	}
-	else
-	{
-		m_pHeadBlock = pBlock;
-	}
-
-    // Reallocate the free object pool array.
-    T* volatile * ppFreeObjects = m_ppFreeObjects;
-    ppFreeObjects = static_cast< T* volatile * >( allocator.Reallocate(
-        const_cast< T** >( m_ppFreeObjects ),
-        sizeof( T* ) * allocatedBlockCount * blockSize ) );
-    HELIUM_ASSERT( ppFreeObjects );
-
-    m_ppFreeObjects = ppFreeObjects;
-
-    // Add the new block of objects to the free list.
-    HELIUM_ASSERT( m_freeObjectCount == 0 );
-    m_freeObjectCount = blockSize;
-
-    for( size_t objectIndex = 0; objectIndex < blockSize; ++objectIndex )
+    pBlock->pNext = NULL;
+
+    // We need to insert the new block on the end, otherwise object indexes
+    // will no longer correpond to the same object
+    Block *pLastBlock = m_pHeadBlock;
+    if (pLastBlock)
+    {
+        while (pLastBlock->pNext)
+        {
+            pLastBlock = pLastBlock->pNext;
+        }
+
+        pLastBlock->pNext = pBlock;
+    }
+    else
+    {
+        m_pHeadBlock = pBlock;
+    }
+
+    // Hand the first objects to the calling thread's cache, and add the rest to the depot.
+    size_t objectIndex = 0;
+    if( pCache )
+    {
+        HELIUM_ASSERT( pCache->objectCount == 0 );
+
+        size_t cacheCount = Min< size_t >( blockSize, static_cast< size_t >( MAGAZINE_SIZE ) );
+        for( ; objectIndex < cacheCount; ++objectIndex )
+        {
+            pCache->pObjects[ objectIndex ] = pObjects + objectIndex;
+        }
+
+        pCache->objectCount = cacheCount;
+    }
+
+    while( objectIndex < blockSize )
+    {
+        Magazine* pMagazine = GetEmptyMagazine();
+        HELIUM_ASSERT( pMagazine );
+
+        size_t magazineCount = Min< size_t >( blockSize - objectIndex, static_cast< size_t >( MAGAZINE_SIZE ) );
+        for( size_t magazineIndex = 0; magazineIndex < magazineCount; ++magazineIndex )
+        {
+            pMagazine->pObjects[ magazineIndex ] = pObjects + objectIndex;
+            ++objectIndex;
+        }
+
+        pMagazine->objectCount = magazineCount;
+        PushMagazine( m_fullMagazines, pMagazine );
+    }
+}
+
+/// Get the object cache for the calling thread, adopting a flushed cache or creating a new one if necessary.
+///
+/// @return  Thread cache.
+template< typename T, typename Allocator >
+typename Helium::ObjectPool< T, Allocator >::ThreadCache* Helium::ObjectPool< T, Allocator >::GetThreadCache()
+{
+    ThreadCache* pCache = static_cast< ThreadCache* >( m_threadCache.GetPointer() );
+    if( pCache )
     {
-        ppFreeObjects[ objectIndex ] = pObjects;
-        ++pObjects;
+        return pCache;
     }
+
+    // Caches are never removed from the list until the pool is destroyed, so the list can be searched without locking.
+    for( pCache = m_pThreadCaches; pCache != NULL; pCache = pCache->pNext )
+    {
+        if( pCache->state == CACHE_STATE_FREE &&
+            AtomicCompareExchangeAcquire(
+                pCache->state,
+                static_cast< int32_t >( CACHE_STATE_IN_USE ),
+                static_cast< int32_t >( CACHE_STATE_FREE ) ) == CACHE_STATE_FREE )
+        {
+            HELIUM_ASSERT( pCache->objectCount == 0 );
+            m_threadCache.SetPointer( pCache );
+            RegisterObjectPoolThreadCache( pCache );
+
+            return pCache;
+        }
+    }
+
+    pCache = static_cast< ThreadCache* >( Allocator().Allocate( sizeof( ThreadCache ) ) );
+    HELIUM_ASSERT( pCache );
+    pCache->pThreadExitFunction = &OnThreadExit;
+    pCache->pNextThreadCache = NULL;
+    pCache->state = CACHE_STATE_IN_USE;
+    pCache->pPool = this;
+    pCache->objectCount = 0;
+
+    // Track the cache so that it can be freed when the pool is destroyed.
+    ThreadCache* pHead;
+    do
+    {
+        pHead = m_pThreadCaches;
+        pCache->pNext = pHead;
+    } while( AtomicCompareExchangeRelease( m_pThreadCaches, pCache, pHead ) != pHead );
+
+    m_threadCache.SetPointer( pCache );
+    RegisterObjectPoolThreadCache( pCache );
+
+    return pCache;
+}
+
+/// Refill an empty thread cache with a magazine of objects from the shared depot.
+///
+/// @param[in] pCache  Thread cache to refill.
+///
+/// @return  True if the cache was refilled, false if the depot was empty.
+template< typename T, typename Allocator >
+bool Helium::ObjectPool< T, Allocator >::RefillThreadCache( ThreadCache* pCache )
+{
+    HELIUM_ASSERT( pCache );
+    HELIUM_ASSERT( pCache->objectCount == 0 );
+
+    Magazine* pMagazine = PopMagazine( m_fullMagazines );
+    if( !pMagazine )
+    {
+        return false;
+    }
+
+    size_t objectCount = pMagazine->objectCount;
+    HELIUM_ASSERT( objectCount != 0 && objectCount <= MAGAZINE_SIZE );
+    ArrayCopy( pCache->pObjects, pMagazine->pObjects, objectCount );
+    pCache->objectCount = objectCount;
+
+    PushMagazine( m_emptyMagazines, pMagazine );
+
+    return true;
+}
+
+/// Move a magazine of objects from a full thread cache to the shared depot.
+///
+/// @param[in] pCache  Thread cache to drain.
+template< typename T, typename Allocator >
+void Helium::ObjectPool< T, Allocator >::DrainThreadCache( ThreadCache* pCache )
+{
+    HELIUM_ASSERT( pCache );
+    HELIUM_ASSERT( pCache->objectCount >= MAGAZINE_SIZE );
+
+    Magazine* pMagazine = GetEmptyMagazine();
+    HELIUM_ASSERT( pMagazine );
+
+    size_t objectCount = pCache->objectCount - MAGAZINE_SIZE;
+    ArrayCopy( pMagazine->pObjects, pCache->pObjects + objectCount, MAGAZINE_SIZE );
+    pMagazine->objectCount = MAGAZINE_SIZE;
+    pCache->objectCount = objectCount;
+
+    PushMagazine( m_fullMagazines, pMagazine );
+}
+
+/// Move all objects from a thread cache to the shared depot.
+///
+/// @param[in] pCache  Thread cache to empty.
+template< typename T, typename Allocator >
+void Helium::ObjectPool< T, Allocator >::EmptyThreadCache( ThreadCache* pCache )
+{
+    HELIUM_ASSERT( pCache );
+
+    while( pCache->objectCount >= MAGAZINE_SIZE )
+    {
+        DrainThreadCache( pCache );
+    }
+
+    size_t objectCount = pCache->objectCount;
+    if( objectCount != 0 )
+    {
+        Magazine* pMagazine = GetEmptyMagazine();
+        HELIUM_ASSERT( pMagazine );
+
+        ArrayCopy( pMagazine->pObjects, pCache->pObjects, objectCount );
+        pMagazine->objectCount = objectCount;
+        pCache->objectCount = 0;
+
+        PushMagazine( m_fullMagazines, pMagazine );
+    }
+}
+
+/// Get an empty magazine, allocating a new one if none are available for reuse.
+///
+/// @return  Empty magazine.
+template< typename T, typename Allocator >
+typename Helium::ObjectPool< T, Allocator >::Magazine* Helium::ObjectPool< T, Allocator >::GetEmptyMagazine()
+{
+    Magazine* pMagazine = PopMagazine( m_emptyMagazines );
+    if( !pMagazine )
+    {
+        pMagazine = static_cast< Magazine* >( Allocator().Allocate( sizeof( Magazine ) ) );
+        HELIUM_ASSERT( pMagazine );
+        pMagazine->pNext = NULL;
+    }
+
+    pMagazine->objectCount = 0;
+
+    return pMagazine;
+}
+
+/// Flush a thread cache when the thread to which it is assigned exits.
+///
+/// If the pool still exists, the cached objects are returned to its depot and the cache is made available for
+/// adoption by another thread.  If the pool has already been destroyed, the cache is freed.
+///
+/// @param[in] pCache  Thread cache of the exiting thread.
+template< typename T, typename Allocator >
+void Helium::ObjectPool< T, Allocator >::OnThreadExit( ObjectPoolThreadCacheHeader* pCache )
+{
+    HELIUM_ASSERT( pCache );
+
+    ThreadCache* pThreadCache = static_cast< ThreadCache* >( pCache );
+
+    // The pool destructor waits for caches being flushed, so the pool cannot be destroyed while the cache is in the
+    // exiting state.
+    if( AtomicCompareExchangeAcquire(
+        pThreadCache->state,
+        static_cast< int32_t >( CACHE_STATE_EXITING ),
+        static_cast< int32_t >( CACHE_STATE_IN_USE ) ) == CACHE_STATE_IN_USE )
+    {
+        ObjectPool* pPool = pThreadCache->pPool;
+        HELIUM_ASSERT( pPool );
+
+        pPool->m_threadCache.SetPointer( NULL );
+        pPool->EmptyThreadCache( pThreadCache );
+        AtomicExchangeRelease( pThreadCache->state, static_cast< int32_t >( CACHE_STATE_FREE ) );
+    }
+    else
+    {
+        HELIUM_ASSERT( pThreadCache->state == CACHE_STATE_ORPHANED );
+        Allocator().Free( pThreadCache );
+    }
+}
+
+/// Push a magazine onto a magazine list.
+///
+/// @param[in] rList      List onto which the magazine should be pushed.
+/// @param[in] pMagazine  Magazine to push.
+template< typename T, typename Allocator >
+void Helium::ObjectPool< T, Allocator >::PushMagazine( MagazineList& rList, Magazine* pMagazine )
+{
+    HELIUM_ASSERT( pMagazine );
+
+    Magazine* pHead;
+    do
+    {
+        pHead = rList.pHead;
+        pMagazine->pNext = pHead;
+    } while( AtomicCompareExchangeRelease( rList.pHead, pMagazine, pHead ) != pHead );
+}
+
+/// Pop a magazine from a magazine list.
+///
+/// @param[in] rList  List from which to pop a magazine.
+///
+/// @return  Magazine popped from the list, or null if the list was empty.
+template< typename T, typename Allocator >
+typename Helium::ObjectPool< T, Allocator >::Magazine* Helium::ObjectPool< T, Allocator >::PopMagazine(
+    MagazineList& rList )
+{
+    if( !rList.pHead )
+    {
+        return NULL;
+    }
+
+    AtomicIncrementAcquire( rList.popCount );
+
+    // Detach the entire list, keep the first magazine, and push the rest back.  If other magazines were pushed while
+    // the list was detached, detach those as well and append the remainder to them (the newly pushed list is usually
+    // much shorter than the remainder).
+    Magazine* pMagazine = AtomicExchangeAcquire< Magazine >( rList.pHead, NULL );
+    if( pMagazine )
+    {
+        Magazine* pRemainder = pMagazine->pNext;
+        pMagazine->pNext = NULL;
+
+        while( pRemainder &&
+               AtomicCompareExchangeRelease< Magazine >( rList.pHead, pRemainder, NULL ) != NULL )
+        {
+            Magazine* pPushed = AtomicExchangeAcquire< Magazine >( rList.pHead, NULL );
+            if( pPushed )
+            {
+                Magazine* pTail = pPushed;
+                while( pTail->pNext )
+                {
+                    pTail = pTail->pNext;
+                }
+
+                pTail->pNext = pRemainder;
+                pRemainder = pPushed;
+            }
+        }
+    }
+
+    AtomicDecrementRelease( rList.popCount );
+
+    return pMagazine;
+}
+
+/// Free all magazines in a magazine list.  Assumes no other threads are accessing the list.
+///
+/// @param[in] rList  List of magazines to free.
+template< typename T, typename Allocator >
+void Helium::ObjectPool< T, Allocator >::FreeMagazines( MagazineList& rList )
+{
+    Allocator allocator;
+
+    Magazine* pNextMagazine = rList.pHead;
+    while( pNextMagazine )
+    {
+        Magazine* pMagazine = pNextMagazine;
+        pNextMagazine = pNextMagazine->pNext;
+        allocator.Free( pMagazine );
+    }
+
+    rList.pHead = NULL;
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <utility>
+
 #include "Foundation/API.h"
 
 namespace Helium
@@ -19,6 +21,8 @@ namespace Helium
         //@{
         KeyValue();
         KeyValue( const T1& rFirst, const T2& rSecond );
+        KeyValue( const KeyValue& rSource );
+        KeyValue( KeyValue&& rSource );
         //@}
 
         /// @name Data Access
@@ -58,6 +62,8 @@ namespace Helium
         Pair();
         Pair( const T1& rFirst, const T2& rSecond );
         Pair( const KeyValue< T1, T2 >& rKeyValue );
+        Pair( const Pair& rSource );
+        Pair( Pair&& rSource );
         //@}
 
         /// @name Data Access
@@ -15,6 +15,28 @@ Helium::KeyValue< T1, T2 >::KeyValue( const T1& rFirst, const T2& rSecond )
 {
 }
 
+/// Copy constructor.
+///
+/// @param[in] rSource  Pair from which to copy.
+template< typename T1, typename T2 >
+Helium::KeyValue< T1, T2 >::KeyValue( const KeyValue& rSource )
+    : m_first( rSource.m_first )
+    , m_second( rSource.m_second )
+{
+}
+
+/// Move constructor.
+///
+/// This allows containers to relocate their entries (i.e. when rehashing) without copying the values.
+///
+/// @param[in] rSource  Pair from which to move.
+template< typename T1, typename T2 >
+Helium::KeyValue< T1, T2 >::KeyValue( KeyValue&& rSource )
+    : m_first( std::move( rSource.m_first ) )
+    , m_second( std::move( rSource.m_second ) )
+{
+}
+
 /// Get the first element in this pair.
 ///
 /// @return  Constant reference to the first pair element.
@@ -116,6 +138,24 @@ Helium::Pair< T1, T2 >::Pair( const KeyValue< T1, T2 >& rKeyValue )
 {
 }
 
+/// Copy constructor.
+///
+/// @param[in] rSource  Pair from which to copy.
+template< typename T1, typename T2 >
+Helium::Pair< T1, T2 >::Pair( const Pair& rSource )
+    : KeyValue< T1, T2 >( rSource )
+{
+}
+
+/// Move constructor.
+///
+/// @param[in] rSource  Pair from which to move.
+template< typename T1, typename T2 >
+Helium::Pair< T1, T2 >::Pair( Pair&& rSource )
+    : KeyValue< T1, T2 >( std::move( rSource ) )
+{
+}
+
 /// Get the first element in this pair.
 ///
 /// @return  Reference to the first pair element.
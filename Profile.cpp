@@ -67,7 +67,7 @@ Sink::Sink( const char* func, const char* file, uint32_t line )
 	, m_Millis( 0.0f )
 	, m_Index( -1 )
 {
-	StringPrint( m_Name, "%s() %s:%d", func, file, line );
+	HELIUM_STRING_FORMAT_BUFFER( m_Name, HELIUM_PROFILE_STRING_MAX, TXT( "{}() {}:{}" ), func, file, line );
 
 	Init();
 }
@@ -93,7 +93,7 @@ Sink::~Sink()
 
 void Sink::Report()
 {
-	Log::Profile( TXT( "[%12.3f] [%8d] %s\n" ), m_Millis, m_Hits, m_Name);
+	HELIUM_LOG_FORMAT( Log::Streams::Profile, Log::Levels::Default, TXT( "[{:12.3f}] [{:8}] {}\n" ), m_Millis, m_Hits, m_Name );
 }
 
 int CompareLocationPtr( const void* ptr1, const void* ptr2 )
@@ -228,7 +228,7 @@ Profile::Timer::~Timer()
 
 	if ( m_Name[0] != '\0' )
 	{
-		Log::Profile( TXT( "[%12.3f] %s\n" ), millis, m_Name);
+		HELIUM_LOG_FORMAT( Log::Streams::Profile, Log::Levels::Default, TXT( "[{:12.3f}] {}\n" ), millis, m_Name );
 	}
 
 #if HELIUM_PROFILE_INSTRUMENTATION
@@ -145,12 +145,19 @@ namespace Helium
         Iterator Find( const Key& rKey );
         ConstIterator Find( const Key& rKey ) const;
 
+        Iterator LowerBound( const Key& rKey );
+        ConstIterator LowerBound( const Key& rKey ) const;
+        Iterator UpperBound( const Key& rKey );
+        ConstIterator UpperBound( const Key& rKey ) const;
+
         Pair< Iterator, bool > Insert( const Value& rValue );
         bool Insert( ConstIterator& rIterator, const Value& rValue );
 
         bool Remove( const Key& rKey );
         void Remove( Iterator iterator );
 
+        void BulkLoad( const Value* pValues, size_t count );
+
         void Swap( RedBlackTree& rTree );
         //@}
 
@@ -192,6 +199,7 @@ namespace Helium
             const RedBlackTree< Value, Key, ExtractKey, CompareKey, OtherAllocator, InternalValue >& rSource );
 
         size_t FindNodeIndex( const Key& rKey ) const;
+        size_t FindBoundNodeIndex( const Key& rKey, bool bUpper ) const;
 
         size_t FindFirstNodeIndex() const;
         size_t FindLastNodeIndex() const;
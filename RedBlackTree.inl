@@ -174,6 +174,66 @@ typename Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, In
     return ConstIterator( this, FindNodeIndex( rKey ) );
 }
 
+/// Find the first node in this tree with a key that does not precede the specified key.
+///
+/// @param[in] rKey  Key for which to search.
+///
+/// @return  Iterator referencing the first node with a key that is not less than the specified key, or an iterator
+///          referencing the end of this tree if all keys are less than the specified key.
+///
+/// @see UpperBound()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator
+    Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::LowerBound( const Key& rKey )
+{
+    return Iterator( this, FindBoundNodeIndex( rKey, false ) );
+}
+
+/// Find the first node in this tree with a key that does not precede the specified key.
+///
+/// @param[in] rKey  Key for which to search.
+///
+/// @return  Constant iterator referencing the first node with a key that is not less than the specified key, or a
+///          constant iterator referencing the end of this tree if all keys are less than the specified key.
+///
+/// @see UpperBound()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator
+    Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::LowerBound( const Key& rKey ) const
+{
+    return ConstIterator( this, FindBoundNodeIndex( rKey, false ) );
+}
+
+/// Find the first node in this tree with a key that succeeds the specified key.
+///
+/// @param[in] rKey  Key for which to search.
+///
+/// @return  Iterator referencing the first node with a key that is greater than the specified key, or an iterator
+///          referencing the end of this tree if no keys are greater than the specified key.
+///
+/// @see LowerBound()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::Iterator
+    Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::UpperBound( const Key& rKey )
+{
+    return Iterator( this, FindBoundNodeIndex( rKey, true ) );
+}
+
+/// Find the first node in this tree with a key that succeeds the specified key.
+///
+/// @param[in] rKey  Key for which to search.
+///
+/// @return  Constant iterator referencing the first node with a key that is greater than the specified key, or a
+///          constant iterator referencing the end of this tree if no keys are greater than the specified key.
+///
+/// @see LowerBound()
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+typename Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::ConstIterator
+    Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::UpperBound( const Key& rKey ) const
+{
+    return ConstIterator( this, FindBoundNodeIndex( rKey, true ) );
+}
+
 /// Attempt to insert a node with a unique key into this tree.
 ///
 /// @param[in] rValue  Value of the node to insert.
@@ -651,6 +711,30 @@ void Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, Intern
     m_blackNodes[ m_root ] = true;
 }
 
+/// Replace the contents of this tree with a sorted array of values.
+///
+/// This is provided for interface compatibility with BTree.  Storage for all values is reserved up front, but each
+/// value is still inserted individually.
+///
+/// @param[in] pValues  Values to load, sorted by key.
+/// @param[in] count    Number of values to load.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+void Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::BulkLoad(
+    const Value* pValues,
+    size_t count )
+{
+    HELIUM_ASSERT( pValues || count == 0 );
+
+    Clear();
+    Reserve( count );
+
+    ConstIterator iterator;
+    for( size_t valueIndex = 0; valueIndex < count; ++valueIndex )
+    {
+        HELIUM_VERIFY( Insert( iterator, pValues[ valueIndex ] ) );
+    }
+}
+
 /// Swap the contents of this tree with another tree.
 ///
 /// @param[in] rTree  Tree with which to swap.
@@ -660,7 +744,7 @@ void Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, Intern
     m_values.Swap( rTree.m_values );
     m_links.Swap( rTree.m_links );
     m_blackNodes.Swap( rTree.m_blackNodes );
-    Swap( m_root, rTree.m_root );
+    Helium::Swap( m_root, rTree.m_root );
 }
 
 /// Check this tree for validity.
@@ -774,6 +858,38 @@ size_t Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, Inte
     return Invalid< size_t >();
 }
 
+/// Find the node in this tree with the lowest key that does not precede (or that succeeds) the given key.
+///
+/// @param[in] rKey    Key to locate.
+/// @param[in] bUpper  True to find the first node with a key greater than the given key, false to find the first node
+///                    with a key not less than the given key.
+///
+/// @return  Index of the node if found, an invalid index if no such node exists.
+template< typename Value, typename Key, typename ExtractKey, typename CompareKey, typename Allocator, typename InternalValue >
+size_t Helium::RedBlackTree< Value, Key, ExtractKey, CompareKey, Allocator, InternalValue >::FindBoundNodeIndex(
+    const Key& rKey,
+    bool bUpper ) const
+{
+    ExtractKey keyExtract;
+    CompareKey keyCompare;
+
+    size_t boundNodeIndex = Invalid< size_t >();
+    size_t nodeIndex = m_root;
+    while( IsValid( nodeIndex ) )
+    {
+        const Key& rNodeKey = keyExtract( m_values[ nodeIndex ] );
+        bool bRight = ( bUpper ? !keyCompare( rKey, rNodeKey ) : keyCompare( rNodeKey, rKey ) );
+        if( !bRight )
+        {
+            boundNodeIndex = nodeIndex;
+        }
+
+        nodeIndex = m_links[ nodeIndex ].children[ bRight ];
+    }
+
+    return boundNodeIndex;
+}
+
 /// Retrieve the index of the node in this tree with the lowest sort order.
 ///
 /// @return  Index of the lowest-sorted node in this tree.
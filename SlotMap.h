@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Foundation/DynamicArray.h"
+#include "Foundation/SparseArray.h"
+
+namespace Helium
+{
+    /// Generational handle to an element in a SlotMap.
+    ///
+    /// A handle combines a 32-bit slot index with the 32-bit generation of the slot at the time the element was added.
+    /// The slot's generation is incremented whenever its element is removed, so handles to removed elements are
+    /// detected as stale even after the slot is reused.
+    class SlotMapHandle
+    {
+    public:
+        /// @name Construction/Destruction
+        //@{
+        inline SlotMapHandle();
+        inline SlotMapHandle( uint32_t index, uint32_t generation );
+        //@}
+
+        /// @name Data Access
+        //@{
+        inline uint32_t GetIndex() const;
+        inline uint32_t GetGeneration() const;
+
+        inline bool IsValid() const;
+
+        inline uint64_t GetValue() const;
+        inline static SlotMapHandle FromValue( uint64_t value );
+        //@}
+
+        /// @name Overloaded Operators
+        //@{
+        inline bool operator==( const SlotMapHandle& rOther ) const;
+        inline bool operator!=( const SlotMapHandle& rOther ) const;
+        //@}
+
+    private:
+        /// Slot index.
+        uint32_t m_index;
+        /// Slot generation.
+        uint32_t m_generation;
+    };
+
+    /// Densely packed container addressed by generational handles (not thread-safe).
+    ///
+    /// Elements are stored contiguously in a DynamicArray, so iterating over all elements is as cache-friendly as
+    /// iterating over a plain array.  Handles reference slots in a SparseArray that map to the current position of each
+    /// element in the dense array; removing an element moves the last element into its place and updates that element's
+    /// slot.  Adding, removing, validating, and looking up an element by handle are all constant-time operations.
+    ///
+    /// Each slot keeps a generation counter that is incremented when its element is removed, and a handle is only valid
+    /// while its generation matches.  Since counters are 32 bits, a stale handle can only be mistaken for a valid one
+    /// after its slot has been reused more than four billion times.
+    ///
+    /// Element order is not preserved across removals, and pointers and references to elements are invalidated by any
+    /// operation that adds or removes an element.  Hold onto handles instead.
+    template< typename T, typename Allocator = DefaultAllocator >
+    class SlotMap : NonCopyable
+    {
+    public:
+        /// Type for element values.
+        typedef T ValueType;
+
+        /// Type for element handles.
+        typedef SlotMapHandle Handle;
+
+        /// Iterator type.
+        typedef typename DynamicArray< T, Allocator >::Iterator Iterator;
+        /// Constant iterator type.
+        typedef typename DynamicArray< T, Allocator >::ConstIterator ConstIterator;
+
+        /// @name Construction/Destruction
+        //@{
+        SlotMap();
+        ~SlotMap();
+        //@}
+
+        /// @name Map Operations
+        //@{
+        size_t GetSize() const;
+        bool IsEmpty() const;
+
+        size_t GetCapacity() const;
+        void Reserve( size_t capacity );
+        void Trim();
+
+        void Clear();
+
+        Handle Add( const T& rValue );
+        Handle Add( T&& rValue );
+        template< typename... Args > Handle Emplace( Args&&... args );
+        bool Remove( Handle handle );
+
+        bool IsValid( Handle handle ) const;
+        T* Get( Handle handle );
+        const T* Get( Handle handle ) const;
+
+        void Swap( SlotMap& rMap );
+        //@}
+
+        /// @name Dense Element Access
+        //@{
+        Iterator Begin();
+        ConstIterator Begin() const;
+        Iterator End();
+        ConstIterator End() const;
+
+        T* GetData();
+        const T* GetData() const;
+
+        T& GetElement( size_t index );
+        const T& GetElement( size_t index ) const;
+        Handle GetHandle( size_t index ) const;
+        //@}
+
+        /// @name Overloaded Operators
+        //@{
+        T& operator[]( Handle handle );
+        const T& operator[]( Handle handle ) const;
+        //@}
+
+    private:
+        /// Densely packed elements.
+        DynamicArray< T, Allocator > m_elements;
+        /// Slot index of each element in the dense element array.
+        DynamicArray< uint32_t, Allocator > m_elementSlots;
+        /// Dense element array index for each slot in use.
+        SparseArray< uint32_t, Allocator > m_slots;
+        /// Current generation of each slot that has ever been used.
+        DynamicArray< uint32_t, Allocator > m_generations;
+
+        /// @name Private Utility Functions
+        //@{
+        Handle AddSlot();
+        //@}
+    };
+}
+
+#include "Foundation/SlotMap.inl"
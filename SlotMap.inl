@@ -0,0 +1,483 @@
+/// Constructor.
+///
+/// Creates an invalid handle.
+Helium::SlotMapHandle::SlotMapHandle()
+    : m_index( Invalid< uint32_t >() )
+    , m_generation( 0 )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] index       Slot index.
+/// @param[in] generation  Slot generation.
+Helium::SlotMapHandle::SlotMapHandle( uint32_t index, uint32_t generation )
+    : m_index( index )
+    , m_generation( generation )
+{
+}
+
+/// Get the slot index referenced by this handle.
+///
+/// @return  Slot index.
+///
+/// @see GetGeneration()
+uint32_t Helium::SlotMapHandle::GetIndex() const
+{
+    return m_index;
+}
+
+/// Get the slot generation referenced by this handle.
+///
+/// @return  Slot generation.
+///
+/// @see GetIndex()
+uint32_t Helium::SlotMapHandle::GetGeneration() const
+{
+    return m_generation;
+}
+
+/// Get whether this handle has been set.
+///
+/// Note that this does not test whether the handle references an element that is still in a given map.  Use
+/// SlotMap::IsValid() for that.
+///
+/// @return  True if this handle has been set, false if it is an invalid handle.
+bool Helium::SlotMapHandle::IsValid() const
+{
+    return ( m_index != Invalid< uint32_t >() );
+}
+
+/// Get this handle packed into a single 64-bit value.
+///
+/// @return  Packed handle value, with the generation in the upper 32 bits and the index in the lower 32 bits.
+///
+/// @see FromValue()
+uint64_t Helium::SlotMapHandle::GetValue() const
+{
+    return ( static_cast< uint64_t >( m_generation ) << 32 ) | m_index;
+}
+
+/// Create a handle from a packed 64-bit value.
+///
+/// @param[in] value  Packed handle value.
+///
+/// @return  Handle.
+///
+/// @see GetValue()
+Helium::SlotMapHandle Helium::SlotMapHandle::FromValue( uint64_t value )
+{
+    return SlotMapHandle( static_cast< uint32_t >( value ), static_cast< uint32_t >( value >> 32 ) );
+}
+
+/// Equality comparison operator.
+///
+/// @param[in] rOther  Handle with which to compare.
+///
+/// @return  True if this handle and the given handle are the same, false if not.
+bool Helium::SlotMapHandle::operator==( const SlotMapHandle& rOther ) const
+{
+    return ( m_index == rOther.m_index && m_generation == rOther.m_generation );
+}
+
+/// Inequality comparison operator.
+///
+/// @param[in] rOther  Handle with which to compare.
+///
+/// @return  True if this handle and the given handle are different, false if they are the same.
+bool Helium::SlotMapHandle::operator!=( const SlotMapHandle& rOther ) const
+{
+    return ( m_index != rOther.m_index || m_generation != rOther.m_generation );
+}
+
+/// Constructor.
+template< typename T, typename Allocator >
+Helium::SlotMap< T, Allocator >::SlotMap()
+{
+}
+
+/// Destructor.
+template< typename T, typename Allocator >
+Helium::SlotMap< T, Allocator >::~SlotMap()
+{
+}
+
+/// Get the number of elements in this map.
+///
+/// @return  Element count.
+///
+/// @see IsEmpty(), GetCapacity()
+template< typename T, typename Allocator >
+size_t Helium::SlotMap< T, Allocator >::GetSize() const
+{
+    return m_elements.GetSize();
+}
+
+/// Get whether this map is empty.
+///
+/// @return  True if this map is empty, false if not.
+///
+/// @see GetSize()
+template< typename T, typename Allocator >
+bool Helium::SlotMap< T, Allocator >::IsEmpty() const
+{
+    return m_elements.IsEmpty();
+}
+
+/// Get the number of elements for which memory is currently allocated.
+///
+/// @return  Element capacity.
+///
+/// @see GetSize(), Reserve(), Trim()
+template< typename T, typename Allocator >
+size_t Helium::SlotMap< T, Allocator >::GetCapacity() const
+{
+    return m_elements.GetCapacity();
+}
+
+/// Explicitly increase the capacity of this map to support at least the specified number of elements.
+///
+/// @param[in] capacity  Desired capacity.
+///
+/// @see GetCapacity(), Trim()
+template< typename T, typename Allocator >
+void Helium::SlotMap< T, Allocator >::Reserve( size_t capacity )
+{
+    m_elements.Reserve( capacity );
+    m_elementSlots.Reserve( capacity );
+    m_slots.Reserve( capacity );
+    m_generations.Reserve( capacity );
+}
+
+/// Resize the allocated memory for this map to match the number of elements and slots in use.
+///
+/// @see GetCapacity(), Reserve()
+template< typename T, typename Allocator >
+void Helium::SlotMap< T, Allocator >::Trim()
+{
+    m_elements.Trim();
+    m_elementSlots.Trim();
+    m_slots.Trim();
+    m_generations.Trim();
+}
+
+/// Remove all elements from this map and free all allocated element memory.
+///
+/// Slot generations are retained, so handles to removed elements remain stale when slots are reused.
+template< typename T, typename Allocator >
+void Helium::SlotMap< T, Allocator >::Clear()
+{
+    size_t elementCount = m_elementSlots.GetSize();
+    for( size_t elementIndex = 0; elementIndex < elementCount; ++elementIndex )
+    {
+        ++m_generations[ m_elementSlots[ elementIndex ] ];
+    }
+
+    m_elements.Clear();
+    m_elementSlots.Clear();
+    m_slots.Clear();
+}
+
+/// Add an element to this map.
+///
+/// @param[in] rValue  Value to add.
+///
+/// @return  Handle to the new element.
+///
+/// @see Emplace(), Remove()
+template< typename T, typename Allocator >
+Helium::SlotMapHandle Helium::SlotMap< T, Allocator >::Add( const T& rValue )
+{
+    m_elements.Add( rValue );
+
+    return AddSlot();
+}
+
+/// Add an element to this map, moving the given value into place.
+///
+/// @param[in] rValue  Value to move into the map.
+///
+/// @return  Handle to the new element.
+///
+/// @see Emplace(), Remove()
+template< typename T, typename Allocator >
+Helium::SlotMapHandle Helium::SlotMap< T, Allocator >::Add( T&& rValue )
+{
+    m_elements.Add( std::move( rValue ) );
+
+    return AddSlot();
+}
+
+/// Construct a new element in place in this map.
+///
+/// @param[in] args  Arguments to forward to the element constructor.
+///
+/// @return  Handle to the new element.
+///
+/// @see Add(), Remove()
+template< typename T, typename Allocator >
+template< typename... Args >
+Helium::SlotMapHandle Helium::SlotMap< T, Allocator >::Emplace( Args&&... args )
+{
+    m_elements.Emplace( std::forward< Args >( args )... );
+
+    return AddSlot();
+}
+
+/// Remove an element from this map.
+///
+/// The last element in the dense element array is moved into the space left by the removed element.
+///
+/// @param[in] handle  Handle to the element to remove.
+///
+/// @return  True if the element was removed, false if the handle was stale or invalid.
+///
+/// @see Add(), IsValid()
+template< typename T, typename Allocator >
+bool Helium::SlotMap< T, Allocator >::Remove( Handle handle )
+{
+    if( !IsValid( handle ) )
+    {
+        return false;
+    }
+
+    size_t slotIndex = handle.GetIndex();
+    uint32_t elementIndex = m_slots[ slotIndex ];
+
+    size_t lastElementIndex = m_elements.GetSize() - 1;
+    if( elementIndex != lastElementIndex )
+    {
+        m_slots[ m_elementSlots[ lastElementIndex ] ] = elementIndex;
+    }
+
+    m_elements.RemoveSwap( elementIndex );
+    m_elementSlots.RemoveSwap( elementIndex );
+
+    m_slots.Remove( slotIndex );
+    ++m_generations[ slotIndex ];
+
+    return true;
+}
+
+/// Get whether a handle references an element in this map.
+///
+/// Slot generations are incremented when elements are removed, and are never reset, so this only needs to compare the
+/// handle generation with the current slot generation.
+///
+/// @param[in] handle  Handle to test.
+///
+/// @return  True if the handle references an element in this map, false if it is stale or invalid.
+template< typename T, typename Allocator >
+bool Helium::SlotMap< T, Allocator >::IsValid( Handle handle ) const
+{
+    size_t slotIndex = handle.GetIndex();
+    if( slotIndex >= m_generations.GetSize() || m_generations[ slotIndex ] != handle.GetGeneration() )
+    {
+        return false;
+    }
+
+    HELIUM_ASSERT( slotIndex < m_slots.GetSize() && m_slots.IsElementValid( slotIndex ) );
+
+    return true;
+}
+
+/// Get the element referenced by a handle.
+///
+/// @param[in] handle  Element handle.
+///
+/// @return  Pointer to the element, or null if the handle is stale or invalid.
+///
+/// @see IsValid()
+template< typename T, typename Allocator >
+T* Helium::SlotMap< T, Allocator >::Get( Handle handle )
+{
+    return ( IsValid( handle ) ? &m_elements[ m_slots[ handle.GetIndex() ] ] : NULL );
+}
+
+/// Get the element referenced by a handle.
+///
+/// @param[in] handle  Element handle.
+///
+/// @return  Constant pointer to the element, or null if the handle is stale or invalid.
+///
+/// @see IsValid()
+template< typename T, typename Allocator >
+const T* Helium::SlotMap< T, Allocator >::Get( Handle handle ) const
+{
+    return ( IsValid( handle ) ? &m_elements[ m_slots[ handle.GetIndex() ] ] : NULL );
+}
+
+/// Swap the contents of this map with another map.
+///
+/// @param[in] rMap  Map with which to swap.
+template< typename T, typename Allocator >
+void Helium::SlotMap< T, Allocator >::Swap( SlotMap& rMap )
+{
+    m_elements.Swap( rMap.m_elements );
+    m_elementSlots.Swap( rMap.m_elementSlots );
+    m_slots.Swap( rMap.m_slots );
+    m_generations.Swap( rMap.m_generations );
+}
+
+/// Retrieve an iterator referencing the beginning of the dense element array.
+///
+/// @return  Iterator at the beginning of this map.
+///
+/// @see End()
+template< typename T, typename Allocator >
+typename Helium::SlotMap< T, Allocator >::Iterator Helium::SlotMap< T, Allocator >::Begin()
+{
+    return m_elements.Begin();
+}
+
+/// Retrieve a constant iterator referencing the beginning of the dense element array.
+///
+/// @return  Constant iterator at the beginning of this map.
+///
+/// @see End()
+template< typename T, typename Allocator >
+typename Helium::SlotMap< T, Allocator >::ConstIterator Helium::SlotMap< T, Allocator >::Begin() const
+{
+    return m_elements.Begin();
+}
+
+/// Retrieve an iterator referencing the end of the dense element array.
+///
+/// @return  Iterator at the end of this map.
+///
+/// @see Begin()
+template< typename T, typename Allocator >
+typename Helium::SlotMap< T, Allocator >::Iterator Helium::SlotMap< T, Allocator >::End()
+{
+    return m_elements.End();
+}
+
+/// Retrieve a constant iterator referencing the end of the dense element array.
+///
+/// @return  Constant iterator at the end of this map.
+///
+/// @see Begin()
+template< typename T, typename Allocator >
+typename Helium::SlotMap< T, Allocator >::ConstIterator Helium::SlotMap< T, Allocator >::End() const
+{
+    return m_elements.End();
+}
+
+/// Get a pointer to the dense element array.
+///
+/// @return  Pointer to the first element, or null if the map has no allocated element memory.
+///
+/// @see GetSize()
+template< typename T, typename Allocator >
+T* Helium::SlotMap< T, Allocator >::GetData()
+{
+    return m_elements.GetData();
+}
+
+/// Get a constant pointer to the dense element array.
+///
+/// @return  Constant pointer to the first element, or null if the map has no allocated element memory.
+///
+/// @see GetSize()
+template< typename T, typename Allocator >
+const T* Helium::SlotMap< T, Allocator >::GetData() const
+{
+    return m_elements.GetData();
+}
+
+/// Get the element at the specified position in the dense element array.
+///
+/// @param[in] index  Dense element array index.
+///
+/// @return  Reference to the element.
+///
+/// @see GetHandle()
+template< typename T, typename Allocator >
+T& Helium::SlotMap< T, Allocator >::GetElement( size_t index )
+{
+    return m_elements.GetElement( index );
+}
+
+/// Get the element at the specified position in the dense element array.
+///
+/// @param[in] index  Dense element array index.
+///
+/// @return  Constant reference to the element.
+///
+/// @see GetHandle()
+template< typename T, typename Allocator >
+const T& Helium::SlotMap< T, Allocator >::GetElement( size_t index ) const
+{
+    return m_elements.GetElement( index );
+}
+
+/// Get the handle of the element at the specified position in the dense element array.
+///
+/// @param[in] index  Dense element array index.
+///
+/// @return  Element handle.
+///
+/// @see GetElement()
+template< typename T, typename Allocator >
+Helium::SlotMapHandle Helium::SlotMap< T, Allocator >::GetHandle( size_t index ) const
+{
+    uint32_t slotIndex = m_elementSlots[ index ];
+
+    return Handle( slotIndex, m_generations[ slotIndex ] );
+}
+
+/// Get the element referenced by a handle.
+///
+/// @param[in] handle  Element handle.  This must reference an element in this map (can test using IsValid()).
+///
+/// @return  Reference to the element.
+///
+/// @see Get(), IsValid()
+template< typename T, typename Allocator >
+T& Helium::SlotMap< T, Allocator >::operator[]( Handle handle )
+{
+    HELIUM_ASSERT( IsValid( handle ) );
+
+    return m_elements[ m_slots[ handle.GetIndex() ] ];
+}
+
+/// Get the element referenced by a handle.
+///
+/// @param[in] handle  Element handle.  This must reference an element in this map (can test using IsValid()).
+///
+/// @return  Constant reference to the element.
+///
+/// @see Get(), IsValid()
+template< typename T, typename Allocator >
+const T& Helium::SlotMap< T, Allocator >::operator[]( Handle handle ) const
+{
+    HELIUM_ASSERT( IsValid( handle ) );
+
+    return m_elements[ m_slots[ handle.GetIndex() ] ];
+}
+
+/// Allocate a slot for the element most recently added to the end of the dense element array.
+///
+/// @return  Handle to the new element.
+template< typename T, typename Allocator >
+Helium::SlotMapHandle Helium::SlotMap< T, Allocator >::AddSlot()
+{
+    HELIUM_ASSERT( !m_elements.IsEmpty() );
+    size_t elementIndex = m_elements.GetSize() - 1;
+    HELIUM_ASSERT( elementIndex < Invalid< uint32_t >() );
+
+    size_t slotIndex = m_slots.Add( static_cast< uint32_t >( elementIndex ) );
+    HELIUM_ASSERT( slotIndex < Invalid< uint32_t >() );
+
+    // Slots are always allocated from the lowest unused index, so at most one slot past the end of the generation
+    // array can be allocated at a time.
+    HELIUM_ASSERT( slotIndex <= m_generations.GetSize() );
+    if( slotIndex == m_generations.GetSize() )
+    {
+        m_generations.Add( 0 );
+    }
+
+    m_elementSlots.Add( static_cast< uint32_t >( slotIndex ) );
+
+    return Handle( static_cast< uint32_t >( slotIndex ), m_generations[ slotIndex ] );
+}
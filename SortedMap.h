@@ -1,19 +1,27 @@
 #pragma once
 
 #include "Foundation/RedBlackTree.h"
+#include "Foundation/BTree.h"
 
 namespace Helium
 {
     /// Key-sorted map.
     ///
-    /// SortedMap stores elements using a red-black tree data structure.  Lookups, insertions, and deletions are
-    /// performed in a worst-case of O(log n) time.  When iterating, values are guaranteed to be sorted by their keys.
-    template< typename Key, typename Data, typename CompareKey = Less< Key >, typename Allocator = DefaultAllocator >
-    class SortedMap : public RedBlackTree< KeyValue< Key, Data >, Key, SelectKey< KeyValue< Key, Data > >, CompareKey, Allocator, Pair< Key, Data > >
+    /// SortedMap stores elements using a red-black tree data structure by default.  Lookups, insertions, and deletions
+    /// are performed in a worst-case of O(log n) time.  When iterating, values are guaranteed to be sorted by their
+    /// keys.
+    ///
+    /// The tree engine can be changed to BTree, which keeps values in cache-line sized nodes and is typically faster
+    /// for large maps that are searched or iterated frequently, and which can be bulk-loaded from sorted entries.
+    template<
+        typename Key, typename Data, typename CompareKey = Less< Key >, typename Allocator = DefaultAllocator,
+        template< typename, typename, typename, typename, typename, typename > class Tree = RedBlackTree >
+    class SortedMap
+        : public Tree< KeyValue< Key, Data >, Key, SelectKey< KeyValue< Key, Data > >, CompareKey, Allocator, Pair< Key, Data > >
     {
     public:
         /// Parent class type.
-        typedef RedBlackTree< KeyValue< Key, Data >, Key, SelectKey< KeyValue< Key, Data > >, CompareKey, Allocator, Pair< Key, Data > > Base;
+        typedef Tree< KeyValue< Key, Data >, Key, SelectKey< KeyValue< Key, Data > >, CompareKey, Allocator, Pair< Key, Data > > Base;
 
         /// Type for map keys.
         typedef typename Base::KeyType KeyType;
@@ -32,31 +40,31 @@ namespace Helium
         SortedMap();
         SortedMap( const SortedMap& rSource );
         template< typename OtherAllocator > SortedMap(
-            const SortedMap< Key, Data, CompareKey, OtherAllocator >& rSource );
+            const SortedMap< Key, Data, CompareKey, OtherAllocator, Tree >& rSource );
         //@}
 
         /// @name Overloaded Operators
         //@{
         SortedMap& operator=( const SortedMap& rSource );
         template< typename OtherAllocator > SortedMap& operator=(
-            const SortedMap< Key, Data, CompareKey, OtherAllocator >& rSource );
+            const SortedMap< Key, Data, CompareKey, OtherAllocator, Tree >& rSource );
 
         Data& operator[]( const Key& rKey );
 
         bool operator==( const SortedMap& rOther ) const;
         template< typename OtherAllocator > bool operator==(
-            const SortedMap< Key, Data, CompareKey, OtherAllocator >& rOther ) const;
+            const SortedMap< Key, Data, CompareKey, OtherAllocator, Tree >& rOther ) const;
 
         bool operator!=( const SortedMap& rOther ) const;
         template< typename OtherAllocator > bool operator!=(
-            const SortedMap< Key, Data, CompareKey, OtherAllocator >& rOther ) const;
+            const SortedMap< Key, Data, CompareKey, OtherAllocator, Tree >& rOther ) const;
         //@}
 
     private:
         /// @name Private Utility Functions
         //@{
         template< typename OtherAllocator > bool Equals(
-            const SortedMap< Key, Data, CompareKey, OtherAllocator >& rOther ) const;
+            const SortedMap< Key, Data, CompareKey, OtherAllocator, Tree >& rOther ) const;
         //@}
     };
 }
@@ -1,14 +1,18 @@
 /// Constructor
-template< typename Key, typename Data, typename CompareKey, typename Allocator >
-Helium::SortedMap< Key, Data, CompareKey, Allocator >::SortedMap()
+template<
+    typename Key, typename Data, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
+Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >::SortedMap()
 {
 }
 
 /// Copy constructor.
 ///
 /// @param[in] rSource  Source object from which to copy.
-template< typename Key, typename Data, typename CompareKey, typename Allocator >
-Helium::SortedMap< Key, Data, CompareKey, Allocator >::SortedMap( const SortedMap& rSource )
+template<
+    typename Key, typename Data, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
+Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >::SortedMap( const SortedMap& rSource )
     : Base( rSource )
 {
 }
@@ -16,10 +20,12 @@ Helium::SortedMap< Key, Data, CompareKey, Allocator >::SortedMap( const SortedMa
 /// Copy constructor.
 ///
 /// @param[in] rSource  Source object from which to copy.
-template< typename Key, typename Data, typename CompareKey, typename Allocator >
+template<
+    typename Key, typename Data, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
 template< typename OtherAllocator >
-Helium::SortedMap< Key, Data, CompareKey, Allocator >::SortedMap(
-    const SortedMap< Key, Data, CompareKey, OtherAllocator >& rSource )
+Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >::SortedMap(
+    const SortedMap< Key, Data, CompareKey, OtherAllocator, Tree >& rSource )
     : Base( rSource )
 {
 }
@@ -29,9 +35,11 @@ Helium::SortedMap< Key, Data, CompareKey, Allocator >::SortedMap(
 /// @param[in] rSource  Source object from which to copy.
 ///
 /// @return  Reference to this object.
-template< typename Key, typename Data, typename CompareKey, typename Allocator >
-Helium::SortedMap< Key, Data, CompareKey, Allocator >& Helium::SortedMap< Key, Data, CompareKey, Allocator >::operator=(
-    const SortedMap& rSource )
+template<
+    typename Key, typename Data, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
+Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >&
+    Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >::operator=( const SortedMap& rSource )
 {
     Base::operator=( rSource );
 
@@ -43,10 +51,13 @@ Helium::SortedMap< Key, Data, CompareKey, Allocator >& Helium::SortedMap< Key, D
 /// @param[in] rSource  Source object from which to copy.
 ///
 /// @return  Reference to this object.
-template< typename Key, typename Data, typename CompareKey, typename Allocator >
+template<
+    typename Key, typename Data, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
 template< typename OtherAllocator >
-Helium::SortedMap< Key, Data, CompareKey, Allocator >& Helium::SortedMap< Key, Data, CompareKey, Allocator >::operator=(
-    const SortedMap< Key, Data, CompareKey, OtherAllocator >& rSource )
+Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >&
+    Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >::operator=(
+        const SortedMap< Key, Data, CompareKey, OtherAllocator, Tree >& rSource )
 {
     Base::operator=( rSource );
 
@@ -59,11 +70,13 @@ Helium::SortedMap< Key, Data, CompareKey, Allocator >& Helium::SortedMap< Key, D
 /// @param[in] rKey  Key to locate.
 ///
 /// @return  Reference to the data associated with the given key.
-template< typename Key, typename Data, typename CompareKey, typename Allocator >
-Data& Helium::SortedMap< Key, Data, CompareKey, Allocator >::operator[]( const Key& rKey )
+template<
+    typename Key, typename Data, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
+Data& Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >::operator[]( const Key& rKey )
 {
     typename Base::Iterator iterator;
-    Insert( iterator, Pair< Key, Data >( rKey, Data() ) );
+    Base::Insert( iterator, Pair< Key, Data >( rKey, Data() ) );
 
     return iterator->Second();
 }
@@ -75,8 +88,10 @@ Data& Helium::SortedMap< Key, Data, CompareKey, Allocator >::operator[]( const K
 /// @return  True if this map and the given map match, false if they differ.
 ///
 /// @see operator!=()
-template< typename Key, typename Data, typename CompareKey, typename Allocator >
-bool Helium::SortedMap< Key, Data, CompareKey, Allocator >::operator==( const SortedMap& rOther ) const
+template<
+    typename Key, typename Data, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
+bool Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >::operator==( const SortedMap& rOther ) const
 {
     return Equals( rOther );
 }
@@ -88,10 +103,12 @@ bool Helium::SortedMap< Key, Data, CompareKey, Allocator >::operator==( const So
 /// @return  True if this map and the given map match, false if they differ.
 ///
 /// @see operator!=()
-template< typename Key, typename Data, typename CompareKey, typename Allocator >
+template<
+    typename Key, typename Data, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
 template< typename OtherAllocator >
-bool Helium::SortedMap< Key, Data, CompareKey, Allocator >::operator==(
-    const SortedMap< Key, Data, CompareKey, OtherAllocator >& rOther ) const
+bool Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >::operator==(
+    const SortedMap< Key, Data, CompareKey, OtherAllocator, Tree >& rOther ) const
 {
     return Equals( rOther );
 }
@@ -103,8 +120,10 @@ bool Helium::SortedMap< Key, Data, CompareKey, Allocator >::operator==(
 /// @return  True if this map and the given map differ, false if they match.
 ///
 /// @see operator==()
-template< typename Key, typename Data, typename CompareKey, typename Allocator >
-bool Helium::SortedMap< Key, Data, CompareKey, Allocator >::operator!=( const SortedMap& rOther ) const
+template<
+    typename Key, typename Data, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
+bool Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >::operator!=( const SortedMap& rOther ) const
 {
     return !Equals( rOther );
 }
@@ -116,10 +135,12 @@ bool Helium::SortedMap< Key, Data, CompareKey, Allocator >::operator!=( const So
 /// @return  True if this map and the given map differ, false if they match.
 ///
 /// @see operator==()
-template< typename Key, typename Data, typename CompareKey, typename Allocator >
+template<
+    typename Key, typename Data, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
 template< typename OtherAllocator >
-bool Helium::SortedMap< Key, Data, CompareKey, Allocator >::operator!=(
-    const SortedMap< Key, Data, CompareKey, OtherAllocator >& rOther ) const
+bool Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >::operator!=(
+    const SortedMap< Key, Data, CompareKey, OtherAllocator, Tree >& rOther ) const
 {
     return !Equals( rOther );
 }
@@ -129,10 +150,12 @@ bool Helium::SortedMap< Key, Data, CompareKey, Allocator >::operator!=(
 /// @param[in] rOther  Map with which to compare.
 ///
 /// @return  True if this map and the given map match, false if they differ.
-template< typename Key, typename Data, typename CompareKey, typename Allocator >
+template<
+    typename Key, typename Data, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
 template< typename OtherAllocator >
-bool Helium::SortedMap< Key, Data, CompareKey, Allocator >::Equals(
-    const SortedMap< Key, Data, CompareKey, OtherAllocator >& rOther ) const
+bool Helium::SortedMap< Key, Data, CompareKey, Allocator, Tree >::Equals(
+    const SortedMap< Key, Data, CompareKey, OtherAllocator, Tree >& rOther ) const
 {
     if( Base::GetSize() != rOther.GetSize() )
     {
@@ -1,19 +1,25 @@
 #pragma once
 
 #include "Foundation/RedBlackTree.h"
+#include "Foundation/BTree.h"
 
 namespace Helium
 {
     /// Sorted set.
     ///
-    /// SortedSet stores elements using a red-black tree data structure.  Lookups, insertions, and deletions are
-    /// performed in a worst-case of O(log n) time.  When iterating, values are guaranteed to be sorted.
-    template< typename Key, typename CompareKey = Less< Key >, typename Allocator = DefaultAllocator >
-    class SortedSet : public RedBlackTree< const Key, const Key, Identity< const Key >, CompareKey, Allocator, Key >
+    /// SortedSet stores elements using a red-black tree data structure by default.  Lookups, insertions, and deletions
+    /// are performed in a worst-case of O(log n) time.  When iterating, values are guaranteed to be sorted.
+    ///
+    /// The tree engine can be changed to BTree, which keeps values in cache-line sized nodes and is typically faster
+    /// for large sets that are searched or iterated frequently, and which can be bulk-loaded from sorted values.
+    template<
+        typename Key, typename CompareKey = Less< Key >, typename Allocator = DefaultAllocator,
+        template< typename, typename, typename, typename, typename, typename > class Tree = RedBlackTree >
+    class SortedSet : public Tree< const Key, const Key, Identity< const Key >, CompareKey, Allocator, Key >
     {
     public:
         /// Parent class type.
-        typedef RedBlackTree< const Key, const Key, Identity< const Key >, CompareKey, Allocator, Key > Base;
+        typedef Tree< const Key, const Key, Identity< const Key >, CompareKey, Allocator, Key > Base;
 
         /// Type for set keys.
         typedef typename Base::KeyType KeyType;
@@ -30,29 +36,29 @@ namespace Helium
         SortedSet();
         SortedSet( const SortedSet& rSource );
         template< typename OtherAllocator > SortedSet(
-            const SortedSet< Key, CompareKey, OtherAllocator >& rSource );
+            const SortedSet< Key, CompareKey, OtherAllocator, Tree >& rSource );
         //@}
 
         /// @name Overloaded Operators
         //@{
         SortedSet& operator=( const SortedSet& rSource );
         template< typename OtherAllocator > SortedSet& operator=(
-            const SortedSet< Key, CompareKey, OtherAllocator >& rSource );
+            const SortedSet< Key, CompareKey, OtherAllocator, Tree >& rSource );
 
         bool operator==( const SortedSet& rOther ) const;
         template< typename OtherAllocator > bool operator==(
-            const SortedSet< Key, CompareKey, OtherAllocator >& rOther ) const;
+            const SortedSet< Key, CompareKey, OtherAllocator, Tree >& rOther ) const;
 
         bool operator!=( const SortedSet& rOther ) const;
         template< typename OtherAllocator > bool operator!=(
-            const SortedSet< Key, CompareKey, OtherAllocator >& rOther ) const;
+            const SortedSet< Key, CompareKey, OtherAllocator, Tree >& rOther ) const;
         //@}
 
     private:
         /// @name Private Utility Functions
         //@{
         template< typename OtherAllocator > bool Equals(
-            const SortedSet< Key, CompareKey, OtherAllocator >& rOther ) const;
+            const SortedSet< Key, CompareKey, OtherAllocator, Tree >& rOther ) const;
         //@}
     };
 }
@@ -1,14 +1,18 @@
 /// Constructor
-template< typename Key, typename CompareKey, typename Allocator >
-Helium::SortedSet< Key, CompareKey, Allocator >::SortedSet()
+template<
+    typename Key, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
+Helium::SortedSet< Key, CompareKey, Allocator, Tree >::SortedSet()
 {
 }
 
 /// Copy constructor.
 ///
 /// @param[in] rSource  Source object from which to copy.
-template< typename Key, typename CompareKey, typename Allocator >
-Helium::SortedSet< Key, CompareKey, Allocator >::SortedSet( const SortedSet& rSource )
+template<
+    typename Key, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
+Helium::SortedSet< Key, CompareKey, Allocator, Tree >::SortedSet( const SortedSet& rSource )
     : Base( rSource )
 {
 }
@@ -16,10 +20,12 @@ Helium::SortedSet< Key, CompareKey, Allocator >::SortedSet( const SortedSet& rSo
 /// Copy constructor.
 ///
 /// @param[in] rSource  Source object from which to copy.
-template< typename Key, typename CompareKey, typename Allocator >
+template<
+    typename Key, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
 template< typename OtherAllocator >
-Helium::SortedSet< Key, CompareKey, Allocator >::SortedSet(
-    const SortedSet< Key, CompareKey, OtherAllocator >& rSource )
+Helium::SortedSet< Key, CompareKey, Allocator, Tree >::SortedSet(
+    const SortedSet< Key, CompareKey, OtherAllocator, Tree >& rSource )
     : Base( rSource )
 {
 }
@@ -29,9 +35,11 @@ Helium::SortedSet< Key, CompareKey, Allocator >::SortedSet(
 /// @param[in] rSource  Source object from which to copy.
 ///
 /// @return  Reference to this object.
-template< typename Key, typename CompareKey, typename Allocator >
-Helium::SortedSet< Key, CompareKey, Allocator >& Helium::SortedSet< Key, CompareKey, Allocator >::operator=(
-    const SortedSet& rSource )
+template<
+    typename Key, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
+Helium::SortedSet< Key, CompareKey, Allocator, Tree >&
+    Helium::SortedSet< Key, CompareKey, Allocator, Tree >::operator=( const SortedSet& rSource )
 {
     Base::operator=( rSource );
 
@@ -43,10 +51,13 @@ Helium::SortedSet< Key, CompareKey, Allocator >& Helium::SortedSet< Key, Compare
 /// @param[in] rSource  Source object from which to copy.
 ///
 /// @return  Reference to this object.
-template< typename Key, typename CompareKey, typename Allocator >
+template<
+    typename Key, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
 template< typename OtherAllocator >
-Helium::SortedSet< Key, CompareKey, Allocator >& Helium::SortedSet< Key, CompareKey, Allocator >::operator=(
-    const SortedSet< Key, CompareKey, OtherAllocator >& rSource )
+Helium::SortedSet< Key, CompareKey, Allocator, Tree >&
+    Helium::SortedSet< Key, CompareKey, Allocator, Tree >::operator=(
+        const SortedSet< Key, CompareKey, OtherAllocator, Tree >& rSource )
 {
     Base::operator=( rSource );
 
@@ -60,8 +71,10 @@ Helium::SortedSet< Key, CompareKey, Allocator >& Helium::SortedSet< Key, Compare
 /// @return  True if this set and the given set match, false if they differ.
 ///
 /// @see operator!=()
-template< typename Key, typename CompareKey, typename Allocator >
-bool Helium::SortedSet< Key, CompareKey, Allocator >::operator==( const SortedSet& rOther ) const
+template<
+    typename Key, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
+bool Helium::SortedSet< Key, CompareKey, Allocator, Tree >::operator==( const SortedSet& rOther ) const
 {
     return Equals( rOther );
 }
@@ -73,10 +86,12 @@ bool Helium::SortedSet< Key, CompareKey, Allocator >::operator==( const SortedSe
 /// @return  True if this set and the given set match, false if they differ.
 ///
 /// @see operator!=()
-template< typename Key, typename CompareKey, typename Allocator >
+template<
+    typename Key, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
 template< typename OtherAllocator >
-bool Helium::SortedSet< Key, CompareKey, Allocator >::operator==(
-    const SortedSet< Key, CompareKey, OtherAllocator >& rOther ) const
+bool Helium::SortedSet< Key, CompareKey, Allocator, Tree >::operator==(
+    const SortedSet< Key, CompareKey, OtherAllocator, Tree >& rOther ) const
 {
     return Equals( rOther );
 }
@@ -88,8 +103,10 @@ bool Helium::SortedSet< Key, CompareKey, Allocator >::operator==(
 /// @return  True if this set and the given set differ, false if they match.
 ///
 /// @see operator==()
-template< typename Key, typename CompareKey, typename Allocator >
-bool Helium::SortedSet< Key, CompareKey, Allocator >::operator!=( const SortedSet& rOther ) const
+template<
+    typename Key, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
+bool Helium::SortedSet< Key, CompareKey, Allocator, Tree >::operator!=( const SortedSet& rOther ) const
 {
     return !Equals( rOther );
 }
@@ -101,10 +118,12 @@ bool Helium::SortedSet< Key, CompareKey, Allocator >::operator!=( const SortedSe
 /// @return  True if this set and the given set differ, false if they match.
 ///
 /// @see operator==()
-template< typename Key, typename CompareKey, typename Allocator >
+template<
+    typename Key, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
 template< typename OtherAllocator >
-bool Helium::SortedSet< Key, CompareKey, Allocator >::operator!=(
-    const SortedSet< Key, CompareKey, OtherAllocator >& rOther ) const
+bool Helium::SortedSet< Key, CompareKey, Allocator, Tree >::operator!=(
+    const SortedSet< Key, CompareKey, OtherAllocator, Tree >& rOther ) const
 {
     return !Equals( rOther );
 }
@@ -114,10 +133,12 @@ bool Helium::SortedSet< Key, CompareKey, Allocator >::operator!=(
 /// @param[in] rOther  Set with which to compare.
 ///
 /// @return  True if this set and the given set match, false if they differ.
-template< typename Key, typename CompareKey, typename Allocator >
+template<
+    typename Key, typename CompareKey, typename Allocator,
+    template< typename, typename, typename, typename, typename, typename > class Tree >
 template< typename OtherAllocator >
-bool Helium::SortedSet< Key, CompareKey, Allocator >::Equals(
-    const SortedSet< Key, CompareKey, OtherAllocator >& rOther ) const
+bool Helium::SortedSet< Key, CompareKey, Allocator, Tree >::Equals(
+    const SortedSet< Key, CompareKey, OtherAllocator, Tree >& rOther ) const
 {
     if( Base::GetSize() != rOther.GetSize() )
     {
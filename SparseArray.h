@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Foundation/API.h"
+#include "Foundation/Math.h"
 
 namespace Helium
 {
@@ -106,6 +107,12 @@ namespace Helium
     };
 
     /// Resizable sparse array (not thread-safe).
+    ///
+    /// Slot usage is tracked in a bit array, along with a two-level summary of which bit array words contain free slots
+    /// and which contain used slots.  Each summary level holds one bit per word of the level below, so finding
+    /// the first free slot when adding an element, or the last used slot when removing one, only takes a few
+    /// count-trailing-zeros or count-leading-zeros operations regardless of how fragmented the array is.
+    /// ForEachElement() uses the same summary to skip empty regions when visiting all elements in use.
     template< typename T, typename Allocator = DefaultAllocator >
     class SparseArray
     {
@@ -134,6 +141,7 @@ namespace Helium
         //@{
         SparseArray();
         SparseArray( const T* pSource, size_t size );
+        SparseArray( const SparseArray& rSource );
         template< typename OtherAllocator > SparseArray( const SparseArray< T, OtherAllocator >& rSource );
         ~SparseArray();
         //@}
@@ -171,6 +179,9 @@ namespace Helium
         void Remove( size_t index );
 
         void Swap( SparseArray& rArray );
+
+        template< typename Function > void ForEachElement( Function function );
+        template< typename Function > void ForEachElement( Function function ) const;
         //@}
 
         /// @name In-place Object Creation
@@ -206,8 +217,9 @@ namespace Helium
         /// Buffer capacity.
         size_t m_capacity;
 
-        /// Index of the lowest element last modified (searches for free slots will start from here when adding).
-        size_t m_lastUpdateIndex;
+        /// Summary bits specifying which used element bit array words have free and used slots, followed by summary
+        /// bits specifying which of those summary words have any bits set.
+        uint64_t* m_pUsedElementSummary;
 
         /// Allocator instance.
         Allocator m_allocator;
@@ -219,6 +231,16 @@ namespace Helium
 
         size_t AllocateSlot();
 
+        void ResizeUsedElements( size_t capacity );
+        void UpdateUsedElementSummary();
+        void SetUsedElement( size_t index );
+        void ClearUsedElement( size_t index );
+        size_t FindFreeSlot() const;
+        size_t FindLastUsedSlot( size_t endIndex ) const;
+
+        static size_t GetUsedElementWordCount( size_t capacity );
+        static size_t GetSummaryWordCount( size_t wordCount );
+
         template< typename OtherAllocator > SparseArray& Assign( const SparseArray< T, OtherAllocator >& rSource );
 
         T* Allocate( size_t count );
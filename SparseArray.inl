@@ -453,7 +453,7 @@ Helium::SparseArray< T, Allocator >::SparseArray()
     , m_size( 0 )
     , m_usedSize( 0 )
     , m_capacity( 0 )
-    , m_lastUpdateIndex( 0 )
+    , m_pUsedElementSummary( NULL )
 {
 }
 
@@ -469,23 +469,41 @@ Helium::SparseArray< T, Allocator >::SparseArray( const T* pSource, size_t size
     , m_pUsedElements( NULL )
     , m_size( size )
     , m_usedSize( size )
-    , m_capacity( size )
-    , m_lastUpdateIndex( 0 )
+    , m_capacity( 0 )
+    , m_pUsedElementSummary( NULL )
 {
     HELIUM_ASSERT( pSource );
     if( size != 0 )
     {
-        m_pBuffer = Allocate( m_size );
+        m_pBuffer = Allocate( size );
         HELIUM_ASSERT( m_pBuffer );
         ArrayUninitializedCopy( m_pBuffer, pSource, size );
 
-        size_t bitArrayByteCount = Align( size, sizeof( uint32_t ) * 8 ) / 8;
-        m_pUsedElements = static_cast< uint32_t* >( m_allocator.Allocate( bitArrayByteCount ) );
-        HELIUM_ASSERT( m_pUsedElements );
-        MemorySet( m_pUsedElements, 0xff, bitArrayByteCount );
+        ResizeUsedElements( size );
+        SetBitRange( m_pUsedElements, 0, size );
+        UpdateUsedElementSummary();
     }
 }
 
+/// Copy constructor.
+///
+/// When copying, only the memory needed to hold onto the used contents of the source array will be allocated (i.e. if
+/// the source array has 10 elements but a capacity of 20, only memory for the 10 used elements will be allocated for
+/// this copy).  Holes will be compacted as well.
+///
+/// @param[in] rSource  Array from which to copy.
+template< typename T, typename Allocator >
+Helium::SparseArray< T, Allocator >::SparseArray( const SparseArray& rSource )
+    : m_pBuffer( NULL )
+    , m_pUsedElements( NULL )
+    , m_size( 0 )
+    , m_usedSize( 0 )
+    , m_capacity( 0 )
+    , m_pUsedElementSummary( NULL )
+{
+    Assign( rSource );
+}
+
 /// Copy constructor.
 ///
 /// When copying, only the memory needed to hold onto the used contents of the source array will be allocated (i.e. if
@@ -501,7 +519,7 @@ Helium::SparseArray< T, Allocator >::SparseArray( const SparseArray< T, OtherAll
     , m_size( 0 )
     , m_usedSize( 0 )
     , m_capacity( 0 )
-    , m_lastUpdateIndex( 0 )
+    , m_pUsedElementSummary( NULL )
 {
     size_t usedSize = rSource.m_usedSize;
     if( usedSize != 0 )
@@ -530,6 +548,7 @@ Helium::SparseArray< T, Allocator >::~SparseArray()
     InPlaceDestroy( m_pBuffer, m_size, m_pUsedElements );
     Free( m_pBuffer );
     m_allocator.Free( m_pUsedElements );
+    m_allocator.Free( m_pUsedElementSummary );
 }
 
 /// Get the size of this array, including internal holes.
@@ -583,11 +602,8 @@ void Helium::SparseArray< T, Allocator >::Reserve( size_t capacity )
         m_pBuffer = ResizeBuffer( m_pBuffer, m_size, m_pUsedElements, m_capacity, capacity );
         HELIUM_ASSERT( m_pBuffer );
 
-        size_t bitArrayByteCount = Align( capacity, sizeof( uint32_t ) * 8 ) / 8;
-        m_pUsedElements = static_cast< uint32_t* >( m_allocator.Reallocate( m_pUsedElements, bitArrayByteCount ) );
-        HELIUM_ASSERT( m_pUsedElements );
-
-        m_capacity = capacity;
+        ResizeUsedElements( capacity );
+        UpdateUsedElementSummary();
     }
 }
 
@@ -602,11 +618,8 @@ void Helium::SparseArray< T, Allocator >::Trim()
         m_pBuffer = ResizeBuffer( m_pBuffer, m_size, m_pUsedElements, m_capacity, m_size );
         HELIUM_ASSERT( m_pBuffer || m_size == 0 );
 
-        size_t bitArrayByteCount = Align( m_size, sizeof( uint32_t ) * 8 ) / 8;
-        m_pUsedElements = static_cast< uint32_t* >( m_allocator.Reallocate( m_pUsedElements, bitArrayByteCount ) );
-        HELIUM_ASSERT( m_pUsedElements || bitArrayByteCount == 0 );
-
-        m_capacity = m_size;
+        ResizeUsedElements( m_size );
+        UpdateUsedElementSummary();
     }
 }
 
@@ -648,11 +661,12 @@ void Helium::SparseArray< T, Allocator >::Clear()
     m_allocator.Free( m_pUsedElements );
     m_pUsedElements = NULL;
 
+    m_allocator.Free( m_pUsedElementSummary );
+    m_pUsedElementSummary = NULL;
+
     m_size = 0;
     m_usedSize = 0;
     m_capacity = 0;
-
-    m_lastUpdateIndex = 0;
 }
 
 /// Retrieve an iterator referencing the beginning of this array.
@@ -807,21 +821,19 @@ void Helium::SparseArray< T, Allocator >::Set( const T* pSource, size_t size )
         m_pBuffer = Reallocate( m_pBuffer, size );
         HELIUM_ASSERT( m_pBuffer || size == 0 );
 
-        size_t bitArrayByteCount = Align( size, sizeof( uint32_t ) * 8 ) / 8;
-        m_pUsedElements = static_cast< uint32_t* >( m_allocator.Reallocate( m_pUsedElements, bitArrayByteCount ) );
-        HELIUM_ASSERT( m_pUsedElements || bitArrayByteCount == 0 );
-
-        m_capacity = size;
+        ResizeUsedElements( size );
     }
 
     HELIUM_ASSERT( size == 0 ? m_pBuffer == NULL : m_pBuffer != NULL );
 
     m_size = size;
     m_usedSize = size;
-    m_lastUpdateIndex = 0;
 
     ArrayUninitializedCopy( m_pBuffer, pSource, size );
-    MemorySet( m_pUsedElements, 0xff, size );
+
+    MemoryZero( m_pUsedElements, sizeof( uint32_t ) * GetUsedElementWordCount( m_capacity ) );
+    SetBitRange( m_pUsedElements, 0, size );
+    UpdateUsedElementSummary();
 }
 
 /// Add an element to this array.
@@ -860,12 +872,7 @@ void Helium::SparseArray< T, Allocator >::Remove( size_t index )
 
     // Clear out the array slot.
     m_pBuffer[ index ].~T();
-
-    size_t bitElementIndex, maskIndex;
-    GetBitElementAndMaskIndex< uint32_t >( index, bitElementIndex, maskIndex );
-
-    uint32_t bitMask = ( 1U << maskIndex );
-    m_pUsedElements[ bitElementIndex ] &= ~bitMask;
+    ClearUsedElement( index );
 
     // Decrement the used element count.
     HELIUM_ASSERT( m_usedSize != 0 );
@@ -874,7 +881,6 @@ void Helium::SparseArray< T, Allocator >::Remove( size_t index )
     {
         // No elements are in use anymore, so we can be sure the array is now empty.
         m_size = 0;
-        m_lastUpdateIndex = 0;
 
         return;
     }
@@ -882,45 +888,15 @@ void Helium::SparseArray< T, Allocator >::Remove( size_t index )
     // If we removed the last element in the array, search for the new last element and update the array size.
     if( index == m_size - 1 )
     {
-        while( index != 0 )
-        {
-            bitMask >>= 1;
-            if( !bitMask )
-            {
-                --bitElementIndex;
-                bitMask = ( 1U << ( sizeof( uint32_t ) * 8 - 1 ) );
-            }
-
-            if( m_pUsedElements[ bitElementIndex ] & bitMask )
-            {
-                // Found our new last element, so update the size and bail.
-                m_size = index;
-                if( index < m_lastUpdateIndex )
-                {
-                    m_lastUpdateIndex = index;
-                }
-
-                return;
-            }
+        size_t lastIndex = FindLastUsedSlot( index );
 
-            --index;
-        }
-
-        // We should never reach this point, as our previous check for when the used size reaches zero should have
-        // been triggered.
-        HELIUM_BREAK_MSG(
+        // We should always find a used slot, as our previous check for when the used size reaches zero should have
+        // been triggered otherwise.
+        HELIUM_ASSERT_MSG(
+            IsValid( lastIndex ),
             TXT( "SparseArray::Remove(): Failed to find a used array slot, although at least one should exist." ) );
 
-        m_size = 0;
-        m_lastUpdateIndex = 0;
-
-        return;
-    }
-
-    // If the element just removed is less than the last marked index, update the index.
-    if( index < m_lastUpdateIndex )
-    {
-        m_lastUpdateIndex = index;
+        m_size = ( IsValid( lastIndex ) ? lastIndex + 1 : 0 );
     }
 }
 
@@ -931,25 +907,95 @@ template< typename T, typename Allocator >
 void Helium::SparseArray< T, Allocator >::Swap( SparseArray& rArray )
 {
     T* pBuffer = m_pBuffer;
-    uint32_t pUsedElements = m_pUsedElements;
+    uint32_t* pUsedElements = m_pUsedElements;
+    uint64_t* pUsedElementSummary = m_pUsedElementSummary;
     size_t size = m_size;
     size_t usedSize = m_usedSize;
     size_t capacity = m_capacity;
-    size_t lastUpdateIndex = m_lastUpdateIndex;
 
     m_pBuffer = rArray.m_pBuffer;
     m_pUsedElements = rArray.m_pUsedElements;
+    m_pUsedElementSummary = rArray.m_pUsedElementSummary;
     m_size = rArray.m_size;
     m_usedSize = rArray.m_usedSize;
     m_capacity = rArray.m_capacity;
-    m_lastUpdateIndex = rArray.m_lastUpdateIndex;
 
     rArray.m_pBuffer = pBuffer;
     rArray.m_pUsedElements = pUsedElements;
+    rArray.m_pUsedElementSummary = pUsedElementSummary;
     rArray.m_size = size;
     rArray.m_usedSize = usedSize;
     rArray.m_capacity = capacity;
-    rArray.m_lastUpdateIndex = lastUpdateIndex;
+}
+
+/// Call a function for each element in use in this array, in index order.
+///
+/// This is considerably faster than iterating over the array using iterators when the array is sparse, as regions
+/// without any used elements are skipped using the used element summary bits, and each used element bit array word is
+/// only read once.  Elements must not be added to or removed from the array while visiting.
+///
+/// @param[in] function  Function or function object to call with a reference to each element.
+template< typename T, typename Allocator >
+template< typename Function >
+void Helium::SparseArray< T, Allocator >::ForEachElement( Function function )
+{
+    size_t summaryWordCount = GetSummaryWordCount( GetUsedElementWordCount( m_capacity ) );
+    size_t topWordCount = GetSummaryWordCount( summaryWordCount );
+    const uint64_t* pUsedSummary = m_pUsedElementSummary + summaryWordCount;
+    const uint64_t* pUsedTop = m_pUsedElementSummary + summaryWordCount * 2 + topWordCount;
+
+    for( size_t topIndex = 0; topIndex < topWordCount; ++topIndex )
+    {
+        for( uint64_t topBits = pUsedTop[ topIndex ]; topBits != 0; topBits &= topBits - 1 )
+        {
+            size_t summaryIndex = topIndex * 64 + CountTrailingZeros( topBits );
+            for( uint64_t summaryBits = pUsedSummary[ summaryIndex ]; summaryBits != 0; summaryBits &= summaryBits - 1 )
+            {
+                size_t wordIndex = summaryIndex * 64 + CountTrailingZeros( summaryBits );
+                T* pElements = m_pBuffer + wordIndex * 32;
+                uint32_t elementBits = m_pUsedElements[ wordIndex ];
+                for( ; elementBits != 0; elementBits &= elementBits - 1 )
+                {
+                    function( pElements[ CountTrailingZeros( elementBits ) ] );
+                }
+            }
+        }
+    }
+}
+
+/// Call a function for each element in use in this array, in index order.
+///
+/// This is considerably faster than iterating over the array using iterators when the array is sparse, as regions
+/// without any used elements are skipped using the used element summary bits, and each used element bit array word is
+/// only read once.
+///
+/// @param[in] function  Function or function object to call with a constant reference to each element.
+template< typename T, typename Allocator >
+template< typename Function >
+void Helium::SparseArray< T, Allocator >::ForEachElement( Function function ) const
+{
+    size_t summaryWordCount = GetSummaryWordCount( GetUsedElementWordCount( m_capacity ) );
+    size_t topWordCount = GetSummaryWordCount( summaryWordCount );
+    const uint64_t* pUsedSummary = m_pUsedElementSummary + summaryWordCount;
+    const uint64_t* pUsedTop = m_pUsedElementSummary + summaryWordCount * 2 + topWordCount;
+
+    for( size_t topIndex = 0; topIndex < topWordCount; ++topIndex )
+    {
+        for( uint64_t topBits = pUsedTop[ topIndex ]; topBits != 0; topBits &= topBits - 1 )
+        {
+            size_t summaryIndex = topIndex * 64 + CountTrailingZeros( topBits );
+            for( uint64_t summaryBits = pUsedSummary[ summaryIndex ]; summaryBits != 0; summaryBits &= summaryBits - 1 )
+            {
+                size_t wordIndex = summaryIndex * 64 + CountTrailingZeros( summaryBits );
+                const T* pElements = m_pBuffer + wordIndex * 32;
+                uint32_t elementBits = m_pUsedElements[ wordIndex ];
+                for( ; elementBits != 0; elementBits &= elementBits - 1 )
+                {
+                    function( pElements[ CountTrailingZeros( elementBits ) ] );
+                }
+            }
+        }
+    }
 }
 
 /// Allocate a new object as a new element in this array.
@@ -1074,11 +1120,8 @@ void Helium::SparseArray< T, Allocator >::Grow( size_t capacity )
         m_pBuffer = ResizeBuffer( m_pBuffer, m_size, m_pUsedElements, m_capacity, capacity );
         HELIUM_ASSERT( m_pBuffer );
 
-        size_t bitArrayByteCount = Align( capacity, sizeof( uint32_t ) * 8 ) / 8;
-        m_pUsedElements = static_cast< uint32_t* >( m_allocator.Reallocate( m_pUsedElements, bitArrayByteCount ) );
-        HELIUM_ASSERT( m_pUsedElements );
-
-        m_capacity = capacity;
+        ResizeUsedElements( capacity );
+        UpdateUsedElementSummary();
     }
 }
 
@@ -1090,44 +1133,20 @@ size_t Helium::SparseArray< T, Allocator >::AllocateSlot()
 {
     size_t size = m_size;
 
-    // Search for an unused slot within the array first.
+    // Use the first unused slot within the array if there are any holes.
     if( m_usedSize != size )
     {
-        size_t bitElementIndex, maskIndex;
-        GetBitElementAndMaskIndex< uint32_t >( m_lastUpdateIndex, bitElementIndex, maskIndex );
-        uint32_t bitMask = ( 1U << maskIndex );
-
-        uint32_t elementBits = 0;
-        size_t lastBitElementIndex = Invalid< size_t >();
-        for( size_t index = m_lastUpdateIndex; index < size; ++index )
+        size_t index = FindFreeSlot();
+        HELIUM_ASSERT_MSG(
+            index < size,
+            TXT( "SparseArray::AllocateSlot(): Failed to find an unused array slot, although one should exist." ) );
+        if( index < size )
         {
-            if( bitElementIndex != lastBitElementIndex )
-            {
-                elementBits = m_pUsedElements[ bitElementIndex ];
-                lastBitElementIndex = bitElementIndex;
-            }
-
-            if( !( elementBits & bitMask ) )
-            {
-                m_pUsedElements[ bitElementIndex ] = elementBits | bitMask;
-                ++m_usedSize;
-
-                m_lastUpdateIndex = index + 1;
+            SetUsedElement( index );
+            ++m_usedSize;
 
-                return index;
-            }
-
-            bitMask <<= 1;
-            if( !bitMask )
-            {
-                ++bitElementIndex;
-                bitMask = 1U;
-            }
+            return index;
         }
-
-        HELIUM_BREAK_MSG(
-            ( TXT( "SparseArray::AllocateSlot(): Failed to find an unused array slot, although at least one " )
-              TXT( "should exist." ) ) );
     }
 
     HELIUM_ASSERT( size == m_usedSize );
@@ -1136,9 +1155,7 @@ size_t Helium::SparseArray< T, Allocator >::AllocateSlot()
     size_t newSize = size + 1;
     Grow( newSize );
 
-    size_t bitElementIndex, maskIndex;
-    GetBitElementAndMaskIndex< uint32_t >( size, bitElementIndex, maskIndex );
-    SetBit( m_pUsedElements[ bitElementIndex ], maskIndex );
+    SetUsedElement( size );
 
     m_usedSize = newSize;
     m_size = newSize;
@@ -1146,6 +1163,302 @@ size_t Helium::SparseArray< T, Allocator >::AllocateSlot()
     return size;
 }
 
+/// Resize the used element bit array to support the given capacity and update the array capacity.
+///
+/// Any newly allocated bits are cleared.  The used element summary must be updated separately.
+///
+/// @param[in] capacity  New array capacity.
+///
+/// @see UpdateUsedElementSummary()
+template< typename T, typename Allocator >
+void Helium::SparseArray< T, Allocator >::ResizeUsedElements( size_t capacity )
+{
+    size_t oldWordCount = GetUsedElementWordCount( m_capacity );
+    size_t wordCount = GetUsedElementWordCount( capacity );
+    if( wordCount != oldWordCount )
+    {
+        m_pUsedElements = static_cast< uint32_t* >(
+            m_allocator.Reallocate( m_pUsedElements, sizeof( uint32_t ) * wordCount ) );
+        HELIUM_ASSERT( m_pUsedElements || wordCount == 0 );
+
+        if( wordCount > oldWordCount )
+        {
+            MemoryZero( m_pUsedElements + oldWordCount, sizeof( uint32_t ) * ( wordCount - oldWordCount ) );
+        }
+    }
+
+    m_capacity = capacity;
+}
+
+/// Rebuild the used element summary from the used element bit array for the current capacity.
+///
+/// The summary consists of four bit arrays: one bit per used element bit array word that is set if the word has any
+/// free slots, one bit per word that is set if the word has any used slots, and a bit per word of each of those arrays
+/// that is set if the word has any bits set.  Bits for slots beyond the array capacity are always clear in the used
+/// element bit array, so they are treated as free slots.
+template< typename T, typename Allocator >
+void Helium::SparseArray< T, Allocator >::UpdateUsedElementSummary()
+{
+    m_allocator.Free( m_pUsedElementSummary );
+    m_pUsedElementSummary = NULL;
+
+    size_t wordCount = GetUsedElementWordCount( m_capacity );
+    size_t summaryWordCount = GetSummaryWordCount( wordCount );
+    size_t topWordCount = GetSummaryWordCount( summaryWordCount );
+    if( summaryWordCount == 0 )
+    {
+        return;
+    }
+
+    size_t summaryByteCount = sizeof( uint64_t ) * ( summaryWordCount + topWordCount ) * 2;
+    m_pUsedElementSummary = static_cast< uint64_t* >( m_allocator.Allocate( summaryByteCount ) );
+    HELIUM_ASSERT( m_pUsedElementSummary );
+    MemoryZero( m_pUsedElementSummary, summaryByteCount );
+
+    uint64_t* pFreeSummary = m_pUsedElementSummary;
+    uint64_t* pUsedSummary = pFreeSummary + summaryWordCount;
+    uint64_t* pFreeTop = pUsedSummary + summaryWordCount;
+    uint64_t* pUsedTop = pFreeTop + topWordCount;
+
+    for( size_t wordIndex = 0; wordIndex < wordCount; ++wordIndex )
+    {
+        uint32_t elementBits = m_pUsedElements[ wordIndex ];
+        uint64_t summaryMask = static_cast< uint64_t >( 1 ) << ( wordIndex % 64 );
+        if( elementBits != 0xffffffff )
+        {
+            pFreeSummary[ wordIndex / 64 ] |= summaryMask;
+        }
+
+        if( elementBits != 0 )
+        {
+            pUsedSummary[ wordIndex / 64 ] |= summaryMask;
+        }
+    }
+
+    for( size_t summaryIndex = 0; summaryIndex < summaryWordCount; ++summaryIndex )
+    {
+        uint64_t topMask = static_cast< uint64_t >( 1 ) << ( summaryIndex % 64 );
+        if( pFreeSummary[ summaryIndex ] != 0 )
+        {
+            pFreeTop[ summaryIndex / 64 ] |= topMask;
+        }
+
+        if( pUsedSummary[ summaryIndex ] != 0 )
+        {
+            pUsedTop[ summaryIndex / 64 ] |= topMask;
+        }
+    }
+}
+
+/// Mark an array slot as in use, updating the used element summary.
+///
+/// @param[in] index  Index of the slot to mark (must currently be unused).
+///
+/// @see ClearUsedElement()
+template< typename T, typename Allocator >
+void Helium::SparseArray< T, Allocator >::SetUsedElement( size_t index )
+{
+    HELIUM_ASSERT( index < m_capacity );
+
+    size_t wordIndex, maskIndex;
+    GetBitElementAndMaskIndex< uint32_t >( index, wordIndex, maskIndex );
+
+    uint32_t elementBits = m_pUsedElements[ wordIndex ];
+    HELIUM_ASSERT( !GetBit< uint32_t >( elementBits, maskIndex ) );
+    uint32_t newElementBits = elementBits | ( 1U << maskIndex );
+    m_pUsedElements[ wordIndex ] = newElementBits;
+
+    size_t summaryWordCount = GetSummaryWordCount( GetUsedElementWordCount( m_capacity ) );
+    size_t topWordCount = GetSummaryWordCount( summaryWordCount );
+    uint64_t* pFreeSummary = m_pUsedElementSummary;
+    uint64_t* pUsedSummary = pFreeSummary + summaryWordCount;
+    uint64_t* pFreeTop = pUsedSummary + summaryWordCount;
+    uint64_t* pUsedTop = pFreeTop + topWordCount;
+
+    size_t summaryIndex = wordIndex / 64;
+    uint64_t summaryMask = static_cast< uint64_t >( 1 ) << ( wordIndex % 64 );
+    size_t topIndex = summaryIndex / 64;
+    uint64_t topMask = static_cast< uint64_t >( 1 ) << ( summaryIndex % 64 );
+
+    if( elementBits == 0 )
+    {
+        pUsedSummary[ summaryIndex ] |= summaryMask;
+        pUsedTop[ topIndex ] |= topMask;
+    }
+
+    if( newElementBits == 0xffffffff )
+    {
+        uint64_t freeSummaryBits = pFreeSummary[ summaryIndex ] & ~summaryMask;
+        pFreeSummary[ summaryIndex ] = freeSummaryBits;
+        if( freeSummaryBits == 0 )
+        {
+            pFreeTop[ topIndex ] &= ~topMask;
+        }
+    }
+}
+
+/// Mark an array slot as unused, updating the used element summary.
+///
+/// @param[in] index  Index of the slot to mark (must currently be in use).
+///
+/// @see SetUsedElement()
+template< typename T, typename Allocator >
+void Helium::SparseArray< T, Allocator >::ClearUsedElement( size_t index )
+{
+    HELIUM_ASSERT( index < m_capacity );
+
+    size_t wordIndex, maskIndex;
+    GetBitElementAndMaskIndex< uint32_t >( index, wordIndex, maskIndex );
+
+    uint32_t elementBits = m_pUsedElements[ wordIndex ];
+    HELIUM_ASSERT( GetBit< uint32_t >( elementBits, maskIndex ) );
+    uint32_t newElementBits = elementBits & ~( 1U << maskIndex );
+    m_pUsedElements[ wordIndex ] = newElementBits;
+
+    size_t summaryWordCount = GetSummaryWordCount( GetUsedElementWordCount( m_capacity ) );
+    size_t topWordCount = GetSummaryWordCount( summaryWordCount );
+    uint64_t* pFreeSummary = m_pUsedElementSummary;
+    uint64_t* pUsedSummary = pFreeSummary + summaryWordCount;
+    uint64_t* pFreeTop = pUsedSummary + summaryWordCount;
+    uint64_t* pUsedTop = pFreeTop + topWordCount;
+
+    size_t summaryIndex = wordIndex / 64;
+    uint64_t summaryMask = static_cast< uint64_t >( 1 ) << ( wordIndex % 64 );
+    size_t topIndex = summaryIndex / 64;
+    uint64_t topMask = static_cast< uint64_t >( 1 ) << ( summaryIndex % 64 );
+
+    if( elementBits == 0xffffffff )
+    {
+        pFreeSummary[ summaryIndex ] |= summaryMask;
+        pFreeTop[ topIndex ] |= topMask;
+    }
+
+    if( newElementBits == 0 )
+    {
+        uint64_t usedSummaryBits = pUsedSummary[ summaryIndex ] & ~summaryMask;
+        pUsedSummary[ summaryIndex ] = usedSummaryBits;
+        if( usedSummaryBits == 0 )
+        {
+            pUsedTop[ topIndex ] &= ~topMask;
+        }
+    }
+}
+
+/// Find the first unused slot in this array.
+///
+/// Since slots past the end of the array are never in use, this returns the array size if there are no holes and the
+/// array has spare capacity.
+///
+/// @return  Index of the first unused slot, or an invalid index if every slot up to the array capacity is in use.
+template< typename T, typename Allocator >
+size_t Helium::SparseArray< T, Allocator >::FindFreeSlot() const
+{
+    size_t summaryWordCount = GetSummaryWordCount( GetUsedElementWordCount( m_capacity ) );
+    size_t topWordCount = GetSummaryWordCount( summaryWordCount );
+    const uint64_t* pFreeSummary = m_pUsedElementSummary;
+    const uint64_t* pFreeTop = pFreeSummary + summaryWordCount * 2;
+
+    for( size_t topIndex = 0; topIndex < topWordCount; ++topIndex )
+    {
+        uint64_t topBits = pFreeTop[ topIndex ];
+        if( topBits != 0 )
+        {
+            size_t summaryIndex = topIndex * 64 + CountTrailingZeros( topBits );
+            size_t wordIndex = summaryIndex * 64 + CountTrailingZeros( pFreeSummary[ summaryIndex ] );
+            size_t index = wordIndex * 32 + CountTrailingZeros( ~m_pUsedElements[ wordIndex ] );
+
+            return ( index < m_capacity ? index : Invalid< size_t >() );
+        }
+    }
+
+    return Invalid< size_t >();
+}
+
+/// Find the last used slot in this array before a given index.
+///
+/// @param[in] endIndex  Index at which to stop searching (the slot at this index is not checked).
+///
+/// @return  Index of the last used slot before the given index, or an invalid index if no slots before the given
+///          index are in use.
+template< typename T, typename Allocator >
+size_t Helium::SparseArray< T, Allocator >::FindLastUsedSlot( size_t endIndex ) const
+{
+    HELIUM_ASSERT( endIndex <= m_capacity );
+    if( endIndex == 0 )
+    {
+        return Invalid< size_t >();
+    }
+
+    size_t summaryWordCount = GetSummaryWordCount( GetUsedElementWordCount( m_capacity ) );
+    size_t topWordCount = GetSummaryWordCount( summaryWordCount );
+    const uint64_t* pUsedSummary = m_pUsedElementSummary + summaryWordCount;
+    const uint64_t* pUsedTop = m_pUsedElementSummary + summaryWordCount * 2 + topWordCount;
+
+    // Check the bit array word containing the slot before the end index first.
+    size_t wordIndex, maskIndex;
+    GetBitElementAndMaskIndex< uint32_t >( endIndex - 1, wordIndex, maskIndex );
+
+    uint32_t elementBits = m_pUsedElements[ wordIndex ] & ( 0xffffffffU >> ( 31 - maskIndex ) );
+    if( elementBits != 0 )
+    {
+        return wordIndex * 32 + 31 - CountLeadingZeros( elementBits );
+    }
+
+    // Find the last preceding bit array word with used slots, first using the summary word containing the current
+    // word, and then using the top-level summary.
+    size_t summaryIndex = wordIndex / 64;
+    uint64_t summaryMask = ( static_cast< uint64_t >( 1 ) << ( wordIndex % 64 ) ) - 1;
+    uint64_t summaryBits = pUsedSummary[ summaryIndex ] & summaryMask;
+    if( summaryBits == 0 )
+    {
+        size_t topIndex = summaryIndex / 64;
+        uint64_t topMask = ( static_cast< uint64_t >( 1 ) << ( summaryIndex % 64 ) ) - 1;
+        uint64_t topBits = pUsedTop[ topIndex ] & topMask;
+        while( topBits == 0 )
+        {
+            if( topIndex == 0 )
+            {
+                return Invalid< size_t >();
+            }
+
+            --topIndex;
+            topBits = pUsedTop[ topIndex ];
+        }
+
+        summaryIndex = topIndex * 64 + 63 - CountLeadingZeros( topBits );
+        summaryBits = pUsedSummary[ summaryIndex ];
+        HELIUM_ASSERT( summaryBits != 0 );
+    }
+
+    wordIndex = summaryIndex * 64 + 63 - CountLeadingZeros( summaryBits );
+    elementBits = m_pUsedElements[ wordIndex ];
+    HELIUM_ASSERT( elementBits != 0 );
+
+    return wordIndex * 32 + 31 - CountLeadingZeros( elementBits );
+}
+
+/// Get the number of words needed for the used element bit array of an array with the given capacity.
+///
+/// @param[in] capacity  Array capacity.
+///
+/// @return  Number of 32-bit words in the used element bit array.
+template< typename T, typename Allocator >
+size_t Helium::SparseArray< T, Allocator >::GetUsedElementWordCount( size_t capacity )
+{
+    return ( capacity + 31 ) / 32;
+}
+
+/// Get the number of words needed for a summary bit array with one bit per word of another bit array.
+///
+/// @param[in] wordCount  Number of words in the bit array being summarized.
+///
+/// @return  Number of 64-bit words in the summary.
+template< typename T, typename Allocator >
+size_t Helium::SparseArray< T, Allocator >::GetSummaryWordCount( size_t wordCount )
+{
+    return ( wordCount + 63 ) / 64;
+}
+
 /// Assignment operator implementation.
 ///
 /// This is separated out to help deal with the fact that the default (shallow-copy) assignment operator is used if we
@@ -32,6 +32,16 @@ CharString::CharString( const char* pString, size_t size )
 {
 }
 
+/// Constructor.
+///
+/// This creates a copy of the characters referenced by a string view.
+///
+/// @param[in] rString  String view from which to copy.
+CharString::CharString( const CharStringView& rString )
+	: StringBase( rString )
+{
+}
+
 /// Copy constructor.
 ///
 /// When copying, only the memory needed to hold onto the used contents of the source string will be allocated (i.e.
@@ -44,6 +54,16 @@ CharString::CharString( const CharString& rSource )
 {
 }
 
+/// Move constructor.
+///
+/// This takes ownership of the buffer of the given string, leaving the given string empty.
+///
+/// @param[in] rSource  String from which to move.
+CharString::CharString( CharString&& rSource )
+	: StringBase( std::move( rSource ) )
+{
+}
+
 /// Append a character to the end of this string.
 ///
 /// @param[in] character  Character to append.
@@ -71,6 +91,16 @@ void CharString::Add( const CharString& rString )
 	StringBase::Add( rString );
 }
 
+/// Append the characters referenced by a string view to the end of this string.
+///
+/// Note that it is not safe to append a view of this string to itself using this function.
+///
+/// @param[in] rString  String view to append.
+void CharString::Add( const CharStringView& rString )
+{
+	StringBase::Add( rString );
+}
+
 /// Insert copies of a character at the specified index in this string.
 ///
 /// @param[in] index      Index at which to insert copies of the character.
@@ -103,6 +133,17 @@ void CharString::Insert( size_t index, const CharString& rString )
 	StringBase::Insert( index, rString );
 }
 
+/// Insert a copy of the characters referenced by a string view at the specified index in this string.
+///
+/// Note that it is not safe to insert a view of this string to itself using this function.
+///
+/// @param[in] index    Index at which to insert a copy of the string.
+/// @param[in] rString  String view to insert.
+void CharString::Insert( size_t index, const CharStringView& rString )
+{
+	StringBase::Insert( index, rString );
+}
+
 /// Set this string to a single character.
 ///
 /// This will always destroy the current string contents and allocate a fresh buffer whose capacity matches that
@@ -146,6 +187,30 @@ CharString& CharString::operator=( const CharString& rSource )
 	return *this;
 }
 
+/// Set this string to the contents of the given string, taking ownership of its buffer.
+///
+/// The given string is left empty.
+///
+/// @param[in] rSource  String from which to move.
+///
+/// @return  Reference to this string.
+CharString& CharString::operator=( CharString&& rSource )
+{
+	m_buffer = std::move( rSource.m_buffer );
+	return *this;
+}
+
+/// Set this string to a copy of the characters referenced by a string view.
+///
+/// @param[in] rString  String view from which to copy.  This can reference characters in this string.
+///
+/// @return  Reference to this string.
+CharString& CharString::operator=( const CharStringView& rString )
+{
+	StringBase::operator=( rString );
+	return *this;
+}
+
 /// Append a character to the end of this string.
 ///
 /// @param[in] character  Character to append.
@@ -179,6 +244,17 @@ CharString& CharString::operator+=( const CharString& rString )
 	return *this;
 }
 
+/// Append the characters referenced by a string view to the end of this string.
+///
+/// @param[in] rString  String view to append.
+///
+/// @return  Reference to this string.
+CharString& CharString::operator+=( const CharStringView& rString )
+{
+	Add( rString );
+	return *this;
+}
+
 /// Check whether the contents of this string match the contents of a given null-terminated C-style string.
 ///
 /// @param[in] pString  String with which to compare.  This can be null.
@@ -199,6 +275,16 @@ bool CharString::operator==( const CharString& rString ) const
 	return StringBase::operator==( rString );
 }
 
+/// Check whether the contents of this string match the characters referenced by a given string view.
+///
+/// @param[in] rString  String view with which to compare.
+///
+/// @return  True if the strings match, false if not.
+bool CharString::operator==( const CharStringView& rString ) const
+{
+	return StringBase::operator==( rString );
+}
+
 /// Check whether the contents of this string do not match the contents of a given null-terminated C-style string.
 ///
 /// @param[in] pString  String with which to compare.  This can be null.
@@ -219,6 +305,16 @@ bool CharString::operator!=( const CharString& rString ) const
 	return StringBase::operator!=( rString );
 }
 
+/// Check whether the contents of this string do not match the characters referenced by a given string view.
+///
+/// @param[in] rString  String view with which to compare.
+///
+/// @return  True if the strings do not match, false if they do.
+bool CharString::operator!=( const CharStringView& rString ) const
+{
+	return StringBase::operator!=( rString );
+}
+
 
 /// Constructor.
 ///
@@ -249,6 +345,16 @@ WideString::WideString( const wchar_t* pString, size_t size )
 {
 }
 
+/// Constructor.
+///
+/// This creates a copy of the characters referenced by a string view.
+///
+/// @param[in] rString  String view from which to copy.
+WideString::WideString( const WideStringView& rString )
+	: StringBase( rString )
+{
+}
+
 /// Copy constructor.
 ///
 /// When copying, only the memory needed to hold onto the used contents of the source string will be allocated (i.e.
@@ -261,6 +367,16 @@ WideString::WideString( const WideString& rSource )
 {
 }
 
+/// Move constructor.
+///
+/// This takes ownership of the buffer of the given string, leaving the given string empty.
+///
+/// @param[in] rSource  String from which to move.
+WideString::WideString( WideString&& rSource )
+	: StringBase( std::move( rSource ) )
+{
+}
+
 /// Append a character to the end of this string.
 ///
 /// @param[in] character  Character to append.
@@ -288,6 +404,16 @@ void WideString::Add( const WideString& rString )
 	StringBase::Add( rString );
 }
 
+/// Append the characters referenced by a string view to the end of this string.
+///
+/// Note that it is not safe to append a view of this string to itself using this function.
+///
+/// @param[in] rString  String view to append.
+void WideString::Add( const WideStringView& rString )
+{
+	StringBase::Add( rString );
+}
+
 /// Insert copies of a character at the specified index in this string.
 ///
 /// @param[in] index      Index at which to insert copies of the character.
@@ -320,6 +446,17 @@ void WideString::Insert( size_t index, const WideString& rString )
 	StringBase::Insert( index, rString );
 }
 
+/// Insert a copy of the characters referenced by a string view at the specified index in this string.
+///
+/// Note that it is not safe to insert a view of this string to itself using this function.
+///
+/// @param[in] index    Index at which to insert a copy of the string.
+/// @param[in] rString  String view to insert.
+void WideString::Insert( size_t index, const WideStringView& rString )
+{
+	StringBase::Insert( index, rString );
+}
+
 /// Set this string to a single character.
 ///
 /// This will always destroy the current string contents and allocate a fresh buffer whose capacity matches that
@@ -363,6 +500,30 @@ WideString& WideString::operator=( const WideString& rSource )
 	return *this;
 }
 
+/// Set this string to the contents of the given string, taking ownership of its buffer.
+///
+/// The given string is left empty.
+///
+/// @param[in] rSource  String from which to move.
+///
+/// @return  Reference to this string.
+WideString& WideString::operator=( WideString&& rSource )
+{
+	m_buffer = std::move( rSource.m_buffer );
+	return *this;
+}
+
+/// Set this string to a copy of the characters referenced by a string view.
+///
+/// @param[in] rString  String view from which to copy.  This can reference characters in this string.
+///
+/// @return  Reference to this string.
+WideString& WideString::operator=( const WideStringView& rString )
+{
+	StringBase::operator=( rString );
+	return *this;
+}
+
 /// Append a character to the end of this string.
 ///
 /// @param[in] character  Character to append.
@@ -396,6 +557,17 @@ WideString& WideString::operator+=( const WideString& rString )
 	return *this;
 }
 
+/// Append the characters referenced by a string view to the end of this string.
+///
+/// @param[in] rString  String view to append.
+///
+/// @return  Reference to this string.
+WideString& WideString::operator+=( const WideStringView& rString )
+{
+	Add( rString );
+	return *this;
+}
+
 /// Check whether the contents of this string match the contents of a given null-terminated C-style string.
 ///
 /// @param[in] pString  String with which to compare.  This can be null.
@@ -416,6 +588,16 @@ bool WideString::operator==( const WideString& rString ) const
 	return StringBase::operator==( rString );
 }
 
+/// Check whether the contents of this string match the characters referenced by a given string view.
+///
+/// @param[in] rString  String view with which to compare.
+///
+/// @return  True if the strings match, false if not.
+bool WideString::operator==( const WideStringView& rString ) const
+{
+	return StringBase::operator==( rString );
+}
+
 /// Check whether the contents of this string do not match the contents of a given null-terminated C-style string.
 ///
 /// @param[in] pString  String with which to compare.  This can be null.
@@ -436,6 +618,16 @@ bool WideString::operator!=( const WideString& rString ) const
 	return StringBase::operator!=( rString );
 }
 
+/// Check whether the contents of this string do not match the characters referenced by a given string view.
+///
+/// @param[in] rString  String view with which to compare.
+///
+/// @return  True if the strings do not match, false if they do.
+bool WideString::operator!=( const WideStringView& rString ) const
+{
+	return StringBase::operator!=( rString );
+}
+
 /// Default CharString hash.
 ///
 /// @param[in] rKey  Key for which to compute a hash value.
@@ -9,6 +9,9 @@
 #include "Foundation/Math.h"
 #include "Foundation/HashFunctions.h"
 #include "Foundation/DynamicArray.h"
+#include "Foundation/InlineStringBuffer.h"
+#include "Foundation/StringView.h"
+#include "Foundation/StringFormat.h"
 
 #include <string>
 #include <stdlib.h>
@@ -16,15 +19,26 @@
 namespace Helium
 {
 	/// Base string class.
+	///
+	/// Short strings (up to INLINE_CAPACITY character type elements, including the null terminator) are stored in the
+	/// string object itself, overlapping the pointer, size, and capacity fields used once memory has been allocated.
+	/// Such strings can be created, copied, and destroyed without allocating any memory, while the string object stays
+	/// the size of three pointers.
+	///
+	/// @see InlineStringBuffer
 	template< typename CharType, typename Allocator = DefaultAllocator >
 	class StringBase
 	{
 	public:
+		/// Number of character type elements (including the null terminator) stored without allocating memory.
+		static const size_t INLINE_CAPACITY = InlineStringBuffer< CharType, Allocator >::INLINE_CAPACITY;
+
 		/// @name Construction/Destruction
 		//@{
 		StringBase();
 		explicit StringBase( const CharType* pString );
 		StringBase( const CharType* pString, size_t size );
+		explicit StringBase( const StringView< CharType >& rString );
 		//@}
 
 		/// @name String Operations
@@ -46,14 +60,17 @@ namespace Helium
 
 		void Add( CharType character, size_t count = 1 );
 		void Add( const CharType* pString, size_t length = 0 );
+		void Add( const StringView< CharType >& rString );
 		void Insert( size_t index, CharType character, size_t count = 1 );
 		void Insert( size_t index, const CharType* pString );
+		void Insert( size_t index, const StringView< CharType >& rString );
 		void Remove( size_t index, size_t count = 1 );
 
 		template< typename OtherAllocator > void Substring(
 			StringBase< CharType, OtherAllocator >& rOutput, size_t index = 0,
 			size_t count = Invalid< size_t >() ) const;
 		StringBase Substring( size_t index = 0, size_t count = Invalid< size_t >() ) const;
+		StringView< CharType > SubstringView( size_t index = 0, size_t count = Invalid< size_t >() ) const;
 
 		CharType& GetFirst();
 		const CharType& GetFirst() const;
@@ -66,9 +83,18 @@ namespace Helium
 		uint32_t Parse( const CharType* pFormatString, ... );
 		//@}
 
+		/// @name Typed Formatting
+		//@{
+		void FormatTyped( const CharType* pFormatString );
+		template< typename... Args > void FormatTyped( const CharType* pFormatString, const Args&... args );
+		void AddFormatTyped( const CharType* pFormatString );
+		template< typename... Args > void AddFormatTyped( const CharType* pFormatString, const Args&... args );
+		//@}
+
 		/// @name Parsing
 		//@{
 		size_t Find( CharType character, size_t startIndex = 0 ) const;
+		size_t Find( const StringView< CharType >& rString, size_t startIndex = 0 ) const;
 		size_t FindReverse( CharType character, size_t startIndex = Invalid< size_t >() ) const;
 
 		size_t FindAny(
@@ -97,14 +123,17 @@ namespace Helium
 		template< typename OtherAllocator > bool Contains(
 			const StringBase< CharType, OtherAllocator >& rString ) const;
 		bool Contains( const CharType* pString ) const;
+		bool Contains( const StringView< CharType >& rString ) const;
 
 		template< typename OtherAllocator > bool StartsWith(
 			const StringBase< CharType, OtherAllocator >& rString ) const;
 		bool StartsWith( const CharType* pString ) const;
+		bool StartsWith( const StringView< CharType >& rString ) const;
 
 		template< typename OtherAllocator > bool EndsWith(
 			const StringBase< CharType, OtherAllocator >& rString ) const;
 		bool EndsWith( const CharType* pString ) const;
+		bool EndsWith( const StringView< CharType >& rString ) const;
 
 		template< typename ArrayType, typename ArrayAllocator > void Split(
 			DynamicArray< ArrayType, ArrayAllocator >& rStringResults, CharType separator,
@@ -126,6 +155,7 @@ namespace Helium
 
 		StringBase& operator=( CharType character );
 		StringBase& operator=( const CharType* pString );
+		StringBase& operator=( const StringView< CharType >& rString );
 		template< typename OtherAllocator > StringBase& operator=(
 			const StringBase< CharType, OtherAllocator >& rSource );
 
@@ -136,15 +166,17 @@ namespace Helium
 		bool operator==( const CharType* pString ) const;
 		template< typename OtherAllocator > bool operator==(
 			const StringBase< CharType, OtherAllocator >& rString ) const;
+		bool operator==( const StringView< CharType >& rString ) const;
 
 		bool operator!=( const CharType* pString ) const;
 		template< typename OtherAllocator > bool operator!=(
 			const StringBase< CharType, OtherAllocator >& rString ) const;
+		bool operator!=( const StringView< CharType >& rString ) const;
 		//@}
 
 	protected:
-		/// Allocated string buffer.
-		DynamicArray< CharType, Allocator > m_buffer;
+		/// String buffer.
+		InlineStringBuffer< CharType, Allocator > m_buffer;
 
 		/// @name Protected String Operations
 		//@{
@@ -152,6 +184,13 @@ namespace Helium
 		template< typename OtherAllocator > void Insert(
 			size_t index, const StringBase< CharType, OtherAllocator >& rString );
 		//@}
+
+	private:
+		/// @name Private String Operations
+		//@{
+		void AddFormatArgs(
+			const CharType* pFormatString, const FormatArgument< CharType >* pArguments, size_t argumentCount );
+		//@}
 	};
 
 	/// 8-bit character string class.
@@ -163,7 +202,9 @@ namespace Helium
 		CharString();
 		explicit CharString( const char* pString );
 		CharString( const char* pString, size_t size );
+		explicit CharString( const CharStringView& rString );
 		CharString( const CharString& rSource );
+		CharString( CharString&& rSource );
 		//@}
 
 		/// @name String Operations
@@ -171,10 +212,12 @@ namespace Helium
 		void Add( char character, size_t count = 1 );
 		void Add( const char* pString, size_t length = 0 );
 		void Add( const CharString& rString );
+		void Add( const CharStringView& rString );
 
 		void Insert( size_t index, char character, size_t count = 1 );
 		void Insert( size_t index, const char* pString );
 		void Insert( size_t index, const CharString& rString );
+		void Insert( size_t index, const CharStringView& rString );
 		//@}
 
 		/// @name Overloaded Operators
@@ -182,15 +225,20 @@ namespace Helium
 		CharString& operator=( char character );
 		CharString& operator=( const char* pString );
 		CharString& operator=( const CharString& rSource );
+		CharString& operator=( CharString&& rSource );
+		CharString& operator=( const CharStringView& rString );
 
 		CharString& operator+=( char character );
 		CharString& operator+=( const char* pString );
 		CharString& operator+=( const CharString& rString );
+		CharString& operator+=( const CharStringView& rString );
 
 		bool operator==( const char* pString ) const;
 		bool operator==( const CharString& rString ) const;
+		bool operator==( const CharStringView& rString ) const;
 		bool operator!=( const char* pString ) const;
 		bool operator!=( const CharString& rString ) const;
+		bool operator!=( const CharStringView& rString ) const;
 		//@}
 	};
 
@@ -203,7 +251,9 @@ namespace Helium
 		WideString();
 		explicit WideString( const wchar_t* pString );
 		WideString( const wchar_t* pString, size_t size );
+		explicit WideString( const WideStringView& rString );
 		WideString( const WideString& rSource );
+		WideString( WideString&& rSource );
 		//@}
 
 		/// @name String Operations
@@ -211,10 +261,12 @@ namespace Helium
 		void Add( wchar_t character, size_t count = 1 );
 		void Add( const wchar_t* pString, size_t length = 0 );
 		void Add( const WideString& rString );
+		void Add( const WideStringView& rString );
 
 		void Insert( size_t index, wchar_t character, size_t count = 1 );
 		void Insert( size_t index, const wchar_t* pString );
 		void Insert( size_t index, const WideString& rString );
+		void Insert( size_t index, const WideStringView& rString );
 		//@}
 
 		/// @name Overloaded Operators
@@ -222,15 +274,20 @@ namespace Helium
 		WideString& operator=( wchar_t character );
 		WideString& operator=( const wchar_t* pString );
 		WideString& operator=( const WideString& rSource );
+		WideString& operator=( WideString&& rSource );
+		WideString& operator=( const WideStringView& rString );
 
 		WideString& operator+=( wchar_t character );
 		WideString& operator+=( const wchar_t* pString );
 		WideString& operator+=( const WideString& rString );
+		WideString& operator+=( const WideStringView& rString );
 
 		bool operator==( const wchar_t* pString ) const;
 		bool operator==( const WideString& rString ) const;
+		bool operator==( const WideStringView& rString ) const;
 		bool operator!=( const wchar_t* pString ) const;
 		bool operator!=( const WideString& rString ) const;
+		bool operator!=( const WideStringView& rString ) const;
 		//@}
 	};
 
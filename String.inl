@@ -43,6 +43,23 @@ Helium::StringBase< CharType, Allocator >::StringBase( const CharType* pString,
 	}
 }
 
+/// Constructor.
+///
+/// This creates a copy of the characters referenced by a string view.
+///
+/// @param[in] rString  String view from which to copy.
+template< typename CharType, typename Allocator >
+Helium::StringBase< CharType, Allocator >::StringBase( const StringView< CharType >& rString )
+{
+	size_t size = rString.GetSize();
+	if( size != 0 )
+	{
+		m_buffer.Reserve( size + 1 );
+		m_buffer.Set( rString.GetData(), size );
+		m_buffer.Add( static_cast< CharType >( '\0' ) );
+	}
+}
+
 /// Get the size of this string.
 ///
 /// Note that this only counts the number of character type elements in the internal string buffer up to, but not
@@ -234,6 +251,17 @@ void Helium::StringBase< CharType, Allocator >::Add( const CharType* pString, si
 	}
 }
 
+/// Append the characters referenced by a string view to the end of this string.
+///
+/// Note that it is not safe to append a view of this string to itself using this function.
+///
+/// @param[in] rString  String view to append.
+template< typename CharType, typename Allocator >
+void Helium::StringBase< CharType, Allocator >::Add( const StringView< CharType >& rString )
+{
+	Insert( GetSize(), rString );
+}
+
 /// Insert copies of a character at the specified index in this string.
 ///
 /// @param[in] index      Index at which to insert copies of the character.
@@ -286,6 +314,37 @@ void Helium::StringBase< CharType, Allocator >::Insert( size_t index, const Char
 	}
 }
 
+/// Insert a copy of the characters referenced by a string view at the specified index in this string.
+///
+/// Note that it is not safe to insert a view of this string to itself using this function.
+///
+/// @param[in] index    Index at which to insert a copy of the string.
+/// @param[in] rString  String view to insert.
+template< typename CharType, typename Allocator >
+void Helium::StringBase< CharType, Allocator >::Insert( size_t index, const StringView< CharType >& rString )
+{
+	HELIUM_ASSERT( index <= GetSize() );
+
+	size_t stringLength = rString.GetSize();
+	if( stringLength != 0 )
+	{
+		const CharType* pString = rString.GetData();
+		HELIUM_ASSERT( pString < m_buffer.GetData() || pString >= m_buffer.GetData() + m_buffer.GetSize() );
+
+		if( m_buffer.GetSize() == 0 )
+		{
+			// String views are not necessarily null-terminated, so the terminator needs to be added separately.
+			m_buffer.Reserve( stringLength + 1 );
+			m_buffer.AddArray( pString, stringLength );
+			m_buffer.Add( static_cast< CharType >( 0 ) );
+		}
+		else
+		{
+			m_buffer.InsertArray( index, pString, stringLength );
+		}
+	}
+}
+
 /// Remove characters from this string.
 ///
 /// @param[in] index  Index from which to remove character type elements.
@@ -357,6 +416,22 @@ Helium::StringBase< CharType, Allocator > Helium::StringBase< CharType, Allocato
 	return output;
 }
 
+/// Get a view of a range of characters in this string without copying them.
+///
+/// The view is only valid until this string is modified or destroyed.
+///
+/// @param[in] index  Starting character index.
+/// @param[in] count  Maximum number of characters to include.
+///
+/// @return  View of the requested characters.
+template< typename CharType, typename Allocator >
+Helium::StringView< CharType > Helium::StringBase< CharType, Allocator >::SubstringView(
+	size_t index,
+	size_t count ) const
+{
+	return StringView< CharType >( *this ).Substring( index, count );
+}
+
 /// Get the first character in this string.
 ///
 /// @return  Reference to the first element in this string.
@@ -501,6 +576,112 @@ void Helium::StringBase< CharType, Allocator >::Format( const CharType* pFormatS
 	va_end( argList );
 }
 
+/// Set this string using typed formatting.
+///
+/// @param[in] pFormatString  Format string.
+///
+/// @see AddFormatTyped(), StringFormat()
+template< typename CharType, typename Allocator >
+void Helium::StringBase< CharType, Allocator >::FormatTyped( const CharType* pFormatString )
+{
+	m_buffer.Resize( 0 );
+	AddFormatArgs( pFormatString, NULL, 0 );
+}
+
+/// Set this string using typed formatting.
+///
+/// The string is formatted directly into the existing string buffer, so no memory is allocated if the result fits
+/// within the current capacity.  Format arguments must not reference this string.
+///
+/// @param[in] pFormatString  Format string.
+/// @param[in] args           Format arguments.
+///
+/// @see AddFormatTyped(), StringFormat()
+template< typename CharType, typename Allocator >
+template< typename... Args >
+void Helium::StringBase< CharType, Allocator >::FormatTyped( const CharType* pFormatString, const Args&... args )
+{
+	const FormatArgument< CharType > arguments[] = { args... };
+
+	m_buffer.Resize( 0 );
+	AddFormatArgs( pFormatString, arguments, sizeof...( Args ) );
+}
+
+/// Append to the end of this string using typed formatting.
+///
+/// @param[in] pFormatString  Format string.
+///
+/// @see FormatTyped(), StringFormat()
+template< typename CharType, typename Allocator >
+void Helium::StringBase< CharType, Allocator >::AddFormatTyped( const CharType* pFormatString )
+{
+	AddFormatArgs( pFormatString, NULL, 0 );
+}
+
+/// Append to the end of this string using typed formatting.
+///
+/// The string is formatted directly into the existing string buffer, so no memory is allocated if the result fits
+/// within the current capacity.  Format arguments must not reference this string.
+///
+/// @param[in] pFormatString  Format string.
+/// @param[in] args           Format arguments.
+///
+/// @see FormatTyped(), StringFormat()
+template< typename CharType, typename Allocator >
+template< typename... Args >
+void Helium::StringBase< CharType, Allocator >::AddFormatTyped( const CharType* pFormatString, const Args&... args )
+{
+	const FormatArgument< CharType > arguments[] = { args... };
+
+	AddFormatArgs( pFormatString, arguments, sizeof...( Args ) );
+}
+
+/// Append a formatted string to the end of this string.
+///
+/// @param[in] pFormatString  Format string.
+/// @param[in] pArguments     Format arguments.
+/// @param[in] argumentCount  Number of format arguments.
+template< typename CharType, typename Allocator >
+void Helium::StringBase< CharType, Allocator >::AddFormatArgs(
+	const CharType* pFormatString,
+	const FormatArgument< CharType >* pArguments,
+	size_t argumentCount )
+{
+	HELIUM_ASSERT( pFormatString );
+
+	// Format into the unused buffer capacity first, only growing the buffer and formatting again if the result does not
+	// fit.
+	size_t startSize = GetSize();
+	size_t bufferSize = Max( m_buffer.GetCapacity(), startSize + 1 );
+	m_buffer.Resize( bufferSize );
+
+	size_t resultLength = StringFormatArgs(
+		m_buffer.GetData() + startSize,
+		bufferSize - startSize,
+		pFormatString,
+		pArguments,
+		argumentCount );
+
+	size_t newBufferSize = startSize + resultLength + 1;
+	if( newBufferSize > bufferSize )
+	{
+		m_buffer.Resize( newBufferSize );
+
+		size_t finalLength = StringFormatArgs(
+			m_buffer.GetData() + startSize,
+			resultLength + 1,
+			pFormatString,
+			pArguments,
+			argumentCount );
+		HELIUM_ASSERT( finalLength == resultLength );
+		HELIUM_UNREF( finalLength );
+	}
+	else
+	{
+		m_buffer.Resize( newBufferSize > 1 ? newBufferSize : 0 );
+	}
+}
+
 /// Find the first instance of the specified character, starting from the given offset.
 ///
 /// @param[in] character   Character to locate.
@@ -512,16 +693,23 @@ void Helium::StringBase< CharType, Allocator >::Format( const CharType* pFormatS
 template< typename CharType, typename Allocator >
 size_t Helium::StringBase< CharType, Allocator >::Find( CharType character, size_t startIndex ) const
 {
-	size_t size = GetSize();
-	for( size_t index = startIndex; index < size; ++index )
-	{
-		if( m_buffer[ index ] == character )
-		{
-			return index;
-		}
-	}
+	return StringView< CharType >( *this ).Find( character, startIndex );
+}
 
-	return Invalid< size_t >();
+/// Find the first instance of the specified string, starting from the given offset.
+///
+/// @param[in] rString     String to locate.
+/// @param[in] startIndex  Index from which to start searching.
+///
+/// @return  Index of the first instance of the specified string if found, or an invalid index if not found.
+///
+/// @see FindReverse(), FindAny(), FindAnyReverse(), FindNone(), FindNoneReverse()
+template< typename CharType, typename Allocator >
+size_t Helium::StringBase< CharType, Allocator >::Find(
+	const StringView< CharType >& rString,
+	size_t startIndex ) const
+{
+	return StringView< CharType >( *this ).Find( rString, startIndex );
 }
 
 /// Find the last instance of the specified character, starting from the given offset and searching in reverse.
@@ -576,23 +764,7 @@ size_t Helium::StringBase< CharType, Allocator >::FindAny(
 		characterCount = StringLength( pCharacters );
 	}
 
-	if( characterCount != 0 )
-	{
-		size_t size = GetSize();
-		for( size_t index = startIndex; index < size; ++index )
-		{
-			CharType testCharacter = m_buffer[ index ];
-			for( size_t characterIndex = 0; characterIndex < characterCount; ++characterIndex )
-			{
-				if( testCharacter == pCharacters[ characterIndex ] )
-				{
-					return index;
-				}
-			}
-		}
-	}
-
-	return Invalid< size_t >();
+	return StringView< CharType >( *this ).FindAny( StringView< CharType >( pCharacters, characterCount ), startIndex );
 }
 
 /// Find the first instance of any of the characters in the given string, starting from the given offset.
@@ -703,29 +875,12 @@ size_t Helium::StringBase< CharType, Allocator >::FindNone(
 		characterCount = StringLength( pCharacters );
 	}
 
-	if( characterCount != 0 )
+	if( characterCount == 0 )
 	{
-		size_t size = GetSize();
-		for( size_t index = startIndex; index < size; ++index )
-		{
-			CharType testCharacter = m_buffer[ index ];
-			size_t characterIndex;
-			for( characterIndex = 0; characterIndex < characterCount; ++characterIndex )
-			{
-				if( testCharacter == pCharacters[ characterIndex ] )
-				{
-					break;
-				}
-			}
-
-			if( characterIndex >= characterCount )
-			{
-				return index;
-			}
-		}
+		return Invalid< size_t >();
 	}
 
-	return Invalid< size_t >();
+	return StringView< CharType >( *this ).FindNone( StringView< CharType >( pCharacters, characterCount ), startIndex );
 }
 
 /// Find the first character not in a given set of characters, starting from the given offset.
@@ -827,16 +982,7 @@ size_t Helium::StringBase< CharType, Allocator >::FindNoneReverse(
 template< typename CharType, typename Allocator >
 bool Helium::StringBase< CharType, Allocator >::Contains( CharType character ) const
 {
-	size_t size = GetSize();
-	for( size_t index = 0; index < size; ++index )
-	{
-		if( m_buffer[ index ] == character )
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return IsValid( Find( character ) );
 }
 
 /// Check whether this string contains another string.
@@ -848,32 +994,7 @@ template< typename CharType, typename Allocator >
 template< typename OtherAllocator >
 bool Helium::StringBase< CharType, Allocator >::Contains( const StringBase< CharType, OtherAllocator >& rString ) const
 {
-	size_t otherSize = rString.GetSize();
-	if( otherSize == 0 )
-	{
-		// We always contain an empty string.
-		return true;
-	}
-
-	size_t size = GetSize();
-	if( otherSize > size )
-	{
-		return false;
-	}
-
-	const CharType* pString = rString.m_buffer.GetData();
-
-	size -= otherSize;
-	size_t otherByteCount = sizeof( CharType ) * otherSize;
-	for( size_t index = 0; index < size; ++index )
-	{
-		if( MemoryCompare( &m_buffer[ index ], pString, otherByteCount ) == 0 )
-		{
-			return true;
-		}
-	}
-
-	return false;
+	return StringView< CharType >( *this ).Contains( StringView< CharType >( rString ) );
 }
 
 /// Check whether this string contains another string.
@@ -890,29 +1011,18 @@ bool Helium::StringBase< CharType, Allocator >::Contains( const CharType* pStrin
 		return false;
 	}
 
-	size_t otherSize = StringLength( pString );
-	if( otherSize == 0 )
-	{
-		return true;
-	}
-
-	size_t size = GetSize();
-	if( otherSize > size )
-	{
-		return false;
-	}
-
-	size -= otherSize;
-	size_t otherByteCount = sizeof( CharType ) * otherSize;
-	for( size_t index = 0; index < size; ++index )
-	{
-		if( MemoryCompare( &m_buffer[ index ], pString, otherByteCount ) == 0 )
-		{
-			return true;
-		}
-	}
+	return StringView< CharType >( *this ).Contains( StringView< CharType >( pString ) );
+}
 
-	return false;
+/// Check whether this string contains another string.
+///
+/// @param[in] rString  String view for which to check.
+///
+/// @return  True if this string contains the specified string, false if not.
+template< typename CharType, typename Allocator >
+bool Helium::StringBase< CharType, Allocator >::Contains( const StringView< CharType >& rString ) const
+{
+	return StringView< CharType >( *this ).Contains( rString );
 }
 
 /// Check whether this string starts with a given string.
@@ -964,6 +1074,19 @@ bool Helium::StringBase< CharType, Allocator >::StartsWith( const CharType* pStr
 	return ( compareResult == 0 );
 }
 
+/// Check whether this string starts with a given string.
+///
+/// @param[in] rString  String view with which to check.
+///
+/// @return  True if this string starts with the given string, false if not.
+///
+/// @see EndsWith()
+template< typename CharType, typename Allocator >
+bool Helium::StringBase< CharType, Allocator >::StartsWith( const StringView< CharType >& rString ) const
+{
+	return StringView< CharType >( *this ).StartsWith( rString );
+}
+
 /// Check whether this string ends with a given string.
 ///
 /// @param[in] rString  String with which to check.
@@ -1017,6 +1140,19 @@ bool Helium::StringBase< CharType, Allocator >::EndsWith( const CharType* pStrin
 	return ( compareResult == 0 );
 }
 
+/// Check whether this string ends with a given string.
+///
+/// @param[in] rString  String view with which to check.
+///
+/// @return  True if this string ends with the given string, false if not.
+///
+/// @see StartsWith()
+template< typename CharType, typename Allocator >
+bool Helium::StringBase< CharType, Allocator >::EndsWith( const StringView< CharType >& rString ) const
+{
+	return StringView< CharType >( *this ).EndsWith( rString );
+}
+
 /// Split a string into an array of strings based on the specified character separator.
 ///
 /// @param[out] rStringResults              List of resulting strings.
@@ -1035,33 +1171,7 @@ void Helium::StringBase< CharType, Allocator >::Split(
 	CharType separator,
 	bool bCombineAdjacentSeparators ) const
 {
-	rStringResults.Resize( 0 );
-
-	// Always allow splitting off an empty string at the start if this string starts with a separator character.
-	bool bHaveNonSeparator = true;
-
-	size_t startIndex = 0;
-	size_t characterCount = GetSize();
-	for( size_t characterIndex = 0; characterIndex < characterCount; ++characterIndex )
-	{
-		if( m_buffer[ characterIndex ] == separator )
-		{
-			if( !bCombineAdjacentSeparators || bHaveNonSeparator )
-			{
-				HELIUM_VERIFY( rStringResults.New( m_buffer.GetData() + startIndex, characterIndex - startIndex ) );
-				bHaveNonSeparator = false;
-			}
-
-			startIndex = characterIndex + 1;
-		}
-		else
-		{
-			bHaveNonSeparator = true;
-		}
-	}
-
-	// Always allow splitting off an empty string at the end if this string ends with a separator character.
-	HELIUM_VERIFY( rStringResults.New( m_buffer.GetData() + startIndex, characterCount - startIndex ) );
+	StringView< CharType >( *this ).Split( rStringResults, separator, bCombineAdjacentSeparators );
 }
 
 /// Split a string into an array of strings based on the specified character separators.
@@ -1088,46 +1198,15 @@ void Helium::StringBase< CharType, Allocator >::Split(
 {
 	HELIUM_ASSERT( pSeparators || separatorCount == 0 );
 
-	rStringResults.Resize( 0 );
-
 	if( IsInvalid( separatorCount ) )
 	{
 		separatorCount = StringLength( pSeparators );
 	}
 
-	// Always allow splitting off an empty string at the start if this string starts with a separator character.
-	bool bHaveNonSeparator = true;
-
-	size_t startIndex = 0;
-	size_t characterCount = GetSize();
-	for( size_t characterIndex = 0; characterIndex < characterCount; ++characterIndex )
-	{
-		CharType character = m_buffer[ characterIndex ];
-		size_t separatorIndex;
-		for( separatorIndex = 0; separatorIndex < separatorCount; ++separatorIndex )
-		{
-			if( character == pSeparators[ separatorIndex ] )
-			{
-				if( !bCombineAdjacentSeparators || bHaveNonSeparator )
-				{
-					HELIUM_VERIFY( rStringResults.New( m_buffer.GetData() + startIndex, characterIndex - startIndex ) );
-					bHaveNonSeparator = false;
-				}
-
-				startIndex = characterIndex + 1;
-
-				break;
-			}
-		}
-
-		if( separatorIndex >= separatorCount )
-		{
-			bHaveNonSeparator = true;
-		}
-	}
-
-	// Always allow splitting off an empty string at the end if this string ends with a separator character.
-	HELIUM_VERIFY( rStringResults.New( m_buffer.GetData() + startIndex, characterCount - startIndex ) );
+	StringView< CharType >( *this ).Split(
+		rStringResults,
+		StringView< CharType >( pSeparators, separatorCount ),
+		bCombineAdjacentSeparators );
 }
 
 /// Split a string into an array of strings based on the specified character separators.
@@ -1245,6 +1324,46 @@ Helium::StringBase< CharType, Allocator >& Helium::StringBase< CharType, Allocat
 	return *this;
 }
 
+/// Set this string to a copy of the characters referenced by a string view.
+///
+/// If the view references characters in this string, the string is trimmed down to those characters in place.
+/// Otherwise, this will always destroy the current string contents and allocate a fresh buffer whose capacity matches
+/// the size of the given view.
+///
+/// @param[in] rString  String view from which to copy.
+///
+/// @return  Reference to this string.
+template< typename CharType, typename Allocator >
+Helium::StringBase< CharType, Allocator >& Helium::StringBase< CharType, Allocator >::operator=(
+	const StringView< CharType >& rString )
+{
+	const CharType* pString = rString.GetData();
+	size_t size = rString.GetSize();
+
+	const CharType* pBuffer = m_buffer.GetData();
+	if( size != 0 && pString >= pBuffer && pString < pBuffer + m_buffer.GetSize() )
+	{
+		size_t index = static_cast< size_t >( pString - pBuffer );
+		size_t endIndex = index + size;
+		HELIUM_ASSERT( endIndex <= GetSize() );
+
+		Remove( endIndex, GetSize() - endIndex );
+		Remove( 0, index );
+
+		return *this;
+	}
+
+	m_buffer.Clear();
+	if( size != 0 )
+	{
+		m_buffer.Reserve( size + 1 );
+		m_buffer.Set( pString, size );
+		m_buffer.Add( static_cast< CharType >( 0 ) );
+	}
+
+	return *this;
+}
+
 /// Set this string to the contents of the given string.
 ///
 /// If the given string is not the same as this string, this will always destroy the current string contents and
@@ -1374,6 +1493,17 @@ bool Helium::StringBase< CharType, Allocator >::operator==(
 			 MemoryCompare( m_buffer.GetData(), rString.m_buffer.GetData(), bufferSize * sizeof( CharType ) ) == 0 );
 }
 
+/// Check whether the contents of this string match the characters referenced by a given string view.
+///
+/// @param[in] rString  String view with which to compare.
+///
+/// @return  True if the strings match, false if not.
+template< typename CharType, typename Allocator >
+bool Helium::StringBase< CharType, Allocator >::operator==( const StringView< CharType >& rString ) const
+{
+	return ( StringView< CharType >( *this ) == rString );
+}
+
 /// Check whether the contents of this string do not match the contents of a given null-terminated C-style string.
 ///
 /// @param[in] pString  String with which to compare.  This can be null.
@@ -1398,6 +1528,17 @@ bool Helium::StringBase< CharType, Allocator >::operator!=(
 	return !( *this == rString );
 }
 
+/// Check whether the contents of this string do not match the characters referenced by a given string view.
+///
+/// @param[in] rString  String view with which to compare.
+///
+/// @return  True if the strings do not match, false if they do.
+template< typename CharType, typename Allocator >
+bool Helium::StringBase< CharType, Allocator >::operator!=( const StringView< CharType >& rString ) const
+{
+	return !( *this == rString );
+}
+
 /// Append the contents of a string to the end of this string.
 ///
 /// @param[in] rString  String to append.
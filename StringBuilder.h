@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Platform/Types.h"
+#include "Platform/Utility.h"
+#include "Platform/MemoryHeap.h"
+
+#include "Foundation/API.h"
+#include "Foundation/Stream.h"
+#include "Foundation/String.h"
+#include "Foundation/StringView.h"
+#include "Foundation/StringFormat.h"
+
+namespace Helium
+{
+	/// Append-only string builder backed by a chain of memory chunks.
+	///
+	/// Appending to a StringBase grows a single contiguous buffer, copying the entire string each time it is
+	/// reallocated.  A string builder instead appends into fixed-size chunks that are never moved once allocated, with
+	/// each new chunk larger than the last (up to a maximum chunk size).  The complete string is only assembled once,
+	/// either by copying it into a string with ToString() (which allocates the string buffer a single time) or by
+	/// writing each chunk directly to a stream with WriteTo().
+	///
+	/// Chunks are allocated using the given allocator.  Clear() keeps the first chunk so that a builder can be reused
+	/// without allocating memory for small strings.
+	template< typename CharType, typename Allocator = DefaultAllocator >
+	class StringBuilder : NonCopyable
+	{
+	public:
+		/// Capacity of the first chunk allocated, in characters.
+		static const size_t INITIAL_CHUNK_CAPACITY = 256;
+		/// Maximum capacity of chunks allocated for growth, in characters (single appends larger than this are stored
+		/// in a chunk sized to fit).
+		static const size_t MAX_CHUNK_CAPACITY = 64 * 1024;
+
+		/// @name Construction/Destruction
+		//@{
+		StringBuilder();
+		explicit StringBuilder( size_t initialCapacity );
+		~StringBuilder();
+		//@}
+
+		/// @name Builder Operations
+		//@{
+		size_t GetSize() const;
+		bool IsEmpty() const;
+
+		void Clear();
+
+		void Add( CharType character, size_t count = 1 );
+		void Add( const StringView< CharType >& rString );
+
+		void AddFormatTyped( const CharType* pFormatString );
+		template< typename... Args > void AddFormatTyped( const CharType* pFormatString, const Args&... args );
+		//@}
+
+		/// @name Output
+		//@{
+		template< typename StringAllocator > void ToString( StringBase< CharType, StringAllocator >& rString ) const;
+		template< typename StringAllocator > void AddToString( StringBase< CharType, StringAllocator >& rString ) const;
+
+		bool WriteTo( Stream& rStream ) const;
+		//@}
+
+		/// @name Overloaded Operators
+		//@{
+		StringBuilder& operator+=( CharType character );
+		StringBuilder& operator+=( const StringView< CharType >& rString );
+		//@}
+
+	private:
+		/// Chunk header (the chunk characters immediately follow the header in memory).
+		struct Chunk
+		{
+			/// Next chunk in the chain.
+			Chunk* pNext;
+			/// Number of characters the chunk can hold.
+			size_t capacity;
+			/// Number of characters currently stored in the chunk.
+			size_t size;
+
+			/// @name Data Access
+			//@{
+			CharType* GetCharacters();
+			const CharType* GetCharacters() const;
+			//@}
+		};
+
+		/// First chunk in the chain.
+		Chunk* m_pFirstChunk;
+		/// Last chunk in the chain (the chunk currently being appended to).
+		Chunk* m_pLastChunk;
+		/// Total number of characters stored in all chunks.
+		size_t m_size;
+		/// Capacity to use for the next chunk allocated.
+		size_t m_nextChunkCapacity;
+
+		/// @name Private Utility Functions
+		//@{
+		CharType* Allocate( size_t minimumCount, size_t& rAvailableCount );
+		void AddChunk( size_t minimumCapacity );
+		void AddFormatArgs(
+			const CharType* pFormatString, const FormatArgument< CharType >* pArguments, size_t argumentCount );
+		//@}
+	};
+
+	/// 8-bit character string builder.
+	typedef StringBuilder< char > CharStringBuilder;
+	/// Wide character string builder.
+	typedef StringBuilder< wchar_t > WideStringBuilder;
+}
+
+#include "Foundation/StringBuilder.inl"
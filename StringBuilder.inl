@@ -0,0 +1,353 @@
+/// Constructor.
+///
+/// No memory is allocated until the first character is added.
+template< typename CharType, typename Allocator >
+Helium::StringBuilder< CharType, Allocator >::StringBuilder()
+	: m_pFirstChunk( NULL )
+	, m_pLastChunk( NULL )
+	, m_size( 0 )
+	, m_nextChunkCapacity( INITIAL_CHUNK_CAPACITY )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] initialCapacity  Capacity of the first chunk to allocate, in characters.  This is useful when the
+///                             approximate size of the final string is known.  No memory is allocated until the first
+///                             character is added.
+template< typename CharType, typename Allocator >
+Helium::StringBuilder< CharType, Allocator >::StringBuilder( size_t initialCapacity )
+	: m_pFirstChunk( NULL )
+	, m_pLastChunk( NULL )
+	, m_size( 0 )
+	, m_nextChunkCapacity( initialCapacity != 0 ? initialCapacity : INITIAL_CHUNK_CAPACITY )
+{
+}
+
+/// Destructor.
+template< typename CharType, typename Allocator >
+Helium::StringBuilder< CharType, Allocator >::~StringBuilder()
+{
+	Allocator allocator;
+
+	Chunk* pChunk = m_pFirstChunk;
+	while( pChunk )
+	{
+		Chunk* pNextChunk = pChunk->pNext;
+		allocator.Free( pChunk );
+		pChunk = pNextChunk;
+	}
+}
+
+/// Get the number of characters added to this builder.
+///
+/// @return  Number of characters in the built string.
+///
+/// @see IsEmpty()
+template< typename CharType, typename Allocator >
+size_t Helium::StringBuilder< CharType, Allocator >::GetSize() const
+{
+	return m_size;
+}
+
+/// Get whether this builder is empty.
+///
+/// @return  True if no characters have been added, false if not.
+///
+/// @see GetSize()
+template< typename CharType, typename Allocator >
+bool Helium::StringBuilder< CharType, Allocator >::IsEmpty() const
+{
+	return ( m_size == 0 );
+}
+
+/// Remove all characters from this builder.
+///
+/// The first chunk is kept for reuse, while all other chunks are freed.
+template< typename CharType, typename Allocator >
+void Helium::StringBuilder< CharType, Allocator >::Clear()
+{
+	if( !m_pFirstChunk )
+	{
+		return;
+	}
+
+	Allocator allocator;
+
+	Chunk* pChunk = m_pFirstChunk->pNext;
+	while( pChunk )
+	{
+		Chunk* pNextChunk = pChunk->pNext;
+		allocator.Free( pChunk );
+		pChunk = pNextChunk;
+	}
+
+	m_pFirstChunk->pNext = NULL;
+	m_pFirstChunk->size = 0;
+	m_pLastChunk = m_pFirstChunk;
+	m_size = 0;
+	m_nextChunkCapacity = Min( m_pFirstChunk->capacity * 2, static_cast< size_t >( MAX_CHUNK_CAPACITY ) );
+}
+
+/// Append a character to the end of the built string.
+///
+/// @param[in] character  Character to append.
+/// @param[in] count      Number of copies of the character to append.
+template< typename CharType, typename Allocator >
+void Helium::StringBuilder< CharType, Allocator >::Add( CharType character, size_t count )
+{
+	while( count != 0 )
+	{
+		size_t availableCount;
+		CharType* pDest = Allocate( 1, availableCount );
+
+		size_t writeCount = Min( count, availableCount );
+		ArraySet( pDest, character, writeCount );
+		m_pLastChunk->size += writeCount;
+		m_size += writeCount;
+		count -= writeCount;
+	}
+}
+
+/// Append a string to the end of the built string.
+///
+/// @param[in] rString  String to append.
+template< typename CharType, typename Allocator >
+void Helium::StringBuilder< CharType, Allocator >::Add( const StringView< CharType >& rString )
+{
+	const CharType* pSource = rString.GetData();
+	size_t count = rString.GetSize();
+	while( count != 0 )
+	{
+		// Fill the remaining space in the current chunk before allocating a new chunk large enough for the rest.
+		size_t availableCount;
+		CharType* pDest = Allocate( count, availableCount );
+
+		size_t writeCount = Min( count, availableCount );
+		ArrayCopy( pDest, pSource, writeCount );
+		m_pLastChunk->size += writeCount;
+		m_size += writeCount;
+		pSource += writeCount;
+		count -= writeCount;
+	}
+}
+
+/// Append to the end of the built string using typed formatting.
+///
+/// @param[in] pFormatString  Format string.
+///
+/// @see StringFormat()
+template< typename CharType, typename Allocator >
+void Helium::StringBuilder< CharType, Allocator >::AddFormatTyped( const CharType* pFormatString )
+{
+	AddFormatArgs( pFormatString, NULL, 0 );
+}
+
+/// Append to the end of the built string using typed formatting.
+///
+/// The string is formatted directly into chunk memory.
+///
+/// @param[in] pFormatString  Format string.
+/// @param[in] args           Format arguments.
+///
+/// @see StringFormat()
+template< typename CharType, typename Allocator >
+template< typename... Args >
+void Helium::StringBuilder< CharType, Allocator >::AddFormatTyped( const CharType* pFormatString, const Args&... args )
+{
+	const FormatArgument< CharType > arguments[] = { args... };
+
+	AddFormatArgs( pFormatString, arguments, sizeof...( Args ) );
+}
+
+/// Set the contents of a string to the built string.
+///
+/// The string buffer is resized once to the final size before the chunks are copied into it.
+///
+/// @param[out] rString  String in which to store the built string.
+///
+/// @see AddToString(), WriteTo()
+template< typename CharType, typename Allocator >
+template< typename StringAllocator >
+void Helium::StringBuilder< CharType, Allocator >::ToString( StringBase< CharType, StringAllocator >& rString ) const
+{
+	rString.Remove( 0, rString.GetSize() );
+	AddToString( rString );
+}
+
+/// Append the built string to the end of a string.
+///
+/// The string buffer is resized once to the final size before the chunks are copied into it.
+///
+/// @param[in,out] rString  String to which the built string should be appended.
+///
+/// @see ToString(), WriteTo()
+template< typename CharType, typename Allocator >
+template< typename StringAllocator >
+void Helium::StringBuilder< CharType, Allocator >::AddToString( StringBase< CharType, StringAllocator >& rString ) const
+{
+	rString.Reserve( rString.GetSize() + m_size );
+
+	for( const Chunk* pChunk = m_pFirstChunk; pChunk; pChunk = pChunk->pNext )
+	{
+		rString.Add( StringView< CharType >( pChunk->GetCharacters(), pChunk->size ) );
+	}
+}
+
+/// Write the built string to a stream.
+///
+/// Each chunk is written directly to the stream without assembling the complete string in memory first.  No null
+/// terminator is written.
+///
+/// @param[in] rStream  Stream to which the string should be written.
+///
+/// @return  True if the entire string was written successfully, false if not.
+///
+/// @see ToString()
+template< typename CharType, typename Allocator >
+bool Helium::StringBuilder< CharType, Allocator >::WriteTo( Stream& rStream ) const
+{
+	for( const Chunk* pChunk = m_pFirstChunk; pChunk; pChunk = pChunk->pNext )
+	{
+		if( pChunk->size != 0 &&
+			rStream.Write( pChunk->GetCharacters(), sizeof( CharType ), pChunk->size ) != pChunk->size )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/// Append a character to the end of the built string.
+///
+/// @param[in] character  Character to append.
+///
+/// @return  Reference to this builder.
+template< typename CharType, typename Allocator >
+Helium::StringBuilder< CharType, Allocator >& Helium::StringBuilder< CharType, Allocator >::operator+=(
+	CharType character )
+{
+	Add( character );
+
+	return *this;
+}
+
+/// Append a string to the end of the built string.
+///
+/// @param[in] rString  String to append.
+///
+/// @return  Reference to this builder.
+template< typename CharType, typename Allocator >
+Helium::StringBuilder< CharType, Allocator >& Helium::StringBuilder< CharType, Allocator >::operator+=(
+	const StringView< CharType >& rString )
+{
+	Add( rString );
+
+	return *this;
+}
+
+/// Get the characters stored in this chunk.
+///
+/// @return  First character in the chunk.
+template< typename CharType, typename Allocator >
+CharType* Helium::StringBuilder< CharType, Allocator >::Chunk::GetCharacters()
+{
+	return reinterpret_cast< CharType* >( this + 1 );
+}
+
+/// Get the characters stored in this chunk.
+///
+/// @return  First character in the chunk.
+template< typename CharType, typename Allocator >
+const CharType* Helium::StringBuilder< CharType, Allocator >::Chunk::GetCharacters() const
+{
+	return reinterpret_cast< const CharType* >( this + 1 );
+}
+
+/// Get space for appending characters, allocating a new chunk if the current chunk is full.
+///
+/// The space returned is not reserved; the caller must update the chunk and builder sizes for any characters it
+/// writes.
+///
+/// @param[in]  minimumCount     Number of characters to make room for if a new chunk needs to be allocated.
+/// @param[out] rAvailableCount  Number of characters that can be written at the returned address (at least one).
+///
+/// @return  Address at which to write characters.
+template< typename CharType, typename Allocator >
+CharType* Helium::StringBuilder< CharType, Allocator >::Allocate( size_t minimumCount, size_t& rAvailableCount )
+{
+	if( !m_pLastChunk || m_pLastChunk->size == m_pLastChunk->capacity )
+	{
+		AddChunk( minimumCount );
+	}
+
+	rAvailableCount = m_pLastChunk->capacity - m_pLastChunk->size;
+
+	return m_pLastChunk->GetCharacters() + m_pLastChunk->size;
+}
+
+/// Allocate a new chunk and append it to the chunk chain.
+///
+/// @param[in] minimumCapacity  Minimum number of characters the new chunk must be able to hold.
+template< typename CharType, typename Allocator >
+void Helium::StringBuilder< CharType, Allocator >::AddChunk( size_t minimumCapacity )
+{
+	size_t capacity = Max( m_nextChunkCapacity, minimumCapacity );
+
+	Chunk* pChunk = static_cast< Chunk* >( Allocator().Allocate( sizeof( Chunk ) + sizeof( CharType ) * capacity ) );
+	HELIUM_ASSERT( pChunk );
+	pChunk->pNext = NULL;
+	pChunk->capacity = capacity;
+	pChunk->size = 0;
+
+	if( m_pLastChunk )
+	{
+		m_pLastChunk->pNext = pChunk;
+	}
+	else
+	{
+		m_pFirstChunk = pChunk;
+	}
+
+	m_pLastChunk = pChunk;
+
+	m_nextChunkCapacity = Min( m_nextChunkCapacity * 2, static_cast< size_t >( MAX_CHUNK_CAPACITY ) );
+}
+
+/// Append a formatted string to the end of the built string.
+///
+/// @param[in] pFormatString  Format string.
+/// @param[in] pArguments     Format arguments.
+/// @param[in] argumentCount  Number of format arguments.
+template< typename CharType, typename Allocator >
+void Helium::StringBuilder< CharType, Allocator >::AddFormatArgs(
+	const CharType* pFormatString,
+	const FormatArgument< CharType >* pArguments,
+	size_t argumentCount )
+{
+	HELIUM_ASSERT( pFormatString );
+
+	// Format into the space remaining in the current chunk (the formatter needs room for a null terminator, which is
+	// not kept).  If the result does not fit, format it again into a new chunk large enough to hold it.
+	size_t availableCount = ( m_pLastChunk ? m_pLastChunk->capacity - m_pLastChunk->size : 0 );
+	CharType* pDest = ( m_pLastChunk ? m_pLastChunk->GetCharacters() + m_pLastChunk->size : NULL );
+	size_t length = StringFormatArgs(
+		pDest,
+		availableCount,
+		pFormatString,
+		pArguments,
+		argumentCount );
+	if( length >= availableCount )
+	{
+		AddChunk( length + 1 );
+		pDest = m_pLastChunk->GetCharacters();
+
+		size_t finalLength = StringFormatArgs( pDest, length + 1, pFormatString, pArguments, argumentCount );
+		HELIUM_ASSERT( finalLength == length );
+		HELIUM_UNREF( finalLength );
+	}
+
+	m_pLastChunk->size += length;
+	m_size += length;
+}
@@ -0,0 +1,470 @@
+#include "FoundationPch.h"
+#include "Foundation/StringConverter.h"
+
+#if defined( HELIUM_CPU_X86 ) && ( defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+# define HELIUM_STRING_CONVERTER_SSE2 1
+# include <emmintrin.h>
+#endif
+
+using namespace Helium;
+
+/// Number of characters converted per iteration in the vectorized ASCII conversion loops.
+static const size_t ASCII_BLOCK_SIZE = 16;
+
+#if HELIUM_STRING_CONVERTER_SSE2
+/// Widen a block of sixteen ASCII characters and store them in a wide character buffer.
+///
+/// @param[out] pDest   Destination buffer (must have room for at least ASCII_BLOCK_SIZE characters).
+/// @param[in]  source  Sixteen ASCII characters.
+static void StoreWideAsciiBlock( wchar_t* pDest, __m128i source )
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i low = _mm_unpacklo_epi8( source, zero );
+    __m128i high = _mm_unpackhi_epi8( source, zero );
+
+    __m128i* pDestVector = reinterpret_cast< __m128i* >( pDest );
+    if( sizeof( wchar_t ) == 2 )
+    {
+        _mm_storeu_si128( pDestVector, low );
+        _mm_storeu_si128( pDestVector + 1, high );
+    }
+    else
+    {
+        _mm_storeu_si128( pDestVector, _mm_unpacklo_epi16( low, zero ) );
+        _mm_storeu_si128( pDestVector + 1, _mm_unpackhi_epi16( low, zero ) );
+        _mm_storeu_si128( pDestVector + 2, _mm_unpacklo_epi16( high, zero ) );
+        _mm_storeu_si128( pDestVector + 3, _mm_unpackhi_epi16( high, zero ) );
+    }
+}
+
+/// Load a block of sixteen wide characters and narrow them if they are all ASCII characters.
+///
+/// @param[out] rDest    Sixteen narrowed characters if all characters were ASCII characters.
+/// @param[in]  pSource  Source characters (must have at least ASCII_BLOCK_SIZE characters).
+///
+/// @return  True if all characters were ASCII characters and were narrowed, false if not.
+static bool LoadNarrowAsciiBlock( __m128i& rDest, const wchar_t* pSource )
+{
+    const __m128i* pSourceVector = reinterpret_cast< const __m128i* >( pSource );
+    __m128i zero = _mm_setzero_si128();
+
+    if( sizeof( wchar_t ) == 2 )
+    {
+        __m128i low = _mm_loadu_si128( pSourceVector );
+        __m128i high = _mm_loadu_si128( pSourceVector + 1 );
+
+        __m128i nonAsciiBits = _mm_and_si128(
+            _mm_or_si128( low, high ),
+            _mm_set1_epi16( static_cast< short >( 0xff80 ) ) );
+        if( _mm_movemask_epi8( _mm_cmpeq_epi16( nonAsciiBits, zero ) ) != 0xffff )
+        {
+            return false;
+        }
+
+        rDest = _mm_packus_epi16( low, high );
+    }
+    else
+    {
+        __m128i source0 = _mm_loadu_si128( pSourceVector );
+        __m128i source1 = _mm_loadu_si128( pSourceVector + 1 );
+        __m128i source2 = _mm_loadu_si128( pSourceVector + 2 );
+        __m128i source3 = _mm_loadu_si128( pSourceVector + 3 );
+
+        __m128i nonAsciiBits = _mm_and_si128(
+            _mm_or_si128( _mm_or_si128( source0, source1 ), _mm_or_si128( source2, source3 ) ),
+            _mm_set1_epi32( static_cast< int >( 0xffffff80 ) ) );
+        if( _mm_movemask_epi8( _mm_cmpeq_epi32( nonAsciiBits, zero ) ) != 0xffff )
+        {
+            return false;
+        }
+
+        rDest = _mm_packus_epi16( _mm_packs_epi32( source0, source1 ), _mm_packs_epi32( source2, source3 ) );
+    }
+
+    return true;
+}
+#endif  // HELIUM_STRING_CONVERTER_SSE2
+
+/// Decode a UTF-8 string into UTF-16 (if wchar_t is 16 bits) or UTF-32 (if wchar_t is 32 bits).
+///
+/// @param[out] pDest           Destination buffer, or null to only validate the source string and compute the size of
+///                             the converted string.
+/// @param[in]  destCapacity    Maximum number of wide characters to write to the destination buffer (ignored if
+///                             @c pDest is null).  Conversion stops at the first code point that does not fit.
+/// @param[in]  pSource         UTF-8 string to decode.
+/// @param[in]  sourceLength    Number of bytes in the source string.
+///
+/// @return  Number of wide characters written (or needed if @c pDest is null), or Invalid< size_t >() if an invalid
+///          UTF-8 sequence was encountered.
+static size_t DecodeUtf8( wchar_t* pDest, size_t destCapacity, const char* pSource, size_t sourceLength )
+{
+    const uint8_t* pByte = reinterpret_cast< const uint8_t* >( pSource );
+    const uint8_t* pByteEnd = pByte + sourceLength;
+
+    size_t destIndex = 0;
+    while( pByte < pByteEnd )
+    {
+#if HELIUM_STRING_CONVERTER_SSE2
+        // Convert runs of ASCII characters a block at a time.
+        while( static_cast< size_t >( pByteEnd - pByte ) >= ASCII_BLOCK_SIZE &&
+               ( !pDest || destCapacity - destIndex >= ASCII_BLOCK_SIZE ) )
+        {
+            __m128i source = _mm_loadu_si128( reinterpret_cast< const __m128i* >( pByte ) );
+            if( _mm_movemask_epi8( source ) != 0 )
+            {
+                break;
+            }
+
+            if( pDest )
+            {
+                StoreWideAsciiBlock( pDest + destIndex, source );
+            }
+
+            pByte += ASCII_BLOCK_SIZE;
+            destIndex += ASCII_BLOCK_SIZE;
+        }
+
+        if( pByte >= pByteEnd )
+        {
+            break;
+        }
+#endif
+
+        uint32_t codePoint = *pByte;
+        size_t sequenceLength;
+        if( codePoint < 0x80 )
+        {
+            sequenceLength = 1;
+        }
+        else if( codePoint >= 0xc2 && codePoint <= 0xdf )
+        {
+            sequenceLength = 2;
+            codePoint &= 0x1f;
+        }
+        else if( codePoint >= 0xe0 && codePoint <= 0xef )
+        {
+            sequenceLength = 3;
+            codePoint &= 0x0f;
+        }
+        else if( codePoint >= 0xf0 && codePoint <= 0xf4 )
+        {
+            sequenceLength = 4;
+            codePoint &= 0x07;
+        }
+        else
+        {
+            // Continuation byte without a lead byte, overlong two-byte lead byte, or lead byte beyond U+10FFFF.
+            return Invalid< size_t >();
+        }
+
+        if( static_cast< size_t >( pByteEnd - pByte ) < sequenceLength )
+        {
+            return Invalid< size_t >();
+        }
+
+        for( size_t byteIndex = 1; byteIndex < sequenceLength; ++byteIndex )
+        {
+            uint8_t continuationByte = pByte[ byteIndex ];
+            if( ( continuationByte & 0xc0 ) != 0x80 )
+            {
+                return Invalid< size_t >();
+            }
+
+            codePoint = ( codePoint << 6 ) | ( continuationByte & 0x3f );
+        }
+
+        // Reject overlong encodings, encoded surrogates, and code points beyond the Unicode code space.
+        if( ( sequenceLength == 3 && ( codePoint < 0x800 || ( codePoint >= 0xd800 && codePoint <= 0xdfff ) ) ) ||
+            ( sequenceLength == 4 && ( codePoint < 0x10000 || codePoint > 0x10ffff ) ) )
+        {
+            return Invalid< size_t >();
+        }
+
+        size_t unitCount = ( sizeof( wchar_t ) == 2 && codePoint >= 0x10000 ? 2 : 1 );
+        if( pDest )
+        {
+            if( destCapacity - destIndex < unitCount )
+            {
+                break;
+            }
+
+            if( unitCount == 2 )
+            {
+                codePoint -= 0x10000;
+                pDest[ destIndex ] = static_cast< wchar_t >( 0xd800 | ( codePoint >> 10 ) );
+                pDest[ destIndex + 1 ] = static_cast< wchar_t >( 0xdc00 | ( codePoint & 0x3ff ) );
+            }
+            else
+            {
+                pDest[ destIndex ] = static_cast< wchar_t >( codePoint );
+            }
+        }
+
+        destIndex += unitCount;
+        pByte += sequenceLength;
+    }
+
+    return destIndex;
+}
+
+/// Encode a UTF-16 (if wchar_t is 16 bits) or UTF-32 (if wchar_t is 32 bits) string as UTF-8.
+///
+/// @param[out] pDest           Destination buffer, or null to only validate the source string and compute the size of
+///                             the converted string.
+/// @param[in]  destCapacity    Maximum number of bytes to write to the destination buffer (ignored if @c pDest is
+///                             null).  Conversion stops at the first code point whose encoding does not fit.
+/// @param[in]  pSource         Wide character string to encode.
+/// @param[in]  sourceLength    Number of wide characters in the source string.
+///
+/// @return  Number of bytes written (or needed if @c pDest is null), or Invalid< size_t >() if an unpaired surrogate or
+///          a value outside the Unicode code space was encountered.
+static size_t EncodeUtf8( char* pDest, size_t destCapacity, const wchar_t* pSource, size_t sourceLength )
+{
+    const wchar_t* pSourceEnd = pSource + sourceLength;
+
+    size_t destIndex = 0;
+    while( pSource < pSourceEnd )
+    {
+#if HELIUM_STRING_CONVERTER_SSE2
+        // Convert runs of ASCII characters a block at a time.
+        while( static_cast< size_t >( pSourceEnd - pSource ) >= ASCII_BLOCK_SIZE &&
+               ( !pDest || destCapacity - destIndex >= ASCII_BLOCK_SIZE ) )
+        {
+            __m128i narrowed;
+            if( !LoadNarrowAsciiBlock( narrowed, pSource ) )
+            {
+                break;
+            }
+
+            if( pDest )
+            {
+                _mm_storeu_si128( reinterpret_cast< __m128i* >( pDest + destIndex ), narrowed );
+            }
+
+            pSource += ASCII_BLOCK_SIZE;
+            destIndex += ASCII_BLOCK_SIZE;
+        }
+
+        if( pSource >= pSourceEnd )
+        {
+            break;
+        }
+#endif
+
+        uint32_t codePoint = static_cast< uint32_t >( *pSource );
+        size_t sourceCount = 1;
+        if( codePoint >= 0xd800 && codePoint <= 0xdfff )
+        {
+            // Surrogates are only valid as a high/low pair in UTF-16 strings.
+            if( sizeof( wchar_t ) != 2 || codePoint >= 0xdc00 || pSourceEnd - pSource < 2 )
+            {
+                return Invalid< size_t >();
+            }
+
+            uint32_t lowSurrogate = static_cast< uint32_t >( pSource[ 1 ] );
+            if( lowSurrogate < 0xdc00 || lowSurrogate > 0xdfff )
+            {
+                return Invalid< size_t >();
+            }
+
+            codePoint = 0x10000 + ( ( codePoint - 0xd800 ) << 10 ) + ( lowSurrogate - 0xdc00 );
+            sourceCount = 2;
+        }
+        else if( codePoint > 0x10ffff )
+        {
+            return Invalid< size_t >();
+        }
+
+        size_t byteCount = ( codePoint < 0x80 ? 1 : ( codePoint < 0x800 ? 2 : ( codePoint < 0x10000 ? 3 : 4 ) ) );
+        if( pDest )
+        {
+            if( destCapacity - destIndex < byteCount )
+            {
+                break;
+            }
+
+            char* pDestByte = pDest + destIndex;
+            switch( byteCount )
+            {
+                case 1:
+                    pDestByte[ 0 ] = static_cast< char >( codePoint );
+                    break;
+
+                case 2:
+                    pDestByte[ 0 ] = static_cast< char >( 0xc0 | ( codePoint >> 6 ) );
+                    pDestByte[ 1 ] = static_cast< char >( 0x80 | ( codePoint & 0x3f ) );
+                    break;
+
+                case 3:
+                    pDestByte[ 0 ] = static_cast< char >( 0xe0 | ( codePoint >> 12 ) );
+                    pDestByte[ 1 ] = static_cast< char >( 0x80 | ( ( codePoint >> 6 ) & 0x3f ) );
+                    pDestByte[ 2 ] = static_cast< char >( 0x80 | ( codePoint & 0x3f ) );
+                    break;
+
+                default:
+                    pDestByte[ 0 ] = static_cast< char >( 0xf0 | ( codePoint >> 18 ) );
+                    pDestByte[ 1 ] = static_cast< char >( 0x80 | ( ( codePoint >> 12 ) & 0x3f ) );
+                    pDestByte[ 2 ] = static_cast< char >( 0x80 | ( ( codePoint >> 6 ) & 0x3f ) );
+                    pDestByte[ 3 ] = static_cast< char >( 0x80 | ( codePoint & 0x3f ) );
+                    break;
+            }
+        }
+
+        destIndex += byteCount;
+        pSource += sourceCount;
+    }
+
+    return destIndex;
+}
+
+/// Compute the number of wide characters needed to store a UTF-8 string converted to a wide character string.
+///
+/// @param[in] pSourceString  String to convert (does not need to be null-terminated).
+/// @param[in] sourceLength   Number of characters in the source string.
+///
+/// @return  Number of wide characters needed to store the converted string (not including a null terminator), or
+///          Invalid< size_t >() if an invalid UTF-8 sequence was encountered.
+size_t StringConverter< char, wchar_t >::GetConvertedSize( const char* pSourceString, size_t sourceLength )
+{
+    HELIUM_ASSERT( pSourceString || sourceLength == 0 );
+
+    return DecodeUtf8( NULL, 0, pSourceString, sourceLength );
+}
+
+/// Convert a UTF-8 string to a wide character string.
+///
+/// @param[out] pDestString     Destination string buffer.
+/// @param[in]  destBufferSize  Size of the destination string buffer in characters.
+/// @param[in]  pSourceString   String to convert.
+///
+/// @return  If the destination string buffer is not null, the number of wide characters written to the destination
+///          buffer (not including a null terminator) if no errors were encountered, otherwise Invalid< size_t >()
+///          if an invalid UTF-8 sequence was encountered in the source string.  If the destination buffer is null, this
+///          will only validate the conversion and return either the number of wide characters needed to convert and
+///          store the string in the destination buffer (not including a null terminator) or Invalid< size_t >() if an
+///          invalid UTF-8 sequence was encountered.  A null terminator will always be written to the destination
+///          buffer if one is provided and the size is not zero.
+size_t StringConverter< char, wchar_t >::Convert(
+    wchar_t* pDestString,
+    size_t destBufferSize,
+    const char* pSourceString )
+{
+    HELIUM_ASSERT( pSourceString );
+
+    return Convert( pDestString, destBufferSize, pSourceString, StringLength( pSourceString ) );
+}
+
+/// Convert a UTF-8 string to a wide character string.
+///
+/// If the destination buffer is too small, conversion stops at the last code point that fits in the buffer (the rest
+/// of the source string is not validated).
+///
+/// @param[out] pDestString     Destination string buffer.
+/// @param[in]  destBufferSize  Size of the destination string buffer in characters.
+/// @param[in]  pSourceString   String to convert (does not need to be null-terminated).
+/// @param[in]  sourceLength    Number of characters in the source string.
+///
+/// @return  If the destination string buffer is not null, the number of wide characters written to the destination
+///          buffer (not including a null terminator) if no errors were encountered, otherwise Invalid< size_t >()
+///          if an invalid UTF-8 sequence was encountered in the source string.  If the destination buffer is null, this
+///          returns the same result as GetConvertedSize().  A null terminator will always be written to the
+///          destination buffer if one is provided and the size is not zero.
+size_t StringConverter< char, wchar_t >::Convert(
+    wchar_t* pDestString,
+    size_t destBufferSize,
+    const char* pSourceString,
+    size_t sourceLength )
+{
+    HELIUM_ASSERT( pSourceString || sourceLength == 0 );
+
+    if( !pDestString )
+    {
+        return DecodeUtf8( NULL, 0, pSourceString, sourceLength );
+    }
+
+    if( destBufferSize == 0 )
+    {
+        return 0;
+    }
+
+    size_t charactersConverted = DecodeUtf8( pDestString, destBufferSize - 1, pSourceString, sourceLength );
+    pDestString[ IsValid( charactersConverted ) ? charactersConverted : 0 ] = L'\0';
+
+    return charactersConverted;
+}
+
+/// Compute the number of bytes needed to store a wide character string converted to a UTF-8 string.
+///
+/// @param[in] pSourceString  String to convert (does not need to be null-terminated).
+/// @param[in] sourceLength   Number of characters in the source string.
+///
+/// @return  Number of bytes needed to store the converted string (not including a null terminator), or
+///          Invalid< size_t >() if an invalid wide character was encountered.
+size_t StringConverter< wchar_t, char >::GetConvertedSize( const wchar_t* pSourceString, size_t sourceLength )
+{
+    HELIUM_ASSERT( pSourceString || sourceLength == 0 );
+
+    return EncodeUtf8( NULL, 0, pSourceString, sourceLength );
+}
+
+/// Convert a wide character string to a UTF-8 string.
+///
+/// @param[out] pDestString     Destination string buffer.
+/// @param[in]  destBufferSize  Size of the destination string buffer in characters.
+/// @param[in]  pSourceString   String to convert.
+///
+/// @return  If the destination string buffer is not null, the number of single-byte characters written to the
+///          destination buffer (not including a null terminator) if no errors were encountered, otherwise
+///          Invalid< size_t >() if an invalid wide character was encountered in the source string.  If the
+///          destination buffer is null, this will only validate the conversion and return either the number of
+///          single-byte characters needed to convert and store the string in the destination buffer (not including a
+///          null terminator) or Invalid< size_t >() if an invalid wide character was encountered.  A null terminator
+///          will always be written to the destination buffer if one is provided and the size is not zero.
+size_t StringConverter< wchar_t, char >::Convert(
+    char* pDestString,
+    size_t destBufferSize,
+    const wchar_t* pSourceString )
+{
+    HELIUM_ASSERT( pSourceString );
+
+    return Convert( pDestString, destBufferSize, pSourceString, StringLength( pSourceString ) );
+}
+
+/// Convert a wide character string to a UTF-8 string.
+///
+/// If the destination buffer is too small, conversion stops at the last code point whose encoding fits in the buffer
+/// (multibyte sequences are never split, and the rest of the source string is not validated).
+///
+/// @param[out] pDestString     Destination string buffer.
+/// @param[in]  destBufferSize  Size of the destination string buffer in characters.
+/// @param[in]  pSourceString   String to convert (does not need to be null-terminated).
+/// @param[in]  sourceLength    Number of characters in the source string.
+///
+/// @return  If the destination string buffer is not null, the number of single-byte characters written to the
+///          destination buffer (not including a null terminator) if no errors were encountered, otherwise
+///          Invalid< size_t >() if an invalid wide character was encountered in the source string.  If the
+///          destination buffer is null, this returns the same result as GetConvertedSize().  A null terminator will
+///          always be written to the destination buffer if one is provided and the size is not zero.
+size_t StringConverter< wchar_t, char >::Convert(
+    char* pDestString,
+    size_t destBufferSize,
+    const wchar_t* pSourceString,
+    size_t sourceLength )
+{
+    HELIUM_ASSERT( pSourceString || sourceLength == 0 );
+
+    if( !pDestString )
+    {
+        return EncodeUtf8( NULL, 0, pSourceString, sourceLength );
+    }
+
+    if( destBufferSize == 0 )
+    {
+        return 0;
+    }
+
+    size_t charactersConverted = EncodeUtf8( pDestString, destBufferSize - 1, pSourceString, sourceLength );
+    pDestString[ IsValid( charactersConverted ) ? charactersConverted : 0 ] = '\0';
+
+    return charactersConverted;
+}
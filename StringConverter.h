@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Foundation/API.h"
 #include "Foundation/String.h"
 
 namespace Helium
@@ -12,44 +13,65 @@ namespace Helium
     {
     };
 
-    /// Single-byte character string to wide string conversion.
+    /// UTF-8 string to wide string conversion.
     ///
-    /// This performs a conversion based on the current locale settings.  As such, characters outside the standard 7-bit
-    /// ASCII character set may be converted differently based on the platform on which the application is currently
-    /// running.
+    /// Source strings are decoded as UTF-8 and converted to UTF-16 (where wchar_t is 16 bits) or UTF-32 (where wchar_t
+    /// is 32 bits), independent of the current locale.  Invalid UTF-8 sequences (including overlong encodings and
+    /// encoded surrogates) cause the conversion to fail.  Runs of ASCII characters are converted sixteen characters at a
+    /// time when SSE2 is available.
+    ///
+    /// To convert into a caller-managed buffer without guessing its size, call GetConvertedSize() to get the number of
+    /// wide characters needed, then call Convert() with a buffer of at least that size plus one for the null
+    /// terminator.
     template<>
-    class StringConverter< char, wchar_t >
+    class HELIUM_FOUNDATION_API StringConverter< char, wchar_t >
     {
     public:
         /// @name Conversion Functions
         //@{
-        inline static size_t Convert( wchar_t* pDestString, size_t destBufferSize, const char* pSourceString );
+        static size_t GetConvertedSize( const char* pSourceString, size_t sourceLength );
+
+        static size_t Convert( wchar_t* pDestString, size_t destBufferSize, const char* pSourceString );
+        static size_t Convert(
+            wchar_t* pDestString, size_t destBufferSize, const char* pSourceString, size_t sourceLength );
         template< typename SourceAllocator > static size_t Convert(
             wchar_t* pDestString, size_t destBufferSize, const StringBase< char, SourceAllocator >& rSourceString );
         template< typename DestAllocator > static bool Convert(
             StringBase< wchar_t, DestAllocator >& rDestString, const char* pSourceString );
+        template< typename DestAllocator > static bool Convert(
+            StringBase< wchar_t, DestAllocator >& rDestString, const char* pSourceString, size_t sourceLength );
         template< typename DestAllocator, typename SourceAllocator > static bool Convert(
             StringBase< wchar_t, DestAllocator >& rDestString,
             const StringBase< char, SourceAllocator >& rSourceString );
         //@}
     };
 
-    /// Wide string to single-byte character string conversion.
+    /// Wide string to UTF-8 string conversion.
     ///
-    /// This performs a conversion based on the current locale settings.  As such, it may not be possible to convert
-    /// certain characters outside the standard 7-bit ASCII character set due to restrictions with the current locale's
-    /// character support.
+    /// Source strings are treated as UTF-16 (where wchar_t is 16 bits) or UTF-32 (where wchar_t is 32 bits) and encoded
+    /// as UTF-8, independent of the current locale.  Unpaired surrogates and values outside the Unicode code space cause
+    /// the conversion to fail.  Runs of ASCII characters are converted sixteen characters at a time when SSE2 is
+    /// available.
+    ///
+    /// To convert into a caller-managed buffer without guessing its size, call GetConvertedSize() to get the number of
+    /// bytes needed, then call Convert() with a buffer of at least that size plus one for the null terminator.
     template<>
-    class StringConverter< wchar_t, char >
+    class HELIUM_FOUNDATION_API StringConverter< wchar_t, char >
     {
     public:
         /// @name Conversion Functions
         //@{
-        inline static size_t Convert( char* pDestString, size_t destBufferSize, const wchar_t* pSourceString );
+        static size_t GetConvertedSize( const wchar_t* pSourceString, size_t sourceLength );
+
+        static size_t Convert( char* pDestString, size_t destBufferSize, const wchar_t* pSourceString );
+        static size_t Convert(
+            char* pDestString, size_t destBufferSize, const wchar_t* pSourceString, size_t sourceLength );
         template< typename SourceAllocator > static size_t Convert(
             char* pDestString, size_t destBufferSize, const StringBase< wchar_t, SourceAllocator >& rSourceString );
         template< typename DestAllocator > static bool Convert(
             StringBase< char, DestAllocator >& rDestString, const wchar_t* pSourceString );
+        template< typename DestAllocator > static bool Convert(
+            StringBase< char, DestAllocator >& rDestString, const wchar_t* pSourceString, size_t sourceLength );
         template< typename DestAllocator, typename SourceAllocator > static bool Convert(
             StringBase< char, DestAllocator >& rDestString,
             const StringBase< wchar_t, SourceAllocator >& rSourceString );
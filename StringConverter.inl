@@ -1,57 +1,4 @@
-/// Convert a single-byte character string to a wide character string.
-///
-/// @param[out] pDestString     Destination string buffer.
-/// @param[in]  destBufferSize  Size of the destination string buffer in characters.
-/// @param[in]  pSourceString   String to convert.
-///
-/// @return  If the destination string buffer is not null, the number of wide characters written to the destination
-///          buffer (not including a null terminator) if no errors were encountered, otherwise Invalid< size_t >()
-///          if either an invalid multibyte character was encountered in the source string or a character was
-///          encountered that could not be converted properly.  If the destination buffer is null, this will only
-///          validate the conversion and return either the number of wide characters needed to convert and store the
-///          string in the destination buffer (not including a null terminator) or Invalid< size_t >() if an invalid
-///          or incompatible character was encountered.  A null terminator will always be written to the destination
-///          buffer if one is provided and the size is not zero.
-size_t Helium::StringConverter< char, wchar_t >::Convert(
-    wchar_t* pDestString,
-    size_t destBufferSize,
-    const char* pSourceString )
-{
-    HELIUM_ASSERT( pSourceString );
-
-#if HELIUM_CC_CL
-    size_t charactersConverted = 0;
-    errno_t result = mbstowcs_s(
-        &charactersConverted,
-        pDestString,
-        ( pDestString ? destBufferSize : 0 ),
-        pSourceString,
-        _TRUNCATE );
-    if( result != 0 )
-    {
-        return Invalid< size_t >();
-    }
-
-    // Subtract the null terminator count.
-    if( charactersConverted != 0 )
-    {
-        --charactersConverted;
-    }
-
-    return charactersConverted;
-#else
-    size_t charactersConverted = mbstowcs( pDestString, pSourceString, destBufferSize );
-    if( pDestString && destBufferSize != 0 && charactersConverted == destBufferSize )
-    {
-        pDestString[ destBufferSize - 1 ] = L'\0';
-        --charactersConverted;
-    }
-
-    return charactersConverted;
-#endif
-}
-
-/// Convert a single-byte character string to a wide character string.
+/// Convert a UTF-8 string to a wide character string.
 ///
 /// @param[out] pDestString     Destination string buffer.
 /// @param[in]  destBufferSize  Size of the destination string buffer in characters.
@@ -59,11 +6,10 @@ size_t Helium::StringConverter< char, wchar_t >::Convert(
 ///
 /// @return  If the destination string buffer is not null, the number of wide characters written to the destination
 ///          buffer (not including a null terminator) if no errors were encountered, otherwise Invalid< size_t >()
-///          if either an invalid multibyte character was encountered in the source string or a character was
-///          encountered that could not be converted properly.  If the destination buffer is null, this will only
-///          validate the conversion and return either the number of wide characters needed to convert and store the
-///          string in the destination buffer (not including a null terminator) or Invalid< size_t >() if an invalid
-///          or incompatible character was encountered.  A null terminator will always be written to the destination
+///          if an invalid UTF-8 sequence was encountered in the source string.  If the destination buffer is null, this
+///          will only validate the conversion and return either the number of wide characters needed to convert and
+///          store the string in the destination buffer (not including a null terminator) or Invalid< size_t >() if an
+///          invalid UTF-8 sequence was encountered.  A null terminator will always be written to the destination
 ///          buffer if one is provided and the size is not zero.
 template< typename SourceAllocator >
 size_t Helium::StringConverter< char, wchar_t >::Convert(
@@ -71,10 +17,10 @@ size_t Helium::StringConverter< char, wchar_t >::Convert(
     size_t destBufferSize,
     const StringBase< char, SourceAllocator >& rSourceString )
 {
-    return Convert( pDestString, destBufferSize, *rSourceString );
+    return Convert( pDestString, destBufferSize, *rSourceString, rSourceString.GetSize() );
 }
 
-/// Convert a single-byte character string to a wide character string.
+/// Convert a UTF-8 string to a wide character string.
 ///
 /// @param[out] rDestString    Destination string buffer.
 /// @param[in]  pSourceString  String to convert.
@@ -85,7 +31,28 @@ bool Helium::StringConverter< char, wchar_t >::Convert(
     StringBase< wchar_t, DestAllocator >& rDestString,
     const char* pSourceString )
 {
-    size_t destStringSize = Convert( NULL, 0, pSourceString );
+    HELIUM_ASSERT( pSourceString );
+
+    return Convert( rDestString, pSourceString, StringLength( pSourceString ) );
+}
+
+/// Convert a UTF-8 string to a wide character string.
+///
+/// The size of the converted string is computed before the destination string is resized, so the destination string
+/// memory is reallocated at most once.
+///
+/// @param[out] rDestString    Destination string buffer.
+/// @param[in]  pSourceString  String to convert (does not need to be null-terminated).
+/// @param[in]  sourceLength   Number of characters in the source string.
+///
+/// @return  True if the conversion was successful, false if not.
+template< typename DestAllocator >
+bool Helium::StringConverter< char, wchar_t >::Convert(
+    StringBase< wchar_t, DestAllocator >& rDestString,
+    const char* pSourceString,
+    size_t sourceLength )
+{
+    size_t destStringSize = GetConvertedSize( pSourceString, sourceLength );
     if( IsInvalid( destStringSize ) )
     {
         return false;
@@ -109,12 +76,12 @@ bool Helium::StringConverter< char, wchar_t >::Convert(
         rDestString.Remove( destStringSize, currentStringSize - destStringSize );
     }
 
-    Convert( &rDestString[ 0 ], destStringSize + 1, pSourceString );
+    Convert( &rDestString[ 0 ], destStringSize + 1, pSourceString, sourceLength );
 
     return true;
 }
 
-/// Convert a single-byte character string to a wide character string.
+/// Convert a UTF-8 string to a wide character string.
 ///
 /// @param[out] rDestString    Destination string buffer.
 /// @param[in]  rSourceString  String to convert.
@@ -125,63 +92,10 @@ bool Helium::StringConverter< char, wchar_t >::Convert(
     StringBase< wchar_t, DestAllocator >& rDestString,
     const StringBase< char, SourceAllocator >& rSourceString )
 {
-    return Convert( rDestString, *rSourceString );
-}
-
-/// Convert a wide character string to a single-byte character string.
-///
-/// @param[out] pDestString     Destination string buffer.
-/// @param[in]  destBufferSize  Size of the destination string buffer in characters.
-/// @param[in]  pSourceString   String to convert.
-///
-/// @return  If the destination string buffer is not null, the number of single-byte characters written to the
-///          destination buffer (not including a null terminator) if no errors were encountered, otherwise
-///          Invalid< size_t >() if either an invalid wide character was encountered in the source string or a
-///          character was encountered that could not be converted properly.  If the destination buffer is null,
-///          this will only validate the conversion and return either the number of single-byte characters needed to
-///          convert and store the string in the destination buffer (not including a null terminator) or
-///          Invalid< size_t >() if an invalid or incompatible character was encountered.  A null terminator will
-///          always be written to the destination buffer if one is provided and the size is not zero.
-size_t Helium::StringConverter< wchar_t, char >::Convert(
-    char* pDestString,
-    size_t destBufferSize,
-    const wchar_t* pSourceString )
-{
-    HELIUM_ASSERT( pSourceString );
-
-#if HELIUM_CC_CL
-    size_t charactersConverted = 0;
-    errno_t result = wcstombs_s(
-        &charactersConverted,
-        pDestString,
-        ( pDestString ? destBufferSize : 0 ),
-        pSourceString,
-        _TRUNCATE );
-    if( result != 0 )
-    {
-        return Invalid< size_t >();
-    }
-
-    // Subtract the null terminator count.
-    if( charactersConverted != 0 )
-    {
-        --charactersConverted;
-    }
-
-    return charactersConverted;
-#else
-    size_t charactersConverted = wcstombs( pDestString, pSourceString, destBufferSize );
-    if( pDestString && destBufferSize != 0 && charactersConverted == destBufferSize )
-    {
-        pDestString[ destBufferSize - 1 ] = '\0';
-        --charactersConverted;
-    }
-
-    return charactersConverted;
-#endif
+    return Convert( rDestString, *rSourceString, rSourceString.GetSize() );
 }
 
-/// Convert a wide character string to a single-byte character string.
+/// Convert a wide character string to a UTF-8 string.
 ///
 /// @param[out] pDestString     Destination string buffer.
 /// @param[in]  destBufferSize  Size of the destination string buffer in characters.
@@ -189,22 +103,21 @@ size_t Helium::StringConverter< wchar_t, char >::Convert(
 ///
 /// @return  If the destination string buffer is not null, the number of single-byte characters written to the
 ///          destination buffer (not including a null terminator) if no errors were encountered, otherwise
-///          Invalid< size_t >() if either an invalid wide character was encountered in the source string or a
-///          character was encountered that could not be converted properly.  If the destination buffer is null,
-///          this will only validate the conversion and return either the number of single-byte characters needed to
-///          convert and store the string in the destination buffer (not including a null terminator) or
-///          Invalid< size_t >() if an invalid or incompatible character was encountered.  A null terminator will
-///          always be written to the destination buffer if one is provided and the size is not zero.
+///          Invalid< size_t >() if an invalid wide character was encountered in the source string.  If the
+///          destination buffer is null, this will only validate the conversion and return either the number of
+///          single-byte characters needed to convert and store the string in the destination buffer (not including a
+///          null terminator) or Invalid< size_t >() if an invalid wide character was encountered.  A null terminator
+///          will always be written to the destination buffer if one is provided and the size is not zero.
 template< typename SourceAllocator >
 size_t Helium::StringConverter< wchar_t, char >::Convert(
     char* pDestString,
     size_t destBufferSize,
     const StringBase< wchar_t, SourceAllocator >& rSourceString )
 {
-    return Convert( pDestString, destBufferSize, *rSourceString );
+    return Convert( pDestString, destBufferSize, *rSourceString, rSourceString.GetSize() );
 }
 
-/// Convert a single-byte character string to a wide character string.
+/// Convert a wide character string to a UTF-8 string.
 ///
 /// @param[out] rDestString    Destination string buffer.
 /// @param[in]  pSourceString  String to convert.
@@ -215,7 +128,28 @@ bool Helium::StringConverter< wchar_t, char >::Convert(
     StringBase< char, DestAllocator >& rDestString,
     const wchar_t* pSourceString )
 {
-    size_t destStringSize = Convert( NULL, 0, pSourceString );
+    HELIUM_ASSERT( pSourceString );
+
+    return Convert( rDestString, pSourceString, StringLength( pSourceString ) );
+}
+
+/// Convert a wide character string to a UTF-8 string.
+///
+/// The size of the converted string is computed before the destination string is resized, so the destination string
+/// memory is reallocated at most once.
+///
+/// @param[out] rDestString    Destination string buffer.
+/// @param[in]  pSourceString  String to convert (does not need to be null-terminated).
+/// @param[in]  sourceLength   Number of characters in the source string.
+///
+/// @return  True if the conversion was successful, false if not.
+template< typename DestAllocator >
+bool Helium::StringConverter< wchar_t, char >::Convert(
+    StringBase< char, DestAllocator >& rDestString,
+    const wchar_t* pSourceString,
+    size_t sourceLength )
+{
+    size_t destStringSize = GetConvertedSize( pSourceString, sourceLength );
     if( IsInvalid( destStringSize ) )
     {
         return false;
@@ -239,12 +173,12 @@ bool Helium::StringConverter< wchar_t, char >::Convert(
         rDestString.Remove( destStringSize, currentStringSize - destStringSize );
     }
 
-    Convert( &rDestString[ 0 ], destStringSize + 1, pSourceString );
+    Convert( &rDestString[ 0 ], destStringSize + 1, pSourceString, sourceLength );
 
     return true;
 }
 
-/// Convert a single-byte character string to a wide character string.
+/// Convert a wide character string to a UTF-8 string.
 ///
 /// @param[out] rDestString    Destination string buffer.
 /// @param[in]  rSourceString  String to convert.
@@ -255,7 +189,7 @@ bool Helium::StringConverter< wchar_t, char >::Convert(
     StringBase< char, DestAllocator >& rDestString,
     const StringBase< wchar_t, SourceAllocator >& rSourceString )
 {
-    return Convert( rDestString, *rSourceString );
+    return Convert( rDestString, *rSourceString, rSourceString.GetSize() );
 }
 
 /// Null string conversion.
@@ -0,0 +1,1334 @@
+#include "FoundationPch.h"
+#include "Foundation/StringFormat.h"
+
+#include "Foundation/Math.h"
+
+#include <cfloat>
+
+using namespace Helium;
+
+/// Maximum number of significant digits computed for floating-point values.
+static const size_t MAX_SIGNIFICANT_DIGITS = 17;
+/// Maximum floating-point precision (larger precisions are clamped).
+static const size_t MAX_FLOAT_PRECISION = 100;
+/// Default floating-point precision.
+static const size_t DEFAULT_FLOAT_PRECISION = 6;
+/// Size of the scratch buffer used to convert an integer (large enough for 64 binary digits and a sign).
+static const size_t INTEGER_BUFFER_SIZE = 72;
+/// Size of the scratch buffer used to convert a floating-point value (large enough for the largest double in
+/// fixed-point notation at the maximum precision).
+static const size_t FLOAT_BUFFER_SIZE = 512;
+
+/// log10( 2 ), used to estimate the decimal exponent of floating-point values.
+static const double LOG10_2 = 0.30102999566398119521;
+
+/// Two-digit decimal strings for "00" through "99".
+static const char DECIMAL_DIGIT_PAIRS[] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+/// Lowercase hexadecimal digits.
+static const char HEX_DIGITS_LOWER[] = "0123456789abcdef";
+/// Uppercase hexadecimal digits.
+static const char HEX_DIGITS_UPPER[] = "0123456789ABCDEF";
+
+/// Powers of ten that are exactly representable as unsigned 64-bit integers.
+static const uint64_t INTEGER_POWERS_OF_TEN[] =
+{
+	1ULL,
+	10ULL,
+	100ULL,
+	1000ULL,
+	10000ULL,
+	100000ULL,
+	1000000ULL,
+	10000000ULL,
+	100000000ULL,
+	1000000000ULL,
+	10000000000ULL,
+	100000000000ULL,
+	1000000000000ULL,
+	10000000000000ULL,
+	100000000000000ULL,
+	1000000000000000ULL,
+	10000000000000000ULL,
+	100000000000000000ULL,
+	1000000000000000000ULL,
+	10000000000000000000ULL
+};
+
+/// Number of 32-bit words in a FormatBigInteger.  The largest value needed is 5^340, for 17 digits of the smallest
+/// denormalized double (just under 800 bits), with room for shifting during division.
+static const size_t BIG_INTEGER_WORD_COUNT = 32;
+
+/// Parsed placeholder format specification.
+struct FormatSpec
+{
+	/// Minimum field width.
+	size_t width;
+	/// Precision, or an invalid value to use the default precision.
+	size_t precision;
+	/// Type character, or zero to use the default type.
+	char type;
+	/// True to left-justify the field.
+	bool bLeftJustify;
+	/// True to always print the sign of numbers.
+	bool bPlusSign;
+	/// True to pad numbers with zeros.
+	bool bZeroPad;
+};
+
+/// Output state for a string being formatted.
+///
+/// Characters beyond the buffer capacity are counted but not written, so formatting can continue to compute the
+/// length of the complete string after the buffer is full.
+template< typename CharType >
+class FormatWriter
+{
+public:
+	/// Constructor.
+	///
+	/// @param[in] pBuffer     Destination buffer, or null to only count characters.
+	/// @param[in] bufferSize  Size of the destination buffer, including room for a null terminator.
+	FormatWriter( CharType* pBuffer, size_t bufferSize )
+		: m_pBuffer( pBuffer )
+		, m_capacity( pBuffer && bufferSize != 0 ? bufferSize - 1 : 0 )
+		, m_length( 0 )
+	{
+	}
+
+	/// Write a single character.
+	///
+	/// @param[in] character  Character to write.
+	void Write( CharType character )
+	{
+		if( m_length < m_capacity )
+		{
+			m_pBuffer[ m_length ] = character;
+		}
+
+		++m_length;
+	}
+
+	/// Write a sequence of characters.
+	///
+	/// @param[in] pString  Characters to write.
+	/// @param[in] count    Number of characters to write.
+	void Write( const CharType* pString, size_t count )
+	{
+		if( m_length < m_capacity )
+		{
+			ArrayCopy( m_pBuffer + m_length, pString, Min( count, m_capacity - m_length ) );
+		}
+
+		m_length += count;
+	}
+
+	/// Write a sequence of ASCII characters, widening them to the destination character type.
+	///
+	/// @param[in] pString  Characters to write.
+	/// @param[in] count    Number of characters to write.
+	void WriteAscii( const char* pString, size_t count )
+	{
+		if( m_length < m_capacity )
+		{
+			size_t writeCount = Min( count, m_capacity - m_length );
+			CharType* pDest = m_pBuffer + m_length;
+			for( size_t index = 0; index < writeCount; ++index )
+			{
+				pDest[ index ] = static_cast< CharType >( pString[ index ] );
+			}
+		}
+
+		m_length += count;
+	}
+
+	/// Write a character a given number of times.
+	///
+	/// @param[in] character  Character to write.
+	/// @param[in] count      Number of times to write the character.
+	void WriteRepeated( CharType character, size_t count )
+	{
+		if( m_length < m_capacity )
+		{
+			ArraySet( m_pBuffer + m_length, character, Min( count, m_capacity - m_length ) );
+		}
+
+		m_length += count;
+	}
+
+	/// Null-terminate the output.
+	void Terminate()
+	{
+		if( m_pBuffer )
+		{
+			m_pBuffer[ Min( m_length, m_capacity ) ] = static_cast< CharType >( '\0' );
+		}
+	}
+
+	/// Get the length of the complete formatted string.
+	///
+	/// @return  Number of characters written or counted so far.
+	size_t GetLength() const
+	{
+		return m_length;
+	}
+
+private:
+	/// Destination buffer.
+	CharType* m_pBuffer;
+	/// Maximum number of characters (not including the null terminator) that can be written to the buffer.
+	size_t m_capacity;
+	/// Length of the formatted string so far.
+	size_t m_length;
+};
+
+/// Get whether a character is a decimal digit.
+template< typename CharType >
+static bool IsFormatDigit( CharType character )
+{
+	return ( character >= static_cast< CharType >( '0' ) && character <= static_cast< CharType >( '9' ) );
+}
+
+/// Parse a placeholder format specification.
+///
+/// This must accept the same syntax as FormatStringChecker.
+///
+/// @param[in]  pString  Format string position immediately following the opening brace of the placeholder.
+/// @param[out] rSpec    Parsed format specification.
+///
+/// @return  Format string position immediately following the closing brace of the placeholder, or null if the
+///          placeholder is malformed.
+template< typename CharType >
+static const CharType* ParseFormatSpec( const CharType* pString, FormatSpec& rSpec )
+{
+	rSpec.width = 0;
+	rSpec.precision = Invalid< size_t >();
+	rSpec.type = '\0';
+	rSpec.bLeftJustify = false;
+	rSpec.bPlusSign = false;
+	rSpec.bZeroPad = false;
+
+	if( *pString == static_cast< CharType >( ':' ) )
+	{
+		++pString;
+
+		for( ; ; ++pString )
+		{
+			CharType character = *pString;
+			if( character == static_cast< CharType >( '-' ) )
+			{
+				rSpec.bLeftJustify = true;
+			}
+			else if( character == static_cast< CharType >( '+' ) )
+			{
+				rSpec.bPlusSign = true;
+			}
+			else if( character == static_cast< CharType >( '0' ) )
+			{
+				rSpec.bZeroPad = true;
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		for( ; IsFormatDigit( *pString ); ++pString )
+		{
+			rSpec.width = rSpec.width * 10 + static_cast< size_t >( *pString - static_cast< CharType >( '0' ) );
+		}
+
+		if( *pString == static_cast< CharType >( '.' ) )
+		{
+			++pString;
+			if( !IsFormatDigit( *pString ) )
+			{
+				return NULL;
+			}
+
+			rSpec.precision = 0;
+			for( ; IsFormatDigit( *pString ); ++pString )
+			{
+				rSpec.precision = rSpec.precision * 10 + static_cast< size_t >( *pString - static_cast< CharType >( '0' ) );
+			}
+		}
+
+		switch( *pString )
+		{
+			case 'd':
+			case 'x':
+			case 'X':
+			case 'b':
+			case 'f':
+			case 'e':
+			case 'E':
+			case 'g':
+				rSpec.type = static_cast< char >( *pString );
+				++pString;
+				break;
+		}
+	}
+
+	if( *pString != static_cast< CharType >( '}' ) )
+	{
+		return NULL;
+	}
+
+	return pString + 1;
+}
+
+/// Write padding characters for a field.
+///
+/// @param[in] rWriter      Output writer.
+/// @param[in] rSpec        Format specification.
+/// @param[in] fieldLength  Number of characters in the field.
+/// @param[in] bLeading     True if writing padding before the field, false if writing padding after the field.
+template< typename CharType >
+static void WriteFieldPadding(
+	FormatWriter< CharType >& rWriter,
+	const FormatSpec& rSpec,
+	size_t fieldLength,
+	bool bLeading )
+{
+	if( rSpec.width > fieldLength && rSpec.bLeftJustify != bLeading )
+	{
+		rWriter.WriteRepeated( static_cast< CharType >( ' ' ), rSpec.width - fieldLength );
+	}
+}
+
+/// Write a field of ASCII characters (such as a converted number), padding it to the format specification width.
+///
+/// @param[in] rWriter        Output writer.
+/// @param[in] rSpec          Format specification.
+/// @param[in] pField         Field characters.
+/// @param[in] fieldLength    Number of field characters.
+/// @param[in] prefixLength   Number of leading sign or prefix characters after which zero padding is inserted.
+/// @param[in] bAllowZeroPad  True if the field can be padded with zeros, false if it is always padded with spaces.
+template< typename CharType >
+static void WriteAsciiField(
+	FormatWriter< CharType >& rWriter,
+	const FormatSpec& rSpec,
+	const char* pField,
+	size_t fieldLength,
+	size_t prefixLength,
+	bool bAllowZeroPad )
+{
+	if( bAllowZeroPad && rSpec.bZeroPad && !rSpec.bLeftJustify && rSpec.width > fieldLength )
+	{
+		rWriter.WriteAscii( pField, prefixLength );
+		rWriter.WriteRepeated( static_cast< CharType >( '0' ), rSpec.width - fieldLength );
+		rWriter.WriteAscii( pField + prefixLength, fieldLength - prefixLength );
+
+		return;
+	}
+
+	WriteFieldPadding( rWriter, rSpec, fieldLength, true );
+	rWriter.WriteAscii( pField, fieldLength );
+	WriteFieldPadding( rWriter, rSpec, fieldLength, false );
+}
+
+/// Write a field of string characters, padding it to the format specification width.
+///
+/// @param[in] rWriter      Output writer.
+/// @param[in] rSpec        Format specification.
+/// @param[in] pField       Field characters.
+/// @param[in] fieldLength  Number of field characters.
+template< typename CharType >
+static void WriteStringField(
+	FormatWriter< CharType >& rWriter,
+	const FormatSpec& rSpec,
+	const CharType* pField,
+	size_t fieldLength )
+{
+	WriteFieldPadding( rWriter, rSpec, fieldLength, true );
+	rWriter.Write( pField, fieldLength );
+	WriteFieldPadding( rWriter, rSpec, fieldLength, false );
+}
+
+/// Convert an unsigned integer to decimal digits, writing backward from the end of a buffer.
+///
+/// @param[in] pBufferEnd  End of the buffer.
+/// @param[in] value       Value to convert.
+///
+/// @return  Pointer to the first digit written.
+static char* WriteDecimalBackward( char* pBufferEnd, uint64_t value )
+{
+	char* pDigit = pBufferEnd;
+	while( value >= 100 )
+	{
+		size_t pairIndex = static_cast< size_t >( value % 100 ) * 2;
+		value /= 100;
+
+		pDigit -= 2;
+		pDigit[ 0 ] = DECIMAL_DIGIT_PAIRS[ pairIndex ];
+		pDigit[ 1 ] = DECIMAL_DIGIT_PAIRS[ pairIndex + 1 ];
+	}
+
+	if( value >= 10 )
+	{
+		size_t pairIndex = static_cast< size_t >( value ) * 2;
+
+		pDigit -= 2;
+		pDigit[ 0 ] = DECIMAL_DIGIT_PAIRS[ pairIndex ];
+		pDigit[ 1 ] = DECIMAL_DIGIT_PAIRS[ pairIndex + 1 ];
+	}
+	else
+	{
+		*( --pDigit ) = static_cast< char >( '0' + value );
+	}
+
+	return pDigit;
+}
+
+/// Convert an unsigned integer to digits in a power-of-two base, writing backward from the end of a buffer.
+///
+/// @param[in] pBufferEnd  End of the buffer.
+/// @param[in] value       Value to convert.
+/// @param[in] shift       Number of bits per digit.
+/// @param[in] pDigits     Digit characters.
+///
+/// @return  Pointer to the first digit written.
+static char* WriteBinaryBaseBackward( char* pBufferEnd, uint64_t value, uint32_t shift, const char* pDigits )
+{
+	uint64_t digitMask = ( static_cast< uint64_t >( 1 ) << shift ) - 1;
+
+	char* pDigit = pBufferEnd;
+	do
+	{
+		*( --pDigit ) = pDigits[ value & digitMask ];
+		value >>= shift;
+	} while( value != 0 );
+
+	return pDigit;
+}
+
+/// Format an integer.
+///
+/// @param[in] rWriter     Output writer.
+/// @param[in] rSpec       Format specification.
+/// @param[in] magnitude   Absolute value of the integer.
+/// @param[in] bNegative   True if the integer is negative.
+template< typename CharType >
+static void FormatInteger(
+	FormatWriter< CharType >& rWriter,
+	const FormatSpec& rSpec,
+	uint64_t magnitude,
+	bool bNegative )
+{
+	char buffer[ INTEGER_BUFFER_SIZE ];
+	char* pBufferEnd = buffer + INTEGER_BUFFER_SIZE;
+
+	char* pDigits;
+	switch( rSpec.type )
+	{
+		case 'x':
+			pDigits = WriteBinaryBaseBackward( pBufferEnd, magnitude, 4, HEX_DIGITS_LOWER );
+			break;
+
+		case 'X':
+			pDigits = WriteBinaryBaseBackward( pBufferEnd, magnitude, 4, HEX_DIGITS_UPPER );
+			break;
+
+		case 'b':
+			pDigits = WriteBinaryBaseBackward( pBufferEnd, magnitude, 1, HEX_DIGITS_LOWER );
+			break;
+
+		default:
+			pDigits = WriteDecimalBackward( pBufferEnd, magnitude );
+			break;
+	}
+
+	size_t prefixLength = 0;
+	if( bNegative || rSpec.bPlusSign )
+	{
+		*( --pDigits ) = ( bNegative ? '-' : '+' );
+		prefixLength = 1;
+	}
+
+	WriteAsciiField( rWriter, rSpec, pDigits, static_cast< size_t >( pBufferEnd - pDigits ), prefixLength, true );
+}
+
+/// Fixed-size unsigned integer used to compute the decimal digits of floating-point values exactly.
+///
+/// Only the operations needed to scale a double by a power of ten and divide out its integer digits are provided.
+class FormatBigInteger
+{
+public:
+	/// Constructor.
+	///
+	/// @param[in] value  Initial value.
+	explicit FormatBigInteger( uint64_t value )
+		: m_wordCount( 0 )
+	{
+		while( value != 0 )
+		{
+			m_words[ m_wordCount++ ] = static_cast< uint32_t >( value );
+			value >>= 32;
+		}
+	}
+
+	/// Multiply this value by a power of two.
+	///
+	/// @param[in] bitCount  Power of two by which to multiply.
+	void ShiftLeft( uint32_t bitCount )
+	{
+		if( m_wordCount == 0 )
+		{
+			return;
+		}
+
+		size_t wordShift = bitCount / 32;
+		uint32_t bitShift = bitCount % 32;
+		HELIUM_ASSERT( m_wordCount + wordShift < BIG_INTEGER_WORD_COUNT );
+
+		// Shift from the most significant word down so that no source word is overwritten before it is read.
+		m_words[ m_wordCount + wordShift ] = 0;
+		for( size_t index = m_wordCount; index-- != 0; )
+		{
+			uint64_t shifted = static_cast< uint64_t >( m_words[ index ] ) << bitShift;
+			m_words[ index + wordShift + 1 ] |= static_cast< uint32_t >( shifted >> 32 );
+			m_words[ index + wordShift ] = static_cast< uint32_t >( shifted );
+		}
+
+		for( size_t index = 0; index < wordShift; ++index )
+		{
+			m_words[ index ] = 0;
+		}
+
+		m_wordCount += wordShift + 1;
+		TrimWords();
+	}
+
+	/// Multiply this value by a power of five.
+	///
+	/// @param[in] power  Power of five by which to multiply.
+	void MultiplyByPowerOfFive( uint32_t power )
+	{
+		// 5^13 is the largest power of five that fits in a single word.
+		for( ; power >= 13; power -= 13 )
+		{
+			MultiplyByWord( 1220703125 );
+		}
+
+		uint32_t multiplier = 1;
+		for( ; power != 0; --power )
+		{
+			multiplier *= 5;
+		}
+
+		if( multiplier != 1 )
+		{
+			MultiplyByWord( multiplier );
+		}
+	}
+
+	/// Divide this value by another value, leaving the remainder in this value.
+	///
+	/// @param[in] rDivisor  Divisor (must be nonzero, and small enough for the quotient to fit in 64 bits).
+	///
+	/// @return  Quotient.
+	uint64_t Divide( const FormatBigInteger& rDivisor )
+	{
+		HELIUM_ASSERT( rDivisor.m_wordCount != 0 );
+
+		if( Compare( *this, rDivisor ) < 0 )
+		{
+			return 0;
+		}
+
+		// Small divisors (values scaled down by a few powers of ten) and powers of two (values scaled up) are common,
+		// and both can be handled without long division.
+		if( rDivisor.m_wordCount == 1 )
+		{
+			return DivideByWord( rDivisor.m_words[ 0 ] );
+		}
+
+		if( rDivisor.IsPowerOfTwo() )
+		{
+			return DivideByPowerOfTwo( rDivisor.GetBitCount() - 1 );
+		}
+
+		// Binary long division, starting with the divisor aligned to the most significant bit of this value.
+		uint32_t shift = GetBitCount() - rDivisor.GetBitCount();
+		HELIUM_ASSERT( shift < 64 );
+
+		FormatBigInteger shiftedDivisor( rDivisor );
+		shiftedDivisor.ShiftLeft( shift );
+
+		uint64_t quotient = 0;
+		for( ; ; )
+		{
+			quotient <<= 1;
+			if( Compare( *this, shiftedDivisor ) >= 0 )
+			{
+				Subtract( shiftedDivisor );
+				quotient |= 1;
+			}
+
+			if( shift-- == 0 )
+			{
+				break;
+			}
+
+			shiftedDivisor.ShiftRightOne();
+		}
+
+		return quotient;
+	}
+
+	/// Compare two values.
+	///
+	/// @param[in] rA  First value.
+	/// @param[in] rB  Second value.
+	///
+	/// @return  A negative value if @c rA is less than @c rB, a positive value if @c rA is greater than @c rB, or zero
+	///          if they are equal.
+	static int Compare( const FormatBigInteger& rA, const FormatBigInteger& rB )
+	{
+		if( rA.m_wordCount != rB.m_wordCount )
+		{
+			return ( rA.m_wordCount < rB.m_wordCount ? -1 : 1 );
+		}
+
+		for( size_t index = rA.m_wordCount; index-- != 0; )
+		{
+			if( rA.m_words[ index ] != rB.m_words[ index ] )
+			{
+				return ( rA.m_words[ index ] < rB.m_words[ index ] ? -1 : 1 );
+			}
+		}
+
+		return 0;
+	}
+
+private:
+	/// Value words, least significant first.
+	uint32_t m_words[ BIG_INTEGER_WORD_COUNT ];
+	/// Number of words in use (the most significant word in use is always nonzero).
+	size_t m_wordCount;
+
+	/// Multiply this value by a single word.
+	///
+	/// @param[in] multiplier  Value by which to multiply.
+	void MultiplyByWord( uint32_t multiplier )
+	{
+		uint64_t carry = 0;
+		for( size_t index = 0; index < m_wordCount; ++index )
+		{
+			uint64_t product = static_cast< uint64_t >( m_words[ index ] ) * multiplier + carry;
+			m_words[ index ] = static_cast< uint32_t >( product );
+			carry = product >> 32;
+		}
+
+		if( carry != 0 )
+		{
+			HELIUM_ASSERT( m_wordCount < BIG_INTEGER_WORD_COUNT );
+			m_words[ m_wordCount++ ] = static_cast< uint32_t >( carry );
+		}
+	}
+
+	/// Subtract a value that is not greater than this value.
+	///
+	/// @param[in] rValue  Value to subtract.
+	void Subtract( const FormatBigInteger& rValue )
+	{
+		HELIUM_ASSERT( Compare( *this, rValue ) >= 0 );
+
+		uint64_t borrow = 0;
+		for( size_t index = 0; index < m_wordCount; ++index )
+		{
+			uint64_t subtrahend = ( index < rValue.m_wordCount ? rValue.m_words[ index ] : 0 ) + borrow;
+			uint64_t word = m_words[ index ];
+			m_words[ index ] = static_cast< uint32_t >( word - subtrahend );
+			borrow = ( word < subtrahend ? 1 : 0 );
+		}
+
+		TrimWords();
+	}
+
+	/// Divide this value by a single word, leaving the remainder in this value.
+	///
+	/// @param[in] divisor  Divisor (must be nonzero, and small enough for the quotient to fit in 64 bits).
+	///
+	/// @return  Quotient.
+	uint64_t DivideByWord( uint32_t divisor )
+	{
+		HELIUM_ASSERT( divisor != 0 );
+
+		uint64_t quotient = 0;
+		uint64_t remainder = 0;
+		for( size_t index = m_wordCount; index-- != 0; )
+		{
+			uint64_t dividend = ( remainder << 32 ) | m_words[ index ];
+			quotient = ( quotient << 32 ) | ( dividend / divisor );
+			remainder = dividend % divisor;
+		}
+
+		m_words[ 0 ] = static_cast< uint32_t >( remainder );
+		m_wordCount = ( remainder != 0 ? 1 : 0 );
+
+		return quotient;
+	}
+
+	/// Divide this value by a power of two, leaving the remainder in this value.
+	///
+	/// @param[in] bitCount  Power of two by which to divide (the quotient must fit in 64 bits).
+	///
+	/// @return  Quotient.
+	uint64_t DivideByPowerOfTwo( uint32_t bitCount )
+	{
+		size_t wordIndex = bitCount / 32;
+		uint32_t bitShift = bitCount % 32;
+
+		// A 64-bit quotient spans at most three words once the bit shift is taken into account.
+		uint64_t lowBits = GetWord( wordIndex ) | ( static_cast< uint64_t >( GetWord( wordIndex + 1 ) ) << 32 );
+		uint64_t highBits = GetWord( wordIndex + 2 );
+		HELIUM_ASSERT( ( highBits >> bitShift ) == 0 );
+		uint64_t quotient = ( lowBits >> bitShift ) | ( bitShift != 0 ? highBits << ( 64 - bitShift ) : 0 );
+
+		if( m_wordCount > wordIndex )
+		{
+			m_words[ wordIndex ] &= ( static_cast< uint32_t >( 1 ) << bitShift ) - 1;
+			m_wordCount = wordIndex + 1;
+			TrimWords();
+		}
+
+		return quotient;
+	}
+
+	/// Get whether this value is a power of two.
+	///
+	/// @return  True if exactly one bit is set in this value, false if not.
+	bool IsPowerOfTwo() const
+	{
+		if( m_wordCount == 0 )
+		{
+			return false;
+		}
+
+		for( size_t index = 0; index + 1 < m_wordCount; ++index )
+		{
+			if( m_words[ index ] != 0 )
+			{
+				return false;
+			}
+		}
+
+		uint32_t topWord = m_words[ m_wordCount - 1 ];
+
+		return( ( topWord & ( topWord - 1 ) ) == 0 );
+	}
+
+	/// Get a word of this value.
+	///
+	/// @param[in] index  Word index, which may be past the words in use.
+	///
+	/// @return  Word at the given index, or zero if the index is past the words in use.
+	uint32_t GetWord( size_t index ) const
+	{
+		return ( index < m_wordCount ? m_words[ index ] : 0 );
+	}
+
+	/// Divide this value by two.
+	void ShiftRightOne()
+	{
+		for( size_t index = 0; index < m_wordCount; ++index )
+		{
+			uint32_t nextWord = ( index + 1 < m_wordCount ? m_words[ index + 1 ] : 0 );
+			m_words[ index ] = ( m_words[ index ] >> 1 ) | ( nextWord << 31 );
+		}
+
+		TrimWords();
+	}
+
+	/// Get the number of significant bits in this value.
+	///
+	/// @return  Position of the most significant set bit plus one, or zero if this value is zero.
+	uint32_t GetBitCount() const
+	{
+		if( m_wordCount == 0 )
+		{
+			return 0;
+		}
+
+		uint32_t bitCount = static_cast< uint32_t >( m_wordCount - 1 ) * 32;
+		for( uint32_t topWord = m_words[ m_wordCount - 1 ]; topWord != 0; topWord >>= 1 )
+		{
+			++bitCount;
+		}
+
+		return bitCount;
+	}
+
+	/// Drop zero words from the most significant end of this value.
+	void TrimWords()
+	{
+		while( m_wordCount != 0 && m_words[ m_wordCount - 1 ] == 0 )
+		{
+			--m_wordCount;
+		}
+	}
+};
+
+/// Get the exact ratio of two integers equal to a positive, finite floating-point value multiplied by a power of ten.
+///
+/// @param[in]  value         Value to scale.
+/// @param[in]  power         Power of ten by which to scale.
+/// @param[out] rNumerator    Numerator of the scaled value.
+/// @param[out] rDenominator  Denominator of the scaled value.
+static void GetScaledRatio( double value, int power, FormatBigInteger& rNumerator, FormatBigInteger& rDenominator )
+{
+	// The frexp() mantissa lies in [0.5, 1), so scaling it by 2^DBL_MANT_DIG gives the integer significand exactly, for
+	// denormalized values as well.
+	int binaryExponent;
+	double mantissa = frexp( value, &binaryExponent );
+	uint64_t significand = static_cast< uint64_t >( ldexp( mantissa, DBL_MANT_DIG ) );
+	binaryExponent -= DBL_MANT_DIG;
+
+	// Split the power of ten into powers of two and five, and cancel the factors of two shared by both sides, so the
+	// integers stay a few words long for values of moderate magnitude.
+	while( ( significand & 1 ) == 0 )
+	{
+		significand >>= 1;
+		++binaryExponent;
+	}
+
+	binaryExponent += power;
+
+	rNumerator = FormatBigInteger( significand );
+	rDenominator = FormatBigInteger( 1 );
+
+	if( power > 0 )
+	{
+		rNumerator.MultiplyByPowerOfFive( static_cast< uint32_t >( power ) );
+	}
+	else
+	{
+		rDenominator.MultiplyByPowerOfFive( static_cast< uint32_t >( -power ) );
+	}
+
+	if( binaryExponent > 0 )
+	{
+		rNumerator.ShiftLeft( static_cast< uint32_t >( binaryExponent ) );
+	}
+	else
+	{
+		rDenominator.ShiftLeft( static_cast< uint32_t >( -binaryExponent ) );
+	}
+}
+
+/// Multiply a positive, finite floating-point value by a power of ten and round the exact result to an integer.
+///
+/// Ties are rounded to even, as printf() does.
+///
+/// @param[in] value  Value to scale.
+/// @param[in] power  Power of ten by which to scale (the scaled value must be less than 2^63).
+///
+/// @return  Rounded scaled value.
+static uint64_t RoundScaledValue( double value, int power )
+{
+	FormatBigInteger numerator( 0 );
+	FormatBigInteger denominator( 0 );
+	GetScaledRatio( value, power, numerator, denominator );
+
+	uint64_t quotient = numerator.Divide( denominator );
+
+	// Compare twice the remainder against the denominator to round the fractional part.
+	numerator.ShiftLeft( 1 );
+	int comparison = FormatBigInteger::Compare( numerator, denominator );
+	if( comparison > 0 || ( comparison == 0 && ( quotient & 1 ) != 0 ) )
+	{
+		++quotient;
+	}
+
+	return quotient;
+}
+
+/// Get the decimal exponent of a positive, finite floating-point value.
+///
+/// @param[in] value  Value to test.
+///
+/// @return  Power of ten of the most significant decimal digit of the value.
+static int GetDecimalExponent( double value )
+{
+	int binaryExponent;
+	frexp( value, &binaryExponent );
+
+	// The value lies in [2^(binaryExponent-1), 2^binaryExponent), so this estimate is either exact or one too low.
+	int exponent = static_cast< int >( floor( static_cast< double >( binaryExponent - 1 ) * LOG10_2 ) );
+
+	FormatBigInteger numerator( 0 );
+	FormatBigInteger denominator( 0 );
+	GetScaledRatio( value, -( exponent + 1 ), numerator, denominator );
+	if( FormatBigInteger::Compare( numerator, denominator ) >= 0 )
+	{
+		++exponent;
+	}
+
+	return exponent;
+}
+
+/// Get the rounded significant decimal digits of a positive, finite floating-point value.
+///
+/// The digits are computed from the exact binary value, so they match the leading digits printed by printf().
+///
+/// @param[in]     value       Value to convert.
+/// @param[in]     digitCount  Number of significant digits to compute (from 1 to MAX_SIGNIFICANT_DIGITS).
+/// @param[in,out] rExponent   Decimal exponent of the value (as returned by GetDecimalExponent()).  This is
+///                            incremented if rounding carries into an additional digit.
+///
+/// @return  Significant digits as an integer value with @c digitCount digits.
+static uint64_t GetDecimalSignificand( double value, size_t digitCount, int& rExponent )
+{
+	HELIUM_ASSERT( digitCount != 0 && digitCount <= MAX_SIGNIFICANT_DIGITS );
+
+	uint64_t significand = RoundScaledValue( value, static_cast< int >( digitCount ) - 1 - rExponent );
+	if( significand >= INTEGER_POWERS_OF_TEN[ digitCount ] )
+	{
+		significand /= 10;
+		++rExponent;
+	}
+
+	return significand;
+}
+
+/// Convert significant digits to characters.
+///
+/// @param[out] pDigits      Buffer in which to store the digit characters.
+/// @param[in]  significand  Significant digits.
+/// @param[in]  digitCount   Number of digits to write (leading digits are zero-filled).
+static void GetSignificandDigits( char* pDigits, uint64_t significand, size_t digitCount )
+{
+	for( size_t index = digitCount; index != 0; --index )
+	{
+		pDigits[ index - 1 ] = static_cast< char >( '0' + significand % 10 );
+		significand /= 10;
+	}
+}
+
+/// Write a floating-point value in fixed-point notation.
+///
+/// @param[out] pBuffer       Output buffer.
+/// @param[in]  significand   Significant digits.
+/// @param[in]  digitCount    Number of significant digits.
+/// @param[in]  exponent      Power of ten of the first significant digit.
+/// @param[in]  lastPosition  Power of ten of the last digit to write (zero or negative).
+///
+/// @return  Pointer past the last character written.
+static char* WriteFixedForm( char* pBuffer, uint64_t significand, size_t digitCount, int exponent, int lastPosition )
+{
+	char digits[ MAX_SIGNIFICANT_DIGITS ];
+	GetSignificandDigits( digits, significand, digitCount );
+
+	for( int position = Max( exponent, 0 ); position >= lastPosition; --position )
+	{
+		if( position == -1 )
+		{
+			*( pBuffer++ ) = '.';
+		}
+
+		int digitIndex = exponent - position;
+		*( pBuffer++ ) = ( digitIndex >= 0 && static_cast< size_t >( digitIndex ) < digitCount ? digits[ digitIndex ] : '0' );
+	}
+
+	return pBuffer;
+}
+
+/// Write a floating-point value in exponential notation.
+///
+/// @param[out] pBuffer      Output buffer.
+/// @param[in]  significand  Significant digits.
+/// @param[in]  digitCount   Number of significant digits.
+/// @param[in]  exponent     Power of ten of the first significant digit.
+/// @param[in]  precision    Number of digits to write after the decimal point.
+/// @param[in]  bUppercase   True to use an uppercase exponent character, false to use lowercase.
+///
+/// @return  Pointer past the last character written.
+static char* WriteExponentForm(
+	char* pBuffer,
+	uint64_t significand,
+	size_t digitCount,
+	int exponent,
+	size_t precision,
+	bool bUppercase )
+{
+	char digits[ MAX_SIGNIFICANT_DIGITS ];
+	GetSignificandDigits( digits, significand, digitCount );
+
+	*( pBuffer++ ) = digits[ 0 ];
+	if( precision != 0 )
+	{
+		*( pBuffer++ ) = '.';
+		for( size_t digitIndex = 1; digitIndex <= precision; ++digitIndex )
+		{
+			*( pBuffer++ ) = ( digitIndex < digitCount ? digits[ digitIndex ] : '0' );
+		}
+	}
+
+	*( pBuffer++ ) = ( bUppercase ? 'E' : 'e' );
+	*( pBuffer++ ) = ( exponent < 0 ? '-' : '+' );
+
+	// Always write at least two exponent digits, as printf() does.
+	char exponentBuffer[ INTEGER_BUFFER_SIZE ];
+	char* pExponentEnd = exponentBuffer + INTEGER_BUFFER_SIZE;
+	char* pExponent = WriteDecimalBackward(
+		pExponentEnd,
+		static_cast< uint64_t >( exponent < 0 ? -exponent : exponent ) );
+	if( pExponentEnd - pExponent < 2 )
+	{
+		*( --pExponent ) = '0';
+	}
+
+	while( pExponent != pExponentEnd )
+	{
+		*( pBuffer++ ) = *( pExponent++ );
+	}
+
+	return pBuffer;
+}
+
+/// Format a floating-point value.
+///
+/// @param[in] rWriter  Output writer.
+/// @param[in] rSpec    Format specification.
+/// @param[in] value    Value to format.
+template< typename CharType >
+static void FormatFloat( FormatWriter< CharType >& rWriter, const FormatSpec& rSpec, double value )
+{
+	char buffer[ FLOAT_BUFFER_SIZE ];
+	char* pBuffer = buffer;
+
+	if( value < 0.0 || ( value == 0.0 && 1.0 / value < 0.0 ) )
+	{
+		*( pBuffer++ ) = '-';
+		value = -value;
+	}
+	else if( rSpec.bPlusSign )
+	{
+		*( pBuffer++ ) = '+';
+	}
+
+	size_t prefixLength = static_cast< size_t >( pBuffer - buffer );
+	bool bFinite = ( value == value && value <= DBL_MAX );
+
+	if( !bFinite )
+	{
+		MemoryCopy( pBuffer, ( value != value ? "nan" : "inf" ), 3 );
+		pBuffer += 3;
+	}
+	else
+	{
+		size_t precision = ( IsValid( rSpec.precision )
+			? Min( rSpec.precision, MAX_FLOAT_PRECISION )
+			: DEFAULT_FLOAT_PRECISION );
+
+		switch( rSpec.type )
+		{
+			case 'f':
+			{
+				uint64_t significand = 0;
+				size_t digitCount = 0;
+				int exponent = 0;
+				if( value != 0.0 )
+				{
+					exponent = GetDecimalExponent( value );
+					int requiredDigits = exponent + 1 + static_cast< int >( precision );
+					if( requiredDigits > 0 )
+					{
+						digitCount = Min( static_cast< size_t >( requiredDigits ), MAX_SIGNIFICANT_DIGITS );
+						significand = GetDecimalSignificand( value, digitCount, exponent );
+					}
+					else if( RoundScaledValue( value, static_cast< int >( precision ) ) != 0 )
+					{
+						// The value is below the last displayed digit, but rounds up to it.
+						significand = 1;
+						digitCount = 1;
+						exponent = -static_cast< int >( precision );
+					}
+				}
+
+				pBuffer = WriteFixedForm( pBuffer, significand, digitCount, exponent, -static_cast< int >( precision ) );
+
+				break;
+			}
+
+			case 'e':
+			case 'E':
+			{
+				size_t digitCount = Min( precision + 1, MAX_SIGNIFICANT_DIGITS );
+				uint64_t significand = 0;
+				int exponent = 0;
+				if( value != 0.0 )
+				{
+					exponent = GetDecimalExponent( value );
+					significand = GetDecimalSignificand( value, digitCount, exponent );
+				}
+
+				pBuffer = WriteExponentForm( pBuffer, significand, digitCount, exponent, precision, rSpec.type == 'E' );
+
+				break;
+			}
+
+			default:
+			{
+				// Use the shorter of fixed-point or exponential notation with trailing zeros removed, as "%g" does.
+				size_t significantDigits = Max< size_t >( precision, 1 );
+				size_t digitCount = Min( significantDigits, MAX_SIGNIFICANT_DIGITS );
+				uint64_t significand = 0;
+				int exponent = 0;
+				if( value != 0.0 )
+				{
+					exponent = GetDecimalExponent( value );
+					significand = GetDecimalSignificand( value, digitCount, exponent );
+				}
+
+				while( digitCount > 1 && significand % 10 == 0 )
+				{
+					significand /= 10;
+					--digitCount;
+				}
+
+				if( exponent < -4 || exponent >= static_cast< int >( significantDigits ) )
+				{
+					pBuffer = WriteExponentForm( pBuffer, significand, digitCount, exponent, digitCount - 1, false );
+				}
+				else
+				{
+					int lastPosition = Min( exponent - static_cast< int >( digitCount ) + 1, 0 );
+					pBuffer = WriteFixedForm( pBuffer, significand, digitCount, exponent, lastPosition );
+				}
+
+				break;
+			}
+		}
+	}
+
+	HELIUM_ASSERT( pBuffer <= buffer + FLOAT_BUFFER_SIZE );
+
+	WriteAsciiField( rWriter, rSpec, buffer, static_cast< size_t >( pBuffer - buffer ), prefixLength, bFinite );
+}
+
+/// Format a single argument.
+///
+/// @param[in] rWriter    Output writer.
+/// @param[in] rSpec      Format specification.
+/// @param[in] rArgument  Argument to format.
+template< typename CharType >
+static void FormatValue(
+	FormatWriter< CharType >& rWriter,
+	const FormatSpec& rSpec,
+	const FormatArgument< CharType >& rArgument )
+{
+	switch( rArgument.GetType() )
+	{
+		case FormatArgument< CharType >::TYPE_SIGNED:
+		{
+			int64_t value = rArgument.GetSigned();
+			uint64_t magnitude = ( value < 0 ? 0 - static_cast< uint64_t >( value ) : static_cast< uint64_t >( value ) );
+			FormatInteger( rWriter, rSpec, magnitude, value < 0 );
+
+			break;
+		}
+
+		case FormatArgument< CharType >::TYPE_UNSIGNED:
+		{
+			FormatInteger( rWriter, rSpec, rArgument.GetUnsigned(), false );
+
+			break;
+		}
+
+		case FormatArgument< CharType >::TYPE_FLOAT:
+		{
+			FormatFloat( rWriter, rSpec, rArgument.GetFloat() );
+
+			break;
+		}
+
+		case FormatArgument< CharType >::TYPE_BOOL:
+		{
+			bool bValue = rArgument.GetBool();
+			WriteAsciiField( rWriter, rSpec, ( bValue ? "true" : "false" ), ( bValue ? 4 : 5 ), 0, false );
+
+			break;
+		}
+
+		case FormatArgument< CharType >::TYPE_CHARACTER:
+		{
+			CharType character = rArgument.GetCharacter();
+			WriteStringField( rWriter, rSpec, &character, 1 );
+
+			break;
+		}
+
+		case FormatArgument< CharType >::TYPE_STRING:
+		{
+			StringView< CharType > string = rArgument.GetString();
+			size_t length = string.GetSize();
+			if( IsValid( rSpec.precision ) && rSpec.precision < length )
+			{
+				length = rSpec.precision;
+			}
+
+			WriteStringField( rWriter, rSpec, string.GetData(), length );
+
+			break;
+		}
+
+		case FormatArgument< CharType >::TYPE_POINTER:
+		{
+			char buffer[ INTEGER_BUFFER_SIZE ];
+			char* pBufferEnd = buffer + INTEGER_BUFFER_SIZE;
+			char* pDigits = WriteBinaryBaseBackward(
+				pBufferEnd,
+				static_cast< uint64_t >( reinterpret_cast< uintptr_t >( rArgument.GetPointer() ) ),
+				4,
+				HEX_DIGITS_LOWER );
+			*( --pDigits ) = 'x';
+			*( --pDigits ) = '0';
+
+			WriteAsciiField( rWriter, rSpec, pDigits, static_cast< size_t >( pBufferEnd - pDigits ), 2, true );
+
+			break;
+		}
+	}
+}
+
+/// Write a formatted string to a character buffer.
+///
+/// @param[out] pBuffer        Buffer in which to write the formatted string, or null to only compute the formatted
+///                            string length.
+/// @param[in]  bufferSize     Size of the buffer in characters, including room for a null terminator.
+/// @param[in]  pFormatString  Format string.
+/// @param[in]  pArguments     Format arguments.
+/// @param[in]  argumentCount  Number of format arguments.
+///
+/// @return  Length of the complete formatted string, not including the null terminator.
+template< typename CharType >
+static size_t FormatString(
+	CharType* pBuffer,
+	size_t bufferSize,
+	const CharType* pFormatString,
+	const FormatArgument< CharType >* pArguments,
+	size_t argumentCount )
+{
+	HELIUM_ASSERT( pFormatString );
+	HELIUM_ASSERT( pArguments || argumentCount == 0 );
+
+	FormatWriter< CharType > writer( pBuffer, bufferSize );
+
+	const CharType* pCharacter = pFormatString;
+	size_t argumentIndex = 0;
+	for( ; ; )
+	{
+		// Copy literal text up to the next brace in a single step.
+		const CharType* pLiteral = pCharacter;
+		CharType character = *pCharacter;
+		while( character != static_cast< CharType >( '\0' ) &&
+			character != static_cast< CharType >( '{' ) &&
+			character != static_cast< CharType >( '}' ) )
+		{
+			character = *( ++pCharacter );
+		}
+
+		writer.Write( pLiteral, static_cast< size_t >( pCharacter - pLiteral ) );
+
+		if( character == static_cast< CharType >( '\0' ) )
+		{
+			break;
+		}
+
+		// Escaped brace.
+		if( pCharacter[ 1 ] == character )
+		{
+			writer.Write( character );
+			pCharacter += 2;
+
+			continue;
+		}
+
+		FormatSpec spec;
+		const CharType* pSpecEnd = NULL;
+		if( character == static_cast< CharType >( '{' ) )
+		{
+			pSpecEnd = ParseFormatSpec( pCharacter + 1, spec );
+		}
+
+		if( !pSpecEnd )
+		{
+			HELIUM_BREAK_MSG( TXT( "Malformed format string placeholder" ) );
+
+			writer.Write( character );
+			++pCharacter;
+
+			continue;
+		}
+
+		pCharacter = pSpecEnd;
+
+		if( argumentIndex >= argumentCount )
+		{
+			HELIUM_BREAK_MSG( TXT( "Format string has more placeholders than format arguments" ) );
+
+			continue;
+		}
+
+		FormatValue( writer, spec, pArguments[ argumentIndex ] );
+		++argumentIndex;
+	}
+
+	HELIUM_ASSERT_MSG(
+		argumentIndex == argumentCount,
+		TXT( "Format string has fewer placeholders than format arguments" ) );
+
+	writer.Terminate();
+
+	return writer.GetLength();
+}
+
+/// Write a formatted string to a character buffer.
+///
+/// @param[out] pBuffer        Buffer in which to write the formatted string, or null to only compute the formatted
+///                            string length.
+/// @param[in]  bufferSize     Size of the buffer in characters, including room for a null terminator.
+/// @param[in]  pFormatString  Format string.
+/// @param[in]  pArguments     Format arguments.
+/// @param[in]  argumentCount  Number of format arguments.
+///
+/// @return  Length of the complete formatted string, not including the null terminator.
+///
+/// @see StringFormat()
+size_t Helium::StringFormatArgs(
+	char* pBuffer,
+	size_t bufferSize,
+	const char* pFormatString,
+	const FormatArgument< char >* pArguments,
+	size_t argumentCount )
+{
+	return FormatString( pBuffer, bufferSize, pFormatString, pArguments, argumentCount );
+}
+
+/// Write a formatted string to a character buffer.
+///
+/// @param[out] pBuffer        Buffer in which to write the formatted string, or null to only compute the formatted
+///                            string length.
+/// @param[in]  bufferSize     Size of the buffer in characters, including room for a null terminator.
+/// @param[in]  pFormatString  Format string.
+/// @param[in]  pArguments     Format arguments.
+/// @param[in]  argumentCount  Number of format arguments.
+///
+/// @return  Length of the complete formatted string, not including the null terminator.
+///
+/// @see StringFormat()
+size_t Helium::StringFormatArgs(
+	wchar_t* pBuffer,
+	size_t bufferSize,
+	const wchar_t* pFormatString,
+	const FormatArgument< wchar_t >* pArguments,
+	size_t argumentCount )
+{
+	return FormatString( pBuffer, bufferSize, pFormatString, pArguments, argumentCount );
+}
@@ -0,0 +1,193 @@
+#pragma once
+
+#include "Platform/Types.h"
+#include "Platform/Assert.h"
+#include "Platform/Utility.h"
+
+#include "Foundation/API.h"
+#include "Foundation/StringView.h"
+
+/// @defgroup stringformatmacros Checked String Formatting Macros
+///
+/// These macros validate the syntax of a literal format string and check that its placeholder count matches the
+/// number of arguments at compile time, then perform the formatting.  The format string must be the first argument
+/// after the fixed macro parameters.
+//@{
+
+/// Validate a literal format string against its arguments at compile time.
+#define HELIUM_FORMAT_CHECK( ... ) \
+	static_assert( \
+		Helium::CountFormatPlaceholders( HELIUM_FORMAT_EXPAND( HELIUM_FORMAT_FIRST_ARGUMENT( __VA_ARGS__, 0 ) ) ) == \
+			sizeof( Helium::FormatArgumentCounter( __VA_ARGS__ ) ) - 1, \
+		"Format string is malformed or does not match the number of format arguments" )
+
+/// Set the contents of a string using a compile-time checked format string.
+#define HELIUM_STRING_FORMAT( STRING, ... ) \
+	do { HELIUM_FORMAT_CHECK( __VA_ARGS__ ); ( STRING ).FormatTyped( __VA_ARGS__ ); } while( 0 )
+
+/// Append to a string using a compile-time checked format string.
+#define HELIUM_STRING_ADD_FORMAT( STRING, ... ) \
+	do { HELIUM_FORMAT_CHECK( __VA_ARGS__ ); ( STRING ).AddFormatTyped( __VA_ARGS__ ); } while( 0 )
+
+/// Format into a character buffer using a compile-time checked format string.
+#define HELIUM_STRING_FORMAT_BUFFER( BUFFER, BUFFER_SIZE, ... ) \
+	do { HELIUM_FORMAT_CHECK( __VA_ARGS__ ); Helium::StringFormat( BUFFER, BUFFER_SIZE, __VA_ARGS__ ); } while( 0 )
+
+//@}
+
+/// @cond HELIUM_FORMAT_PRIVATE
+#define HELIUM_FORMAT_EXPAND( X ) X
+#define HELIUM_FORMAT_FIRST_ARGUMENT( FIRST, ... ) FIRST
+/// @endcond
+
+namespace Helium
+{
+	template< typename CharType, typename Allocator > class StringBase;
+
+	/// Typed argument for the string formatting functions.
+	///
+	/// Format arguments are constructed implicitly from the values passed to StringFormat(), StringBase::FormatTyped(),
+	/// and Log::Format().  Strings are referenced rather than copied, so an argument must not outlive the value from
+	/// which it was created.  Passing a value of an unsupported type is a compile error instead of undefined behavior.
+	template< typename CharType >
+	class FormatArgument
+	{
+	public:
+		/// Argument types.
+		enum EType
+		{
+			TYPE_SIGNED,     ///< Signed integer.
+			TYPE_UNSIGNED,   ///< Unsigned integer.
+			TYPE_FLOAT,      ///< Floating-point value.
+			TYPE_BOOL,       ///< Boolean value.
+			TYPE_CHARACTER,  ///< Single character.
+			TYPE_STRING,     ///< Character string.
+			TYPE_POINTER,    ///< Pointer address.
+		};
+
+		/// @name Construction/Destruction
+		//@{
+		FormatArgument( short value );
+		FormatArgument( unsigned short value );
+		FormatArgument( int value );
+		FormatArgument( unsigned int value );
+		FormatArgument( long value );
+		FormatArgument( unsigned long value );
+		FormatArgument( long long value );
+		FormatArgument( unsigned long long value );
+		FormatArgument( float value );
+		FormatArgument( double value );
+		FormatArgument( bool value );
+		FormatArgument( CharType value );
+		FormatArgument( const CharType* pString );
+		FormatArgument( const StringView< CharType >& rString );
+		template< typename Allocator > FormatArgument( const StringBase< CharType, Allocator >& rString );
+		FormatArgument( const void* pPointer );
+		//@}
+
+		/// @name Data Access
+		//@{
+		EType GetType() const;
+
+		int64_t GetSigned() const;
+		uint64_t GetUnsigned() const;
+		double GetFloat() const;
+		bool GetBool() const;
+		CharType GetCharacter() const;
+		StringView< CharType > GetString() const;
+		const void* GetPointer() const;
+		//@}
+
+	private:
+		/// Referenced string characters.
+		struct StringValue
+		{
+			/// First character.
+			const CharType* pString;
+			/// Number of characters.
+			size_t size;
+		};
+
+		/// Argument type.
+		EType m_type;
+		/// Argument value.
+		union
+		{
+			int64_t m_signedValue;
+			uint64_t m_unsignedValue;
+			double m_floatValue;
+			bool m_boolValue;
+			CharType m_characterValue;
+			StringValue m_stringValue;
+			const void* m_pPointerValue;
+		};
+	};
+
+	/// @defgroup stringformat Typed String Formatting
+	///
+	/// Format strings contain literal text and "{}" placeholders, each of which is replaced with the next argument.
+	/// Literal braces are written as "{{" and "}}".  A placeholder may contain a format specification after a colon,
+	/// in the form "{:[flags][width][.precision][type]}":
+	/// - flags: "-" to left-justify within the field width, "+" to always print the sign of numbers, and "0" to pad
+	///   numbers with zeros instead of spaces.
+	/// - width: minimum number of characters to write.
+	/// - precision: digits after the decimal point for "f" and "e" formatting, significant digits for "g" formatting,
+	///   or the maximum number of characters to write for strings.
+	/// - type: "d" (decimal, the default for integers), "x" or "X" (hexadecimal), or "b" (binary) for integers; "g"
+	///   (the default), "f", "e", or "E" for floating-point values.
+	///
+	/// Integers and floating-point values are converted by dedicated routines that do not depend on the current locale
+	/// and do not use the C runtime printf() family.  Floating-point values are rounded exactly to at most 17
+	/// significant digits, matching printf() output to that many digits.  Any further digits requested by the precision
+	/// are written as zeros.
+	///
+	/// Output is written directly to the destination buffer.  As with snprintf(), the return value is the length of
+	/// the complete formatted string, which may exceed the buffer size if the output was truncated.
+	//@{
+	HELIUM_FOUNDATION_API size_t StringFormatArgs(
+		char* pBuffer, size_t bufferSize, const char* pFormatString, const FormatArgument< char >* pArguments,
+		size_t argumentCount );
+	HELIUM_FOUNDATION_API size_t StringFormatArgs(
+		wchar_t* pBuffer, size_t bufferSize, const wchar_t* pFormatString, const FormatArgument< wchar_t >* pArguments,
+		size_t argumentCount );
+
+	template< typename CharType > size_t StringFormat(
+		CharType* pBuffer, size_t bufferSize, const CharType* pFormatString );
+	template< typename CharType, typename... Args > size_t StringFormat(
+		CharType* pBuffer, size_t bufferSize, const CharType* pFormatString, const Args&... args );
+	//@}
+
+	/// @defgroup stringformatcheck Compile-time Format String Validation
+	///
+	/// These are used by HELIUM_FORMAT_CHECK() and are not meant to be called directly.
+	//@{
+	template< typename CharType > constexpr size_t CountFormatPlaceholders( const CharType* pFormatString );
+
+	template< typename... Args > char ( &FormatArgumentCounter( const Args&... ) )[ sizeof...( Args ) ];
+	//@}
+
+	/// Compile-time format string parser.
+	///
+	/// This mirrors the runtime format string parser using C++11 constexpr functions.  All functions return null or an
+	/// invalid count if the format string is malformed.
+	template< typename CharType >
+	class FormatStringChecker
+	{
+	public:
+		static constexpr size_t CountPlaceholders( const CharType* pString, size_t count );
+
+	private:
+		static constexpr bool IsDigit( CharType character );
+		static constexpr bool IsFlag( CharType character );
+		static constexpr bool IsType( CharType character );
+
+		static constexpr const CharType* SkipSpec( const CharType* pString );
+		static constexpr const CharType* SkipFlags( const CharType* pString );
+		static constexpr const CharType* SkipDigits( const CharType* pString );
+		static constexpr const CharType* SkipPrecision( const CharType* pString );
+		static constexpr const CharType* SkipType( const CharType* pString );
+		static constexpr const CharType* SkipClose( const CharType* pString );
+	};
+}
+
+#include "Foundation/StringFormat.inl"
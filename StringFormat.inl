@@ -0,0 +1,411 @@
+/// Constructor.
+///
+/// @param[in] value  Argument value.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( short value )
+	: m_type( TYPE_SIGNED )
+	, m_signedValue( value )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] value  Argument value.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( unsigned short value )
+	: m_type( TYPE_UNSIGNED )
+	, m_unsignedValue( value )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] value  Argument value.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( int value )
+	: m_type( TYPE_SIGNED )
+	, m_signedValue( value )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] value  Argument value.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( unsigned int value )
+	: m_type( TYPE_UNSIGNED )
+	, m_unsignedValue( value )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] value  Argument value.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( long value )
+	: m_type( TYPE_SIGNED )
+	, m_signedValue( value )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] value  Argument value.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( unsigned long value )
+	: m_type( TYPE_UNSIGNED )
+	, m_unsignedValue( value )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] value  Argument value.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( long long value )
+	: m_type( TYPE_SIGNED )
+	, m_signedValue( value )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] value  Argument value.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( unsigned long long value )
+	: m_type( TYPE_UNSIGNED )
+	, m_unsignedValue( value )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] value  Argument value.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( float value )
+	: m_type( TYPE_FLOAT )
+	, m_floatValue( value )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] value  Argument value.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( double value )
+	: m_type( TYPE_FLOAT )
+	, m_floatValue( value )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] value  Argument value.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( bool value )
+	: m_type( TYPE_BOOL )
+	, m_boolValue( value )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] value  Argument value.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( CharType value )
+	: m_type( TYPE_CHARACTER )
+	, m_characterValue( value )
+{
+}
+
+/// Constructor.
+///
+/// @param[in] pString  Null-terminated string to reference (a null pointer is treated as an empty string).
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( const CharType* pString )
+	: m_type( TYPE_STRING )
+{
+	m_stringValue.pString = pString;
+	m_stringValue.size = ( pString ? StringLength( pString ) : 0 );
+}
+
+/// Constructor.
+///
+/// @param[in] rString  String to reference.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( const StringView< CharType >& rString )
+	: m_type( TYPE_STRING )
+{
+	m_stringValue.pString = rString.GetData();
+	m_stringValue.size = rString.GetSize();
+}
+
+/// Constructor.
+///
+/// @param[in] rString  String to reference.
+template< typename CharType >
+template< typename Allocator >
+Helium::FormatArgument< CharType >::FormatArgument( const StringBase< CharType, Allocator >& rString )
+	: m_type( TYPE_STRING )
+{
+	m_stringValue.pString = rString.GetData();
+	m_stringValue.size = rString.GetSize();
+}
+
+/// Constructor.
+///
+/// @param[in] pPointer  Pointer whose address should be formatted.
+template< typename CharType >
+Helium::FormatArgument< CharType >::FormatArgument( const void* pPointer )
+	: m_type( TYPE_POINTER )
+	, m_pPointerValue( pPointer )
+{
+}
+
+/// Get the type of this argument.
+///
+/// @return  Argument type.
+template< typename CharType >
+typename Helium::FormatArgument< CharType >::EType Helium::FormatArgument< CharType >::GetType() const
+{
+	return m_type;
+}
+
+/// Get the value of a signed integer argument.
+///
+/// @return  Argument value.
+///
+/// @see GetType()
+template< typename CharType >
+int64_t Helium::FormatArgument< CharType >::GetSigned() const
+{
+	HELIUM_ASSERT( m_type == TYPE_SIGNED );
+
+	return m_signedValue;
+}
+
+/// Get the value of an unsigned integer argument.
+///
+/// @return  Argument value.
+///
+/// @see GetType()
+template< typename CharType >
+uint64_t Helium::FormatArgument< CharType >::GetUnsigned() const
+{
+	HELIUM_ASSERT( m_type == TYPE_UNSIGNED );
+
+	return m_unsignedValue;
+}
+
+/// Get the value of a floating-point argument.
+///
+/// @return  Argument value.
+///
+/// @see GetType()
+template< typename CharType >
+double Helium::FormatArgument< CharType >::GetFloat() const
+{
+	HELIUM_ASSERT( m_type == TYPE_FLOAT );
+
+	return m_floatValue;
+}
+
+/// Get the value of a boolean argument.
+///
+/// @return  Argument value.
+///
+/// @see GetType()
+template< typename CharType >
+bool Helium::FormatArgument< CharType >::GetBool() const
+{
+	HELIUM_ASSERT( m_type == TYPE_BOOL );
+
+	return m_boolValue;
+}
+
+/// Get the value of a character argument.
+///
+/// @return  Argument value.
+///
+/// @see GetType()
+template< typename CharType >
+CharType Helium::FormatArgument< CharType >::GetCharacter() const
+{
+	HELIUM_ASSERT( m_type == TYPE_CHARACTER );
+
+	return m_characterValue;
+}
+
+/// Get the value of a string argument.
+///
+/// @return  View of the referenced string.
+///
+/// @see GetType()
+template< typename CharType >
+Helium::StringView< CharType > Helium::FormatArgument< CharType >::GetString() const
+{
+	HELIUM_ASSERT( m_type == TYPE_STRING );
+
+	return StringView< CharType >( m_stringValue.pString, m_stringValue.size );
+}
+
+/// Get the value of a pointer argument.
+///
+/// @return  Argument value.
+///
+/// @see GetType()
+template< typename CharType >
+const void* Helium::FormatArgument< CharType >::GetPointer() const
+{
+	HELIUM_ASSERT( m_type == TYPE_POINTER );
+
+	return m_pPointerValue;
+}
+
+/// Write a formatted string to a character buffer.
+///
+/// @param[out] pBuffer        Buffer in which to write the formatted string, or null to only compute the formatted
+///                            string length.
+/// @param[in]  bufferSize     Size of the buffer in characters, including room for a null terminator.
+/// @param[in]  pFormatString  Format string.
+///
+/// @return  Length of the complete formatted string, not including the null terminator.
+///
+/// @see StringFormatArgs()
+template< typename CharType >
+size_t Helium::StringFormat( CharType* pBuffer, size_t bufferSize, const CharType* pFormatString )
+{
+	const FormatArgument< CharType >* pArguments = NULL;
+
+	return StringFormatArgs( pBuffer, bufferSize, pFormatString, pArguments, 0 );
+}
+
+/// Write a formatted string to a character buffer.
+///
+/// @param[out] pBuffer        Buffer in which to write the formatted string, or null to only compute the formatted
+///                            string length.
+/// @param[in]  bufferSize     Size of the buffer in characters, including room for a null terminator.
+/// @param[in]  pFormatString  Format string.
+/// @param[in]  args           Format arguments.
+///
+/// @return  Length of the complete formatted string, not including the null terminator.
+///
+/// @see StringFormatArgs()
+template< typename CharType, typename... Args >
+size_t Helium::StringFormat( CharType* pBuffer, size_t bufferSize, const CharType* pFormatString, const Args&... args )
+{
+	const FormatArgument< CharType > arguments[] = { args... };
+
+	return StringFormatArgs( pBuffer, bufferSize, pFormatString, arguments, sizeof...( Args ) );
+}
+
+/// Count the placeholders in a format string at compile time.
+///
+/// @param[in] pFormatString  Format string.
+///
+/// @return  Number of placeholders in the format string, or an invalid count if the format string is malformed.
+template< typename CharType >
+constexpr size_t Helium::CountFormatPlaceholders( const CharType* pFormatString )
+{
+	return FormatStringChecker< CharType >::CountPlaceholders( pFormatString, 0 );
+}
+
+/// Count the placeholders in the remainder of a format string.
+///
+/// @param[in] pString  Current position in the format string, or null if the format string is malformed.
+/// @param[in] count    Number of placeholders found so far.
+///
+/// @return  Total number of placeholders, or an invalid count if the format string is malformed.
+template< typename CharType >
+constexpr size_t Helium::FormatStringChecker< CharType >::CountPlaceholders( const CharType* pString, size_t count )
+{
+	return ( !pString
+		? static_cast< size_t >( -1 )
+		: *pString == static_cast< CharType >( '\0' )
+		? count
+		: *pString == static_cast< CharType >( '{' )
+		? ( pString[ 1 ] == static_cast< CharType >( '{' )
+			? CountPlaceholders( pString + 2, count )
+			: CountPlaceholders( SkipSpec( pString + 1 ), count + 1 ) )
+		: *pString == static_cast< CharType >( '}' )
+		? ( pString[ 1 ] == static_cast< CharType >( '}' )
+			? CountPlaceholders( pString + 2, count )
+			: static_cast< size_t >( -1 ) )
+		: CountPlaceholders( pString + 1, count ) );
+}
+
+/// Get whether a character is a decimal digit.
+template< typename CharType >
+constexpr bool Helium::FormatStringChecker< CharType >::IsDigit( CharType character )
+{
+	return ( character >= static_cast< CharType >( '0' ) && character <= static_cast< CharType >( '9' ) );
+}
+
+/// Get whether a character is a format specification flag.
+template< typename CharType >
+constexpr bool Helium::FormatStringChecker< CharType >::IsFlag( CharType character )
+{
+	return ( character == static_cast< CharType >( '-' ) ||
+		character == static_cast< CharType >( '+' ) ||
+		character == static_cast< CharType >( '0' ) );
+}
+
+/// Get whether a character is a format specification type.
+template< typename CharType >
+constexpr bool Helium::FormatStringChecker< CharType >::IsType( CharType character )
+{
+	return ( character == static_cast< CharType >( 'd' ) ||
+		character == static_cast< CharType >( 'x' ) ||
+		character == static_cast< CharType >( 'X' ) ||
+		character == static_cast< CharType >( 'b' ) ||
+		character == static_cast< CharType >( 'f' ) ||
+		character == static_cast< CharType >( 'e' ) ||
+		character == static_cast< CharType >( 'E' ) ||
+		character == static_cast< CharType >( 'g' ) );
+}
+
+/// Skip past a placeholder format specification and its closing brace.
+template< typename CharType >
+constexpr const CharType* Helium::FormatStringChecker< CharType >::SkipSpec( const CharType* pString )
+{
+	return ( *pString == static_cast< CharType >( ':' ) ? SkipFlags( pString + 1 ) : SkipClose( pString ) );
+}
+
+/// Skip format specification flags, the field width, and the rest of the specification.
+template< typename CharType >
+constexpr const CharType* Helium::FormatStringChecker< CharType >::SkipFlags( const CharType* pString )
+{
+	return ( IsFlag( *pString ) ? SkipFlags( pString + 1 ) : SkipPrecision( SkipDigits( pString ) ) );
+}
+
+/// Skip a sequence of decimal digits.
+template< typename CharType >
+constexpr const CharType* Helium::FormatStringChecker< CharType >::SkipDigits( const CharType* pString )
+{
+	return ( IsDigit( *pString ) ? SkipDigits( pString + 1 ) : pString );
+}
+
+/// Skip the precision, type, and closing brace of a format specification.
+template< typename CharType >
+constexpr const CharType* Helium::FormatStringChecker< CharType >::SkipPrecision( const CharType* pString )
+{
+	return ( *pString != static_cast< CharType >( '.' )
+		? SkipType( pString )
+		: IsDigit( pString[ 1 ] )
+		? SkipType( SkipDigits( pString + 1 ) )
+		: static_cast< const CharType* >( NULL ) );
+}
+
+/// Skip the type and closing brace of a format specification.
+template< typename CharType >
+constexpr const CharType* Helium::FormatStringChecker< CharType >::SkipType( const CharType* pString )
+{
+	return SkipClose( IsType( *pString ) ? pString + 1 : pString );
+}
+
+/// Skip the closing brace of a placeholder.
+template< typename CharType >
+constexpr const CharType* Helium::FormatStringChecker< CharType >::SkipClose( const CharType* pString )
+{
+	return ( *pString == static_cast< CharType >( '}' ) ? pString + 1 : static_cast< const CharType* >( NULL ) );
+}
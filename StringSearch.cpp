@@ -0,0 +1,489 @@
+#include "FoundationPch.h"
+#include "Foundation/StringSearch.h"
+
+#include "Foundation/Math.h"
+
+#if defined( HELIUM_CPU_X86 ) && ( defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+# define HELIUM_STRING_SEARCH_SSE2 1
+# include <emmintrin.h>
+# if defined( __SSE4_2__ ) || defined( __AVX__ )
+#  define HELIUM_STRING_SEARCH_SSE42 1
+#  include <nmmintrin.h>
+# endif
+# if defined( __AVX2__ )
+#  define HELIUM_STRING_SEARCH_AVX2 1
+#  include <immintrin.h>
+# endif
+#endif
+
+using namespace Helium;
+
+#if HELIUM_STRING_SEARCH_SSE2
+/// Maximum number of characters in a set for which searches compare against each character in the set.
+static const size_t MAX_VECTOR_SET_SIZE = 8;
+
+#if HELIUM_STRING_SEARCH_AVX2
+/// Vector type used for string searches.
+typedef __m256i SearchVector;
+/// Vector comparison mask with every character matching.
+static const uint32_t SEARCH_MASK_ALL = 0xffffffff;
+
+static inline SearchVector LoadSearchVector( const void* pData )
+{
+	return _mm256_loadu_si256( static_cast< const __m256i* >( pData ) );
+}
+
+static inline SearchVector OrSearchVectors( SearchVector a, SearchVector b )
+{
+	return _mm256_or_si256( a, b );
+}
+
+static inline uint32_t GetSearchMask( SearchVector matches )
+{
+	return static_cast< uint32_t >( _mm256_movemask_epi8( matches ) );
+}
+
+static inline SearchVector SplatSearchCharacter( char character )
+{
+	return _mm256_set1_epi8( character );
+}
+
+static inline SearchVector SplatSearchCharacter( wchar_t character )
+{
+	return ( sizeof( wchar_t ) == 2
+		? _mm256_set1_epi16( static_cast< int16_t >( character ) )
+		: _mm256_set1_epi32( static_cast< int32_t >( character ) ) );
+}
+
+static inline SearchVector CompareSearchVectors( SearchVector a, SearchVector b, char )
+{
+	return _mm256_cmpeq_epi8( a, b );
+}
+
+static inline SearchVector CompareSearchVectors( SearchVector a, SearchVector b, wchar_t )
+{
+	return ( sizeof( wchar_t ) == 2 ? _mm256_cmpeq_epi16( a, b ) : _mm256_cmpeq_epi32( a, b ) );
+}
+#else
+/// Vector type used for string searches.
+typedef __m128i SearchVector;
+/// Vector comparison mask with every character matching.
+static const uint32_t SEARCH_MASK_ALL = 0xffff;
+
+static inline SearchVector LoadSearchVector( const void* pData )
+{
+	return _mm_loadu_si128( static_cast< const __m128i* >( pData ) );
+}
+
+static inline SearchVector OrSearchVectors( SearchVector a, SearchVector b )
+{
+	return _mm_or_si128( a, b );
+}
+
+static inline uint32_t GetSearchMask( SearchVector matches )
+{
+	return static_cast< uint32_t >( _mm_movemask_epi8( matches ) );
+}
+
+static inline SearchVector SplatSearchCharacter( char character )
+{
+	return _mm_set1_epi8( character );
+}
+
+static inline SearchVector SplatSearchCharacter( wchar_t character )
+{
+	return ( sizeof( wchar_t ) == 2
+		? _mm_set1_epi16( static_cast< int16_t >( character ) )
+		: _mm_set1_epi32( static_cast< int32_t >( character ) ) );
+}
+
+static inline SearchVector CompareSearchVectors( SearchVector a, SearchVector b, char )
+{
+	return _mm_cmpeq_epi8( a, b );
+}
+
+static inline SearchVector CompareSearchVectors( SearchVector a, SearchVector b, wchar_t )
+{
+	return ( sizeof( wchar_t ) == 2 ? _mm_cmpeq_epi16( a, b ) : _mm_cmpeq_epi32( a, b ) );
+}
+#endif
+
+/// Vectorized search for a single character.
+///
+/// Each vector comparison sets every byte of each matching character in the movemask result, so the index of the first
+/// match is found by dividing the index of the lowest set bit by the character size.
+template< typename CharType >
+static size_t VectorFind( const CharType* pString, size_t size, CharType character )
+{
+	const size_t charactersPerVector = sizeof( SearchVector ) / sizeof( CharType );
+
+	SearchVector target = SplatSearchCharacter( character );
+
+	size_t index = 0;
+	for( ; index + charactersPerVector <= size; index += charactersPerVector )
+	{
+		uint32_t mask = GetSearchMask(
+			CompareSearchVectors( LoadSearchVector( pString + index ), target, character ) );
+		if( mask != 0 )
+		{
+			return index + CountTrailingZeros( mask ) / sizeof( CharType );
+		}
+	}
+
+	for( ; index < size; ++index )
+	{
+		if( pString[ index ] == character )
+		{
+			return index;
+		}
+	}
+
+	return Invalid< size_t >();
+}
+
+/// Vectorized search for a character in (or not in, if bMatchNone is true) a small character set.
+///
+/// The characters of each vector are compared against each character in the set, and the comparison results are
+/// combined to find the characters matching any character in the set.
+template< typename CharType >
+static size_t VectorFindSet(
+	const CharType* pString,
+	size_t size,
+	const CharType* pCharacters,
+	size_t characterCount,
+	bool bMatchNone )
+{
+	HELIUM_ASSERT( characterCount != 0 );
+	HELIUM_ASSERT( characterCount <= MAX_VECTOR_SET_SIZE );
+
+	const size_t charactersPerVector = sizeof( SearchVector ) / sizeof( CharType );
+
+	SearchVector targets[ MAX_VECTOR_SET_SIZE ];
+	for( size_t characterIndex = 0; characterIndex < characterCount; ++characterIndex )
+	{
+		targets[ characterIndex ] = SplatSearchCharacter( pCharacters[ characterIndex ] );
+	}
+
+	uint32_t invertMask = ( bMatchNone ? SEARCH_MASK_ALL : 0 );
+
+	size_t index = 0;
+	for( ; index + charactersPerVector <= size; index += charactersPerVector )
+	{
+		SearchVector block = LoadSearchVector( pString + index );
+		SearchVector matches = CompareSearchVectors( block, targets[ 0 ], CharType() );
+		for( size_t characterIndex = 1; characterIndex < characterCount; ++characterIndex )
+		{
+			matches = OrSearchVectors( matches, CompareSearchVectors( block, targets[ characterIndex ], CharType() ) );
+		}
+
+		uint32_t mask = GetSearchMask( matches ) ^ invertMask;
+		if( mask != 0 )
+		{
+			return index + CountTrailingZeros( mask ) / sizeof( CharType );
+		}
+	}
+
+	if( index >= size )
+	{
+		return Invalid< size_t >();
+	}
+
+	size_t tailIndex = ( bMatchNone
+		? StringFindNone< CharType >( pString + index, size - index, pCharacters, characterCount )
+		: StringFindAny< CharType >( pString + index, size - index, pCharacters, characterCount ) );
+
+	return ( IsValid( tailIndex ) ? index + tailIndex : tailIndex );
+}
+#endif  // HELIUM_STRING_SEARCH_SSE2
+
+#if HELIUM_STRING_SEARCH_SSE42
+/// Number of characters in a char set that can be compared with a single PCMPESTRI instruction.
+static const size_t MAX_SSE42_SET_SIZE = 16;
+
+/// Search for a character in (or not in, if bMatchNone is true) a set of up to sixteen characters using PCMPESTRI.
+static size_t Sse42FindSet(
+	const char* pString,
+	size_t size,
+	const char* pCharacters,
+	size_t characterCount,
+	bool bMatchNone )
+{
+	HELIUM_ASSERT( characterCount != 0 );
+	HELIUM_ASSERT( characterCount <= MAX_SSE42_SET_SIZE );
+
+	// Load the character set without reading past the end of the caller's set.
+	char setCharacters[ MAX_SSE42_SET_SIZE ] = { 0 };
+	MemoryCopy( setCharacters, pCharacters, characterCount );
+	__m128i set = _mm_loadu_si128( reinterpret_cast< const __m128i* >( setCharacters ) );
+	int setLength = static_cast< int >( characterCount );
+
+	size_t index = 0;
+	if( bMatchNone )
+	{
+		for( ; index + 16 <= size; index += 16 )
+		{
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( pString + index ) );
+			int blockIndex = _mm_cmpestri(
+				set, setLength, block, 16,
+				_SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_NEGATIVE_POLARITY | _SIDD_LEAST_SIGNIFICANT );
+			if( blockIndex < 16 )
+			{
+				return index + static_cast< size_t >( blockIndex );
+			}
+		}
+	}
+	else
+	{
+		for( ; index + 16 <= size; index += 16 )
+		{
+			__m128i block = _mm_loadu_si128( reinterpret_cast< const __m128i* >( pString + index ) );
+			int blockIndex = _mm_cmpestri(
+				set, setLength, block, 16, _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_LEAST_SIGNIFICANT );
+			if( blockIndex < 16 )
+			{
+				return index + static_cast< size_t >( blockIndex );
+			}
+		}
+	}
+
+	if( index >= size )
+	{
+		return Invalid< size_t >();
+	}
+
+	size_t tailIndex = ( bMatchNone
+		? StringFindNone< char >( pString + index, size - index, pCharacters, characterCount )
+		: StringFindAny< char >( pString + index, size - index, pCharacters, characterCount ) );
+
+	return ( IsValid( tailIndex ) ? index + tailIndex : tailIndex );
+}
+#endif  // HELIUM_STRING_SEARCH_SSE42
+
+/// Number of entries in a char set lookup table.
+static const size_t CHARACTER_TABLE_SIZE = 256;
+
+/// Search for a char in (or not in, if bMatchNone is true) a character set of any size using a lookup table.
+static size_t TableFindSet(
+	const char* pString,
+	size_t size,
+	const char* pCharacters,
+	size_t characterCount,
+	bool bMatchNone )
+{
+	bool characterTable[ CHARACTER_TABLE_SIZE ];
+	ArraySet( characterTable, bMatchNone, CHARACTER_TABLE_SIZE );
+	for( size_t characterIndex = 0; characterIndex < characterCount; ++characterIndex )
+	{
+		characterTable[ static_cast< uint8_t >( pCharacters[ characterIndex ] ) ] = !bMatchNone;
+	}
+
+	for( size_t index = 0; index < size; ++index )
+	{
+		if( characterTable[ static_cast< uint8_t >( pString[ index ] ) ] )
+		{
+			return index;
+		}
+	}
+
+	return Invalid< size_t >();
+}
+
+/// Find the first instance of a character in a string.
+///
+/// @param[in] pString    String to search.
+/// @param[in] size       Number of characters to search.
+/// @param[in] character  Character to locate.
+///
+/// @return  Index of the first instance of the character if found, or an invalid index if not found.
+///
+/// @see StringFindAny(), StringFindNone()
+size_t Helium::StringFind( const char* pString, size_t size, char character )
+{
+	HELIUM_ASSERT( pString || size == 0 );
+
+#if HELIUM_STRING_SEARCH_SSE2
+	return VectorFind( pString, size, character );
+#else
+	return StringFind< char >( pString, size, character );
+#endif
+}
+
+/// Find the first instance of a character in a string.
+///
+/// @param[in] pString    String to search.
+/// @param[in] size       Number of characters to search.
+/// @param[in] character  Character to locate.
+///
+/// @return  Index of the first instance of the character if found, or an invalid index if not found.
+///
+/// @see StringFindAny(), StringFindNone()
+size_t Helium::StringFind( const wchar_t* pString, size_t size, wchar_t character )
+{
+	HELIUM_ASSERT( pString || size == 0 );
+
+#if HELIUM_STRING_SEARCH_SSE2
+	return VectorFind( pString, size, character );
+#else
+	return StringFind< wchar_t >( pString, size, character );
+#endif
+}
+
+/// Find the first instance of any of a set of characters in a string.
+///
+/// @param[in] pString         String to search.
+/// @param[in] size            Number of characters to search.
+/// @param[in] pCharacters     Characters to locate.
+/// @param[in] characterCount  Number of characters in @c pCharacters.
+///
+/// @return  Index of the first instance of any of the characters if found, or an invalid index if not found.
+///
+/// @see StringFind(), StringFindNone()
+size_t Helium::StringFindAny( const char* pString, size_t size, const char* pCharacters, size_t characterCount )
+{
+	HELIUM_ASSERT( pString || size == 0 );
+	HELIUM_ASSERT( pCharacters || characterCount == 0 );
+
+	if( characterCount == 0 || size == 0 )
+	{
+		return Invalid< size_t >();
+	}
+
+	if( characterCount == 1 )
+	{
+		return StringFind( pString, size, pCharacters[ 0 ] );
+	}
+
+#if HELIUM_STRING_SEARCH_SSE42
+	if( characterCount <= MAX_SSE42_SET_SIZE )
+	{
+		return Sse42FindSet( pString, size, pCharacters, characterCount, false );
+	}
+#elif HELIUM_STRING_SEARCH_SSE2
+	if( characterCount <= MAX_VECTOR_SET_SIZE )
+	{
+		return VectorFindSet( pString, size, pCharacters, characterCount, false );
+	}
+#endif
+
+	return TableFindSet( pString, size, pCharacters, characterCount, false );
+}
+
+/// Find the first instance of any of a set of characters in a string.
+///
+/// @param[in] pString         String to search.
+/// @param[in] size            Number of characters to search.
+/// @param[in] pCharacters     Characters to locate.
+/// @param[in] characterCount  Number of characters in @c pCharacters.
+///
+/// @return  Index of the first instance of any of the characters if found, or an invalid index if not found.
+///
+/// @see StringFind(), StringFindNone()
+size_t Helium::StringFindAny(
+	const wchar_t* pString,
+	size_t size,
+	const wchar_t* pCharacters,
+	size_t characterCount )
+{
+	HELIUM_ASSERT( pString || size == 0 );
+	HELIUM_ASSERT( pCharacters || characterCount == 0 );
+
+	if( characterCount == 0 || size == 0 )
+	{
+		return Invalid< size_t >();
+	}
+
+	if( characterCount == 1 )
+	{
+		return StringFind( pString, size, pCharacters[ 0 ] );
+	}
+
+#if HELIUM_STRING_SEARCH_SSE2
+	if( characterCount <= MAX_VECTOR_SET_SIZE )
+	{
+		return VectorFindSet( pString, size, pCharacters, characterCount, false );
+	}
+#endif
+
+	return StringFindAny< wchar_t >( pString, size, pCharacters, characterCount );
+}
+
+/// Find the first character in a string that does not match any of a set of characters.
+///
+/// @param[in] pString         String to search.
+/// @param[in] size            Number of characters to search.
+/// @param[in] pCharacters     Characters to skip.
+/// @param[in] characterCount  Number of characters in @c pCharacters.
+///
+/// @return  Index of the first character not matching any of the given characters if found, or an invalid index if
+///          not found.
+///
+/// @see StringFind(), StringFindAny()
+size_t Helium::StringFindNone( const char* pString, size_t size, const char* pCharacters, size_t characterCount )
+{
+	HELIUM_ASSERT( pString || size == 0 );
+	HELIUM_ASSERT( pCharacters || characterCount == 0 );
+
+	if( size == 0 )
+	{
+		return Invalid< size_t >();
+	}
+
+	if( characterCount == 0 )
+	{
+		return 0;
+	}
+
+#if HELIUM_STRING_SEARCH_SSE42
+	if( characterCount <= MAX_SSE42_SET_SIZE )
+	{
+		return Sse42FindSet( pString, size, pCharacters, characterCount, true );
+	}
+#elif HELIUM_STRING_SEARCH_SSE2
+	if( characterCount <= MAX_VECTOR_SET_SIZE )
+	{
+		return VectorFindSet( pString, size, pCharacters, characterCount, true );
+	}
+#endif
+
+	return TableFindSet( pString, size, pCharacters, characterCount, true );
+}
+
+/// Find the first character in a string that does not match any of a set of characters.
+///
+/// @param[in] pString         String to search.
+/// @param[in] size            Number of characters to search.
+/// @param[in] pCharacters     Characters to skip.
+/// @param[in] characterCount  Number of characters in @c pCharacters.
+///
+/// @return  Index of the first character not matching any of the given characters if found, or an invalid index if
+///          not found.
+///
+/// @see StringFind(), StringFindAny()
+size_t Helium::StringFindNone(
+	const wchar_t* pString,
+	size_t size,
+	const wchar_t* pCharacters,
+	size_t characterCount )
+{
+	HELIUM_ASSERT( pString || size == 0 );
+	HELIUM_ASSERT( pCharacters || characterCount == 0 );
+
+	if( size == 0 )
+	{
+		return Invalid< size_t >();
+	}
+
+	if( characterCount == 0 )
+	{
+		return 0;
+	}
+
+#if HELIUM_STRING_SEARCH_SSE2
+	if( characterCount <= MAX_VECTOR_SET_SIZE )
+	{
+		return VectorFindSet( pString, size, pCharacters, characterCount, true );
+	}
+#endif
+
+	return StringFindNone< wchar_t >( pString, size, pCharacters, characterCount );
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Platform/Types.h"
+#include "Platform/Assert.h"
+#include "Platform/Utility.h"
+
+#include "Foundation/API.h"
+
+namespace Helium
+{
+	/// @defgroup stringsearch String Search Primitives
+	///
+	/// These functions search a range of string characters (which do not need to be null-terminated) and return the
+	/// index of the first matching character, or an invalid index if no character matches.  They are used by StringBase
+	/// and StringView for all of their character searches.
+	///
+	/// The char and wchar_t overloads are vectorized when the target supports SSE2 (sixteen bytes per compare) or AVX2
+	/// (thirty-two bytes per compare).  Character set searches compare against each character in the set for small
+	/// sets, use SSE4.2 PCMPESTRI for char sets of up to sixteen characters when available, and otherwise fall back to
+	/// scalar searches (using a lookup table for char sets).  Other character types always use the scalar template
+	/// implementations.
+	//@{
+	HELIUM_FOUNDATION_API size_t StringFind( const char* pString, size_t size, char character );
+	HELIUM_FOUNDATION_API size_t StringFind( const wchar_t* pString, size_t size, wchar_t character );
+	template< typename CharType > size_t StringFind( const CharType* pString, size_t size, CharType character );
+
+	HELIUM_FOUNDATION_API size_t StringFindAny(
+		const char* pString, size_t size, const char* pCharacters, size_t characterCount );
+	HELIUM_FOUNDATION_API size_t StringFindAny(
+		const wchar_t* pString, size_t size, const wchar_t* pCharacters, size_t characterCount );
+	template< typename CharType > size_t StringFindAny(
+		const CharType* pString, size_t size, const CharType* pCharacters, size_t characterCount );
+
+	HELIUM_FOUNDATION_API size_t StringFindNone(
+		const char* pString, size_t size, const char* pCharacters, size_t characterCount );
+	HELIUM_FOUNDATION_API size_t StringFindNone(
+		const wchar_t* pString, size_t size, const wchar_t* pCharacters, size_t characterCount );
+	template< typename CharType > size_t StringFindNone(
+		const CharType* pString, size_t size, const CharType* pCharacters, size_t characterCount );
+	//@}
+}
+
+#include "Foundation/StringSearch.inl"
@@ -0,0 +1,101 @@
+/// Find the first instance of a character in a string.
+///
+/// @param[in] pString    String to search.
+/// @param[in] size       Number of characters to search.
+/// @param[in] character  Character to locate.
+///
+/// @return  Index of the first instance of the character if found, or an invalid index if not found.
+///
+/// @see StringFindAny(), StringFindNone()
+template< typename CharType >
+size_t Helium::StringFind( const CharType* pString, size_t size, CharType character )
+{
+	HELIUM_ASSERT( pString || size == 0 );
+
+	for( size_t index = 0; index < size; ++index )
+	{
+		if( pString[ index ] == character )
+		{
+			return index;
+		}
+	}
+
+	return Invalid< size_t >();
+}
+
+/// Find the first instance of any of a set of characters in a string.
+///
+/// @param[in] pString         String to search.
+/// @param[in] size            Number of characters to search.
+/// @param[in] pCharacters     Characters to locate.
+/// @param[in] characterCount  Number of characters in @c pCharacters.
+///
+/// @return  Index of the first instance of any of the characters if found, or an invalid index if not found.
+///
+/// @see StringFind(), StringFindNone()
+template< typename CharType >
+size_t Helium::StringFindAny(
+	const CharType* pString,
+	size_t size,
+	const CharType* pCharacters,
+	size_t characterCount )
+{
+	HELIUM_ASSERT( pString || size == 0 );
+	HELIUM_ASSERT( pCharacters || characterCount == 0 );
+
+	for( size_t index = 0; index < size; ++index )
+	{
+		CharType testCharacter = pString[ index ];
+		for( size_t characterIndex = 0; characterIndex < characterCount; ++characterIndex )
+		{
+			if( testCharacter == pCharacters[ characterIndex ] )
+			{
+				return index;
+			}
+		}
+	}
+
+	return Invalid< size_t >();
+}
+
+/// Find the first character in a string that does not match any of a set of characters.
+///
+/// @param[in] pString         String to search.
+/// @param[in] size            Number of characters to search.
+/// @param[in] pCharacters     Characters to skip.
+/// @param[in] characterCount  Number of characters in @c pCharacters.
+///
+/// @return  Index of the first character not matching any of the given characters if found, or an invalid index if
+///          not found.
+///
+/// @see StringFind(), StringFindAny()
+template< typename CharType >
+size_t Helium::StringFindNone(
+	const CharType* pString,
+	size_t size,
+	const CharType* pCharacters,
+	size_t characterCount )
+{
+	HELIUM_ASSERT( pString || size == 0 );
+	HELIUM_ASSERT( pCharacters || characterCount == 0 );
+
+	for( size_t index = 0; index < size; ++index )
+	{
+		CharType testCharacter = pString[ index ];
+		size_t characterIndex;
+		for( characterIndex = 0; characterIndex < characterCount; ++characterIndex )
+		{
+			if( testCharacter == pCharacters[ characterIndex ] )
+			{
+				break;
+			}
+		}
+
+		if( characterIndex >= characterCount )
+		{
+			return index;
+		}
+	}
+
+	return Invalid< size_t >();
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "Platform/Types.h"
+#include "Platform/Utility.h"
+
+#include "Foundation/API.h"
+#include "Foundation/Math.h"
+#include "Foundation/DynamicArray.h"
+#include "Foundation/StringSearch.h"
+
+namespace Helium
+{
+	template< typename CharType, typename Allocator > class StringBase;
+
+	/// Non-owning reference to a range of string characters.
+	///
+	/// A string view does not copy or allocate memory for the characters it references, so the string from which it is
+	/// created must remain valid and unchanged for as long as the view is in use.  Unlike StringBase, the characters
+	/// referenced by a view are not necessarily null-terminated.
+	///
+	/// Views can be used with StringBase::Split() (i.e. by splitting into a DynamicArray of StringView objects) to
+	/// split a string without allocating a new string for each component.
+	template< typename CharType >
+	class StringView
+	{
+	public:
+		/// @name Construction/Destruction
+		//@{
+		StringView();
+		StringView( const CharType* pString );
+		StringView( const CharType* pString, size_t size );
+		template< typename Allocator > StringView( const StringBase< CharType, Allocator >& rString );
+		//@}
+
+		/// @name View Operations
+		//@{
+		size_t GetSize() const;
+		bool IsEmpty() const;
+
+		const CharType* GetData() const;
+
+		void Clear();
+
+		const CharType& GetElement( size_t index ) const;
+		const CharType& GetFirst() const;
+		const CharType& GetLast() const;
+
+		StringView Substring( size_t index = 0, size_t count = Invalid< size_t >() ) const;
+		void RemovePrefix( size_t count );
+		void RemoveSuffix( size_t count );
+
+		int Compare( const StringView& rString ) const;
+		//@}
+
+		/// @name Parsing
+		//@{
+		size_t Find( CharType character, size_t startIndex = 0 ) const;
+		size_t Find( const StringView& rString, size_t startIndex = 0 ) const;
+		size_t FindReverse( CharType character, size_t startIndex = Invalid< size_t >() ) const;
+
+		size_t FindAny( const StringView& rCharacters, size_t startIndex = 0 ) const;
+		size_t FindNone( const StringView& rCharacters, size_t startIndex = 0 ) const;
+
+		bool Contains( CharType character ) const;
+		bool Contains( const StringView& rString ) const;
+
+		bool StartsWith( const StringView& rString ) const;
+		bool EndsWith( const StringView& rString ) const;
+
+		template< typename ArrayType, typename ArrayAllocator > void Split(
+			DynamicArray< ArrayType, ArrayAllocator >& rStringResults, CharType separator,
+			bool bCombineAdjacentSeparators = false ) const;
+		template< typename ArrayType, typename ArrayAllocator > void Split(
+			DynamicArray< ArrayType, ArrayAllocator >& rStringResults, const StringView& rSeparators,
+			bool bCombineAdjacentSeparators = false ) const;
+		//@}
+
+		/// @name Overloaded Operators
+		//@{
+		const CharType& operator[]( size_t index ) const;
+
+		bool operator==( const StringView& rString ) const;
+		bool operator!=( const StringView& rString ) const;
+		bool operator<( const StringView& rString ) const;
+		//@}
+
+	private:
+		/// First character in the view.
+		const CharType* m_pString;
+		/// Number of characters in the view.
+		size_t m_size;
+	};
+
+	/// 8-bit character string view.
+	typedef StringView< char > CharStringView;
+	/// Wide character string view.
+	typedef StringView< wchar_t > WideStringView;
+}
+
+#include "Foundation/StringView.inl"
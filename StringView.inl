@@ -0,0 +1,506 @@
+/// Constructor.
+///
+/// This creates an empty view.
+template< typename CharType >
+Helium::StringView< CharType >::StringView()
+	: m_pString( NULL )
+	, m_size( 0 )
+{
+}
+
+/// Constructor.
+///
+/// This creates a view of a null-terminated C-style string.  The length is determined automatically based on the
+/// location of the first null terminating character.
+///
+/// @param[in] pString  C-style string to reference.  This can be null.
+template< typename CharType >
+Helium::StringView< CharType >::StringView( const CharType* pString )
+	: m_pString( pString )
+	, m_size( pString ? StringLength( pString ) : 0 )
+{
+}
+
+/// Constructor.
+///
+/// This creates a view of a C-style string with an explicit length specified.
+///
+/// @param[in] pString  C-style string to reference.  This can be null as long as the size specified is zero.
+/// @param[in] size     Number of character type elements to reference, not including any null terminator.
+template< typename CharType >
+Helium::StringView< CharType >::StringView( const CharType* pString, size_t size )
+	: m_pString( pString )
+	, m_size( size )
+{
+	HELIUM_ASSERT( pString || size == 0 );
+}
+
+/// Constructor.
+///
+/// This creates a view of the current contents of a string.  The view is only valid until the string is modified or
+/// destroyed.
+///
+/// @param[in] rString  String to reference.
+template< typename CharType >
+template< typename Allocator >
+Helium::StringView< CharType >::StringView( const StringBase< CharType, Allocator >& rString )
+	: m_pString( rString.GetData() )
+	, m_size( rString.GetSize() )
+{
+}
+
+/// Get the size of this view.
+///
+/// @return  Number of character type elements in this view.
+///
+/// @see IsEmpty()
+template< typename CharType >
+size_t Helium::StringView< CharType >::GetSize() const
+{
+	return m_size;
+}
+
+/// Get whether this view is empty.
+///
+/// @return  True if this view is empty, false if not.
+///
+/// @see GetSize()
+template< typename CharType >
+bool Helium::StringView< CharType >::IsEmpty() const
+{
+	return ( m_size == 0 );
+}
+
+/// Get a pointer to the first character referenced by this view.
+///
+/// Note that the characters referenced by a view are not necessarily null-terminated.
+///
+/// @return  First character in this view, or null if this view was created without a string.
+template< typename CharType >
+const CharType* Helium::StringView< CharType >::GetData() const
+{
+	return m_pString;
+}
+
+/// Reset this view to an empty view.
+template< typename CharType >
+void Helium::StringView< CharType >::Clear()
+{
+	m_pString = NULL;
+	m_size = 0;
+}
+
+/// Get the character at the specified index.
+///
+/// @param[in] index  Character index.
+///
+/// @return  Reference to the character at the specified index.
+template< typename CharType >
+const CharType& Helium::StringView< CharType >::GetElement( size_t index ) const
+{
+	HELIUM_ASSERT( index < m_size );
+	return m_pString[ index ];
+}
+
+/// Get the first character in this view.
+///
+/// @return  Reference to the first character in this view.
+///
+/// @see GetLast()
+template< typename CharType >
+const CharType& Helium::StringView< CharType >::GetFirst() const
+{
+	HELIUM_ASSERT( m_size != 0 );
+	return m_pString[ 0 ];
+}
+
+/// Get the last character in this view.
+///
+/// @return  Reference to the last character in this view.
+///
+/// @see GetFirst()
+template< typename CharType >
+const CharType& Helium::StringView< CharType >::GetLast() const
+{
+	HELIUM_ASSERT( m_size != 0 );
+	return m_pString[ m_size - 1 ];
+}
+
+/// Get a view of a range of characters within this view.
+///
+/// @param[in] index  Starting character index.
+/// @param[in] count  Maximum number of characters to include.
+///
+/// @return  View of the requested characters.
+template< typename CharType >
+Helium::StringView< CharType > Helium::StringView< CharType >::Substring( size_t index, size_t count ) const
+{
+	HELIUM_ASSERT( index <= m_size );
+
+	if( index >= m_size )
+	{
+		return StringView();
+	}
+
+	return StringView( m_pString + index, Min( count, m_size - index ) );
+}
+
+/// Remove characters from the start of this view.
+///
+/// @param[in] count  Number of characters to remove.
+///
+/// @see RemoveSuffix()
+template< typename CharType >
+void Helium::StringView< CharType >::RemovePrefix( size_t count )
+{
+	HELIUM_ASSERT( count <= m_size );
+	m_pString += count;
+	m_size -= count;
+}
+
+/// Remove characters from the end of this view.
+///
+/// @param[in] count  Number of characters to remove.
+///
+/// @see RemovePrefix()
+template< typename CharType >
+void Helium::StringView< CharType >::RemoveSuffix( size_t count )
+{
+	HELIUM_ASSERT( count <= m_size );
+	m_size -= count;
+}
+
+/// Compare the characters of this view with those of another view based on character code values.
+///
+/// @param[in] rString  View with which to compare.
+///
+/// @return  Less than zero if this view should precede the given view, greater than zero if this view should follow
+///          the given view, or zero if both views match.
+template< typename CharType >
+int Helium::StringView< CharType >::Compare( const StringView& rString ) const
+{
+	size_t testSize = Min( m_size, rString.m_size );
+	for( size_t characterIndex = 0; characterIndex < testSize; ++characterIndex )
+	{
+		CharType thisCharacter = m_pString[ characterIndex ];
+		CharType otherCharacter = rString.m_pString[ characterIndex ];
+		if( thisCharacter != otherCharacter )
+		{
+			return ( thisCharacter < otherCharacter ? -1 : 1 );
+		}
+	}
+
+	return ( m_size < rString.m_size ? -1 : ( m_size > rString.m_size ? 1 : 0 ) );
+}
+
+/// Find the first instance of the specified character, starting from the given offset.
+///
+/// @param[in] character   Character to locate.
+/// @param[in] startIndex  Index from which to start searching.
+///
+/// @return  Index of the first instance of the specified character if found, or an invalid index if not found.
+///
+/// @see FindReverse(), FindAny(), FindNone()
+template< typename CharType >
+size_t Helium::StringView< CharType >::Find( CharType character, size_t startIndex ) const
+{
+	if( startIndex >= m_size )
+	{
+		return Invalid< size_t >();
+	}
+
+	size_t index = StringFind( m_pString + startIndex, m_size - startIndex, character );
+
+	return ( IsValid( index ) ? startIndex + index : index );
+}
+
+/// Find the first instance of the specified string, starting from the given offset.
+///
+/// @param[in] rString     String to locate.
+/// @param[in] startIndex  Index from which to start searching.
+///
+/// @return  Index of the first instance of the specified string if found, or an invalid index if not found.  An empty
+///          string is always found at the start index (as long as the start index is within this view).
+///
+/// @see FindReverse(), FindAny(), FindNone()
+template< typename CharType >
+size_t Helium::StringView< CharType >::Find( const StringView& rString, size_t startIndex ) const
+{
+	size_t otherSize = rString.m_size;
+	if( startIndex > m_size || otherSize > m_size - startIndex )
+	{
+		return Invalid< size_t >();
+	}
+
+	if( otherSize == 0 )
+	{
+		return startIndex;
+	}
+
+	// Scan for the first character of the string to locate, only comparing the full string at each candidate.
+	CharType firstCharacter = rString.m_pString[ 0 ];
+	size_t otherByteCount = sizeof( CharType ) * otherSize;
+	size_t candidateCount = m_size - otherSize + 1;
+	for( size_t index = startIndex; index < candidateCount; ++index )
+	{
+		size_t offset = StringFind( m_pString + index, candidateCount - index, firstCharacter );
+		if( IsInvalid( offset ) )
+		{
+			break;
+		}
+
+		index += offset;
+		if( MemoryCompare( m_pString + index, rString.m_pString, otherByteCount ) == 0 )
+		{
+			return index;
+		}
+	}
+
+	return Invalid< size_t >();
+}
+
+/// Find the last instance of the specified character, starting from the given offset and searching in reverse.
+///
+/// @param[in] character   Character to locate.
+/// @param[in] startIndex  Index from which to start searching, or an invalid index to start searching from the end of
+///                        the view.
+///
+/// @return  Index of the last instance of the specified character if found, or an invalid index if not found.
+///
+/// @see Find(), FindAny(), FindNone()
+template< typename CharType >
+size_t Helium::StringView< CharType >::FindReverse( CharType character, size_t startIndex ) const
+{
+	size_t index = ( startIndex >= m_size ? m_size : startIndex + 1 );
+	while( index != 0 )
+	{
+		--index;
+		if( m_pString[ index ] == character )
+		{
+			return index;
+		}
+	}
+
+	return Invalid< size_t >();
+}
+
+/// Find the first instance of any of the characters in the given string, starting from the given offset.
+///
+/// @param[in] rCharacters  String containing the characters to locate.
+/// @param[in] startIndex   Index from which to start searching.
+///
+/// @return  Index of the first instance of any of the specified characters if found, or an invalid index if not found.
+///
+/// @see FindNone(), Find(), FindReverse()
+template< typename CharType >
+size_t Helium::StringView< CharType >::FindAny( const StringView& rCharacters, size_t startIndex ) const
+{
+	if( startIndex >= m_size )
+	{
+		return Invalid< size_t >();
+	}
+
+	size_t index = StringFindAny(
+		m_pString + startIndex, m_size - startIndex, rCharacters.m_pString, rCharacters.m_size );
+
+	return ( IsValid( index ) ? startIndex + index : index );
+}
+
+/// Find the first character not matching any of the characters in the given string, starting from the given offset.
+///
+/// @param[in] rCharacters  String containing the characters to skip.
+/// @param[in] startIndex   Index from which to start searching.
+///
+/// @return  Index of the first character not matching any of the specified characters if found, or an invalid index
+///          if not found.
+///
+/// @see FindAny(), Find(), FindReverse()
+template< typename CharType >
+size_t Helium::StringView< CharType >::FindNone( const StringView& rCharacters, size_t startIndex ) const
+{
+	if( startIndex >= m_size )
+	{
+		return Invalid< size_t >();
+	}
+
+	size_t index = StringFindNone(
+		m_pString + startIndex, m_size - startIndex, rCharacters.m_pString, rCharacters.m_size );
+
+	return ( IsValid( index ) ? startIndex + index : index );
+}
+
+/// Check whether this view contains a character.
+///
+/// @param[in] character  Character for which to check.
+///
+/// @return  True if this view contains the specified character, false if not.
+template< typename CharType >
+bool Helium::StringView< CharType >::Contains( CharType character ) const
+{
+	return IsValid( Find( character ) );
+}
+
+/// Check whether this view contains another string.
+///
+/// @param[in] rString  String for which to check.
+///
+/// @return  True if this view contains the specified string, false if not.
+template< typename CharType >
+bool Helium::StringView< CharType >::Contains( const StringView& rString ) const
+{
+	return IsValid( Find( rString ) );
+}
+
+/// Check whether this view starts with a given string.
+///
+/// @param[in] rString  String with which to check.
+///
+/// @return  True if this view starts with the given string, false if not.
+///
+/// @see EndsWith()
+template< typename CharType >
+bool Helium::StringView< CharType >::StartsWith( const StringView& rString ) const
+{
+	size_t stringSize = rString.m_size;
+	if( stringSize > m_size )
+	{
+		return false;
+	}
+
+	return ( stringSize == 0 || MemoryCompare( m_pString, rString.m_pString, sizeof( CharType ) * stringSize ) == 0 );
+}
+
+/// Check whether this view ends with a given string.
+///
+/// @param[in] rString  String with which to check.
+///
+/// @return  True if this view ends with the given string, false if not.
+///
+/// @see StartsWith()
+template< typename CharType >
+bool Helium::StringView< CharType >::EndsWith( const StringView& rString ) const
+{
+	size_t stringSize = rString.m_size;
+	if( stringSize > m_size )
+	{
+		return false;
+	}
+
+	return ( stringSize == 0 ||
+		MemoryCompare( m_pString + m_size - stringSize, rString.m_pString, sizeof( CharType ) * stringSize ) == 0 );
+}
+
+/// Split this view into an array of strings based on the specified character separator.
+///
+/// If the array type is StringView, the resulting strings reference the characters of this view, and no memory is
+/// allocated for the strings themselves.
+///
+/// @param[out] rStringResults              List of resulting strings.
+/// @param[in]  separator                   Separator character.
+/// @param[in]  bCombineAdjacentSeparators  True if adjacent separator characters should be combined to only split
+///                                         the neighboring string components that are not separator characters,
+///                                         false if the string should be split at each and every separator
+///                                         character even if empty strings are generated.  Note that empty strings
+///                                         may still be generated for the first and last elements of the output
+///                                         array if this view starts or ends with a separator character regardless
+///                                         of the setting of this flag.
+template< typename CharType >
+template< typename ArrayType, typename ArrayAllocator >
+void Helium::StringView< CharType >::Split(
+	DynamicArray< ArrayType, ArrayAllocator >& rStringResults,
+	CharType separator,
+	bool bCombineAdjacentSeparators ) const
+{
+	Split( rStringResults, StringView( &separator, 1 ), bCombineAdjacentSeparators );
+}
+
+/// Split this view into an array of strings based on the specified character separators.
+///
+/// If the array type is StringView, the resulting strings reference the characters of this view, and no memory is
+/// allocated for the strings themselves.
+///
+/// @param[out] rStringResults              List of resulting strings.
+/// @param[in]  rSeparators                 Separator characters.
+/// @param[in]  bCombineAdjacentSeparators  True if adjacent separator characters should be combined to only split
+///                                         the neighboring string components that are not separator characters,
+///                                         false if the string should be split at each and every separator
+///                                         character even if empty strings are generated.  Note that empty strings
+///                                         may still be generated for the first and last elements of the output
+///                                         array if this view starts or ends with a separator character regardless
+///                                         of the setting of this flag.
+template< typename CharType >
+template< typename ArrayType, typename ArrayAllocator >
+void Helium::StringView< CharType >::Split(
+	DynamicArray< ArrayType, ArrayAllocator >& rStringResults,
+	const StringView& rSeparators,
+	bool bCombineAdjacentSeparators ) const
+{
+	rStringResults.Resize( 0 );
+
+	size_t startIndex = 0;
+	for( ; ; )
+	{
+		size_t separatorIndex = FindAny( rSeparators, startIndex );
+		if( IsInvalid( separatorIndex ) )
+		{
+			break;
+		}
+
+		// Always allow splitting off an empty string at the start if this view starts with a separator character.
+		if( !bCombineAdjacentSeparators || separatorIndex != startIndex || startIndex == 0 )
+		{
+			HELIUM_VERIFY( rStringResults.New( m_pString + startIndex, separatorIndex - startIndex ) );
+		}
+
+		startIndex = separatorIndex + 1;
+	}
+
+	// Always allow splitting off an empty string at the end if this view ends with a separator character.
+	HELIUM_VERIFY( rStringResults.New( m_pString + startIndex, m_size - startIndex ) );
+}
+
+/// Get the character at the specified index.
+///
+/// @param[in] index  Character index.
+///
+/// @return  Reference to the character at the specified index.
+template< typename CharType >
+const CharType& Helium::StringView< CharType >::operator[]( size_t index ) const
+{
+	HELIUM_ASSERT( index < m_size );
+	return m_pString[ index ];
+}
+
+/// Equality comparison operator.
+///
+/// @param[in] rString  View with which to compare.
+///
+/// @return  True if this view and the given view reference matching characters, false if not.
+template< typename CharType >
+bool Helium::StringView< CharType >::operator==( const StringView& rString ) const
+{
+	return ( m_size == rString.m_size &&
+		( m_size == 0 || MemoryCompare( m_pString, rString.m_pString, sizeof( CharType ) * m_size ) == 0 ) );
+}
+
+/// Inequality comparison operator.
+///
+/// @param[in] rString  View with which to compare.
+///
+/// @return  True if this view and the given view do not reference matching characters, false if they do.
+template< typename CharType >
+bool Helium::StringView< CharType >::operator!=( const StringView& rString ) const
+{
+	return !( *this == rString );
+}
+
+/// Less-than comparison operator.
+///
+/// @param[in] rString  View with which to compare.
+///
+/// @return  True if this view should precede the given view based on character code values, false if not.
+template< typename CharType >
+bool Helium::StringView< CharType >::operator<( const StringView& rString ) const
+{
+	return ( Compare( rString ) < 0 );
+}
@@ -0,0 +1,178 @@
+/// FlatHashMap versus HashMap benchmark.
+///
+/// This is a standalone program and is not part of the Foundation library.  Build it together with the Foundation
+/// and Platform libraries and run it without arguments.  For 1K, 1M, and 10M entries, it times inserting every entry
+/// into an empty map, looking up every entry (hits), looking up the same number of absent keys (misses), and removing
+/// every entry.  Small sizes are repeated so that each measurement covers at least a million operations.
+
+#include "Platform/Types.h"
+#include "Platform/MemoryHeap.h"
+#include "Platform/Timer.h"
+#include "Platform/Utility.h"
+
+#include "Foundation/HashMap.h"
+#include "Foundation/FlatHashMap.h"
+
+#include <stdio.h>
+
+using namespace Helium;
+
+/// Minimum number of operations timed for each measurement.
+static const size_t MIN_OPERATION_COUNT = 1000000;
+
+/// Timing results for one map type and entry count, in nanoseconds per operation.
+struct BenchmarkResults
+{
+    /// Insert time.
+    float64_t insert;
+    /// Successful lookup time.
+    float64_t findHit;
+    /// Failed lookup time.
+    float64_t findMiss;
+    /// Remove time.
+    float64_t remove;
+};
+
+/// Get a benchmark key.
+///
+/// Keys are spread over the full 64-bit range with a bijective mix, so even indices never produce the same key as odd
+/// indices.  Even indices are inserted, and odd indices are used for lookups that miss.
+///
+/// @param[in] index  Key index.
+///
+/// @return  Key.
+static uint64_t GetKey( uint64_t index )
+{
+    index *= 0x9e3779b97f4a7c15ULL;
+    index ^= index >> 29;
+
+    return index;
+}
+
+/// Convert an elapsed tick count to nanoseconds per operation.
+///
+/// @param[in] ticks           Elapsed ticks.
+/// @param[in] operationCount  Number of operations timed.
+///
+/// @return  Nanoseconds per operation.
+static float64_t GetNanosecondsPerOperation( uint64_t ticks, size_t operationCount )
+{
+    return Timer::TicksToMilliseconds( ticks ) * 1000000.0 / static_cast< float64_t >( operationCount );
+}
+
+/// Run the benchmark for a single map type and entry count.
+///
+/// @param[in]  entryCount  Number of entries in the map.
+/// @param[out] rResults    Timing results.
+///
+/// @return  Checksum of the data found, which keeps the lookups from being optimized away.
+template< typename MapType >
+static uint64_t RunBenchmark( size_t entryCount, BenchmarkResults& rResults )
+{
+    typedef typename MapType::ValueType ValueType;
+
+    size_t roundCount = ( entryCount < MIN_OPERATION_COUNT ? MIN_OPERATION_COUNT / entryCount : 1 );
+    size_t operationCount = entryCount * roundCount;
+
+    uint64_t insertTicks = 0;
+    uint64_t findHitTicks = 0;
+    uint64_t findMissTicks = 0;
+    uint64_t removeTicks = 0;
+    uint64_t checksum = 0;
+
+    for( size_t roundIndex = 0; roundIndex < roundCount; ++roundIndex )
+    {
+        MapType map;
+
+        uint64_t startTicks = Timer::GetTickCount();
+        for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+        {
+            map.Insert( ValueType( GetKey( entryIndex * 2 ), entryIndex ) );
+        }
+
+        uint64_t endTicks = Timer::GetTickCount();
+        insertTicks += endTicks - startTicks;
+
+        // Look up keys in a different order than they were inserted.
+        startTicks = endTicks;
+        for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+        {
+            size_t keyIndex = ( entryIndex * 7919 ) % entryCount;
+            typename MapType::ConstIterator iterator = map.Find( GetKey( keyIndex * 2 ) );
+            HELIUM_ASSERT( iterator != map.End() );
+            checksum += iterator->Second();
+        }
+
+        endTicks = Timer::GetTickCount();
+        findHitTicks += endTicks - startTicks;
+
+        startTicks = endTicks;
+        for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+        {
+            if( map.Find( GetKey( entryIndex * 2 + 1 ) ) != map.End() )
+            {
+                ++checksum;
+            }
+        }
+
+        endTicks = Timer::GetTickCount();
+        findMissTicks += endTicks - startTicks;
+
+        startTicks = endTicks;
+        for( size_t entryIndex = 0; entryIndex < entryCount; ++entryIndex )
+        {
+            HELIUM_VERIFY( map.Remove( GetKey( entryIndex * 2 ) ) );
+        }
+
+        endTicks = Timer::GetTickCount();
+        removeTicks += endTicks - startTicks;
+    }
+
+    rResults.insert = GetNanosecondsPerOperation( insertTicks, operationCount );
+    rResults.findHit = GetNanosecondsPerOperation( findHitTicks, operationCount );
+    rResults.findMiss = GetNanosecondsPerOperation( findMissTicks, operationCount );
+    rResults.remove = GetNanosecondsPerOperation( removeTicks, operationCount );
+
+    return checksum;
+}
+
+/// Print a line of timing results.
+///
+/// @param[in] pMapName    Name of the map type.
+/// @param[in] entryCount  Number of entries in the map.
+/// @param[in] rResults    Timing results.
+static void PrintResults( const char* pMapName, size_t entryCount, const BenchmarkResults& rResults )
+{
+    printf(
+        "%-12s %9u %10.1f %10.1f %10.1f %10.1f\n",
+        pMapName,
+        static_cast< unsigned int >( entryCount ),
+        rResults.insert,
+        rResults.findHit,
+        rResults.findMiss,
+        rResults.remove );
+}
+
+int main()
+{
+    static const size_t entryCounts[] = { 1000, 1000000, 10000000 };
+
+    printf( "%-12s %9s %10s %10s %10s %10s  (ns/op)\n", "map", "entries", "insert", "find hit", "find miss", "remove" );
+
+    uint64_t checksum = 0;
+    for( size_t countIndex = 0; countIndex < HELIUM_ARRAY_COUNT( entryCounts ); ++countIndex )
+    {
+        size_t entryCount = entryCounts[ countIndex ];
+        BenchmarkResults results;
+
+        checksum += RunBenchmark< HashMap< uint64_t, uint64_t > >( entryCount, results );
+        PrintResults( "HashMap", entryCount, results );
+
+        checksum += RunBenchmark< FlatHashMap< uint64_t, uint64_t > >( entryCount, results );
+        PrintResults( "FlatHashMap", entryCount, results );
+    }
+
+    printf( "checksum %llu\n", static_cast< unsigned long long >( checksum ) );
+
+    return 0;
+}
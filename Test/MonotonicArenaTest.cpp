@@ -0,0 +1,415 @@
+/// MonotonicArenaAllocator container test.
+///
+/// This is a standalone program and is not part of the Foundation library.  Build it together with the Foundation
+/// and Platform libraries and run it without arguments.  Each Foundation container that takes an allocator is
+/// instantiated with MonotonicArenaAllocator, then filled, searched, and modified inside a MonotonicArenaScope.  The
+/// arena uses a deliberately small block size, so that each container spans several blocks and grows both in place
+/// and by reallocation.  Once the scope has ended, the arena is checked to have been rewound completely.  The program
+/// returns zero if every check passed.
+
+#include "Platform/Types.h"
+#include "Platform/MemoryHeap.h"
+#include "Platform/Utility.h"
+
+#include "Foundation/MonotonicArena.h"
+#include "Foundation/DynamicArray.h"
+#include "Foundation/InlineDynamicArray.h"
+#include "Foundation/SparseArray.h"
+#include "Foundation/SlotMap.h"
+#include "Foundation/BitArray.h"
+#include "Foundation/String.h"
+#include "Foundation/StringBuilder.h"
+#include "Foundation/HashMap.h"
+#include "Foundation/HashSet.h"
+#include "Foundation/FlatHashMap.h"
+#include "Foundation/FlatHashSet.h"
+#include "Foundation/ConcurrentHashMap.h"
+#include "Foundation/ConcurrentHashSet.h"
+#include "Foundation/Map.h"
+#include "Foundation/Set.h"
+#include "Foundation/SortedMap.h"
+#include "Foundation/SortedSet.h"
+#include "Foundation/BTree.h"
+
+#include <stdio.h>
+
+using namespace Helium;
+
+/// Arena block size, small enough that each container spans several blocks.
+static const size_t ARENA_BLOCK_SIZE = 1024;
+/// Number of entries added to each keyed container.
+static const uint32_t KEY_COUNT = 500;
+
+/// Entry construction and validation for set containers, whose entries are the keys themselves.
+struct SetEntries
+{
+    /// Create the entry for a key.
+    ///
+    /// @param[in] key  Entry key.
+    ///
+    /// @return  Entry.
+    template< typename ValueType > static ValueType Create( uint32_t key )
+    {
+        return ValueType( key );
+    }
+
+    /// Test whether an entry holds the expected contents for a key.
+    ///
+    /// @param[in] rValue  Entry to test.
+    /// @param[in] key     Expected key.
+    ///
+    /// @return  True if the entry matches, false if not.
+    template< typename ValueType > static bool Matches( const ValueType& rValue, uint32_t key )
+    {
+        return ( rValue == key );
+    }
+};
+
+/// Entry construction and validation for map containers, whose entries are key/data pairs.
+struct MapEntries
+{
+    /// Create the entry for a key.
+    ///
+    /// @param[in] key  Entry key.
+    ///
+    /// @return  Entry.
+    template< typename ValueType > static ValueType Create( uint32_t key )
+    {
+        return ValueType( key, key * 7 );
+    }
+
+    /// Test whether an entry holds the expected contents for a key.
+    ///
+    /// @param[in] rValue  Entry to test.
+    /// @param[in] key     Expected key.
+    ///
+    /// @return  True if the entry matches, false if not.
+    template< typename ValueType > static bool Matches( const ValueType& rValue, uint32_t key )
+    {
+        return ( rValue.First() == key && rValue.Second() == key * 7 );
+    }
+};
+
+/// Check DynamicArray and InlineDynamicArray.
+///
+/// @param[in] rArena  Arena bound to the calling thread.
+///
+/// @return  True if all checks passed, false if any failed.
+static bool CheckDynamicArrays( MonotonicArena& rArena )
+{
+    bool bSuccess = true;
+
+    DynamicArray< uint32_t, MonotonicArenaAllocator > values;
+    for( uint32_t valueIndex = 0; valueIndex < 1000; ++valueIndex )
+    {
+        values.Push( valueIndex * 3 );
+    }
+
+    values.Remove( 0, 500 );
+    bSuccess &= ( values.GetSize() == 500 && values[ 0 ] == 1500 && values.GetLast() == 2997 );
+
+    InlineDynamicArray< uint32_t, 16, MonotonicArenaAllocator > inlineValues;
+    for( uint32_t valueIndex = 0; valueIndex < 1000; ++valueIndex )
+    {
+        inlineValues.Push( valueIndex * 5 );
+    }
+
+    inlineValues.Remove( 0, 990 );
+    bSuccess &= ( inlineValues.GetSize() == 10 && inlineValues[ 0 ] == 4950 && inlineValues.GetLast() == 4995 );
+
+    bSuccess &= ( rArena.GetUsedSize() != 0 );
+
+    return bSuccess;
+}
+
+/// Check SparseArray.
+///
+/// @param[in] rArena  Arena bound to the calling thread.
+///
+/// @return  True if all checks passed, false if any failed.
+static bool CheckSparseArray( MonotonicArena& rArena )
+{
+    bool bSuccess = true;
+
+    SparseArray< uint32_t, MonotonicArenaAllocator > values;
+    for( uint32_t valueIndex = 0; valueIndex < 1000; ++valueIndex )
+    {
+        bSuccess &= ( values.Add( valueIndex * 3 ) == valueIndex );
+    }
+
+    for( uint32_t valueIndex = 0; valueIndex < 1000; valueIndex += 2 )
+    {
+        values.Remove( valueIndex );
+    }
+
+    bSuccess &= ( values.GetSize() == 1000 );
+    for( uint32_t valueIndex = 0; valueIndex < 1000; ++valueIndex )
+    {
+        bSuccess &= ( ( valueIndex % 2 ) != 0 ?
+            values.IsElementValid( valueIndex ) && values.GetElement( valueIndex ) == valueIndex * 3 :
+            !values.IsElementValid( valueIndex ) );
+    }
+
+    // Removed slots are reused before the array grows.
+    bSuccess &= ( values.Add( 12345 ) == 0 && values.GetSize() == 1000 );
+
+    bSuccess &= ( rArena.GetUsedSize() != 0 );
+
+    return bSuccess;
+}
+
+/// Check SlotMap.
+///
+/// @param[in] rArena  Arena bound to the calling thread.
+///
+/// @return  True if all checks passed, false if any failed.
+static bool CheckSlotMap( MonotonicArena& rArena )
+{
+    typedef SlotMap< uint32_t, MonotonicArenaAllocator > SlotMapType;
+
+    bool bSuccess = true;
+
+    SlotMapType values;
+    DynamicArray< SlotMapType::Handle, MonotonicArenaAllocator > handles;
+    for( uint32_t valueIndex = 0; valueIndex < 1000; ++valueIndex )
+    {
+        handles.Push( values.Add( valueIndex * 3 ) );
+    }
+
+    for( uint32_t valueIndex = 0; valueIndex < 1000; valueIndex += 2 )
+    {
+        bSuccess &= values.Remove( handles[ valueIndex ] );
+    }
+
+    bSuccess &= ( values.GetSize() == 500 );
+    for( uint32_t valueIndex = 0; valueIndex < 1000; ++valueIndex )
+    {
+        const uint32_t* pValue = values.Get( handles[ valueIndex ] );
+        bSuccess &= ( ( valueIndex % 2 ) != 0 ?
+            values.IsValid( handles[ valueIndex ] ) && pValue && *pValue == valueIndex * 3 :
+            !values.IsValid( handles[ valueIndex ] ) && !pValue );
+    }
+
+    bSuccess &= ( rArena.GetUsedSize() != 0 );
+
+    return bSuccess;
+}
+
+/// Check BitArray.
+///
+/// @param[in] rArena  Arena bound to the calling thread.
+///
+/// @return  True if all checks passed, false if any failed.
+static bool CheckBitArray( MonotonicArena& rArena )
+{
+    bool bSuccess = true;
+
+    BitArray< MonotonicArenaAllocator > bits;
+    bits.Add( false, 5000 );
+    for( size_t bitIndex = 0; bitIndex < 5000; bitIndex += 3 )
+    {
+        bits.SetElement( bitIndex );
+    }
+
+    bSuccess &= ( bits.GetSize() == 5000 );
+    for( size_t bitIndex = 0; bitIndex < 5000; ++bitIndex )
+    {
+        bSuccess &= ( static_cast< bool >( bits.GetElement( bitIndex ) ) == ( bitIndex % 3 == 0 ) );
+    }
+
+    bSuccess &= ( rArena.GetUsedSize() != 0 );
+
+    return bSuccess;
+}
+
+/// Check StringBase and StringBuilder.
+///
+/// @param[in] rArena  Arena bound to the calling thread.
+///
+/// @return  True if all checks passed, false if any failed.
+static bool CheckStrings( MonotonicArena& rArena )
+{
+    typedef StringBase< char, MonotonicArenaAllocator > StringType;
+
+    bool bSuccess = true;
+
+    StringType string;
+    for( size_t partIndex = 0; partIndex < 100; ++partIndex )
+    {
+        string.Add( "arena " );
+    }
+
+    StringType stringCopy;
+    stringCopy = string;
+    stringCopy.Remove( 0, 594 );
+    bSuccess &= ( string.GetSize() == 600 && string.StartsWith( "arena arena " ) && stringCopy == "arena " );
+
+    StringBuilder< char, MonotonicArenaAllocator > builder;
+    for( uint32_t partIndex = 0; partIndex < 1000; ++partIndex )
+    {
+        builder.AddFormatTyped( "{},", partIndex );
+    }
+
+    StringType builtString;
+    builder.ToString( builtString );
+    bSuccess &= ( builtString.GetSize() == builder.GetSize() && builtString.StartsWith( "0,1,2," ) &&
+        builtString.EndsWith( "998,999," ) );
+
+    bSuccess &= ( rArena.GetUsedSize() != 0 );
+
+    return bSuccess;
+}
+
+/// Check a container with the common Insert(), Find(), and Remove() interface of the hash tables, tables, and trees.
+///
+/// @param[in] rArena  Arena bound to the calling thread.
+///
+/// @return  True if all checks passed, false if any failed.
+template< typename ContainerType, typename Entries >
+static bool CheckKeyedContainer( MonotonicArena& rArena )
+{
+    typedef typename ContainerType::ValueType ValueType;
+
+    bool bSuccess = true;
+
+    ContainerType container;
+    for( uint32_t key = 0; key < KEY_COUNT; ++key )
+    {
+        bSuccess &= container.Insert( Entries::template Create< ValueType >( key ) ).Second();
+    }
+
+    bSuccess &= !container.Insert( Entries::template Create< ValueType >( 0 ) ).Second();
+
+    for( uint32_t key = 0; key < KEY_COUNT; key += 2 )
+    {
+        bSuccess &= container.Remove( key );
+    }
+
+    bSuccess &= ( container.GetSize() == KEY_COUNT / 2 );
+    for( uint32_t key = 0; key < KEY_COUNT; ++key )
+    {
+        typename ContainerType::ConstIterator iterator = container.Find( key );
+        bSuccess &= ( ( key % 2 ) != 0 ?
+            iterator != container.End() && Entries::Matches( *iterator, key ) :
+            iterator == container.End() );
+    }
+
+    bSuccess &= ( rArena.GetUsedSize() != 0 );
+
+    return bSuccess;
+}
+
+/// Check a concurrent hash table container through its accessor interface.
+///
+/// @param[in] rArena  Arena bound to the calling thread.
+///
+/// @return  True if all checks passed, false if any failed.
+template< typename ContainerType, typename Entries >
+static bool CheckConcurrentContainer( MonotonicArena& rArena )
+{
+    typedef typename ContainerType::ValueType ValueType;
+
+    bool bSuccess = true;
+
+    // Start with a few buckets so that the table is rehashed several times.
+    ContainerType container( 4 );
+    for( uint32_t key = 0; key < KEY_COUNT; ++key )
+    {
+        typename ContainerType::ConstAccessor accessor;
+        bSuccess &= container.Insert( accessor, Entries::template Create< ValueType >( key ) );
+    }
+
+    for( uint32_t key = 0; key < KEY_COUNT; key += 2 )
+    {
+        bSuccess &= container.Remove( key );
+    }
+
+    bSuccess &= ( container.GetSize() == KEY_COUNT / 2 );
+    for( uint32_t key = 0; key < KEY_COUNT; ++key )
+    {
+        typename ContainerType::ConstAccessor accessor;
+        bool bFound = container.Find( accessor, key );
+        bSuccess &= ( ( key % 2 ) != 0 ? bFound && Entries::Matches( *accessor, key ) : !bFound );
+    }
+
+    bSuccess &= ( rArena.GetUsedSize() != 0 );
+
+    return bSuccess;
+}
+
+/// Run a single container check inside a new arena scope.
+///
+/// @param[in] pName      Name of the container checked.
+/// @param[in] pFunction  Check to run.
+///
+/// @return  True if the check passed and the arena was rewound completely at the end of the scope, false if not.
+static bool RunCheck( const char* pName, bool ( *pFunction )( MonotonicArena& ) )
+{
+    MonotonicArena arena( ARENA_BLOCK_SIZE );
+    bool bSuccess;
+
+    {
+        MonotonicArenaScope scope( arena );
+        bSuccess = pFunction( arena );
+    }
+
+    bSuccess &= ( arena.GetUsedSize() == 0 );
+
+    printf( "%-20s %s\n", pName, ( bSuccess ? "passed" : "FAILED" ) );
+
+    return bSuccess;
+}
+
+int main()
+{
+    typedef MonotonicArenaAllocator Alloc;
+
+    bool bSuccess = true;
+
+    bSuccess &= RunCheck( "DynamicArray", CheckDynamicArrays );
+    bSuccess &= RunCheck( "SparseArray", CheckSparseArray );
+    bSuccess &= RunCheck( "SlotMap", CheckSlotMap );
+    bSuccess &= RunCheck( "BitArray", CheckBitArray );
+    bSuccess &= RunCheck( "String", CheckStrings );
+
+    bSuccess &= RunCheck(
+        "HashMap",
+        CheckKeyedContainer< HashMap< uint32_t, uint32_t, Hash< uint32_t >, Equals< uint32_t >, Alloc >, MapEntries > );
+    bSuccess &= RunCheck(
+        "HashSet",
+        CheckKeyedContainer< HashSet< uint32_t, Hash< uint32_t >, Equals< uint32_t >, Alloc >, SetEntries > );
+    bSuccess &= RunCheck(
+        "FlatHashMap",
+        CheckKeyedContainer<
+            FlatHashMap< uint32_t, uint32_t, Hash< uint32_t >, Equals< uint32_t >, Alloc >, MapEntries > );
+    bSuccess &= RunCheck(
+        "FlatHashSet",
+        CheckKeyedContainer< FlatHashSet< uint32_t, Hash< uint32_t >, Equals< uint32_t >, Alloc >, SetEntries > );
+    bSuccess &= RunCheck(
+        "ConcurrentHashMap",
+        CheckConcurrentContainer<
+            ConcurrentHashMap< uint32_t, uint32_t, Hash< uint32_t >, Equals< uint32_t >, Alloc >, MapEntries > );
+    bSuccess &= RunCheck(
+        "ConcurrentHashSet",
+        CheckConcurrentContainer<
+            ConcurrentHashSet< uint32_t, Hash< uint32_t >, Equals< uint32_t >, Alloc >, SetEntries > );
+
+    bSuccess &= RunCheck(
+        "Map",
+        CheckKeyedContainer< Map< uint32_t, uint32_t, Equals< uint32_t >, Alloc >, MapEntries > );
+    bSuccess &= RunCheck(
+        "Set",
+        CheckKeyedContainer< Set< uint32_t, Equals< uint32_t >, Alloc >, SetEntries > );
+
+    bSuccess &= RunCheck(
+        "SortedMap",
+        CheckKeyedContainer< SortedMap< uint32_t, uint32_t, Less< uint32_t >, Alloc >, MapEntries > );
+    bSuccess &= RunCheck(
+        "SortedMap (BTree)",
+        CheckKeyedContainer< SortedMap< uint32_t, uint32_t, Less< uint32_t >, Alloc, BTree >, MapEntries > );
+    bSuccess &= RunCheck(
+        "SortedSet",
+        CheckKeyedContainer< SortedSet< uint32_t, Less< uint32_t >, Alloc >, SetEntries > );
+
+    return ( bSuccess ? 0 : 1 );
+}
@@ -0,0 +1,109 @@
+/// Allocate/release throughput benchmark for ObjectPool.
+///
+/// This is a standalone program and is not part of the Foundation library.  Build it together with the Foundation
+/// and Platform libraries and run it without arguments.  For each thread count, every thread repeatedly allocates a
+/// short burst of objects and releases them again, which exercises both the per-thread caches and the exchange of
+/// magazines with the shared depot.
+
+#include "Platform/Types.h"
+#include "Platform/MemoryHeap.h"
+#include "Platform/Timer.h"
+#include "Platform/Utility.h"
+
+#include "Foundation/ObjectPool.h"
+
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+using namespace Helium;
+
+/// Object allocated during the benchmark (about the size of a RefCountProxy).
+struct BenchmarkObject
+{
+    void* pObject;
+    volatile int32_t refCounts;
+    void* pPadding;
+};
+
+/// Number of objects per pool block.
+static const size_t POOL_BLOCK_SIZE = 1024;
+/// Number of objects each thread holds at once.
+static const size_t BURST_SIZE = 100;
+/// Number of allocate/release bursts run by each thread.
+static const size_t BURST_COUNT = 20000;
+
+/// Run the allocate/release loop for a single thread.
+///
+/// @param[in] pPool  Pool from which to allocate.
+static void RunBursts( ObjectPool< BenchmarkObject >* pPool )
+{
+    BenchmarkObject* objects[ BURST_SIZE ];
+
+    for( size_t burstIndex = 0; burstIndex < BURST_COUNT; ++burstIndex )
+    {
+        // Vary the burst length so that objects regularly move between the thread cache and the depot.
+        size_t burstSize = BURST_SIZE - ( burstIndex % ( BURST_SIZE / 2 ) );
+
+        for( size_t objectIndex = 0; objectIndex < burstSize; ++objectIndex )
+        {
+            objects[ objectIndex ] = pPool->Allocate();
+            HELIUM_ASSERT( objects[ objectIndex ] );
+            objects[ objectIndex ]->refCounts = 1;
+        }
+
+        for( size_t objectIndex = burstSize; objectIndex != 0; --objectIndex )
+        {
+            pPool->Release( objects[ objectIndex - 1 ] );
+        }
+    }
+}
+
+/// Run the benchmark with a given number of threads.
+///
+/// @param[in] threadCount  Number of threads to run concurrently.
+static void RunBenchmark( size_t threadCount )
+{
+    ObjectPool< BenchmarkObject > pool( POOL_BLOCK_SIZE );
+
+    uint64_t startTicks = Timer::GetTickCount();
+
+    std::vector< std::thread > threads;
+    for( size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex )
+    {
+        threads.push_back( std::thread( RunBursts, &pool ) );
+    }
+
+    for( size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex )
+    {
+        threads[ threadIndex ].join();
+    }
+
+    float64_t milliseconds = Timer::TicksToMilliseconds( Timer::GetTickCount() - startTicks );
+
+    // Each burst allocates and releases between BURST_SIZE / 2 + 1 and BURST_SIZE objects.
+    size_t burstObjectTotal = 0;
+    for( size_t burstIndex = 0; burstIndex < BURST_COUNT; ++burstIndex )
+    {
+        burstObjectTotal += BURST_SIZE - ( burstIndex % ( BURST_SIZE / 2 ) );
+    }
+
+    float64_t operationCount = static_cast< float64_t >( burstObjectTotal * 2 * threadCount );
+    printf(
+        "%3u threads: %10.1f ms, %8.2f M allocate/release operations per second\n",
+        static_cast< unsigned int >( threadCount ),
+        milliseconds,
+        operationCount / ( milliseconds * 1000.0 ) );
+}
+
+int main()
+{
+    static const size_t threadCounts[] = { 1, 2, 4, 8, 16, 32 };
+
+    for( size_t countIndex = 0; countIndex < HELIUM_ARRAY_COUNT( threadCounts ); ++countIndex )
+    {
+        RunBenchmark( threadCounts[ countIndex ] );
+    }
+
+    return 0;
+}
@@ -5,6 +5,8 @@
 #include <set>
 
 #include "Foundation/Regex.h"
+#include "Foundation/DynamicArray.h"
+#include "Foundation/StringView.h"
 
 ////////////////////////////////////////////////////////////////////////
 //
@@ -16,6 +18,11 @@
 // Special delimiters that need to be escaped:
 //  - "|" (pipe) should be "\\|"
 //
+// The StringView overload does not use regular expressions: each character
+//  in the delimiter string is a delimiter on its own, and the tokens are
+//  views into the source string, so tokenizing does not allocate any
+//  strings.
+//
 ////////////////////////////////////////////////////////////////////////
 
 namespace Helium
@@ -25,6 +32,11 @@ namespace Helium
 
     template< typename T >
     void Tokenize( const std::string& str, std::set< T >& tokens, const std::string delimiters );
+
+    template< typename CharType, typename Allocator >
+    void Tokenize(
+        const StringView< CharType >& str, DynamicArray< StringView< CharType >, Allocator >& tokens,
+        const StringView< CharType >& delimiters );
 }
 
 #include "Foundation/Tokenize.inl"
\ No newline at end of file
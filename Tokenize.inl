@@ -40,6 +40,26 @@ void Helium::Tokenize( const std::string& str, std::set< T >& tokens, const std:
     }
 }
 
+template< typename CharType, typename Allocator >
+void Helium::Tokenize(
+    const StringView< CharType >& str, DynamicArray< StringView< CharType >, Allocator >& tokens,
+    const StringView< CharType >& delimiters )
+{
+    size_t startIndex = str.FindNone( delimiters );
+    while( IsValid( startIndex ) )
+    {
+        size_t endIndex = str.FindAny( delimiters, startIndex );
+        if( IsInvalid( endIndex ) )
+        {
+            endIndex = str.GetSize();
+        }
+
+        tokens.Push( str.Substring( startIndex, endIndex - startIndex ) );
+
+        startIndex = str.FindNone( delimiters, endIndex );
+    }
+}
+
 namespace Helium
 {
     template<>